@@ -327,3 +327,59 @@ function(add_paimon_test REL_TEST_NAME)
                   ${PCH_ARGS}
                   ${ARG_UNPARSED_ARGUMENTS})
 endfunction()
+
+#
+# Benchmarking
+#
+# Add a new google-benchmark executable. REL_BENCHMARK_NAME follows the same
+# rules as REL_TEST_NAME of add_test_case, and SOURCES defaults to
+# "REL_BENCHMARK_NAME.cpp".
+#
+# The benchmark is added as a dependency of the "benchmark" target, which runs
+# all the benchmarks and writes their results as JSON to
+# PAIMON_BENCHMARK_OUTPUT_DIR, so that the results can be tracked over time.
+function(add_paimon_benchmark REL_BENCHMARK_NAME)
+    set(options)
+    set(one_value_args)
+    set(multi_value_args SOURCES STATIC_LINK_LIBS)
+    cmake_parse_arguments(ARG
+                          "${options}"
+                          "${one_value_args}"
+                          "${multi_value_args}"
+                          ${ARGN})
+    if(ARG_UNPARSED_ARGUMENTS)
+        message(SEND_ERROR "Error: unrecognized arguments: ${ARG_UNPARSED_ARGUMENTS}")
+    endif()
+
+    if(NOT PAIMON_BUILD_BENCHMARKS)
+        return()
+    endif()
+    get_filename_component(BENCHMARK_NAME ${REL_BENCHMARK_NAME} NAME_WE)
+    set(BENCHMARK_NAME "paimon-${BENCHMARK_NAME}")
+
+    if(ARG_SOURCES)
+        set(SOURCES ${ARG_SOURCES})
+    else()
+        set(SOURCES "${REL_BENCHMARK_NAME}.cpp")
+    endif()
+
+    # Make sure the executable name contains only hyphens, not underscores
+    string(REPLACE "_" "-" BENCHMARK_NAME ${BENCHMARK_NAME})
+    set(BENCHMARK_PATH "${EXECUTABLE_OUTPUT_PATH}/${BENCHMARK_NAME}")
+    message(STATUS ${BENCHMARK_NAME})
+    add_executable(${BENCHMARK_NAME} ${SOURCES})
+    target_link_libraries(${BENCHMARK_NAME} PRIVATE ${ARG_STATIC_LINK_LIBS}
+                                                    ${GBENCHMARK_LINK_TOOLCHAIN})
+    target_compile_options(${BENCHMARK_NAME} PRIVATE -fno-access-control)
+
+    set(RUN_BENCHMARK_NAME "run-${BENCHMARK_NAME}")
+    add_custom_target(${RUN_BENCHMARK_NAME}
+                      COMMAND ${CMAKE_COMMAND} -E make_directory
+                              ${PAIMON_BENCHMARK_OUTPUT_DIR}
+                      COMMAND ${BENCHMARK_PATH}
+                              --benchmark_out=${PAIMON_BENCHMARK_OUTPUT_DIR}/${BENCHMARK_NAME}.json
+                              --benchmark_out_format=json
+                      DEPENDS ${BENCHMARK_NAME}
+                      USES_TERMINAL)
+    add_dependencies(benchmark ${RUN_BENCHMARK_NAME})
+endfunction()
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "paimon/commit_message.h"
+#include "paimon/result.h"
+#include "paimon/visibility.h"
+
+namespace paimon {
+class WriteContext;
+
+/// Changes the bucket number of a primary key table with fixed bucket number, one partition at a
+/// time.
+///
+/// A partition is rescaled by reading the merged data of each of its buckets in parallel on the
+/// executor of the context, computing the bucket of each row for the new bucket number and writing
+/// the rows of each new bucket as sorted files. The new files replace all files of the partition,
+/// so the commit messages must be committed by `FileStoreCommit::Overwrite()` with the same
+/// partition.
+///
+/// Partitions are rescaled and committed independently, so hot partitions can be rescaled as they
+/// grow, and a partition which already has the new bucket number is skipped, so an interrupted
+/// rescale can simply be run again.
+///
+/// @note The commit messages also delete the files which are read, so the overwrite fails instead
+/// of losing the data if the partition is changed by other commits after it is scanned, in which
+/// case the partition should be rescaled again. Writers take the bucket number of a partition from
+/// its files, so later writes to a rescaled partition must compute their buckets by its new bucket
+/// number.
+class PAIMON_EXPORT BucketRescaler {
+ public:
+    virtual ~BucketRescaler() = default;
+
+    /// Create an instance of `BucketRescaler`.
+    ///
+    /// @param context A unique pointer to the `WriteContext` of the table. Streaming mode, write id
+    /// and write schema of the context are ignored.
+    /// @return A Result containing a unique pointer to the `BucketRescaler` instance.
+    static Result<std::unique_ptr<BucketRescaler>> Create(std::unique_ptr<WriteContext> context);
+
+    /// Rescales a partition of the latest snapshot.
+    ///
+    /// @param partition The partition to rescale, which maps all partition keys to partition
+    /// values. Empty for a table without partition keys.
+    /// @param bucket_num The new bucket number of the partition.
+    /// @return The commit messages of the rescaled files, to be committed by
+    /// `FileStoreCommit::Overwrite()` with `partition`. Empty if the partition has no data or
+    /// already has `bucket_num` buckets, in which case there is nothing to commit.
+    virtual Result<std::vector<std::shared_ptr<CommitMessage>>> Rescale(
+        const std::map<std::string, std::string>& partition, int32_t bucket_num) = 0;
+
+ protected:
+    BucketRescaler() = default;
+};
+}  // namespace paimon
@@ -93,6 +93,11 @@ struct PAIMON_EXPORT Options {
     /// will be used.
     static const char BUCKET_KEY[];
 
+    /// "postpone.default-bucket-num" - Bucket number for the partitions of a postpone bucket table
+    /// (bucket = -2) which have no data in real buckets yet, used when redistributing postponed
+    /// files into real buckets. Default value is 1.
+    static const char POSTPONE_DEFAULT_BUCKET_NUM[];
+
     // TODO(yonghao.fyh): This option has not been used yet
     /// "page-size" - Memory page size, default value 64 kb.
     static const char PAGE_SIZE[];
@@ -105,6 +110,28 @@ struct PAIMON_EXPORT Options {
     /// Default value is local.
     static const char FILE_SYSTEM[];
 
+    /// "file-system.block-cache.enabled" - Whether to cache the blocks of the immutable files
+    /// read from the file system in memory and on local disk, the cache is shared by the tables
+    /// with the same block cache dir and block size in the process. The max memory and disk
+    /// sizes of the table which creates the shared cache first are used, those of the later
+    /// tables are ignored. Default value is "false".
+    static const char BLOCK_CACHE_ENABLED[];
+
+    /// "file-system.block-cache.dir" - Local directory to store the cached blocks. Default value is
+    /// the system temporary directory.
+    static const char BLOCK_CACHE_DIR[];
+
+    /// "file-system.block-cache.block-size" - Size of a cached block. Default value is 1 mb.
+    static const char BLOCK_CACHE_BLOCK_SIZE[];
+
+    /// "file-system.block-cache.max-memory-size" - Max memory size of the cached blocks, the least
+    /// recently used blocks are evicted when it is exceeded. Default value is 256 mb.
+    static const char BLOCK_CACHE_MAX_MEMORY_SIZE[];
+
+    /// "file-system.block-cache.max-disk-size" - Max local disk size of the cached blocks, the
+    /// least recently used blocks are deleted when it is exceeded. Default value is 10 gb.
+    static const char BLOCK_CACHE_MAX_DISK_SIZE[];
+
     /// "target-file-size" - Target size of a file. Default value is 128MB.
     // TODO(yonghao.fyh): xinyu, change the default value to 128MB for primary key table.
     static const char TARGET_FILE_SIZE[];
@@ -144,6 +171,12 @@ struct PAIMON_EXPORT Options {
     /// compaction of manifest, default value is 16MB.
     static const char MANIFEST_FULL_COMPACTION_FILE_SIZE[];
 
+    /// "partition.statistics-index.enabled" - Whether to write a partition statistics index for
+    /// each snapshot. The index holds the statistics of each partition and the partitions of each
+    /// manifest, so that listing partitions reads one file and planning skips the manifests
+    /// without matching partitions. Default value is false.
+    static const char PARTITION_STATISTICS_INDEX_ENABLED[];
+
     /// "source.split.target-size" - Target size of a source split when scanning a bucket. Default
     /// value is 128MB.
     static const char SOURCE_SPLIT_TARGET_SIZE[];
@@ -152,6 +185,13 @@ struct PAIMON_EXPORT Options {
     /// too many files with a source split, which can be very slow. Default value is 4MB.
     static const char SOURCE_SPLIT_OPEN_FILE_COST[];
 
+    /// "source.split.key-range.enabled" - Whether to split an oversized section of overlapping
+    /// files of a primary key table into several splits by key range. Each split reads the
+    /// overlapping files but only outputs keys in its own [lower, upper) range, which is also
+    /// pushed down into the format readers, so that a huge section can be merged in parallel.
+    /// Default value is false.
+    static const char SOURCE_SPLIT_KEY_RANGE_ENABLED[];
+
     /// "scan.snapshot-id" - Optional snapshot id used in case of "from-snapshot" or
     /// "from-snapshot-full" scan mode
     static const char SCAN_SNAPSHOT_ID[];
@@ -160,6 +200,11 @@ struct PAIMON_EXPORT Options {
     /// "latest-full", "latest", "from-snapshot", "from-snapshot-full". Default value is "default".
     static const char SCAN_MODE[];
 
+    /// "continuous.discovery-interval" - The discovery interval of continuous reading. When the
+    /// snapshot directory cannot be watched for changes, streaming scan polls it with an adaptive
+    /// backoff interval bounded by this value. Default value is 10 s.
+    static const char CONTINUOUS_DISCOVERY_INTERVAL[];
+
     /// "read.batch-size" - Read batch size for any file format if it supports.
     /// The default value is 1024.
     static const char READ_BATCH_SIZE[];
@@ -172,6 +217,26 @@ struct PAIMON_EXPORT Options {
     /// on-disk file. The default value is 256 mb
     static const char WRITE_BUFFER_SIZE[];
 
+    /// "write.async-flush.enabled" - Whether to flush a full write buffer on the write executor.
+    /// The writer swaps in a new buffer and keeps accepting data while the full one is sorted and
+    /// written to files. Note that an append only writer then holds up to "write-buffer-size" of
+    /// imported arrays in memory before they are written, instead of writing each batch directly.
+    /// Default value is false.
+    static const char WRITE_ASYNC_FLUSH_ENABLED[];
+
+    /// "write.async-flush.max-in-flight" - The maximum number of full write buffers waiting to be
+    /// flushed or being flushed when "write.async-flush.enabled" is true. Writes block when the
+    /// limit is reached, so a writer holds at most (max-in-flight + 1) * "write-buffer-size" of
+    /// data in memory. Default value is 1.
+    static const char WRITE_ASYNC_FLUSH_MAX_IN_FLIGHT[];
+
+    /// "write.async-flush.max-memory" - The maximum total size of the full write buffers waiting
+    /// to be flushed or being flushed by all the writers of a table write when
+    /// "write.async-flush.enabled" is true. Writes block until enough buffers are flushed when
+    /// the limit is reached, which bounds the memory when data is spread over many buckets.
+    /// Default value is 0, which means no limit besides "write.async-flush.max-in-flight".
+    static const char WRITE_ASYNC_FLUSH_MAX_MEMORY[];
+
     /// "snapshot.num-retained.min" - The minimum number of completed snapshots to retain. Should be
     /// greater than or equal to 1. Default value is 10
     static const char SNAPSHOT_NUM_RETAINED_MIN[];
@@ -193,6 +258,25 @@ struct PAIMON_EXPORT Options {
     /// cause performance issue. Default value is false.
     static const char SNAPSHOT_CLEAN_EMPTY_DIRECTORIES[];
 
+    /// "snapshot.expire.parallelism" - The maximum number of concurrent metadata reads and file
+    /// deletions when expiring snapshots, 1 means expiring in the calling thread. Default value
+    /// is 16.
+    static const char SNAPSHOT_EXPIRE_PARALLELISM[];
+
+    /// "metadata.cache.enabled" - Whether to cache the parsed snapshots and schemas, and the latest
+    /// and earliest snapshot ids in a process wide metadata cache, so that scans and commits of a
+    /// table skip reading the same metadata again. Snapshots and schemas are cached by path until
+    /// they are evicted. Creating a table drops the cached metadata of a table previously at the
+    /// same path in the process, but a table dropped and recreated by another process may be
+    /// served stale. Default value is false.
+    static const char METADATA_CACHE_ENABLED[];
+
+    /// "metadata.cache.hint-ttl" - How long the cached latest and earliest ids are trusted before
+    /// they are refreshed from the hint files, only works when "metadata.cache.enabled" is true.
+    /// Snapshots committed by other processes may be invisible within the duration. Default value
+    /// is 1 s.
+    static const char METADATA_CACHE_HINT_TTL[];
+
     /// "commit.timeout" - Timeout duration of retry when commit failed. No default value.
     static const char COMMIT_TIMEOUT[];
 
@@ -228,7 +312,7 @@ struct PAIMON_EXPORT Options {
     /// Default value is false.
     static const char DELETION_VECTORS_ENABLED[];
 
-    ///  @note `CHANGELOG_PRODUCER` currently only support `none`
+    ///  @note `CHANGELOG_PRODUCER` currently only support `none`, `input` and `lookup`
     ///
     /// "changelog-producer" - Whether to double write to a changelog file. This changelog file
     /// keeps the details of data changes, it can be read directly during stream reads. This can be
@@ -240,6 +324,31 @@ struct PAIMON_EXPORT Options {
     /// "false".
     static const char FORCE_LOOKUP[];
 
+    /// "lookup.cache-dir" - Local directory to store the lookup files converted from remote data
+    /// files. Default value is the system temporary directory.
+    static const char LOOKUP_CACHE_DIR[];
+
+    /// "lookup.cache-max-disk-size" - Max disk size of the local lookup files, the least recently
+    /// used files are deleted when it is exceeded. Default value is unlimited.
+    static const char LOOKUP_CACHE_MAX_DISK_SIZE[];
+
+    /// "lookup.cache-max-memory-size" - Max memory size of the data blocks of the local lookup
+    /// files cached in memory, the least recently used blocks are dropped when it is exceeded.
+    /// Default value is 256 mb.
+    static const char LOOKUP_CACHE_MAX_MEMORY_SIZE[];
+
+    /// "lookup.cache-block-size" - Size of the data blocks of a local lookup file. Default value is
+    /// 64 kb.
+    static const char LOOKUP_CACHE_BLOCK_SIZE[];
+
+    /// "lookup.cache.bloom.filter.enabled" - Whether to build a bloom filter for the keys of a
+    /// local lookup file. Default value is "true".
+    static const char LOOKUP_CACHE_BLOOM_FILTER_ENABLED[];
+
+    /// "lookup.cache.bloom.filter.fpp" - Expected false positive probability of the bloom filter
+    /// of a local lookup file. Default value is 0.05.
+    static const char LOOKUP_CACHE_BLOOM_FILTER_FPP[];
+
     /// "partial-update.remove-record-on-delete" - Whether to remove the whole row in partial-update
     /// engine when records are received. Default value is "false".
     static const char PARTIAL_UPDATE_REMOVE_RECORD_ON_DELETE[];
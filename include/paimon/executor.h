@@ -16,9 +16,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <thread>
 
 #include "paimon/visibility.h"
 
@@ -51,6 +53,13 @@ class PAIMON_EXPORT Executor {
     /// @note This method should be thread-safe and can be called from multiple threads
     /// simultaneously.
     virtual void Add(std::function<void()> func) = 0;
+
+    /// @return The number of tasks the executor runs at the same time, which bounds the number
+    /// of tasks submitted for a parallel loop. The default implementation returns the number of
+    /// hardware threads.
+    virtual uint32_t GetParallelism() const {
+        return std::max(std::thread::hardware_concurrency(), 1u);
+    }
 };
 
 }  // namespace paimon
@@ -87,7 +87,9 @@ class PAIMON_EXPORT FileStoreCommit {
     ///     on the user-defined statement, the partition might not include all partition keys. Also
     ///     note that this partition does not necessarily equal to the partitions of the newly added
     ///     key-values. This is just the partition to be cleaned up.
-    /// @param commit_messages Description of the commit messages.
+    /// @param commit_messages Description of the commit messages. If they delete any files, the
+    ///     deleted files must be exactly the current files of `partitions`, otherwise the overwrite
+    ///     fails, which detects the changes of the partitions since the deleted files were read.
     /// @param commit_identifier Unique identifier.
     /// @param watermark An optional event-time watermark used to indicate the progress of data
     ///     processing. Default is std::nullopt.
@@ -39,6 +39,13 @@ class PAIMON_EXPORT ReaderBuilder {
 
     /// Build a file batch reader based on the file path.
     virtual Result<std::unique_ptr<FileBatchReader>> Build(const std::string& path) const = 0;
+
+    /// @return Whether the built readers share the footers of files through a cache, in which
+    /// case the readers of a file are better built after the first one has cached the footer.
+    /// The default implementation returns false.
+    virtual bool FooterCacheEnabled() const {
+        return false;
+    }
 };
 
 }  // namespace paimon
@@ -21,16 +21,31 @@
 #include <memory>
 #include <string>
 
+#include "paimon/result.h"
+#include "paimon/status.h"
 #include "paimon/type_fwd.h"
 
 namespace paimon {
 
+/// Statistics of a histogram metric, e.g., the latency of an operation in microseconds.
+///
+/// Percentiles are approximated by the buckets of the histogram, with a relative error of at
+/// most 1/16.
+struct PAIMON_EXPORT HistogramStats {
+    uint64_t count = 0;
+    uint64_t min = 0;
+    uint64_t max = 0;
+    double mean = 0.0;
+    uint64_t p50 = 0;
+    uint64_t p95 = 0;
+    uint64_t p99 = 0;
+};
+
 /// Abstract interface for collecting and managing performance metrics in Paimon operations.
 ///
 /// This class provides a unified interface for tracking various performance metrics
-/// such as counters for read/write operations, I/O statistics, and other operational
-/// measurements. It serves as the base class for concrete implementations like `MetricsImpl`.
-// TODO(yonghao.fyh): add histogram in the future
+/// such as counters for read/write operations, I/O statistics, and histograms for the latencies
+/// of operations. It serves as the base class for concrete implementations like `MetricsImpl`.
 class PAIMON_EXPORT Metrics {
  public:
     virtual ~Metrics() = default;
@@ -49,9 +64,32 @@ class PAIMON_EXPORT Metrics {
     /// @return A map containing all metric names and their current values.
     virtual std::map<std::string, uint64_t> GetAllCounters() const = 0;
 
+    /// Record a value into a specific histogram metric, the histogram is created if it doesn't
+    /// exist. The default implementation ignores the value, for implementations without
+    /// histogram support.
+    /// @param metric_name The name/key of the histogram.
+    /// @param value The value to record, e.g., a latency in microseconds.
+    virtual void ObserveHistogram(const std::string& metric_name, uint64_t value) {}
+
+    /// Get the statistics of a specific histogram metric.
+    /// @param metric_name The name/key of the histogram to retrieve.
+    /// @return The statistics of the histogram, or `Status::KeyError` if the histogram doesn't
+    /// exist. The default implementation always returns `Status::KeyError`.
+    virtual Result<HistogramStats> GetHistogram(const std::string& metric_name) const {
+        return Status::KeyError("metric '", metric_name, "' not found");
+    }
+
+    /// Get the statistics of all histogram metrics as a map.
+    /// @return A map containing all histogram names and their statistics. The default
+    /// implementation returns an empty map.
+    virtual std::map<std::string, HistogramStats> GetAllHistograms() const {
+        return {};
+    }
+
     /// Merge metrics from another Metrics instance into this one.
     ///
-    /// For metrics that exist in both instances, the values are added together.
+    /// For counters that exist in both instances, the values are added together. For histograms
+    /// that exist in both instances, the recorded values are combined.
     /// For metrics that only exist in the other instance, they are copied over.
     /// This operation is useful for aggregating metrics from multiple sources.
     ///
@@ -61,7 +99,8 @@ class PAIMON_EXPORT Metrics {
 
     /// Convert all metrics to a JSON string representation.
     /// @return A JSON string containing all metric names and values, e.g.,
-    /// `{"metric1":100,"metric2":200}`.
+    /// `{"metric1":100,"metric2":200}`. A histogram is represented by its statistics, e.g.,
+    /// `{"latency":{"count":2,"min":10,"max":20,"mean":15.0,"p50":10,"p95":20,"p99":20}}`.
     virtual std::string ToString() const = 0;
 };
 
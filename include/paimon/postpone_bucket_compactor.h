@@ -0,0 +1,67 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "paimon/commit_message.h"
+#include "paimon/result.h"
+#include "paimon/visibility.h"
+
+namespace paimon {
+class WriteContext;
+
+/// Redistributes the data of a postpone bucket table (primary key table with bucket = -2) into
+/// real buckets.
+///
+/// Postponed files are written unsorted into the postpone bucket, and batch reads only read real
+/// buckets, so the postponed data is not visible to them until it is compacted. For each
+/// partition, `Compact()` reads the postponed files in the order they were committed, computes the
+/// bucket of each row, sorts the rows of each bucket by key and writes them as level 0 files of
+/// the real buckets.
+///
+/// The bucket number of a partition is the bucket number of its existing data, or
+/// "postpone.default-bucket-num" if the partition has no data in real buckets yet.
+class PAIMON_EXPORT PostponeBucketCompactor {
+ public:
+    virtual ~PostponeBucketCompactor() = default;
+
+    /// Create an instance of `PostponeBucketCompactor`.
+    ///
+    /// @param context A unique pointer to the `WriteContext` of the table. Streaming mode, write id
+    /// and write schema of the context are ignored.
+    /// @return A Result containing a unique pointer to the `PostponeBucketCompactor` instance.
+    static Result<std::unique_ptr<PostponeBucketCompactor>> Create(
+        std::unique_ptr<WriteContext> context);
+
+    /// Compacts the postponed files of the latest snapshot.
+    ///
+    /// @param partitions The partitions to compact, each maps partition keys to partition values.
+    /// All partitions are compacted if empty.
+    /// @return The commit messages of the new files in real buckets, together with the messages
+    /// removing the compacted postponed files. They must be committed in one commit, so that the
+    /// postponed data is moved atomically.
+    virtual Result<std::vector<std::shared_ptr<CommitMessage>>> Compact(
+        const std::vector<std::map<std::string, std::string>>& partitions) = 0;
+
+ protected:
+    PostponeBucketCompactor() = default;
+};
+}  // namespace paimon
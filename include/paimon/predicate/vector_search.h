@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "paimon/predicate/predicate.h"
+#include "paimon/utils/roaring_bitmap64.h"
 #include "paimon/visibility.h"
 
 namespace paimon {
@@ -44,7 +45,22 @@ struct PAIMON_EXPORT VectorSearch {
           predicate(_predicate) {}
 
     std::shared_ptr<VectorSearch> ReplacePreFilter(PreFilter _pre_filter) const {
-        return std::make_shared<VectorSearch>(field_name, limit, query, _pre_filter, predicate);
+        auto vector_search =
+            std::make_shared<VectorSearch>(field_name, limit, query, _pre_filter, predicate);
+        vector_search->pre_filter_bitmap = pre_filter_bitmap;
+        return vector_search;
+    }
+
+    std::shared_ptr<VectorSearch> ReplacePreFilterBitmap(
+        const std::shared_ptr<const RoaringBitmap64>& _pre_filter_bitmap) const {
+        auto vector_search = std::make_shared<VectorSearch>(*this);
+        vector_search->pre_filter_bitmap = _pre_filter_bitmap;
+        return vector_search;
+    }
+
+    /// @return Whether any of `pre_filter` and `pre_filter_bitmap` is set.
+    bool HasPreFilter() const {
+        return pre_filter != nullptr || pre_filter_bitmap != nullptr;
     }
 
     /// Search field name.
@@ -55,6 +71,11 @@ struct PAIMON_EXPORT VectorSearch {
     std::vector<float> query;
     /// A pre-filter based on **local row ids**, implemented by leveraging other global index
     std::function<bool(int64_t)> pre_filter;
+    /// The **local row ids** allowed in vector search, e.g., the result of other global indexes.
+    /// Unlike `pre_filter`, the index knows all the candidates in advance, so it can choose how
+    /// to filter by the selectivity instead of calling a function for each visited row. If both
+    /// are set, a row must pass both of them.
+    std::shared_ptr<const RoaringBitmap64> pre_filter_bitmap;
     /// A runtime filtering condition that may involve graph traversal of
     /// structured attributes. **Using this parameter often yields better
     /// filtering accuracy** because during index construction, the underlying
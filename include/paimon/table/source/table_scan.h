@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "paimon/result.h"
 #include "paimon/table/source/plan.h"
@@ -41,5 +43,21 @@ class PAIMON_EXPORT TableScan {
     ///
     /// @return A Result containing a shared pointer to the created `Plan` or an error status.
     virtual Result<std::shared_ptr<Plan>> CreatePlan() = 0;
+
+    /// Wait for new snapshots and create plans for them.
+    ///
+    /// In streaming mode, one plan is created for each consecutive snapshot to read, and at most
+    /// `max_plans` plans are returned in one call. Instead of repeatedly calling `CreatePlan()`,
+    /// the snapshot directory is watched (by file system notification for local file system,
+    /// or by polling with an adaptive backoff interval otherwise), so that new snapshots are
+    /// discovered with low latency without frequently accessing the file system. Returns an empty
+    /// vector if no snapshot arrives within `timeout_ms`. In batch mode, this returns the result
+    /// of `CreatePlan()` without waiting.
+    ///
+    /// @param timeout_ms The maximum time to wait in milliseconds.
+    /// @param max_plans The maximum number of plans to return, must be positive.
+    /// @return A Result containing the created plans or an error status.
+    virtual Result<std::vector<std::shared_ptr<Plan>>> WaitForNextPlan(int64_t timeout_ms,
+                                                                       int32_t max_plans);
 };
 }  // namespace paimon
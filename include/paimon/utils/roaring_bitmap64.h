@@ -98,6 +98,10 @@ class PAIMON_EXPORT RoaringBitmap64 {
     /// Contain any value in the half-open interval [min, max).
     bool ContainsAny(int64_t min, int64_t max) const;
 
+    /// @return The number of values in the half-open interval [min, max), computed from the
+    /// container cardinalities without iterating the values. Negative values are not counted.
+    int64_t RangeCardinality(int64_t min, int64_t max) const;
+
     /// Serialize bitmap to bytes.
     PAIMON_UNIQUE_PTR<Bytes> Serialize(MemoryPool* pool) const;
 
@@ -151,8 +151,13 @@ class GenericRow : public InternalRow {
         return DataDefine::GetVariantValue<BinaryString>(fields_[pos]);
     }
 
+    /// @note A binary field held as `Bytes`, e.g., the result of an aggregate function, can also
+    /// be read as a view.
     std::string_view GetStringView(int32_t pos) const override {
         assert(static_cast<size_t>(pos) < fields_.size());
+        if (const auto* bytes = DataDefine::GetVariantPtr<std::shared_ptr<Bytes>>(fields_[pos])) {
+            return std::string_view((*bytes)->data(), (*bytes)->size());
+        }
         return DataDefine::GetVariantValue<std::string_view>(fields_[pos]);
     }
 
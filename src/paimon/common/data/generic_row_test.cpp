@@ -87,6 +87,7 @@ TEST(GenericRowTest, TestSimple) {
     ASSERT_EQ(row.GetDouble(6), static_cast<double>(6.12));
     ASSERT_EQ(row.GetString(7), str);
     ASSERT_EQ(*row.GetBinary(8), *bytes);
+    ASSERT_EQ(row.GetStringView(8), std::string_view(bytes->data(), bytes->size()));
     ASSERT_EQ(std::string(row.GetStringView(9)), str9);
     ASSERT_EQ(row.GetTimestamp(10, /*precision=*/9), ts);
     ASSERT_EQ(row.GetDecimal(11, /*precision=*/30, /*scale=*/20), decimal);
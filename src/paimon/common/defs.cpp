@@ -27,8 +27,14 @@ const char Options::SEQUENCE_GROUP[] = "sequence-group";
 
 const char Options::BUCKET[] = "bucket";
 const char Options::BUCKET_KEY[] = "bucket-key";
+const char Options::POSTPONE_DEFAULT_BUCKET_NUM[] = "postpone.default-bucket-num";
 const char Options::FILE_FORMAT[] = "file.format";
 const char Options::FILE_SYSTEM[] = "file-system";
+const char Options::BLOCK_CACHE_ENABLED[] = "file-system.block-cache.enabled";
+const char Options::BLOCK_CACHE_DIR[] = "file-system.block-cache.dir";
+const char Options::BLOCK_CACHE_BLOCK_SIZE[] = "file-system.block-cache.block-size";
+const char Options::BLOCK_CACHE_MAX_MEMORY_SIZE[] = "file-system.block-cache.max-memory-size";
+const char Options::BLOCK_CACHE_MAX_DISK_SIZE[] = "file-system.block-cache.max-disk-size";
 const char Options::TARGET_FILE_SIZE[] = "target-file-size";
 const char Options::BLOB_TARGET_FILE_SIZE[] = "blob.target-file-size";
 const char Options::PAGE_SIZE[] = "page-size";
@@ -41,18 +47,27 @@ const char Options::MANIFEST_COMPRESSION[] = "manifest.compression";
 const char Options::MANIFEST_MERGE_MIN_COUNT[] = "manifest.merge-min-count";
 const char Options::MANIFEST_FULL_COMPACTION_FILE_SIZE[] =
     "manifest.full-compaction-threshold-size";
+const char Options::PARTITION_STATISTICS_INDEX_ENABLED[] = "partition.statistics-index.enabled";
 const char Options::SOURCE_SPLIT_TARGET_SIZE[] = "source.split.target-size";
 const char Options::SOURCE_SPLIT_OPEN_FILE_COST[] = "source.split.open-file-cost";
+const char Options::SOURCE_SPLIT_KEY_RANGE_ENABLED[] = "source.split.key-range.enabled";
 const char Options::SCAN_SNAPSHOT_ID[] = "scan.snapshot-id";
 const char Options::SCAN_MODE[] = "scan.mode";
+const char Options::CONTINUOUS_DISCOVERY_INTERVAL[] = "continuous.discovery-interval";
 const char Options::READ_BATCH_SIZE[] = "read.batch-size";
 const char Options::WRITE_BATCH_SIZE[] = "write.batch-size";
 const char Options::WRITE_BUFFER_SIZE[] = "write-buffer-size";
+const char Options::WRITE_ASYNC_FLUSH_ENABLED[] = "write.async-flush.enabled";
+const char Options::WRITE_ASYNC_FLUSH_MAX_IN_FLIGHT[] = "write.async-flush.max-in-flight";
+const char Options::WRITE_ASYNC_FLUSH_MAX_MEMORY[] = "write.async-flush.max-memory";
 const char Options::SNAPSHOT_NUM_RETAINED_MIN[] = "snapshot.num-retained.min";
 const char Options::SNAPSHOT_NUM_RETAINED_MAX[] = "snapshot.num-retained.max";
 const char Options::SNAPSHOT_TIME_RETAINED[] = "snapshot.time-retained";
 const char Options::SNAPSHOT_EXPIRE_LIMIT[] = "snapshot.expire.limit";
 const char Options::SNAPSHOT_CLEAN_EMPTY_DIRECTORIES[] = "snapshot.clean-empty-directories";
+const char Options::SNAPSHOT_EXPIRE_PARALLELISM[] = "snapshot.expire.parallelism";
+const char Options::METADATA_CACHE_ENABLED[] = "metadata.cache.enabled";
+const char Options::METADATA_CACHE_HINT_TTL[] = "metadata.cache.hint-ttl";
 const char Options::COMMIT_TIMEOUT[] = "commit.timeout";
 const char Options::COMMIT_MAX_RETRIES[] = "commit.max-retries";
 const char Options::SEQUENCE_FIELD[] = "sequence.field";
@@ -64,6 +79,12 @@ const char Options::FIELDS_DEFAULT_AGG_FUNC[] = "fields.default-aggregate-functi
 const char Options::DELETION_VECTORS_ENABLED[] = "deletion-vectors.enabled";
 const char Options::CHANGELOG_PRODUCER[] = "changelog-producer";
 const char Options::FORCE_LOOKUP[] = "force-lookup";
+const char Options::LOOKUP_CACHE_DIR[] = "lookup.cache-dir";
+const char Options::LOOKUP_CACHE_MAX_DISK_SIZE[] = "lookup.cache-max-disk-size";
+const char Options::LOOKUP_CACHE_MAX_MEMORY_SIZE[] = "lookup.cache-max-memory-size";
+const char Options::LOOKUP_CACHE_BLOCK_SIZE[] = "lookup.cache-block-size";
+const char Options::LOOKUP_CACHE_BLOOM_FILTER_ENABLED[] = "lookup.cache.bloom.filter.enabled";
+const char Options::LOOKUP_CACHE_BLOOM_FILTER_FPP[] = "lookup.cache.bloom.filter.fpp";
 const char Options::PARTIAL_UPDATE_REMOVE_RECORD_ON_DELETE[] =
     "partial-update.remove-record-on-delete";
 const char Options::PARTIAL_UPDATE_REMOVE_RECORD_ON_SEQUENCE_GROUP[] =
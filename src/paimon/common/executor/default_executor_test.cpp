@@ -14,10 +14,14 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <functional>
 #include <future>
 #include <memory>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -26,6 +30,7 @@
 #include "paimon/executor.h"
 #include "paimon/result.h"
 #include "paimon/status.h"
+#include "paimon/testing/utils/testharness.h"
 
 namespace paimon::test {
 
@@ -74,4 +79,110 @@ TEST(DefaultExecutorTest, TestViaWithResult) {
     ASSERT_EQ(4, results.size());
 }
 
+TEST(DefaultExecutorTest, TestParallelFor) {
+    auto executor = CreateDefaultExecutor(/*thread_count=*/2);
+    std::vector<int32_t> results(100, 0);
+    ASSERT_OK(ParallelFor(executor.get(), results.size(), [&results](size_t i) -> Status {
+        results[i] = static_cast<int32_t>(i) * 2;
+        return Status::OK();
+    }));
+    for (size_t i = 0; i < results.size(); i++) {
+        ASSERT_EQ(static_cast<int32_t>(i) * 2, results[i]);
+    }
+    ASSERT_NOK_WITH_MSG(ParallelFor(executor.get(), 10,
+                                    [](size_t i) -> Status {
+                                        return i == 5 ? Status::Invalid("invalid index 5")
+                                                      : Status::OK();
+                                    }),
+                        "invalid index 5");
+    ASSERT_OK(ParallelFor(executor.get(), 0, [](size_t) { return Status::OK(); }));
+}
+
+TEST(DefaultExecutorTest, TestParallelForBoundsTasks) {
+    // counts the tasks submitted to a default executor
+    class CountingExecutor : public Executor {
+     public:
+        explicit CountingExecutor(uint32_t thread_count)
+            : executor_(CreateDefaultExecutor(thread_count)) {}
+        void Add(std::function<void()> func) override {
+            added_++;
+            executor_->Add(std::move(func));
+        }
+        uint32_t GetParallelism() const override {
+            return executor_->GetParallelism();
+        }
+        int32_t Added() const {
+            return added_.load();
+        }
+
+     private:
+        std::unique_ptr<Executor> executor_;
+        std::atomic<int32_t> added_ = {0};
+    };
+    CountingExecutor executor(/*thread_count=*/2);
+    ASSERT_EQ(2, executor.GetParallelism());
+    std::atomic<int64_t> sum = {0};
+    ASSERT_OK(ParallelFor(&executor, 1000, [&sum](size_t i) -> Status {
+        sum += i;
+        return Status::OK();
+    }));
+    ASSERT_EQ(999 * 1000 / 2, sum.load());
+    // the calling thread runs chunks too, so only one task is submitted
+    ASSERT_EQ(1, executor.Added());
+    ASSERT_NOK_WITH_MSG(ParallelFor(&executor, 1000,
+                                    [](size_t i) -> Status {
+                                        return i == 500 ? Status::Invalid("invalid index 500")
+                                                        : Status::OK();
+                                    }),
+                        "invalid index 500");
+}
+
+TEST(DefaultExecutorTest, TestParallelForWithParallelism) {
+    auto executor = CreateDefaultExecutor(/*thread_count=*/4);
+    for (size_t parallelism : {0, 1, 2, 8}) {
+        std::atomic<int32_t> running = {0};
+        std::atomic<int32_t> max_running = {0};
+        std::vector<int32_t> results(50, 0);
+        ASSERT_OK(ParallelFor(executor.get(), results.size(), parallelism, [&](size_t i) {
+            int32_t current = ++running;
+            int32_t expected = max_running.load();
+            while (current > expected && !max_running.compare_exchange_weak(expected, current)) {
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            results[i] = static_cast<int32_t>(i) + 1;
+            --running;
+            return Status::OK();
+        }));
+        for (size_t i = 0; i < results.size(); i++) {
+            ASSERT_EQ(static_cast<int32_t>(i) + 1, results[i]);
+        }
+        ASSERT_LE(max_running.load(), static_cast<int32_t>(std::max<size_t>(parallelism, 1)));
+    }
+    ASSERT_NOK_WITH_MSG(ParallelFor(executor.get(), 10, /*parallelism=*/3,
+                                    [](size_t i) -> Status {
+                                        return i == 5 ? Status::Invalid("invalid index 5")
+                                                      : Status::OK();
+                                    }),
+                        "invalid index 5");
+}
+
+TEST(DefaultExecutorTest, TestParallelForInExecutorTask) {
+    // all threads of the executor wait for ParallelFor, which must not deadlock
+    auto executor = CreateDefaultExecutor(/*thread_count=*/2);
+    std::atomic<int64_t> sum = {0};
+    std::vector<std::future<Status>> futures;
+    for (int32_t i = 0; i < 4; i++) {
+        futures.push_back(Via(executor.get(), [&executor, &sum]() {
+            return ParallelFor(executor.get(), 10, [&sum](size_t i) -> Status {
+                sum += i;
+                return Status::OK();
+            });
+        }));
+    }
+    for (const auto& status : CollectAll(futures)) {
+        ASSERT_OK(status);
+    }
+    ASSERT_EQ(4 * 45, sum.load());
+}
+
 }  // namespace paimon::test
@@ -16,6 +16,7 @@
 
 #include "paimon/executor.h"
 
+#include <algorithm>
 #include <condition_variable>
 #include <functional>
 #include <mutex>
@@ -33,6 +34,10 @@ class DefaultExecutor : public Executor {
 
     void Add(std::function<void()> func) override;
 
+    uint32_t GetParallelism() const override {
+        return std::max<uint32_t>(thread_count_, 1);
+    }
+
  private:
     void WorkerThread();
 
@@ -16,9 +16,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
 #include <functional>
 #include <future>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <unordered_set>
 #include <utility>
@@ -26,6 +31,7 @@
 
 #include "paimon/executor.h"
 #include "paimon/result.h"
+#include "paimon/status.h"
 
 namespace paimon {
 
@@ -114,4 +120,83 @@ inline void Wait(std::vector<std::future<void>>& futures) {
     }
 }
 
+/// Runs `func(i)` for each `i` in `[0, count)` on the executor and waits for all of them.
+///
+/// The indexes are split into chunks, which are taken by at most `executor->GetParallelism()`
+/// tasks, so a large `count` does not flood the executor with tiny tasks. The calling thread
+/// also takes part in running the chunks, and only waits for the chunks which have been started
+/// by the executor. So it never deadlocks even if it is called from a task of the same executor
+/// and all the threads of the executor are busy.
+///
+/// @param func A callable with signature `Status(size_t)`, which must be thread-safe.
+/// @return The first non-ok status returned by `func`, or OK.
+template <typename Func>
+Status ParallelFor(Executor* executor, size_t count, const Func& func) {
+    if (count == 0) {
+        return Status::OK();
+    }
+    size_t task_count =
+        count > 1 ? std::min<size_t>(count, std::max<uint32_t>(executor->GetParallelism(), 1)) : 1;
+    // a few chunks per task, so that tasks which finish early take over the rest
+    size_t chunk_size = std::max<size_t>(count / (task_count * 4), 1);
+    size_t chunk_count = (count + chunk_size - 1) / chunk_size;
+    struct State {
+        std::atomic<size_t> next{0};
+        std::mutex mutex;
+        std::condition_variable finished_cv;
+        size_t finished = 0;
+        Status status;
+    };
+    auto state = std::make_shared<State>();
+    // tasks started by the executor after all chunks are taken do not touch `func`, so it is
+    // safe to capture it by reference
+    auto run = [state, count, chunk_size, chunk_count, &func]() {
+        for (size_t chunk = state->next.fetch_add(1); chunk < chunk_count;
+             chunk = state->next.fetch_add(1)) {
+            Status chunk_status;
+            size_t end = std::min(count, (chunk + 1) * chunk_size);
+            for (size_t i = chunk * chunk_size; i < end; i++) {
+                Status status = func(i);
+                if (!status.ok() && chunk_status.ok()) {
+                    chunk_status = std::move(status);
+                }
+            }
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (!chunk_status.ok() && state->status.ok()) {
+                state->status = std::move(chunk_status);
+            }
+            if (++state->finished == chunk_count) {
+                state->finished_cv.notify_all();
+            }
+        }
+    };
+    for (size_t i = 1; i < task_count; i++) {
+        executor->Add(run);
+    }
+    run();
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->finished_cv.wait(lock,
+                            [&state, chunk_count]() { return state->finished == chunk_count; });
+    return state->status;
+}
+
+/// Same as `ParallelFor(executor, count, func)`, but at most `parallelism` tasks run at the same
+/// time, including the calling thread. With `parallelism` 1 all the tasks run in the calling
+/// thread one by one.
+template <typename Func>
+Status ParallelFor(Executor* executor, size_t count, size_t parallelism, const Func& func) {
+    std::atomic<size_t> next{0};
+    // each worker returns only after it stops taking indexes, so `next` and `func` outlive them
+    auto worker = [&next, count, &func](size_t) -> Status {
+        for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+            Status status = func(i);
+            if (!status.ok()) {
+                return status;
+            }
+        }
+        return Status::OK();
+    };
+    return ParallelFor(executor, std::min(count, std::max<size_t>(parallelism, 1)), worker);
+}
+
 }  // namespace paimon
@@ -16,10 +16,13 @@
 
 #include "paimon/common/file_index/bitmap/bitmap_file_index.h"
 
+#include <algorithm>
+#include <unordered_set>
 #include <utility>
 
 #include "arrow/c/bridge.h"
 #include "fmt/format.h"
+#include "paimon/common/executor/future.h"
 #include "paimon/common/file_index/bitmap/bitmap_file_index_meta.h"
 #include "paimon/common/file_index/bitmap/bitmap_file_index_meta_v1.h"
 #include "paimon/common/file_index/bitmap/bitmap_file_index_meta_v2.h"
@@ -30,6 +33,7 @@
 #include "paimon/common/utils/options_utils.h"
 #include "paimon/data/timestamp.h"
 #include "paimon/defs.h"
+#include "paimon/executor.h"
 #include "paimon/file_index/bitmap_index_result.h"
 #include "paimon/fs/file_system.h"
 #include "paimon/io/data_input_stream.h"
@@ -294,45 +298,184 @@ Result<std::shared_ptr<FileIndexResult>> BitmapFileIndexReader::VisitIsNotNull()
     return VisitNotIn({Literal(data_type_)});
 }
 
+Result<std::shared_ptr<FileIndexResult>> BitmapFileIndexReader::VisitLessThan(
+    const Literal& literal) {
+    if (literal.IsNull()) {
+        return FileIndexReader::VisitLessThan(literal);
+    }
+    return VisitRange(Literal(data_type_), /*lower_inclusive=*/false, literal,
+                      /*upper_inclusive=*/false);
+}
+
+Result<std::shared_ptr<FileIndexResult>> BitmapFileIndexReader::VisitLessOrEqual(
+    const Literal& literal) {
+    if (literal.IsNull()) {
+        return FileIndexReader::VisitLessOrEqual(literal);
+    }
+    return VisitRange(Literal(data_type_), /*lower_inclusive=*/false, literal,
+                      /*upper_inclusive=*/true);
+}
+
+Result<std::shared_ptr<FileIndexResult>> BitmapFileIndexReader::VisitGreaterThan(
+    const Literal& literal) {
+    if (literal.IsNull()) {
+        return FileIndexReader::VisitGreaterThan(literal);
+    }
+    return VisitRange(literal, /*lower_inclusive=*/false, Literal(data_type_),
+                      /*upper_inclusive=*/false);
+}
+
+Result<std::shared_ptr<FileIndexResult>> BitmapFileIndexReader::VisitGreaterOrEqual(
+    const Literal& literal) {
+    if (literal.IsNull()) {
+        return FileIndexReader::VisitGreaterOrEqual(literal);
+    }
+    return VisitRange(literal, /*lower_inclusive=*/true, Literal(data_type_),
+                      /*upper_inclusive=*/false);
+}
+
+Result<std::shared_ptr<FileIndexResult>> BitmapFileIndexReader::VisitRange(
+    const Literal& lower, bool lower_inclusive, const Literal& upper, bool upper_inclusive) {
+    PAIMON_ASSIGN_OR_RAISE(Literal converted_lower,
+                           BitmapFileIndex::ConvertLiteral(lower, arrow_type_));
+    PAIMON_ASSIGN_OR_RAISE(Literal converted_upper,
+                           BitmapFileIndex::ConvertLiteral(upper, arrow_type_));
+    FieldType converted_type = BitmapFileIndex::ConvertType(data_type_);
+    if (converted_lower.GetType() != converted_type ||
+        converted_upper.GetType() != converted_type) {
+        // values of different types can not be compared, remain all rows
+        return FileIndexResult::Remain();
+    }
+    return std::make_shared<BitmapIndexResult>(
+        [lower = std::move(converted_lower), upper = std::move(converted_upper), lower_inclusive,
+         upper_inclusive, reader = shared_from_this()]() -> Result<RoaringBitmap32> {
+            PAIMON_RETURN_NOT_OK(reader->ReadInternalMeta());
+            return reader->GetRangeResultBitmap(lower, lower_inclusive, upper, upper_inclusive);
+        });
+}
+
 Result<RoaringBitmap32> BitmapFileIndexReader::GetInListResultBitmap(
     const std::vector<Literal>& literals) {
-    std::vector<const RoaringBitmap32*> result_bitmaps;
-    result_bitmaps.reserve(literals.size());
+    std::vector<Literal> converted_literals;
+    converted_literals.reserve(literals.size());
+    std::vector<std::pair<Literal, const BitmapFileIndexMeta::Entry*>> entries;
     for (const Literal& literal : literals) {
         PAIMON_ASSIGN_OR_RAISE(Literal converted_literal,
                                BitmapFileIndex::ConvertLiteral(literal, arrow_type_));
-        auto iter = bitmaps_.find(converted_literal);
-        if (iter != bitmaps_.end()) {
-            result_bitmaps.emplace_back(&(iter->second));
-        } else {
-            PAIMON_ASSIGN_OR_RAISE(RoaringBitmap32 bitmap, ReadBitmap(converted_literal));
-            auto new_iter = bitmaps_.emplace(converted_literal, std::move(bitmap));
-            result_bitmaps.emplace_back(&(new_iter.first->second));
+        if (bitmaps_.find(converted_literal) == bitmaps_.end()) {
+            PAIMON_ASSIGN_OR_RAISE(const BitmapFileIndexMeta::Entry* entry,
+                                   bitmap_file_index_meta_->FindEntry(converted_literal));
+            entries.emplace_back(converted_literal, entry);
+        }
+        converted_literals.push_back(std::move(converted_literal));
+    }
+    PAIMON_RETURN_NOT_OK(LoadBitmaps(entries));
+
+    std::vector<const RoaringBitmap32*> result_bitmaps;
+    result_bitmaps.reserve(converted_literals.size());
+    for (const Literal& literal : converted_literals) {
+        result_bitmaps.push_back(&bitmaps_.at(literal));
+    }
+    return RoaringBitmap32::FastUnion(result_bitmaps);
+}
+
+Result<RoaringBitmap32> BitmapFileIndexReader::GetRangeResultBitmap(const Literal& lower,
+                                                                    bool lower_inclusive,
+                                                                    const Literal& upper,
+                                                                    bool upper_inclusive) {
+    PAIMON_ASSIGN_OR_RAISE(
+        std::vector<const BitmapFileIndexMeta::Entry*> range_entries,
+        bitmap_file_index_meta_->FindEntries(lower, lower_inclusive, upper, upper_inclusive));
+    std::vector<std::pair<Literal, const BitmapFileIndexMeta::Entry*>> entries;
+    for (const auto* entry : range_entries) {
+        if (bitmaps_.find(entry->key) == bitmaps_.end()) {
+            entries.emplace_back(entry->key, entry);
         }
     }
+    PAIMON_RETURN_NOT_OK(LoadBitmaps(entries));
+
+    std::vector<const RoaringBitmap32*> result_bitmaps;
+    result_bitmaps.reserve(range_entries.size());
+    for (const auto* entry : range_entries) {
+        result_bitmaps.push_back(&bitmaps_.at(entry->key));
+    }
     return RoaringBitmap32::FastUnion(result_bitmaps);
 }
 
-Result<RoaringBitmap32> BitmapFileIndexReader::ReadBitmap(const Literal& literal) {
-    PAIMON_ASSIGN_OR_RAISE(const BitmapFileIndexMeta::Entry* entry,
-                           bitmap_file_index_meta_->FindEntry(literal));
-    if (entry == nullptr) {
-        return RoaringBitmap32();
+Status BitmapFileIndexReader::LoadBitmaps(
+    const std::vector<std::pair<Literal, const BitmapFileIndexMeta::Entry*>>& entries) {
+    // 1.plan the bitmaps to read, missing values and inlined bitmaps need no io
+    std::vector<std::pair<Literal, const BitmapFileIndexMeta::Entry*>> to_read;
+    std::unordered_set<Literal> planned;
+    for (const auto& [literal, entry] : entries) {
+        if (entry == nullptr) {
+            bitmaps_.emplace(literal, RoaringBitmap32());
+        } else if (entry->offset < 0) {
+            // offset < 0, indicates only one value in bitmap, and the value is (-1 - offset)
+            bitmaps_.emplace(literal, RoaringBitmap32::From({-1 - entry->offset}));
+        } else if (bitmaps_.find(literal) == bitmaps_.end() && planned.insert(literal).second) {
+            to_read.emplace_back(literal, entry);
+        }
+    }
+    if (to_read.empty()) {
+        return Status::OK();
+    }
+    std::sort(to_read.begin(), to_read.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.second->offset < rhs.second->offset;
+    });
+
+    // 2.coalesce nearby bitmaps into a few large reads
+    struct ReadRange {
+        int64_t offset;
+        int64_t length;
+        std::unique_ptr<Bytes> bytes;
+    };
+    std::vector<ReadRange> ranges;
+    std::vector<size_t> range_of_entry;
+    range_of_entry.reserve(to_read.size());
+    for (const auto& [literal, entry] : to_read) {
+        int64_t end = static_cast<int64_t>(entry->offset) + entry->length;
+        if (!ranges.empty()) {
+            ReadRange& last = ranges.back();
+            int64_t last_end = last.offset + last.length;
+            if (entry->offset - last_end <= MAX_READ_GAP &&
+                end - last.offset <= MAX_COALESCED_READ_SIZE) {
+                last.length = std::max(last_end, end) - last.offset;
+                range_of_entry.push_back(ranges.size() - 1);
+                continue;
+            }
+        }
+        ranges.push_back({entry->offset, entry->length, nullptr});
+        range_of_entry.push_back(ranges.size() - 1);
+    }
+    DataInputStream input(input_stream_);
+    for (auto& range : ranges) {
+        PAIMON_RETURN_NOT_OK(input_stream_->Seek(
+            bitmap_file_index_meta_->GetBodyStart() + range.offset, SeekOrigin::FS_SEEK_SET));
+        range.bytes = std::make_unique<Bytes>(range.length, pool_.get());
+        PAIMON_RETURN_NOT_OK(input.ReadBytes(range.bytes.get()));
     }
-    int32_t offset = entry->offset;
-    if (offset < 0) {
-        // offset < 0, indicates only one value in bitmap, and the value is (-1 - offset)
-        return RoaringBitmap32::From({-1 - offset});
+
+    // 3.deserialize bitmaps, in parallel if there are many of them
+    std::vector<RoaringBitmap32> bitmaps(to_read.size());
+    auto deserialize = [&](size_t i) -> Status {
+        const BitmapFileIndexMeta::Entry* entry = to_read[i].second;
+        const ReadRange& range = ranges[range_of_entry[i]];
+        return bitmaps[i].Deserialize(range.bytes->data() + (entry->offset - range.offset),
+                                      entry->length);
+    };
+    if (to_read.size() < PARALLEL_DESERIALIZE_THRESHOLD) {
+        for (size_t i = 0; i < to_read.size(); i++) {
+            PAIMON_RETURN_NOT_OK(deserialize(i));
+        }
     } else {
-        PAIMON_RETURN_NOT_OK(input_stream_->Seek(bitmap_file_index_meta_->GetBodyStart() + offset,
-                                                 SeekOrigin::FS_SEEK_SET));
-        auto bitmap_bytes = std::make_unique<Bytes>(entry->length, pool_.get());
-        DataInputStream input(input_stream_);
-        PAIMON_RETURN_NOT_OK(input.ReadBytes(bitmap_bytes.get()));
-        RoaringBitmap32 res;
-        PAIMON_RETURN_NOT_OK(res.Deserialize(bitmap_bytes->data(), bitmap_bytes->size()));
-        return res;
+        PAIMON_RETURN_NOT_OK(
+            ParallelFor(GetGlobalDefaultExecutor().get(), to_read.size(), deserialize));
+    }
+    for (size_t i = 0; i < to_read.size(); i++) {
+        bitmaps_.emplace(std::move(to_read[i].first), std::move(bitmaps[i]));
     }
+    return Status::OK();
 }
 
 Status BitmapFileIndexReader::ReadInternalMeta() {
@@ -20,6 +20,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "paimon/common/file_index/bitmap/bitmap_file_index_meta.h"
@@ -103,11 +104,14 @@ class BitmapFileIndexReader : public FileIndexReader,
                           const std::shared_ptr<InputStream>& input_stream,
                           const std::shared_ptr<MemoryPool>& pool);
 
-    // TODO(xinyu.lxy): may overwrite VisitGreaterThan... like VisitIsNotNull
-
     Result<std::shared_ptr<FileIndexResult>> VisitEqual(const Literal& literal) override;
     Result<std::shared_ptr<FileIndexResult>> VisitNotEqual(const Literal& literal) override;
 
+    Result<std::shared_ptr<FileIndexResult>> VisitLessThan(const Literal& literal) override;
+    Result<std::shared_ptr<FileIndexResult>> VisitLessOrEqual(const Literal& literal) override;
+    Result<std::shared_ptr<FileIndexResult>> VisitGreaterThan(const Literal& literal) override;
+    Result<std::shared_ptr<FileIndexResult>> VisitGreaterOrEqual(const Literal& literal) override;
+
     Result<std::shared_ptr<FileIndexResult>> VisitIn(const std::vector<Literal>& literals) override;
     Result<std::shared_ptr<FileIndexResult>> VisitNotIn(
         const std::vector<Literal>& literals) override;
@@ -116,10 +120,28 @@ class BitmapFileIndexReader : public FileIndexReader,
     Result<std::shared_ptr<FileIndexResult>> VisitIsNotNull() override;
 
  private:
+    Result<std::shared_ptr<FileIndexResult>> VisitRange(const Literal& lower, bool lower_inclusive,
+                                                        const Literal& upper,
+                                                        bool upper_inclusive);
+
     Result<RoaringBitmap32> GetInListResultBitmap(const std::vector<Literal>& literals);
-    Result<RoaringBitmap32> ReadBitmap(const Literal& literal);
+    Result<RoaringBitmap32> GetRangeResultBitmap(const Literal& lower, bool lower_inclusive,
+                                                 const Literal& upper, bool upper_inclusive);
+    /// Reads the bitmaps of entries which are not in `bitmaps_` yet. The offsets of all bitmaps
+    /// are planned up front, so that nearby bitmaps are fetched with a single read, and the
+    /// bitmaps are deserialized in parallel when there are many of them.
+    Status LoadBitmaps(
+        const std::vector<std::pair<Literal, const BitmapFileIndexMeta::Entry*>>& entries);
     Status ReadInternalMeta();
 
+ public:
+    /// Bitmaps separated by no more than this gap are fetched with a single read.
+    static constexpr int64_t MAX_READ_GAP = 32 * 1024;
+    /// Upper limit of the bytes fetched by a single coalesced read.
+    static constexpr int64_t MAX_COALESCED_READ_SIZE = 8 * 1024 * 1024;
+    /// Bitmaps are deserialized in parallel only when there are at least this many bitmaps.
+    static constexpr size_t PARALLEL_DESERIALIZE_THRESHOLD = 16;
+
  private:
     int32_t head_start_;
     int32_t length_;
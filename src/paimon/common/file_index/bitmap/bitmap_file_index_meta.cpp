@@ -49,6 +49,24 @@ BitmapFileIndexMeta::BitmapFileIndexMeta(const FieldType& type, int32_t row_coun
       write_entries_(std::move(write_entries)),
       pool_(pool) {}
 
+Result<bool> BitmapFileIndexMeta::InRange(const Literal& value, const Literal& lower,
+                                          bool lower_inclusive, const Literal& upper,
+                                          bool upper_inclusive) {
+    if (!lower.IsNull()) {
+        PAIMON_ASSIGN_OR_RAISE(int32_t cmp, value.CompareTo(lower));
+        if (cmp < 0 || (cmp == 0 && !lower_inclusive)) {
+            return false;
+        }
+    }
+    if (!upper.IsNull()) {
+        PAIMON_ASSIGN_OR_RAISE(int32_t cmp, value.CompareTo(upper));
+        if (cmp > 0 || (cmp == 0 && !upper_inclusive)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 Result<std::function<void(const Literal&)>> BitmapFileIndexMeta::GetValueWriter(
     const std::shared_ptr<MemorySegmentOutputStream>& output_stream) const {
     switch (data_type_) {
@@ -60,6 +60,12 @@ class BitmapFileIndexMeta {
     }
 
     virtual Result<const Entry*> FindEntry(const Literal& bitmap_id) = 0;
+    /// Find the entries of non-null values in the range, a null bound indicates the range is
+    /// unbounded on that side.
+    virtual Result<std::vector<const Entry*>> FindEntries(const Literal& lower,
+                                                          bool lower_inclusive,
+                                                          const Literal& upper,
+                                                          bool upper_inclusive) = 0;
     virtual Status Deserialize(const std::shared_ptr<InputStream>& input_stream) = 0;
     virtual Status Serialize(const std::shared_ptr<MemorySegmentOutputStream>& output_stream) = 0;
 
@@ -70,6 +76,9 @@ class BitmapFileIndexMeta {
     Result<std::function<void(const Literal&)>> GetValueWriter(
         const std::shared_ptr<MemorySegmentOutputStream>& output_stream) const;
 
+    static Result<bool> InRange(const Literal& value, const Literal& lower, bool lower_inclusive,
+                                const Literal& upper, bool upper_inclusive);
+
     template <typename T>
     Result<T> ReadAndMoveBodyStart(const std::shared_ptr<DataInputStream>& in,
                                    bool move_body_start = true) {
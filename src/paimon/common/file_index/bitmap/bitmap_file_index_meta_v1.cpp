@@ -53,6 +53,23 @@ Result<const BitmapFileIndexMeta::Entry*> BitmapFileIndexMetaV1::FindEntry(
     return nullptr;
 }
 
+Result<std::vector<const BitmapFileIndexMeta::Entry*>> BitmapFileIndexMetaV1::FindEntries(
+    const Literal& lower, bool lower_inclusive, const Literal& upper, bool upper_inclusive) {
+    // the dictionary of v1 is not sorted, check all values
+    std::vector<const Entry*> entries;
+    for (const auto& [key, entry] : entries_) {
+        if (key.IsNull()) {
+            continue;
+        }
+        PAIMON_ASSIGN_OR_RAISE(bool in_range,
+                               InRange(key, lower, lower_inclusive, upper, upper_inclusive));
+        if (in_range) {
+            entries.push_back(&entry);
+        }
+    }
+    return entries;
+}
+
 Status BitmapFileIndexMetaV1::Serialize(
     const std::shared_ptr<MemorySegmentOutputStream>& output_stream) {
     PAIMON_ASSIGN_OR_RAISE(std::function<void(const Literal&)> write_value,
@@ -78,6 +78,9 @@ class BitmapFileIndexMetaV1 : public BitmapFileIndexMeta {
                           const std::shared_ptr<MemoryPool>& pool);
 
     Result<const BitmapFileIndexMeta::Entry*> FindEntry(const Literal& bitmap_id) override;
+    Result<std::vector<const Entry*>> FindEntries(const Literal& lower, bool lower_inclusive,
+                                                  const Literal& upper,
+                                                  bool upper_inclusive) override;
 
     Status Deserialize(const std::shared_ptr<InputStream>& input_stream) override;
     Status Serialize(const std::shared_ptr<MemorySegmentOutputStream>& output_stream) override;
@@ -123,6 +123,49 @@ Result<const BitmapFileIndexMeta::Entry*> BitmapFileIndexMetaV2::FindEntry(
     return nullptr;
 }
 
+Result<std::vector<const BitmapFileIndexMeta::Entry*>> BitmapFileIndexMetaV2::FindEntries(
+    const Literal& lower, bool lower_inclusive, const Literal& upper, bool upper_inclusive) {
+    std::vector<const Entry*> entries;
+    // blocks are sorted by their first value, start from the last block not greater than lower
+    auto iter = index_blocks_.begin();
+    if (!lower.IsNull()) {
+        // binary search for the first block greater than lower, a failed comparison is returned
+        // instead of aborting in the comparator of std::upper_bound
+        size_t low = 0;
+        size_t high = index_blocks_.size();
+        while (low < high) {
+            size_t mid = low + (high - low) / 2;
+            PAIMON_ASSIGN_OR_RAISE(int32_t cmp, lower.CompareTo(index_blocks_[mid]->key));
+            if (cmp < 0) {
+                high = mid;
+            } else {
+                low = mid + 1;
+            }
+        }
+        iter += low;
+        if (iter != index_blocks_.begin()) {
+            iter--;
+        }
+    }
+    for (; iter != index_blocks_.end(); ++iter) {
+        if (!upper.IsNull()) {
+            PAIMON_ASSIGN_OR_RAISE(int32_t cmp, (*iter)->key.CompareTo(upper));
+            if (cmp > 0) {
+                break;
+            }
+        }
+        PAIMON_ASSIGN_OR_RAISE(const std::vector<Entry>* block_entries, (*iter)->GetEntries());
+        for (const auto& entry : *block_entries) {
+            PAIMON_ASSIGN_OR_RAISE(
+                bool in_range, InRange(entry.key, lower, lower_inclusive, upper, upper_inclusive));
+            if (in_range) {
+                entries.push_back(&entry);
+            }
+        }
+    }
+    return entries;
+}
+
 BitmapFileIndexMetaV2::BitmapIndexBlock* BitmapFileIndexMetaV2::FindBlock(
     const Literal& bitmap_id) {
     if (index_blocks_.empty()) {
@@ -229,6 +272,12 @@ Result<const BitmapFileIndexMeta::Entry*> BitmapFileIndexMetaV2::BitmapIndexBloc
     return nullptr;
 }
 
+Result<const std::vector<BitmapFileIndexMeta::Entry>*>
+BitmapFileIndexMetaV2::BitmapIndexBlock::GetEntries() {
+    PAIMON_RETURN_NOT_OK(TryDeserialize());
+    return &entry_list;
+}
+
 Result<bool> BitmapFileIndexMetaV2::BitmapIndexBlock::TryAdd(const Entry& entry) {
     // null literal will not be added to block
     if (key.IsNull()) {
@@ -99,6 +99,9 @@ class BitmapFileIndexMetaV2 : public BitmapFileIndexMeta {
                           const std::shared_ptr<MemoryPool>& pool);
 
     Result<const BitmapFileIndexMeta::Entry*> FindEntry(const Literal& bitmap_id) override;
+    Result<std::vector<const Entry*>> FindEntries(const Literal& lower, bool lower_inclusive,
+                                                  const Literal& upper,
+                                                  bool upper_inclusive) override;
     Status Deserialize(const std::shared_ptr<InputStream>& input_stream) override;
     Status Serialize(const std::shared_ptr<MemorySegmentOutputStream>& output_stream) override;
 
@@ -124,6 +127,9 @@ class BitmapFileIndexMetaV2::BitmapIndexBlock {
 
     Result<const Entry*> FindEntry(const Literal& bitmap_id);
 
+    /// @return all entries of the block, sorted by value.
+    Result<const std::vector<Entry>*> GetEntries();
+
     Result<bool> TryAdd(const Entry& entry);
 
  private:
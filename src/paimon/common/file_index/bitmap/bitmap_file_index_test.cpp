@@ -16,7 +16,11 @@
 
 #include "paimon/common/file_index/bitmap/bitmap_file_index.h"
 
+#include <functional>
+#include <map>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/api.h"
 #include "arrow/c/bridge.h"
@@ -61,11 +65,13 @@ class BitmapIndexTest : public ::testing::Test {
             << ", expected=" << RoaringBitmap32::From(expected).ToString();
     }
 
-    Result<PAIMON_UNIQUE_PTR<Bytes>> WriteIndex(const std::shared_ptr<arrow::DataType>& type,
-                                                int32_t version,
-                                                const std::shared_ptr<arrow::Array>& array) const {
+    Result<PAIMON_UNIQUE_PTR<Bytes>> WriteIndex(
+        const std::shared_ptr<arrow::DataType>& type, int32_t version,
+        const std::shared_ptr<arrow::Array>& array,
+        std::map<std::string, std::string> options = {}) const {
         auto arrow_schema = arrow::schema({arrow::field("f0", type)});
-        BitmapFileIndex file_index({{"version", std::to_string(version)}});
+        options["version"] = std::to_string(version);
+        BitmapFileIndex file_index(options);
         ArrowSchema c_schema;
         PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*arrow_schema, &c_schema));
         PAIMON_ASSIGN_OR_RAISE(auto writer, file_index.CreateWriter(&c_schema, pool_));
@@ -496,6 +502,16 @@ TEST_F(BitmapIndexTest, TestIntType) {
         CheckResult(reader->VisitIsNull().value(), {2});
         CheckResult(reader->VisitIn({lit_0, lit_1, lit_2}).value(), {0, 1});
         CheckResult(reader->VisitNotIn({lit_0, lit_1, lit_2}).value(), {});
+        CheckResult(reader->VisitLessThan(lit_1).value(), {0});
+        CheckResult(reader->VisitLessOrEqual(lit_1).value(), {0, 1});
+        CheckResult(reader->VisitGreaterThan(lit_0).value(), {1});
+        CheckResult(reader->VisitGreaterOrEqual(lit_0).value(), {0, 1});
+        CheckResult(reader->VisitGreaterOrEqual(lit_2).value(), {});
+        // literal of another type can not be compared
+        ASSERT_TRUE(reader->VisitLessThan(Literal(static_cast<int64_t>(1)))
+                        .value()
+                        ->IsRemain()
+                        .value());
     };
     {
         // test write and read, v1 version
@@ -709,6 +725,98 @@ TEST_F(BitmapIndexTest, TestHighCardinalityForWriteAndRead) {
     }
 }
 
+TEST_F(BitmapIndexTest, TestRangeAndInListWithManyValues) {
+    // data: i % 50 for row i, every 7th row is null
+    auto type = arrow::int32();
+    int32_t row_count = 1000;
+    auto write_data = [&](int32_t version) -> Result<PAIMON_UNIQUE_PTR<Bytes>> {
+        arrow::StructBuilder struct_builder(arrow::struct_({arrow::field("f0", type)}),
+                                            arrow::default_memory_pool(),
+                                            {std::make_shared<arrow::Int32Builder>()});
+        auto int_builder = static_cast<arrow::Int32Builder*>(struct_builder.field_builder(0));
+        for (int32_t i = 0; i < row_count; i++) {
+            EXPECT_TRUE(struct_builder.Append().ok());
+            if (i % 7 == 0) {
+                EXPECT_TRUE(int_builder->AppendNull().ok());
+            } else {
+                EXPECT_TRUE(int_builder->Append(i % 50).ok());
+            }
+        }
+        std::shared_ptr<arrow::Array> array;
+        EXPECT_TRUE(struct_builder.Finish(&array).ok());
+        // small index blocks so that v2 has multiple blocks
+        return WriteIndex(type, version, array, {{BitmapFileIndex::INDEX_BLOCK_SIZE, "64b"}});
+    };
+    auto expected_rows = [&](const std::function<bool(int32_t)>& filter) {
+        std::vector<int32_t> rows;
+        for (int32_t i = 0; i < row_count; i++) {
+            if (i % 7 != 0 && filter(i % 50)) {
+                rows.push_back(i);
+            }
+        }
+        return rows;
+    };
+
+    auto check_result = [&](const char* index_bytes, int32_t index_length) {
+        auto input_stream = std::make_shared<ByteArrayInputStream>(index_bytes, index_length);
+        BitmapFileIndex file_index({});
+        ASSERT_OK_AND_ASSIGN(
+            auto reader,
+            file_index.CreateReader(CreateArrowSchema(type).get(),
+                                    /*start=*/0, /*length=*/index_length, input_stream, pool_));
+        ASSERT_TRUE(reader);
+
+        // enough bitmaps to be deserialized in parallel
+        std::vector<Literal> literals;
+        for (int32_t value = 5; value < 60; value += 2) {
+            literals.emplace_back(value);
+        }
+        CheckResult(reader->VisitIn(literals).value(),
+                    expected_rows([](int32_t value) { return value >= 5 && value % 2 == 1; }));
+        CheckResult(reader->VisitNotIn(literals).value(),
+                    expected_rows([](int32_t value) { return value < 5 || value % 2 == 0; }));
+
+        Literal lit_10(static_cast<int32_t>(10));
+        Literal lit_20(static_cast<int32_t>(20));
+        CheckResult(reader->VisitLessThan(lit_10).value(),
+                    expected_rows([](int32_t value) { return value < 10; }));
+        CheckResult(reader->VisitLessOrEqual(lit_10).value(),
+                    expected_rows([](int32_t value) { return value <= 10; }));
+        CheckResult(reader->VisitGreaterThan(lit_20).value(),
+                    expected_rows([](int32_t value) { return value > 20; }));
+        CheckResult(reader->VisitGreaterOrEqual(lit_20).value(),
+                    expected_rows([](int32_t value) { return value >= 20; }));
+        CheckResult(reader->VisitGreaterThan(Literal(static_cast<int32_t>(-1))).value(),
+                    expected_rows([](int32_t) { return true; }));
+        CheckResult(reader->VisitLessThan(Literal(static_cast<int32_t>(0))).value(), {});
+    };
+    {
+        // test write and read, v1 version
+        ASSERT_OK_AND_ASSIGN(auto index_bytes, write_data(/*version=*/1));
+        check_result(index_bytes->data(), index_bytes->size());
+    }
+    {
+        // test write and read, v2 version
+        ASSERT_OK_AND_ASSIGN(auto index_bytes, write_data(/*version=*/2));
+        check_result(index_bytes->data(), index_bytes->size());
+
+        // a failed comparison with the block keys is returned as an error
+        auto input_stream =
+            std::make_shared<ByteArrayInputStream>(index_bytes->data(), index_bytes->size());
+        BitmapFileIndex file_index({});
+        ASSERT_OK_AND_ASSIGN(auto reader, file_index.CreateReader(
+                                              CreateArrowSchema(type).get(), /*start=*/0,
+                                              /*length=*/index_bytes->size(), input_stream, pool_));
+        auto bitmap_reader = std::dynamic_pointer_cast<BitmapFileIndexReader>(reader);
+        ASSERT_TRUE(bitmap_reader);
+        ASSERT_OK(bitmap_reader->ReadInternalMeta());
+        ASSERT_NOK_WITH_MSG(bitmap_reader->bitmap_file_index_meta_->FindEntries(
+                                Literal(static_cast<int64_t>(10)), /*lower_inclusive=*/true,
+                                Literal(FieldType::BIGINT), /*upper_inclusive=*/true),
+                            "cannot compare with different type");
+    }
+}
+
 TEST_F(BitmapIndexTest, TestCompatibleWithJava) {
     // data: apple, null, apple, null, apple
     // If and only if non-null elements only contain one value (e.g., apple), index bytes can be
@@ -0,0 +1,229 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/file_index/bloomfilter/split_block_bloom_filter_file_index.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "arrow/c/bridge.h"
+#include "fmt/format.h"
+#include "paimon/common/predicate/literal_converter.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/common/utils/math.h"
+#include "paimon/common/utils/options_utils.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/io/byte_order.h"
+#include "paimon/io/data_input_stream.h"
+#include "paimon/memory/bytes.h"
+#include "paimon/predicate/literal.h"
+#include "paimon/status.h"
+
+namespace paimon {
+namespace {
+constexpr int32_t HEADER_SIZE = sizeof(int8_t) + sizeof(int32_t);
+}  // namespace
+
+SplitBlockBloomFilterFileIndex::SplitBlockBloomFilterFileIndex(
+    const std::map<std::string, std::string>& options)
+    : options_(options) {}
+
+Result<std::shared_ptr<FileIndexReader>> SplitBlockBloomFilterFileIndex::CreateReader(
+    ::ArrowSchema* c_arrow_schema, int32_t start, int32_t length,
+    const std::shared_ptr<InputStream>& input_stream,
+    const std::shared_ptr<MemoryPool>& pool) const {
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Schema> arrow_schema,
+                                      arrow::ImportSchema(c_arrow_schema));
+    if (arrow_schema->num_fields() != 1) {
+        return Status::Invalid(
+            "invalid schema for SplitBlockBloomFilterFileIndexReader, supposed to have single "
+            "field.");
+    }
+    PAIMON_RETURN_NOT_OK(input_stream->Seek(start, SeekOrigin::FS_SEEK_SET));
+    Bytes bytes(length, pool.get());
+    DataInputStream data_input_stream(input_stream);
+    PAIMON_RETURN_NOT_OK(data_input_stream.ReadBytes(&bytes));
+    return SplitBlockBloomFilterFileIndexReader::Create(arrow_schema->field(0)->type(), bytes,
+                                                        pool.get());
+}
+
+Result<std::shared_ptr<FileIndexWriter>> SplitBlockBloomFilterFileIndex::CreateWriter(
+    ::ArrowSchema* c_arrow_schema, const std::shared_ptr<MemoryPool>& pool) const {
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Schema> arrow_schema,
+                                      arrow::ImportSchema(c_arrow_schema));
+    if (arrow_schema->num_fields() != 1) {
+        return Status::Invalid(
+            "invalid schema for SplitBlockBloomFilterFileIndexWriter, supposed to have single "
+            "field.");
+    }
+    return SplitBlockBloomFilterFileIndexWriter::Create(arrow_schema->field(0)->type(), options_,
+                                                        pool);
+}
+
+Result<std::shared_ptr<SplitBlockBloomFilterFileIndexWriter>>
+SplitBlockBloomFilterFileIndexWriter::Create(const std::shared_ptr<arrow::DataType>& arrow_type,
+                                             const std::map<std::string, std::string>& options,
+                                             const std::shared_ptr<MemoryPool>& pool) {
+    PAIMON_ASSIGN_OR_RAISE(FastHash::HashFunction hash_function,
+                           FastHash::GetHashFunction(arrow_type));
+    PAIMON_ASSIGN_OR_RAISE(int64_t items, OptionsUtils::GetValueFromMap<int64_t>(
+                                              options, SplitBlockBloomFilterFileIndex::ITEMS,
+                                              /*default_value=*/-1));
+    PAIMON_ASSIGN_OR_RAISE(double fpp, OptionsUtils::GetValueFromMap<double>(
+                                           options, SplitBlockBloomFilterFileIndex::FPP,
+                                           SplitBlockBloomFilterFileIndex::DEFAULT_FPP));
+    if (fpp <= 0 || fpp >= 1) {
+        return Status::Invalid(
+            fmt::format("invalid fpp {} for split block bloom filter, supposed to be in (0, 1)",
+                        fpp));
+    }
+    return std::shared_ptr<SplitBlockBloomFilterFileIndexWriter>(
+        new SplitBlockBloomFilterFileIndexWriter(arrow_type, hash_function, items, fpp, pool));
+}
+
+SplitBlockBloomFilterFileIndexWriter::SplitBlockBloomFilterFileIndexWriter(
+    const std::shared_ptr<arrow::DataType>& arrow_type,
+    const FastHash::HashFunction& hash_function, int64_t items, double fpp,
+    const std::shared_ptr<MemoryPool>& pool)
+    : struct_type_(arrow::struct_({arrow::field("f0", arrow_type)})),
+      hash_function_(hash_function),
+      items_(items),
+      fpp_(fpp),
+      pool_(pool) {}
+
+Status SplitBlockBloomFilterFileIndexWriter::AddBatch(::ArrowArray* batch) {
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> arrow_array,
+                                      arrow::ImportArray(batch, struct_type_));
+    auto struct_array = std::dynamic_pointer_cast<arrow::StructArray>(arrow_array);
+    if (!struct_array || struct_array->num_fields() != 1) {
+        return Status::Invalid(
+            "invalid batch for SplitBlockBloomFilterFileIndexWriter, supposed to be struct array "
+            "with single field.");
+    }
+    PAIMON_ASSIGN_OR_RAISE(
+        std::vector<Literal> values,
+        LiteralConverter::ConvertLiteralsFromArray(*(struct_array->field(0)), /*own_data=*/false));
+    for (const auto& value : values) {
+        if (!value.IsNull()) {
+            hashes_.push_back(hash_function_(value));
+        }
+    }
+    return Status::OK();
+}
+
+Result<PAIMON_UNIQUE_PTR<Bytes>> SplitBlockBloomFilterFileIndexWriter::SerializedBytes() const {
+    std::vector<int64_t> distinct_hashes = hashes_;
+    std::sort(distinct_hashes.begin(), distinct_hashes.end());
+    distinct_hashes.erase(std::unique(distinct_hashes.begin(), distinct_hashes.end()),
+                          distinct_hashes.end());
+    int64_t items = items_ > 0 ? items_ : static_cast<int64_t>(distinct_hashes.size());
+    SplitBlockBloomFilter filter(SplitBlockBloomFilter::OptimalNumBytes(items, fpp_),
+                                 pool_.get());
+    for (int64_t hash : distinct_hashes) {
+        filter.AddHash(hash);
+    }
+
+    int32_t num_bytes = filter.NumBytes();
+    auto bytes = Bytes::AllocateBytes(HEADER_SIZE + num_bytes, pool_.get());
+    char* data = bytes->data();
+    data[0] = SplitBlockBloomFilterFileIndex::VERSION_1;
+    // compatible with the other file indexes, header is big endian
+    int32_t big_endian_num_bytes =
+        SystemByteOrder() == ByteOrder::PAIMON_BIG_ENDIAN ? num_bytes : EndianSwapValue(num_bytes);
+    std::memcpy(data + sizeof(int8_t), &big_endian_num_bytes, sizeof(int32_t));
+    std::memcpy(data + HEADER_SIZE, filter.GetBytes()->data(), num_bytes);
+    return bytes;
+}
+
+Result<std::shared_ptr<SplitBlockBloomFilterFileIndexReader>>
+SplitBlockBloomFilterFileIndexReader::Create(const std::shared_ptr<arrow::DataType>& arrow_type,
+                                             const Bytes& bytes, MemoryPool* pool) {
+    if (bytes.size() < static_cast<size_t>(HEADER_SIZE)) {
+        return Status::Invalid(
+            fmt::format("invalid split block bloom filter index, size {}", bytes.size()));
+    }
+    const char* data = bytes.data();
+    int8_t version = data[0];
+    if (version != SplitBlockBloomFilterFileIndex::VERSION_1) {
+        return Status::Invalid(
+            fmt::format("unknown split block bloom filter index version {}", version));
+    }
+    int32_t num_bytes = 0;
+    std::memcpy(&num_bytes, data + sizeof(int8_t), sizeof(int32_t));
+    if (SystemByteOrder() != ByteOrder::PAIMON_BIG_ENDIAN) {
+        num_bytes = EndianSwapValue(num_bytes);
+    }
+    if (num_bytes < 0 || static_cast<size_t>(num_bytes) != bytes.size() - HEADER_SIZE) {
+        return Status::Invalid(fmt::format(
+            "invalid split block bloom filter index, size {}, num bytes {}", bytes.size(),
+            num_bytes));
+    }
+    PAIMON_ASSIGN_OR_RAISE(FastHash::HashFunction hash_function,
+                           FastHash::GetHashFunction(arrow_type));
+    PAIMON_ASSIGN_OR_RAISE(SplitBlockBloomFilter filter,
+                           SplitBlockBloomFilter::Create(data + HEADER_SIZE, num_bytes, pool));
+    return std::shared_ptr<SplitBlockBloomFilterFileIndexReader>(
+        new SplitBlockBloomFilterFileIndexReader(hash_function, std::move(filter)));
+}
+
+SplitBlockBloomFilterFileIndexReader::SplitBlockBloomFilterFileIndexReader(
+    const FastHash::HashFunction& hash_function, SplitBlockBloomFilter&& filter)
+    : hash_function_(hash_function), filter_(std::move(filter)) {}
+
+Result<std::shared_ptr<FileIndexResult>> SplitBlockBloomFilterFileIndexReader::VisitEqual(
+    const Literal& literal) {
+    return literal.IsNull() || filter_.TestHash(hash_function_(literal))
+               ? FileIndexResult::Remain()
+               : FileIndexResult::Skip();
+}
+
+Result<std::shared_ptr<FileIndexResult>> SplitBlockBloomFilterFileIndexReader::VisitIn(
+    const std::vector<Literal>& literals) {
+    std::vector<int64_t> hashes;
+    hashes.reserve(literals.size());
+    for (const auto& literal : literals) {
+        if (literal.IsNull()) {
+            return FileIndexResult::Remain();
+        }
+        hashes.push_back(hash_function_(literal));
+    }
+    std::unique_ptr<bool[]> results(new bool[hashes.size()]);
+    filter_.TestHashes(hashes.data(), hashes.size(), results.get());
+    bool remain = std::any_of(results.get(), results.get() + hashes.size(),
+                              [](bool result) { return result; });
+    return remain ? FileIndexResult::Remain() : FileIndexResult::Skip();
+}
+
+Result<std::shared_ptr<arrow::BooleanArray>> SplitBlockBloomFilterFileIndexReader::TestHashes(
+    const arrow::Int64Array& hashes) const {
+    std::vector<uint8_t> results(hashes.length());
+    static_assert(sizeof(bool) == sizeof(uint8_t));
+    filter_.TestHashes(hashes.raw_values(), hashes.length(),
+                       reinterpret_cast<bool*>(results.data()));
+    if (hashes.null_count() > 0) {
+        for (int64_t i = 0; i < hashes.length(); i++) {
+            results[i] = results[i] || hashes.IsNull(i);
+        }
+    }
+    arrow::BooleanBuilder builder;
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(builder.AppendValues(results.data(), results.size()));
+    std::shared_ptr<arrow::BooleanArray> array;
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(builder.Finish(&array));
+    return array;
+}
+
+}  // namespace paimon
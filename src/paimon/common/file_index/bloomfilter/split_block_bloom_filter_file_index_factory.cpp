@@ -0,0 +1,35 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/file_index/bloomfilter/split_block_bloom_filter_file_index_factory.h"
+
+#include <utility>
+
+#include "paimon/common/file_index/bloomfilter/split_block_bloom_filter_file_index.h"
+#include "paimon/factories/factory_creator.h"
+
+namespace paimon {
+
+const char SplitBlockBloomFilterFileIndexFactory::IDENTIFIER[] = "split-block-bloom-filter";
+
+Result<std::unique_ptr<FileIndexer>> SplitBlockBloomFilterFileIndexFactory::Create(
+    const std::map<std::string, std::string>& options) const {
+    return std::make_unique<SplitBlockBloomFilterFileIndex>(options);
+}
+
+REGISTER_PAIMON_FACTORY(SplitBlockBloomFilterFileIndexFactory);
+
+}  // namespace paimon
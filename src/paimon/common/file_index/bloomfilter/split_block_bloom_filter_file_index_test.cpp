@@ -0,0 +1,192 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/file_index/bloomfilter/split_block_bloom_filter_file_index.h"
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/c/bridge.h"
+#include "arrow/ipc/json_simple.h"
+#include "gtest/gtest.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/defs.h"
+#include "paimon/io/byte_array_input_stream.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/predicate/literal.h"
+#include "paimon/status.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+class SplitBlockBloomFilterFileIndexTest : public ::testing::Test {
+ public:
+    void SetUp() override {
+        pool_ = GetDefaultPool();
+    }
+    void TearDown() override {
+        pool_.reset();
+    }
+
+    std::unique_ptr<::ArrowSchema> CreateArrowSchema(
+        const std::shared_ptr<arrow::DataType>& data_type) const {
+        auto schema = arrow::schema({arrow::field("f0", data_type)});
+        auto c_schema = std::make_unique<::ArrowSchema>();
+        EXPECT_TRUE(arrow::ExportSchema(*schema, c_schema.get()).ok());
+        return c_schema;
+    }
+
+    Result<PAIMON_UNIQUE_PTR<Bytes>> WriteIndex(
+        const std::shared_ptr<arrow::DataType>& type, const std::shared_ptr<arrow::Array>& array,
+        const std::map<std::string, std::string>& options = {}) const {
+        SplitBlockBloomFilterFileIndex file_index(options);
+        PAIMON_ASSIGN_OR_RAISE(auto writer,
+                               file_index.CreateWriter(CreateArrowSchema(type).get(), pool_));
+        ArrowArray c_array;
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(*array, &c_array));
+        PAIMON_RETURN_NOT_OK(writer->AddBatch(&c_array));
+        return writer->SerializedBytes();
+    }
+
+    Result<std::shared_ptr<FileIndexReader>> CreateReader(
+        const std::shared_ptr<arrow::DataType>& type, const Bytes& index_bytes) const {
+        auto input_stream =
+            std::make_shared<ByteArrayInputStream>(index_bytes.data(), index_bytes.size());
+        SplitBlockBloomFilterFileIndex file_index({});
+        return file_index.CreateReader(CreateArrowSchema(type).get(), /*start=*/0,
+                                       /*length=*/index_bytes.size(), input_stream, pool_);
+    }
+
+ protected:
+    std::shared_ptr<MemoryPool> pool_;
+};
+
+TEST_F(SplitBlockBloomFilterFileIndexTest, TestStringType) {
+    auto type = arrow::utf8();
+    auto array = arrow::ipc::internal::json::ArrayFromJSON(
+                     arrow::struct_({arrow::field("f0", type)}),
+                     R"([["a"], [null], ["b"], [""], ["a"]])")
+                     .ValueOrDie();
+    ASSERT_OK_AND_ASSIGN(auto index_bytes, WriteIndex(type, array));
+    // the filter is sized by 3 distinct values, which is a single block
+    ASSERT_EQ(5 + SplitBlockBloomFilter::BYTES_PER_BLOCK, index_bytes->size());
+    ASSERT_OK_AND_ASSIGN(auto reader, CreateReader(type, *index_bytes));
+
+    Literal lit_a(FieldType::STRING, "a", 1);
+    Literal lit_b(FieldType::STRING, "b", 1);
+    Literal lit_empty(FieldType::STRING, "", 0);
+    ASSERT_TRUE(reader->VisitEqual(lit_a).value()->IsRemain().value());
+    ASSERT_TRUE(reader->VisitEqual(lit_b).value()->IsRemain().value());
+    ASSERT_TRUE(reader->VisitEqual(lit_empty).value()->IsRemain().value());
+    ASSERT_TRUE(reader->VisitEqual(Literal(FieldType::STRING)).value()->IsRemain().value());
+    ASSERT_TRUE(reader->VisitIn({lit_a, lit_b}).value()->IsRemain().value());
+}
+
+TEST_F(SplitBlockBloomFilterFileIndexTest, TestFalsePositive) {
+    auto type = arrow::int64();
+    arrow::StructBuilder struct_builder(arrow::struct_({arrow::field("f0", type)}),
+                                        arrow::default_memory_pool(),
+                                        {std::make_shared<arrow::Int64Builder>()});
+    auto long_builder = static_cast<arrow::Int64Builder*>(struct_builder.field_builder(0));
+    int64_t items = 10000;
+    for (int64_t i = 0; i < items; i++) {
+        ASSERT_TRUE(struct_builder.Append().ok());
+        ASSERT_TRUE(long_builder->Append(i * 2).ok());
+    }
+    std::shared_ptr<arrow::Array> array;
+    ASSERT_TRUE(struct_builder.Finish(&array).ok());
+    ASSERT_OK_AND_ASSIGN(auto index_bytes,
+                         WriteIndex(type, array, {{SplitBlockBloomFilterFileIndex::FPP, "0.01"}}));
+    ASSERT_OK_AND_ASSIGN(auto reader, CreateReader(type, *index_bytes));
+
+    for (int64_t i = 0; i < items; i++) {
+        ASSERT_TRUE(reader->VisitEqual(Literal(i * 2)).value()->IsRemain().value());
+    }
+    int32_t false_positives = 0;
+    std::vector<Literal> absent_literals;
+    for (int64_t i = 0; i < items; i++) {
+        Literal literal(i * 2 + 1);
+        if (reader->VisitEqual(literal).value()->IsRemain().value()) {
+            false_positives++;
+        } else {
+            absent_literals.push_back(literal);
+        }
+    }
+    ASSERT_LT(static_cast<double>(false_positives) / items, 0.02);
+    ASSERT_FALSE(reader->VisitIn(absent_literals).value()->IsRemain().value());
+    absent_literals.emplace_back(static_cast<int64_t>(0));
+    ASSERT_TRUE(reader->VisitIn(absent_literals).value()->IsRemain().value());
+}
+
+TEST_F(SplitBlockBloomFilterFileIndexTest, TestHashes) {
+    auto pool = GetDefaultPool();
+    SplitBlockBloomFilter filter(/*num_bytes=*/1024, pool.get());
+    for (int64_t hash : {1, 3, 5}) {
+        filter.AddHash(hash);
+    }
+    auto index_bytes = Bytes::AllocateBytes(5 + filter.NumBytes(), pool.get());
+    std::vector<char> header = {1, 0, 0, 4, 0};
+    memcpy(index_bytes->data(), header.data(), header.size());
+    memcpy(index_bytes->data() + header.size(), filter.GetBytes()->data(), filter.NumBytes());
+    ASSERT_OK_AND_ASSIGN(auto reader, SplitBlockBloomFilterFileIndexReader::Create(
+                                          arrow::int64(), *index_bytes, pool.get()));
+
+    auto hashes = std::static_pointer_cast<arrow::Int64Array>(
+        arrow::ipc::internal::json::ArrayFromJSON(arrow::int64(), "[1, 2, null, 3, 4, 5]")
+            .ValueOrDie());
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<arrow::BooleanArray> results,
+                         reader->TestHashes(*hashes));
+    ASSERT_EQ(hashes->length(), results->length());
+    ASSERT_EQ(0, results->null_count());
+    for (int64_t i = 0; i < hashes->length(); i++) {
+        if (hashes->IsNull(i)) {
+            ASSERT_TRUE(results->Value(i));
+        } else {
+            ASSERT_EQ(filter.TestHash(hashes->Value(i)), results->Value(i));
+        }
+    }
+    ASSERT_TRUE(results->Value(0));
+    ASSERT_TRUE(results->Value(3));
+    ASSERT_TRUE(results->Value(5));
+}
+
+TEST_F(SplitBlockBloomFilterFileIndexTest, TestInvalid) {
+    auto pool = GetDefaultPool();
+    auto index_bytes = Bytes::AllocateBytes(5 + SplitBlockBloomFilter::BYTES_PER_BLOCK, pool.get());
+    memset(index_bytes->data(), 0, index_bytes->size());
+    index_bytes->data()[0] = 2;
+    ASSERT_NOK_WITH_MSG(
+        SplitBlockBloomFilterFileIndexReader::Create(arrow::int32(), *index_bytes, pool.get()),
+        "unknown split block bloom filter index version 2");
+    index_bytes->data()[0] = 1;
+    ASSERT_NOK_WITH_MSG(
+        SplitBlockBloomFilterFileIndexReader::Create(arrow::int32(), *index_bytes, pool.get()),
+        "invalid split block bloom filter index, size 37, num bytes 0");
+    index_bytes->data()[4] = SplitBlockBloomFilter::BYTES_PER_BLOCK;
+    ASSERT_OK(
+        SplitBlockBloomFilterFileIndexReader::Create(arrow::int32(), *index_bytes, pool.get()));
+    ASSERT_NOK_WITH_MSG(
+        SplitBlockBloomFilterFileIndexReader::Create(arrow::boolean(), *index_bytes, pool.get()),
+        "bloom filter index does not support");
+
+    SplitBlockBloomFilterFileIndex file_index({{SplitBlockBloomFilterFileIndex::FPP, "1.5"}});
+    ASSERT_NOK_WITH_MSG(file_index.CreateWriter(CreateArrowSchema(arrow::int32()).get(), pool_),
+                        "invalid fpp 1.5 for split block bloom filter");
+}
+
+}  // namespace paimon::test
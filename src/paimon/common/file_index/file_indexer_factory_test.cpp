@@ -19,6 +19,7 @@
 #include "gtest/gtest.h"
 #include "paimon/common/file_index/bitmap/bitmap_file_index.h"
 #include "paimon/common/file_index/bloomfilter/bloom_filter_file_index.h"
+#include "paimon/common/file_index/bloomfilter/split_block_bloom_filter_file_index.h"
 #include "paimon/common/file_index/bsi/bit_slice_index_bitmap_file_index.h"
 #include "paimon/file_index/file_indexer.h"
 #include "paimon/status.h"
@@ -41,6 +42,13 @@ TEST(FileIndexerFactoryTest, TestRegister) {
     auto* bsi_indexer = dynamic_cast<BitSliceIndexBitmapFileIndex*>(file_indexer3.get());
     ASSERT_TRUE(bsi_indexer);
 
+    ASSERT_OK_AND_ASSIGN(auto file_indexer4,
+                         FileIndexerFactory::Get("split-block-bloom-filter", {}));
+    ASSERT_TRUE(file_indexer4);
+    auto* split_block_indexer =
+        dynamic_cast<SplitBlockBloomFilterFileIndex*>(file_indexer4.get());
+    ASSERT_TRUE(split_block_indexer);
+
     ASSERT_OK_AND_ASSIGN(auto non_exist_file_indexer, FileIndexerFactory::Get("non-exist", {}));
     ASSERT_FALSE(non_exist_file_indexer);
 }
@@ -0,0 +1,299 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/fs/block_cache.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <utility>
+
+#include "fmt/format.h"
+#include "paimon/common/metrics/metrics_impl.h"
+#include "paimon/common/utils/path_util.h"
+#include "paimon/common/utils/string_utils.h"
+#include "paimon/common/utils/uuid.h"
+#include "paimon/executor.h"
+#include "paimon/memory/memory_pool.h"
+
+namespace paimon {
+
+Result<std::shared_ptr<BlockCache>> BlockCache::Create(const std::string& local_dir,
+                                                       int64_t block_size, int64_t max_memory_size,
+                                                       int64_t max_disk_size,
+                                                       const std::shared_ptr<Executor>& executor,
+                                                       const std::shared_ptr<MemoryPool>& pool) {
+    if (block_size <= 0) {
+        return Status::Invalid(fmt::format("invalid block size {} for block cache", block_size));
+    }
+    std::error_code ec;
+    std::string parent_dir = local_dir;
+    if (parent_dir.empty()) {
+        parent_dir = std::filesystem::temp_directory_path(ec).string();
+        if (ec) {
+            return Status::IOError(
+                fmt::format("get temporary directory fail, ec: {}", ec.message()));
+        }
+    }
+    std::string uuid;
+    if (!UUID::Generate(&uuid)) {
+        return Status::Invalid("generate uuid for block cache failed");
+    }
+    std::string cache_dir = PathUtil::JoinPath(parent_dir, "paimon-block-cache-" + uuid);
+    std::filesystem::create_directories(cache_dir, ec);
+    if (ec) {
+        return Status::IOError(
+            fmt::format("create block cache dir '{}' fail, ec: {}", cache_dir, ec.message()));
+    }
+    return std::shared_ptr<BlockCache>(
+        new BlockCache(cache_dir, block_size, max_memory_size, max_disk_size, executor, pool));
+}
+
+Result<std::shared_ptr<BlockCache>> BlockCache::GetOrCreateShared(const std::string& local_dir,
+                                                                  int64_t block_size,
+                                                                  int64_t max_memory_size,
+                                                                  int64_t max_disk_size) {
+    static std::mutex shared_mutex;
+    static std::map<std::pair<std::string, int64_t>, std::shared_ptr<BlockCache>> shared_caches;
+    std::lock_guard<std::mutex> lock(shared_mutex);
+    auto iter = shared_caches.find({local_dir, block_size});
+    if (iter != shared_caches.end()) {
+        return iter->second;
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<BlockCache> cache,
+                           Create(local_dir, block_size, max_memory_size, max_disk_size,
+                                  GetGlobalDefaultExecutor(), GetDefaultPool()));
+    shared_caches.emplace(std::make_pair(local_dir, block_size), cache);
+    return cache;
+}
+
+BlockCache::BlockCache(const std::string& cache_dir, int64_t block_size, int64_t max_memory_size,
+                       int64_t max_disk_size, const std::shared_ptr<Executor>& executor,
+                       const std::shared_ptr<MemoryPool>& pool)
+    : cache_dir_(cache_dir),
+      block_size_(block_size),
+      max_memory_size_(max_memory_size),
+      max_disk_size_(max_disk_size),
+      executor_(executor),
+      pool_(pool) {}
+
+BlockCache::~BlockCache() {
+    WaitPendingWrites();
+    memory_blocks_.clear();
+    std::error_code ec;
+    std::filesystem::remove_all(cache_dir_, ec);
+}
+
+Result<std::shared_ptr<Bytes>> BlockCache::GetOrLoad(const BlockKey& key, const Loader& loader) {
+    std::promise<Result<std::shared_ptr<Bytes>>> promise;
+    std::string local_path;
+    int64_t local_size = 0;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto memory_iter = memory_blocks_.find(key);
+        if (memory_iter != memory_blocks_.end()) {
+            memory_hit_count_++;
+            memory_lru_.splice(memory_lru_.begin(), memory_lru_, memory_iter->second.lru_iter);
+            return memory_iter->second.block;
+        }
+        auto loading_iter = loading_blocks_.find(key);
+        if (loading_iter != loading_blocks_.end()) {
+            coalesced_count_++;
+            std::shared_future<Result<std::shared_ptr<Bytes>>> future =
+                loading_iter->second.future;
+            lock.unlock();
+            return future.get();
+        }
+        auto disk_iter = disk_blocks_.find(key);
+        if (disk_iter != disk_blocks_.end()) {
+            disk_lru_.splice(disk_lru_.begin(), disk_lru_, disk_iter->second.lru_iter);
+            local_path = disk_iter->second.local_path;
+            local_size = disk_iter->second.size;
+        }
+        loading_blocks_.emplace(key, LoadingBlock{promise.get_future().share()});
+    }
+
+    bool from_disk = false;
+    Result<std::shared_ptr<Bytes>> result = Status::NotExist("block is not on local disk");
+    if (!local_path.empty()) {
+        // the local block may have been evicted meanwhile, fall back to the loader then
+        result = ReadLocalBlock(local_path, local_size);
+        from_disk = result.ok();
+    }
+    if (!from_disk) {
+        result = loader();
+    }
+    bool write_local = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto loading_iter = loading_blocks_.find(key);
+        bool invalidated = loading_iter->second.invalidated;
+        loading_blocks_.erase(loading_iter);
+        if (from_disk) {
+            disk_hit_count_++;
+        } else {
+            miss_count_++;
+        }
+        if (result.ok() && !invalidated) {
+            PutMemoryBlock(key, result.value());
+            write_local = !from_disk && executor_ && max_disk_size_ > 0;
+        }
+    }
+    promise.set_value(result);
+    if (write_local) {
+        WriteLocalBlockAsync(key, result.value());
+    }
+    return result;
+}
+
+Result<std::shared_ptr<Bytes>> BlockCache::ReadLocalBlock(const std::string& local_path,
+                                                          int64_t size) const {
+    std::ifstream in(local_path, std::ios::binary);
+    auto block = std::make_shared<Bytes>(size, pool_.get());
+    if (!in.read(block->data(), size)) {
+        return Status::IOError(fmt::format("read local block '{}' fail", local_path));
+    }
+    return block;
+}
+
+void BlockCache::WriteLocalBlockAsync(const BlockKey& key, const std::shared_ptr<Bytes>& block) {
+    std::string local_path;
+    WritingBlocks::iterator writing_iter;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        local_path = PathUtil::JoinPath(cache_dir_, fmt::format("block-{}", local_block_id_++));
+        writing_iter = writing_blocks_.emplace(key, /*invalidated=*/false);
+        pending_writes_++;
+    }
+    executor_->Add([this, key, block, local_path, writing_iter]() {
+        bool written = false;
+        {
+            std::ofstream out(local_path, std::ios::binary | std::ios::trunc);
+            written = static_cast<bool>(out.write(block->data(), block->size()));
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        bool invalidated = writing_iter->second;
+        writing_blocks_.erase(writing_iter);
+        if (written && !invalidated && disk_blocks_.find(key) == disk_blocks_.end()) {
+            disk_lru_.push_front(key);
+            disk_blocks_.emplace(key, DiskBlock{local_path, static_cast<int64_t>(block->size()),
+                                                disk_lru_.begin()});
+            disk_size_ += block->size();
+            while (disk_size_ > max_disk_size_ && !disk_lru_.empty()) {
+                EraseDiskBlock(disk_blocks_.find(disk_lru_.back()));
+                disk_eviction_count_++;
+            }
+        } else {
+            std::remove(local_path.c_str());
+        }
+        pending_writes_--;
+        pending_writes_cv_.notify_all();
+    });
+}
+
+void BlockCache::PutMemoryBlock(const BlockKey& key, const std::shared_ptr<Bytes>& block) {
+    memory_lru_.push_front(key);
+    memory_blocks_[key] = MemoryBlock{block, memory_lru_.begin()};
+    memory_size_ += block->size();
+    // always keep the most recently used block, which is about to be read
+    while (memory_size_ > max_memory_size_ && memory_lru_.size() > 1) {
+        auto iter = memory_blocks_.find(memory_lru_.back());
+        memory_size_ -= iter->second.block->size();
+        memory_blocks_.erase(iter);
+        memory_lru_.pop_back();
+        memory_eviction_count_++;
+    }
+}
+
+void BlockCache::EraseDiskBlock(std::map<BlockKey, DiskBlock>::iterator iter) {
+    std::remove(iter->second.local_path.c_str());
+    disk_size_ -= iter->second.size;
+    disk_lru_.erase(iter->second.lru_iter);
+    disk_blocks_.erase(iter);
+}
+
+void BlockCache::Invalidate(const std::string& path_prefix) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    BlockKey start{path_prefix, 0, 0};
+    for (auto iter = memory_blocks_.lower_bound(start);
+         iter != memory_blocks_.end() && StringUtils::StartsWith(iter->first.path, path_prefix);) {
+        memory_size_ -= iter->second.block->size();
+        memory_lru_.erase(iter->second.lru_iter);
+        iter = memory_blocks_.erase(iter);
+    }
+    for (auto iter = disk_blocks_.lower_bound(start);
+         iter != disk_blocks_.end() && StringUtils::StartsWith(iter->first.path, path_prefix);) {
+        EraseDiskBlock(iter++);
+    }
+    // the blocks being loaded or written of the files are dropped once they are done
+    for (auto iter = loading_blocks_.lower_bound(start);
+         iter != loading_blocks_.end() && StringUtils::StartsWith(iter->first.path, path_prefix);
+         ++iter) {
+        iter->second.invalidated = true;
+    }
+    for (auto iter = writing_blocks_.lower_bound(start);
+         iter != writing_blocks_.end() && StringUtils::StartsWith(iter->first.path, path_prefix);
+         ++iter) {
+        iter->second = true;
+    }
+}
+
+std::optional<uint64_t> BlockCache::GetCachedFileLength(const std::string& path) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    BlockKey start{path, 0, 0};
+    auto memory_iter = memory_blocks_.lower_bound(start);
+    if (memory_iter != memory_blocks_.end() && memory_iter->first.path == path) {
+        return memory_iter->first.file_length;
+    }
+    auto disk_iter = disk_blocks_.lower_bound(start);
+    if (disk_iter != disk_blocks_.end() && disk_iter->first.path == path) {
+        return disk_iter->first.file_length;
+    }
+    return std::nullopt;
+}
+
+void BlockCache::WaitPendingWrites() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    pending_writes_cv_.wait(lock, [this]() { return pending_writes_ == 0; });
+}
+
+int64_t BlockCache::MemorySize() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return memory_size_;
+}
+
+int64_t BlockCache::DiskSize() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return disk_size_;
+}
+
+std::shared_ptr<Metrics> BlockCache::GetMetrics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto metrics = std::make_shared<MetricsImpl>();
+    metrics->SetCounter(BlockCacheMetrics::BLOCK_CACHE_MEMORY_HIT_COUNT, memory_hit_count_);
+    metrics->SetCounter(BlockCacheMetrics::BLOCK_CACHE_DISK_HIT_COUNT, disk_hit_count_);
+    metrics->SetCounter(BlockCacheMetrics::BLOCK_CACHE_MISS_COUNT, miss_count_);
+    metrics->SetCounter(BlockCacheMetrics::BLOCK_CACHE_COALESCED_COUNT, coalesced_count_);
+    metrics->SetCounter(BlockCacheMetrics::BLOCK_CACHE_MEMORY_EVICTION_COUNT,
+                        memory_eviction_count_);
+    metrics->SetCounter(BlockCacheMetrics::BLOCK_CACHE_DISK_EVICTION_COUNT, disk_eviction_count_);
+    metrics->SetCounter(BlockCacheMetrics::BLOCK_CACHE_MEMORY_SIZE, memory_size_);
+    metrics->SetCounter(BlockCacheMetrics::BLOCK_CACHE_DISK_SIZE, disk_size_);
+    return metrics;
+}
+
+}  // namespace paimon
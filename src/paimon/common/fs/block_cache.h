@@ -0,0 +1,178 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <tuple>
+
+#include "paimon/memory/bytes.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace paimon {
+class Executor;
+class MemoryPool;
+class Metrics;
+
+class BlockCacheMetrics {
+ public:
+    static constexpr char BLOCK_CACHE_MEMORY_HIT_COUNT[] = "blockCacheMemoryHitCount";
+    static constexpr char BLOCK_CACHE_DISK_HIT_COUNT[] = "blockCacheDiskHitCount";
+    static constexpr char BLOCK_CACHE_MISS_COUNT[] = "blockCacheMissCount";
+    static constexpr char BLOCK_CACHE_COALESCED_COUNT[] = "blockCacheCoalescedCount";
+    static constexpr char BLOCK_CACHE_MEMORY_EVICTION_COUNT[] = "blockCacheMemoryEvictionCount";
+    static constexpr char BLOCK_CACHE_DISK_EVICTION_COUNT[] = "blockCacheDiskEvictionCount";
+    static constexpr char BLOCK_CACHE_MEMORY_SIZE[] = "blockCacheMemorySize";
+    static constexpr char BLOCK_CACHE_DISK_SIZE[] = "blockCacheDiskSize";
+};
+
+/// Identifies a fixed size block of an immutable file. The file length is part of the key, so
+/// that a file rewritten with another length never hits the blocks of the old one.
+struct BlockKey {
+    std::string path;
+    uint64_t file_length;
+    uint64_t index;
+
+    bool operator<(const BlockKey& other) const {
+        return std::tie(path, file_length, index) <
+               std::tie(other.path, other.file_length, other.index);
+    }
+};
+
+/// Caches fixed size blocks of immutable files in memory and on local disk. A block loaded from
+/// the remote file is kept in memory and written to the local disk asynchronously on the executor,
+/// a block evicted from memory is then read from the local disk until it is evicted from there as
+/// well. Both tiers evict the least recently used blocks once their byte budget is exceeded.
+/// Concurrent misses of the same block are coalesced into a single load. The cache is thread safe
+/// and can be shared by many file systems.
+class BlockCache {
+ public:
+    using Loader = std::function<Result<std::shared_ptr<Bytes>>()>;
+
+    /// @param local_dir Parent directory of the local blocks, a unique sub directory is created
+    /// for the cache and removed when the cache is destroyed. Use the system temporary directory
+    /// if empty.
+    /// @param executor Executor to write the local blocks, the disk tier is disabled if it is null
+    /// or max_disk_size is not positive.
+    static Result<std::shared_ptr<BlockCache>> Create(const std::string& local_dir,
+                                                      int64_t block_size, int64_t max_memory_size,
+                                                      int64_t max_disk_size,
+                                                      const std::shared_ptr<Executor>& executor,
+                                                      const std::shared_ptr<MemoryPool>& pool);
+
+    /// @return A process wide cache for the local directory and block size. The budgets of the
+    /// first call are used, the budgets of the later calls are ignored.
+    static Result<std::shared_ptr<BlockCache>> GetOrCreateShared(const std::string& local_dir,
+                                                                 int64_t block_size,
+                                                                 int64_t max_memory_size,
+                                                                 int64_t max_disk_size);
+
+    ~BlockCache();
+
+    /// @return The cached block, or the block loaded by `loader` on miss.
+    Result<std::shared_ptr<Bytes>> GetOrLoad(const BlockKey& key, const Loader& loader);
+
+    /// Drops the blocks of the files whose path starts with `path_prefix`.
+    void Invalidate(const std::string& path_prefix);
+
+    /// @return The length of the file if any block of it is cached in memory or on disk, so
+    /// that a file whose blocks are all cached is read without accessing the remote file.
+    std::optional<uint64_t> GetCachedFileLength(const std::string& path) const;
+
+    /// Waits until the pending writes of local blocks are done.
+    void WaitPendingWrites();
+
+    int64_t BlockSize() const {
+        return block_size_;
+    }
+    MemoryPool* GetPool() const {
+        return pool_.get();
+    }
+    int64_t MemorySize() const;
+    int64_t DiskSize() const;
+
+    std::shared_ptr<Metrics> GetMetrics() const;
+
+ private:
+    using LruList = std::list<BlockKey>;
+    struct MemoryBlock {
+        std::shared_ptr<Bytes> block;
+        LruList::iterator lru_iter;
+    };
+    struct DiskBlock {
+        std::string local_path;
+        int64_t size;
+        LruList::iterator lru_iter;
+    };
+    struct LoadingBlock {
+        std::shared_future<Result<std::shared_ptr<Bytes>>> future;
+        // set if the file is invalidated during the load, then the block is not cached
+        bool invalidated = false;
+    };
+    // block key -> whether the file is invalidated during the write of the local block
+    using WritingBlocks = std::multimap<BlockKey, bool>;
+
+    BlockCache(const std::string& cache_dir, int64_t block_size, int64_t max_memory_size,
+               int64_t max_disk_size, const std::shared_ptr<Executor>& executor,
+               const std::shared_ptr<MemoryPool>& pool);
+
+    Result<std::shared_ptr<Bytes>> ReadLocalBlock(const std::string& local_path,
+                                                  int64_t size) const;
+    void WriteLocalBlockAsync(const BlockKey& key, const std::shared_ptr<Bytes>& block);
+
+    void PutMemoryBlock(const BlockKey& key, const std::shared_ptr<Bytes>& block);
+    void EraseDiskBlock(std::map<BlockKey, DiskBlock>::iterator iter);
+
+ private:
+    std::string cache_dir_;
+    int64_t block_size_;
+    int64_t max_memory_size_;
+    int64_t max_disk_size_;
+    std::shared_ptr<Executor> executor_;
+    std::shared_ptr<MemoryPool> pool_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable pending_writes_cv_;
+    // the most recently used block is at the front
+    LruList memory_lru_;
+    std::map<BlockKey, MemoryBlock> memory_blocks_;
+    LruList disk_lru_;
+    std::map<BlockKey, DiskBlock> disk_blocks_;
+    std::map<BlockKey, LoadingBlock> loading_blocks_;
+    WritingBlocks writing_blocks_;
+    int64_t memory_size_ = 0;
+    int64_t disk_size_ = 0;
+    int32_t pending_writes_ = 0;
+    uint64_t local_block_id_ = 0;
+    uint64_t memory_hit_count_ = 0;
+    uint64_t disk_hit_count_ = 0;
+    uint64_t miss_count_ = 0;
+    uint64_t coalesced_count_ = 0;
+    uint64_t memory_eviction_count_ = 0;
+    uint64_t disk_eviction_count_ = 0;
+};
+
+}  // namespace paimon
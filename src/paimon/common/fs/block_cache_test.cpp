@@ -0,0 +1,226 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/fs/block_cache.h"
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "paimon/executor.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/metrics.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+class BlockCacheTest : public testing::Test {
+ public:
+    void SetUp() override {
+        dir_ = UniqueTestDirectory::Create();
+        ASSERT_TRUE(dir_);
+        pool_ = GetDefaultPool();
+        executor_ = CreateDefaultExecutor(/*thread_count=*/2);
+    }
+
+    BlockCache::Loader CreateLoader(const std::string& content) {
+        return [this, content]() -> Result<std::shared_ptr<Bytes>> {
+            load_count_++;
+            return std::make_shared<Bytes>(content, pool_.get());
+        };
+    }
+
+    static uint64_t GetCounter(const BlockCache& cache, const std::string& name) {
+        return cache.GetMetrics()->GetCounter(name).value();
+    }
+
+ protected:
+    std::unique_ptr<UniqueTestDirectory> dir_;
+    std::shared_ptr<MemoryPool> pool_;
+    std::shared_ptr<Executor> executor_;
+    std::atomic<int32_t> load_count_ = 0;
+};
+
+TEST_F(BlockCacheTest, TestMemoryTier) {
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<BlockCache> cache,
+                         BlockCache::Create(dir_->Str(), /*block_size=*/4, /*max_memory_size=*/8,
+                                            /*max_disk_size=*/0, executor_, pool_));
+    BlockKey key0{"/t/data-0.orc", 12, 0};
+    BlockKey key1{"/t/data-0.orc", 12, 1};
+    BlockKey key2{"/t/data-0.orc", 12, 2};
+    ASSERT_OK_AND_ASSIGN(auto block, cache->GetOrLoad(key0, CreateLoader("abcd")));
+    ASSERT_EQ("abcd", std::string(block->data(), block->size()));
+    ASSERT_OK_AND_ASSIGN(block, cache->GetOrLoad(key0, CreateLoader("xxxx")));
+    ASSERT_EQ("abcd", std::string(block->data(), block->size()));
+    ASSERT_EQ(1, load_count_);
+    ASSERT_EQ(4, cache->MemorySize());
+
+    // key0 is the least recently used block when key2 is put
+    ASSERT_OK(cache->GetOrLoad(key1, CreateLoader("efgh")));
+    ASSERT_OK(cache->GetOrLoad(key2, CreateLoader("ijkl")));
+    ASSERT_EQ(8, cache->MemorySize());
+    ASSERT_OK_AND_ASSIGN(block, cache->GetOrLoad(key0, CreateLoader("abcd")));
+    ASSERT_EQ(4, load_count_);
+    ASSERT_OK(cache->GetOrLoad(key2, CreateLoader("ijkl")));
+    ASSERT_EQ(4, load_count_);
+    // the disk tier is disabled
+    cache->WaitPendingWrites();
+    ASSERT_EQ(0, cache->DiskSize());
+
+    ASSERT_EQ(2, GetCounter(*cache, BlockCacheMetrics::BLOCK_CACHE_MEMORY_HIT_COUNT));
+    ASSERT_EQ(4, GetCounter(*cache, BlockCacheMetrics::BLOCK_CACHE_MISS_COUNT));
+    ASSERT_EQ(2, GetCounter(*cache, BlockCacheMetrics::BLOCK_CACHE_MEMORY_EVICTION_COUNT));
+    ASSERT_EQ(8, GetCounter(*cache, BlockCacheMetrics::BLOCK_CACHE_MEMORY_SIZE));
+}
+
+TEST_F(BlockCacheTest, TestDiskTier) {
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<BlockCache> cache,
+                         BlockCache::Create(dir_->Str(), /*block_size=*/4, /*max_memory_size=*/4,
+                                            /*max_disk_size=*/8, executor_, pool_));
+    std::vector<BlockKey> keys = {{"/t/a", 12, 0}, {"/t/a", 12, 1}, {"/t/a", 12, 2}};
+    std::vector<std::string> contents = {"abcd", "efgh", "ijkl"};
+    for (size_t i = 0; i < keys.size(); i++) {
+        ASSERT_OK(cache->GetOrLoad(keys[i], CreateLoader(contents[i])));
+        cache->WaitPendingWrites();
+    }
+    ASSERT_EQ(3, load_count_);
+    ASSERT_EQ(4, cache->MemorySize());
+    // the first block is evicted from both tiers
+    ASSERT_EQ(8, cache->DiskSize());
+    ASSERT_EQ(1, GetCounter(*cache, BlockCacheMetrics::BLOCK_CACHE_DISK_EVICTION_COUNT));
+
+    ASSERT_OK_AND_ASSIGN(auto block, cache->GetOrLoad(keys[1], CreateLoader("xxxx")));
+    ASSERT_EQ("efgh", std::string(block->data(), block->size()));
+    ASSERT_EQ(3, load_count_);
+    ASSERT_EQ(1, GetCounter(*cache, BlockCacheMetrics::BLOCK_CACHE_DISK_HIT_COUNT));
+    ASSERT_OK_AND_ASSIGN(block, cache->GetOrLoad(keys[0], CreateLoader("abcd")));
+    ASSERT_EQ(4, load_count_);
+
+    std::string cache_dir = cache->cache_dir_;
+    ASSERT_TRUE(std::filesystem::exists(cache_dir));
+    cache.reset();
+    ASSERT_FALSE(std::filesystem::exists(cache_dir));
+}
+
+TEST_F(BlockCacheTest, TestInvalidate) {
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<BlockCache> cache,
+                         BlockCache::Create(dir_->Str(), /*block_size=*/4,
+                                            /*max_memory_size=*/1024, /*max_disk_size=*/1024,
+                                            executor_, pool_));
+    ASSERT_OK(cache->GetOrLoad({"/t/bucket-0/a", 4, 0}, CreateLoader("abcd")));
+    ASSERT_OK(cache->GetOrLoad({"/t/bucket-0/b", 4, 0}, CreateLoader("efgh")));
+    ASSERT_OK(cache->GetOrLoad({"/t/bucket-1/a", 4, 0}, CreateLoader("ijkl")));
+    cache->WaitPendingWrites();
+    ASSERT_EQ(12, cache->MemorySize());
+    ASSERT_EQ(12, cache->DiskSize());
+
+    cache->Invalidate("/t/bucket-0/");
+    ASSERT_EQ(4, cache->MemorySize());
+    ASSERT_EQ(4, cache->DiskSize());
+    ASSERT_OK_AND_ASSIGN(auto block,
+                         cache->GetOrLoad({"/t/bucket-0/a", 4, 0}, CreateLoader("mnop")));
+    ASSERT_EQ("mnop", std::string(block->data(), block->size()));
+    ASSERT_OK_AND_ASSIGN(block, cache->GetOrLoad({"/t/bucket-1/a", 4, 0}, CreateLoader("xxxx")));
+    ASSERT_EQ("ijkl", std::string(block->data(), block->size()));
+    ASSERT_EQ(4, load_count_);
+}
+
+TEST_F(BlockCacheTest, TestInvalidateDuringLoad) {
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<BlockCache> cache,
+                         BlockCache::Create(dir_->Str(), /*block_size=*/4,
+                                            /*max_memory_size=*/1024, /*max_disk_size=*/1024,
+                                            executor_, pool_));
+    // invalidating another file does not drop the block being loaded
+    BlockKey key{"/t/a", 4, 0};
+    auto loader = [&]() -> Result<std::shared_ptr<Bytes>> {
+        cache->Invalidate("/t/b");
+        return CreateLoader("abcd")();
+    };
+    ASSERT_OK(cache->GetOrLoad(key, loader));
+    cache->WaitPendingWrites();
+    ASSERT_EQ(4, cache->MemorySize());
+    ASSERT_EQ(4, cache->DiskSize());
+
+    // the block of a file invalidated during the load is returned but not cached
+    BlockKey invalidated_key{"/t/b", 4, 0};
+    auto invalidating_loader = [&]() -> Result<std::shared_ptr<Bytes>> {
+        cache->Invalidate("/t/b");
+        return CreateLoader("efgh")();
+    };
+    ASSERT_OK_AND_ASSIGN(auto block, cache->GetOrLoad(invalidated_key, invalidating_loader));
+    ASSERT_EQ("efgh", std::string(block->data(), block->size()));
+    cache->WaitPendingWrites();
+    ASSERT_EQ(4, cache->MemorySize());
+    ASSERT_EQ(4, cache->DiskSize());
+    ASSERT_OK(cache->GetOrLoad(invalidated_key, CreateLoader("efgh")));
+    ASSERT_EQ(3, load_count_);
+}
+
+TEST_F(BlockCacheTest, TestLoadError) {
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<BlockCache> cache,
+                         BlockCache::Create(dir_->Str(), /*block_size=*/4,
+                                            /*max_memory_size=*/1024, /*max_disk_size=*/1024,
+                                            executor_, pool_));
+    BlockKey key{"/t/a", 4, 0};
+    auto failed_loader = []() -> Result<std::shared_ptr<Bytes>> {
+        return Status::IOError("mock read error");
+    };
+    ASSERT_NOK_WITH_MSG(cache->GetOrLoad(key, failed_loader), "mock read error");
+    // a failed load is not cached
+    ASSERT_OK_AND_ASSIGN(auto block, cache->GetOrLoad(key, CreateLoader("abcd")));
+    ASSERT_EQ("abcd", std::string(block->data(), block->size()));
+    ASSERT_NOK_WITH_MSG(BlockCache::Create(dir_->Str(), /*block_size=*/0, 1024, 1024, executor_,
+                                           pool_),
+                        "invalid block size 0 for block cache");
+}
+
+TEST_F(BlockCacheTest, TestCoalesceConcurrentMisses) {
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<BlockCache> cache,
+                         BlockCache::Create(dir_->Str(), /*block_size=*/4,
+                                            /*max_memory_size=*/1024, /*max_disk_size=*/0,
+                                            executor_, pool_));
+    BlockKey key{"/t/a", 4, 0};
+    auto slow_loader = [this]() -> Result<std::shared_ptr<Bytes>> {
+        load_count_++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        return std::make_shared<Bytes>("abcd", pool_.get());
+    };
+    std::vector<std::thread> threads;
+    std::atomic<int32_t> ok_count = 0;
+    for (int32_t i = 0; i < 8; i++) {
+        threads.emplace_back([&]() {
+            auto block = cache->GetOrLoad(key, slow_loader);
+            if (block.ok() && std::string(block.value()->data(), 4) == "abcd") {
+                ok_count++;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(8, ok_count);
+    ASSERT_EQ(1, load_count_);
+    ASSERT_EQ(1, GetCounter(*cache, BlockCacheMetrics::BLOCK_CACHE_MISS_COUNT));
+    ASSERT_EQ(7, GetCounter(*cache, BlockCacheMetrics::BLOCK_CACHE_COALESCED_COUNT) +
+                     GetCounter(*cache, BlockCacheMetrics::BLOCK_CACHE_MEMORY_HIT_COUNT));
+}
+
+}  // namespace paimon::test
@@ -0,0 +1,220 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/fs/caching_file_system.h"
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "fmt/format.h"
+#include "paimon/common/utils/path_util.h"
+#include "paimon/common/utils/string_utils.h"
+
+namespace paimon {
+
+CachingFileSystem::CachingFileSystem(const std::shared_ptr<FileSystem>& fs,
+                                     const std::shared_ptr<BlockCache>& cache)
+    : fs_(fs), cache_(cache) {}
+
+bool CachingFileSystem::IsCacheable(const std::string& path) {
+    // only the files of a table which are never rewritten are cached, e.g., hint files and
+    // consumer progress files are updated in place
+    static const std::vector<std::string> immutable_prefixes = {
+        "data-",   "changelog-", "manifest-",        "index-",
+        "snapshot-", "schema-",  "partition-stats-", "stats-"};
+    std::string name = PathUtil::GetName(path);
+    for (const auto& prefix : immutable_prefixes) {
+        if (StringUtils::StartsWith(name, prefix)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+Result<std::unique_ptr<InputStream>> CachingFileSystem::Open(const std::string& path) const {
+    if (!IsCacheable(path)) {
+        return fs_->Open(path);
+    }
+    std::optional<uint64_t> cached_length = cache_->GetCachedFileLength(path);
+    if (cached_length) {
+        // the underlying file is opened only if any block misses
+        return std::make_unique<CachingInputStream>(path, cached_length.value(),
+                                                    /*in=*/nullptr, fs_, cache_);
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<InputStream> in, fs_->Open(path));
+    PAIMON_ASSIGN_OR_RAISE(uint64_t length, in->Length());
+    return std::make_unique<CachingInputStream>(path, length, std::move(in), fs_, cache_);
+}
+
+Result<std::unique_ptr<OutputStream>> CachingFileSystem::Create(const std::string& path,
+                                                                bool overwrite) const {
+    if (overwrite) {
+        cache_->Invalidate(path);
+    }
+    return fs_->Create(path, overwrite);
+}
+
+Status CachingFileSystem::Mkdirs(const std::string& path) const {
+    return fs_->Mkdirs(path);
+}
+
+Status CachingFileSystem::Rename(const std::string& src, const std::string& dst) const {
+    cache_->Invalidate(src);
+    cache_->Invalidate(dst);
+    return fs_->Rename(src, dst);
+}
+
+Status CachingFileSystem::Delete(const std::string& path, bool recursive) const {
+    cache_->Invalidate(path);
+    return fs_->Delete(path, recursive);
+}
+
+Result<std::unique_ptr<FileStatus>> CachingFileSystem::GetFileStatus(
+    const std::string& path) const {
+    return fs_->GetFileStatus(path);
+}
+
+Status CachingFileSystem::ListDir(
+    const std::string& directory,
+    std::vector<std::unique_ptr<BasicFileStatus>>* file_status_list) const {
+    return fs_->ListDir(directory, file_status_list);
+}
+
+Status CachingFileSystem::ListFileStatus(
+    const std::string& path, std::vector<std::unique_ptr<FileStatus>>* file_status_list) const {
+    return fs_->ListFileStatus(path, file_status_list);
+}
+
+Result<bool> CachingFileSystem::Exists(const std::string& path) const {
+    return fs_->Exists(path);
+}
+
+std::shared_ptr<Metrics> CachingFileSystem::GetMetrics() const {
+    return cache_->GetMetrics();
+}
+
+CachingInputStream::CachingInputStream(const std::string& path, uint64_t length,
+                                       std::unique_ptr<InputStream>&& in,
+                                       const std::shared_ptr<FileSystem>& fs,
+                                       const std::shared_ptr<BlockCache>& cache)
+    : path_(path), length_(length), in_(std::move(in)), fs_(fs), cache_(cache) {}
+
+Status CachingInputStream::Seek(int64_t offset, SeekOrigin origin) {
+    int64_t position = 0;
+    switch (origin) {
+        case FS_SEEK_SET:
+            position = offset;
+            break;
+        case FS_SEEK_CUR:
+            position = position_ + offset;
+            break;
+        case FS_SEEK_END:
+            position = static_cast<int64_t>(length_) + offset;
+            break;
+        default:
+            return Status::Invalid(
+                "invalid SeekOrigin, only support FS_SEEK_SET, FS_SEEK_CUR, and FS_SEEK_END");
+    }
+    if (position < 0) {
+        return Status::Invalid(fmt::format("seek file '{}' to negative position {}", path_,
+                                           position));
+    }
+    position_ = position;
+    return Status::OK();
+}
+
+Result<int64_t> CachingInputStream::GetPos() const {
+    return position_;
+}
+
+Result<int32_t> CachingInputStream::Read(char* buffer, uint32_t size) {
+    PAIMON_ASSIGN_OR_RAISE(int32_t read_length, Read(buffer, size, position_));
+    position_ += read_length;
+    return read_length;
+}
+
+Result<int32_t> CachingInputStream::Read(char* buffer, uint32_t size, uint64_t offset) {
+    if (offset + size > length_) {
+        return Status::IOError(fmt::format("read file '{}' from {} with size {} exceeds length {}",
+                                           path_, offset, size, length_));
+    }
+    auto block_size = static_cast<uint64_t>(cache_->BlockSize());
+    uint64_t end = offset + size;
+    while (offset < end) {
+        uint64_t index = offset / block_size;
+        PAIMON_ASSIGN_OR_RAISE(
+            std::shared_ptr<Bytes> block,
+            cache_->GetOrLoad(BlockKey{path_, length_, index}, [&]() { return LoadBlock(index); }));
+        uint64_t block_offset = offset - index * block_size;
+        uint64_t copy_length = std::min<uint64_t>(end - offset, block->size() - block_offset);
+        std::memcpy(buffer, block->data() + block_offset, copy_length);
+        buffer += copy_length;
+        offset += copy_length;
+    }
+    return static_cast<int32_t>(size);
+}
+
+Result<std::shared_ptr<Bytes>> CachingInputStream::LoadBlock(uint64_t index) {
+    auto block_size = static_cast<uint64_t>(cache_->BlockSize());
+    uint64_t block_offset = index * block_size;
+    uint64_t block_length = std::min(block_size, length_ - block_offset);
+    auto block = std::make_shared<Bytes>(block_length, cache_->GetPool());
+    std::lock_guard<std::mutex> lock(in_mutex_);
+    if (!in_) {
+        PAIMON_ASSIGN_OR_RAISE(in_, fs_->Open(path_));
+    }
+    uint64_t read_length = 0;
+    while (read_length < block_length) {
+        auto remaining = static_cast<uint32_t>(block_length - read_length);
+        PAIMON_ASSIGN_OR_RAISE(int32_t length, in_->Read(block->data() + read_length, remaining,
+                                                         block_offset + read_length));
+        if (length <= 0) {
+            return Status::IOError(fmt::format("read block {} of file '{}' fail, unexpected eof",
+                                               index, path_));
+        }
+        read_length += length;
+    }
+    return block;
+}
+
+void CachingInputStream::ReadAsync(char* buffer, uint32_t size, uint64_t offset,
+                                   std::function<void(Status)>&& callback) {
+    Result<int32_t> read_size = Read(buffer, size, offset);
+    callback(read_size.status());
+}
+
+Result<std::string> CachingInputStream::GetUri() const {
+    // the underlying file may not be opened
+    return path_;
+}
+
+Result<uint64_t> CachingInputStream::Length() const {
+    return length_;
+}
+
+Status CachingInputStream::Close() {
+    std::lock_guard<std::mutex> lock(in_mutex_);
+    if (!in_) {
+        return Status::OK();
+    }
+    return in_->Close();
+}
+
+}  // namespace paimon
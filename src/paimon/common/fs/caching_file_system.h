@@ -0,0 +1,112 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "paimon/common/fs/block_cache.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace paimon {
+
+/// A `FileSystem` decorator that reads files through a `BlockCache`, so that the footers,
+/// manifests, indexes and hot column chunks read by repeated queries are not downloaded from the
+/// underlying file system again. Only the immutable files of a table are cached, see
+/// `IsCacheable()`, the other files are always read from the underlying file system. A cached
+/// file whose blocks are all cached is read without accessing the underlying file system, even
+/// if it has been deleted by others. The blocks of a file are invalidated when it is
+/// overwritten, renamed or deleted through this file system.
+class CachingFileSystem : public FileSystem {
+ public:
+    CachingFileSystem(const std::shared_ptr<FileSystem>& fs,
+                      const std::shared_ptr<BlockCache>& cache);
+    ~CachingFileSystem() override = default;
+
+    Result<std::unique_ptr<InputStream>> Open(const std::string& path) const override;
+    Result<std::unique_ptr<OutputStream>> Create(const std::string& path,
+                                                 bool overwrite) const override;
+
+    Status Mkdirs(const std::string& path) const override;
+    Status Rename(const std::string& src, const std::string& dst) const override;
+    Status Delete(const std::string& path, bool recursive = true) const override;
+    Result<std::unique_ptr<FileStatus>> GetFileStatus(const std::string& path) const override;
+    Status ListDir(const std::string& directory,
+                   std::vector<std::unique_ptr<BasicFileStatus>>* file_status_list) const override;
+    Status ListFileStatus(
+        const std::string& path,
+        std::vector<std::unique_ptr<FileStatus>>* file_status_list) const override;
+    Result<bool> Exists(const std::string& path) const override;
+
+    const std::shared_ptr<BlockCache>& GetCache() const {
+        return cache_;
+    }
+
+    /// @return The metrics of the block cache, see `BlockCacheMetrics` for the names. The cache
+    /// may be shared by other file systems of the process. The table writers also report them
+    /// along with the write metrics.
+    std::shared_ptr<Metrics> GetMetrics() const;
+
+    /// @return Whether the file is write-once by its name, i.e., a data, changelog, manifest,
+    /// index, snapshot, schema or statistics file.
+    static bool IsCacheable(const std::string& path);
+
+ private:
+    std::shared_ptr<FileSystem> fs_;
+    std::shared_ptr<BlockCache> cache_;
+};
+
+/// An `InputStream` that reads the blocks of an immutable file from a `BlockCache`, and loads the
+/// missing blocks from the underlying stream.
+class CachingInputStream : public InputStream {
+ public:
+    /// @param in The underlying stream, if null it is opened by `fs` on the first missing block.
+    CachingInputStream(const std::string& path, uint64_t length,
+                       std::unique_ptr<InputStream>&& in, const std::shared_ptr<FileSystem>& fs,
+                       const std::shared_ptr<BlockCache>& cache);
+
+    Status Seek(int64_t offset, SeekOrigin origin) override;
+    Result<int64_t> GetPos() const override;
+    Result<int32_t> Read(char* buffer, uint32_t size) override;
+    Result<int32_t> Read(char* buffer, uint32_t size, uint64_t offset) override;
+    void ReadAsync(char* buffer, uint32_t size, uint64_t offset,
+                   std::function<void(Status)>&& callback) override;
+    Result<std::string> GetUri() const override;
+    Result<uint64_t> Length() const override;
+    Status Close() override;
+
+ private:
+    Result<std::shared_ptr<Bytes>> LoadBlock(uint64_t index);
+
+ private:
+    std::string path_;
+    uint64_t length_;
+    int64_t position_ = 0;
+    // guards the underlying stream, blocks may be loaded by concurrent positional reads
+    std::mutex in_mutex_;
+    std::unique_ptr<InputStream> in_;
+    std::shared_ptr<FileSystem> fs_;
+    std::shared_ptr<BlockCache> cache_;
+};
+
+}  // namespace paimon
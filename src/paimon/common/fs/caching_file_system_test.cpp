@@ -0,0 +1,280 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/fs/caching_file_system.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "paimon/common/utils/path_util.h"
+#include "paimon/executor.h"
+#include "paimon/fs/local/local_file_system.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/metrics.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+/// Delays and counts the positional reads of the underlying stream, to mock a remote file.
+class SlowInputStream : public InputStream {
+ public:
+    SlowInputStream(std::unique_ptr<InputStream>&& in, int32_t latency_ms,
+                    std::atomic<int32_t>* read_count)
+        : in_(std::move(in)), latency_ms_(latency_ms), read_count_(read_count) {}
+
+    Status Seek(int64_t offset, SeekOrigin origin) override {
+        return in_->Seek(offset, origin);
+    }
+    Result<int64_t> GetPos() const override {
+        return in_->GetPos();
+    }
+    Result<int32_t> Read(char* buffer, uint32_t size) override {
+        return in_->Read(buffer, size);
+    }
+    Result<int32_t> Read(char* buffer, uint32_t size, uint64_t offset) override {
+        (*read_count_)++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(latency_ms_));
+        return in_->Read(buffer, size, offset);
+    }
+    void ReadAsync(char* buffer, uint32_t size, uint64_t offset,
+                   std::function<void(Status)>&& callback) override {
+        callback(Read(buffer, size, offset).status());
+    }
+    Result<std::string> GetUri() const override {
+        return in_->GetUri();
+    }
+    Result<uint64_t> Length() const override {
+        return in_->Length();
+    }
+    Status Close() override {
+        return in_->Close();
+    }
+
+ private:
+    std::unique_ptr<InputStream> in_;
+    int32_t latency_ms_;
+    std::atomic<int32_t>* read_count_;
+};
+
+class SlowFileSystem : public LocalFileSystem {
+ public:
+    explicit SlowFileSystem(int32_t latency_ms) : latency_ms_(latency_ms) {}
+
+    Result<std::unique_ptr<InputStream>> Open(const std::string& path) const override {
+        open_count_++;
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<InputStream> in, LocalFileSystem::Open(path));
+        return std::make_unique<SlowInputStream>(std::move(in), latency_ms_, &read_count_);
+    }
+
+    int32_t ReadCount() const {
+        return read_count_;
+    }
+    int32_t OpenCount() const {
+        return open_count_;
+    }
+
+ private:
+    int32_t latency_ms_;
+    mutable std::atomic<int32_t> read_count_ = 0;
+    mutable std::atomic<int32_t> open_count_ = 0;
+};
+
+class CachingFileSystemTest : public testing::Test {
+ public:
+    void SetUp() override {
+        dir_ = UniqueTestDirectory::Create();
+        ASSERT_TRUE(dir_);
+        slow_fs_ = std::make_shared<SlowFileSystem>(/*latency_ms=*/10);
+        executor_ = CreateDefaultExecutor(/*thread_count=*/2);
+        content_.resize(10000);
+        for (size_t i = 0; i < content_.size(); i++) {
+            content_[i] = static_cast<char>(i * 31 % 251);
+        }
+        file_path_ = PathUtil::JoinPath(dir_->Str(), "bucket-0/data-0.orc");
+        ASSERT_OK(slow_fs_->WriteFile(file_path_, content_, /*overwrite=*/false));
+    }
+
+    std::shared_ptr<CachingFileSystem> CreateCachingFileSystem(int64_t max_memory_size,
+                                                               int64_t max_disk_size) const {
+        auto cache = BlockCache::Create(dir_->Str(), /*block_size=*/1024, max_memory_size,
+                                        max_disk_size, executor_, GetDefaultPool())
+                         .value();
+        return std::make_shared<CachingFileSystem>(slow_fs_, cache);
+    }
+
+    static std::string ReadRange(FileSystem* fs, const std::string& path, uint64_t offset,
+                                 uint32_t size) {
+        auto in = fs->Open(path).value();
+        std::string buffer(size, '\0');
+        EXPECT_TRUE(in->Read(buffer.data(), size, offset).ok());
+        return buffer;
+    }
+
+    static uint64_t GetCounter(const BlockCache& cache, const std::string& name) {
+        return cache.GetMetrics()->GetCounter(name).value();
+    }
+
+ protected:
+    std::unique_ptr<UniqueTestDirectory> dir_;
+    std::shared_ptr<SlowFileSystem> slow_fs_;
+    std::shared_ptr<Executor> executor_;
+    std::string content_;
+    std::string file_path_;
+};
+
+TEST_F(CachingFileSystemTest, TestRead) {
+    auto fs = CreateCachingFileSystem(/*max_memory_size=*/1024 * 1024, /*max_disk_size=*/0);
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<InputStream> in, fs->Open(file_path_));
+    ASSERT_TRUE(dynamic_cast<CachingInputStream*>(in.get()));
+    ASSERT_OK_AND_ASSIGN(uint64_t length, in->Length());
+    ASSERT_EQ(content_.size(), length);
+
+    // sequential reads across the block boundaries
+    std::string buffer(3000, '\0');
+    ASSERT_OK(in->Seek(500, FS_SEEK_SET));
+    ASSERT_OK(in->Read(buffer.data(), 3000));
+    ASSERT_EQ(content_.substr(500, 3000), buffer);
+    ASSERT_OK_AND_ASSIGN(int64_t pos, in->GetPos());
+    ASSERT_EQ(3500, pos);
+    ASSERT_OK(in->Seek(-100, FS_SEEK_END));
+    ASSERT_OK(in->Read(buffer.data(), 100));
+    ASSERT_EQ(content_.substr(9900), buffer.substr(0, 100));
+    // block 0, 1, 2, 3 and 9 are loaded
+    ASSERT_EQ(5, slow_fs_->ReadCount());
+
+    ASSERT_EQ(content_, ReadRange(fs.get(), file_path_, 0, content_.size()));
+    ASSERT_EQ(10, slow_fs_->ReadCount());
+    ASSERT_EQ(content_.substr(1023, 2), ReadRange(fs.get(), file_path_, 1023, 2));
+    ASSERT_EQ(10, slow_fs_->ReadCount());
+
+    ASSERT_NOK_WITH_MSG(in->Read(buffer.data(), 100, 9950), "exceeds length 10000");
+    ASSERT_NOK_WITH_MSG(in->Seek(-1, FS_SEEK_SET), "seek file");
+    const auto& cache = fs->GetCache();
+    ASSERT_EQ(10, GetCounter(*cache, BlockCacheMetrics::BLOCK_CACHE_MISS_COUNT));
+    ASSERT_EQ(static_cast<int64_t>(content_.size()), cache->MemorySize());
+    ASSERT_OK(in->Close());
+}
+
+TEST_F(CachingFileSystemTest, TestOpenWithAllBlocksCached) {
+    auto fs = CreateCachingFileSystem(/*max_memory_size=*/1024 * 1024, /*max_disk_size=*/0);
+    ASSERT_EQ(content_.substr(0, 2000), ReadRange(fs.get(), file_path_, 0, 2000));
+    ASSERT_EQ(1, slow_fs_->OpenCount());
+
+    // the underlying file is not opened while the blocks read are cached
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<InputStream> in, fs->Open(file_path_));
+    ASSERT_OK_AND_ASSIGN(uint64_t length, in->Length());
+    ASSERT_EQ(content_.size(), length);
+    ASSERT_OK_AND_ASSIGN(std::string uri, in->GetUri());
+    ASSERT_EQ(file_path_, uri);
+    std::string buffer(2000, '\0');
+    ASSERT_OK(in->Read(buffer.data(), 2000, 0));
+    ASSERT_EQ(content_.substr(0, 2000), buffer);
+    ASSERT_EQ(1, slow_fs_->OpenCount());
+    ASSERT_EQ(2, slow_fs_->ReadCount());
+
+    // a missing block opens the underlying file once
+    ASSERT_OK(in->Read(buffer.data(), 2000, 4000));
+    ASSERT_EQ(content_.substr(4000, 2000), buffer);
+    ASSERT_OK(in->Read(buffer.data(), 2000, 6000));
+    ASSERT_EQ(content_.substr(6000, 2000), buffer);
+    ASSERT_EQ(2, slow_fs_->OpenCount());
+    ASSERT_OK(in->Close());
+
+    // the file length is not cached once all blocks of the file are invalidated
+    fs->GetCache()->Invalidate(file_path_);
+    ASSERT_FALSE(fs->GetCache()->GetCachedFileLength(file_path_));
+    ASSERT_EQ(content_.substr(0, 10), ReadRange(fs.get(), file_path_, 0, 10));
+    ASSERT_EQ(3, slow_fs_->OpenCount());
+    ASSERT_OK_AND_ASSIGN(uint64_t misses,
+                         fs->GetMetrics()->GetCounter(BlockCacheMetrics::BLOCK_CACHE_MISS_COUNT));
+    ASSERT_EQ(8, misses);
+}
+
+TEST_F(CachingFileSystemTest, TestReadFromDisk) {
+    // only one block is kept in memory, the others are read from local disk
+    auto fs = CreateCachingFileSystem(/*max_memory_size=*/1024, /*max_disk_size=*/1024 * 1024);
+    ASSERT_EQ(content_, ReadRange(fs.get(), file_path_, 0, content_.size()));
+    ASSERT_EQ(10, slow_fs_->ReadCount());
+    const auto& cache = fs->GetCache();
+    cache->WaitPendingWrites();
+    ASSERT_EQ(static_cast<int64_t>(content_.size()), cache->DiskSize());
+
+    ASSERT_EQ(content_, ReadRange(fs.get(), file_path_, 0, content_.size()));
+    ASSERT_EQ(10, slow_fs_->ReadCount());
+    ASSERT_EQ(10, GetCounter(*cache, BlockCacheMetrics::BLOCK_CACHE_DISK_HIT_COUNT));
+}
+
+TEST_F(CachingFileSystemTest, TestConcurrentReads) {
+    slow_fs_ = std::make_shared<SlowFileSystem>(/*latency_ms=*/100);
+    auto fs = CreateCachingFileSystem(/*max_memory_size=*/1024 * 1024, /*max_disk_size=*/0);
+    std::vector<std::thread> threads;
+    std::atomic<int32_t> ok_count = 0;
+    for (int32_t i = 0; i < 8; i++) {
+        threads.emplace_back([&, i]() {
+            if (ReadRange(fs.get(), file_path_, i * 100, 1000) == content_.substr(i * 100, 1000)) {
+                ok_count++;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(8, ok_count);
+    // the concurrent misses of block 0 and 1 are coalesced
+    ASSERT_EQ(2, slow_fs_->ReadCount());
+}
+
+TEST_F(CachingFileSystemTest, TestInvalidate) {
+    auto fs = CreateCachingFileSystem(/*max_memory_size=*/1024 * 1024, /*max_disk_size=*/0);
+    ASSERT_EQ(content_.substr(0, 10), ReadRange(fs.get(), file_path_, 0, 10));
+    std::string new_content(content_.size(), 'a');
+    ASSERT_OK(fs->WriteFile(file_path_, new_content, /*overwrite=*/true));
+    ASSERT_EQ(new_content.substr(0, 10), ReadRange(fs.get(), file_path_, 0, 10));
+
+    ASSERT_OK(fs->Delete(PathUtil::JoinPath(dir_->Str(), "bucket-0")));
+    ASSERT_EQ(0, fs->GetCache()->MemorySize());
+    ASSERT_OK(slow_fs_->WriteFile(file_path_, content_, /*overwrite=*/false));
+    ASSERT_EQ(content_.substr(0, 10), ReadRange(fs.get(), file_path_, 0, 10));
+}
+
+TEST_F(CachingFileSystemTest, TestHintFileNotCached) {
+    auto fs = CreateCachingFileSystem(/*max_memory_size=*/1024 * 1024, /*max_disk_size=*/0);
+    std::string hint_path = PathUtil::JoinPath(dir_->Str(), "snapshot/LATEST");
+    ASSERT_OK(fs->WriteFile(hint_path, "1", /*overwrite=*/false));
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<InputStream> in, fs->Open(hint_path));
+    ASSERT_FALSE(dynamic_cast<CachingInputStream*>(in.get()));
+    ASSERT_TRUE(CachingFileSystem::IsCacheable(file_path_));
+    ASSERT_FALSE(CachingFileSystem::IsCacheable(hint_path));
+    for (const char* path :
+         {"/t/bucket-0/changelog-a-0.orc", "/t/manifest/manifest-a-0",
+          "/t/manifest/manifest-list-a-0", "/t/manifest/index-manifest-a-0", "/t/index/index-a-0",
+          "/t/snapshot/snapshot-1", "/t/schema/schema-0", "/t/statistics/partition-stats-a-0"}) {
+        ASSERT_TRUE(CachingFileSystem::IsCacheable(path)) << path;
+    }
+    // mutable files are not cached
+    for (const char* path : {"/t/snapshot/EARLIEST", "/t/changelog/LATEST",
+                             "/t/consumer/consumer-a", "/t/tag/tag-a"}) {
+        ASSERT_FALSE(CachingFileSystem::IsCacheable(path)) << path;
+    }
+}
+
+}  // namespace paimon::test
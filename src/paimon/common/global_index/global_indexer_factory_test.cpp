@@ -20,6 +20,7 @@
 
 #include "gtest/gtest.h"
 #include "paimon/common/global_index/bitmap/bitmap_global_index.h"
+#include "paimon/common/global_index/sorted/sorted_global_index.h"
 #include "paimon/testing/utils/testharness.h"
 
 namespace paimon::test {
@@ -30,6 +31,10 @@ TEST(GlobalIndexerFactoryTest, TestSimple) {
 
     auto bitmap_global_index = dynamic_cast<BitmapGlobalIndex*>(indexer.get());
     ASSERT_TRUE(bitmap_global_index);
+
+    ASSERT_OK_AND_ASSIGN(indexer, GlobalIndexerFactory::Get("sorted", options));
+    auto sorted_global_index = dynamic_cast<SortedGlobalIndex*>(indexer.get());
+    ASSERT_TRUE(sorted_global_index);
 }
 
 TEST(GlobalIndexerFactoryTest, TestNonExist) {
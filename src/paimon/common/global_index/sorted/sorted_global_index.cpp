@@ -0,0 +1,618 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/global_index/sorted/sorted_global_index.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+
+#include "arrow/c/bridge.h"
+#include "fmt/format.h"
+#include "paimon/common/file_index/bitmap/bitmap_file_index.h"
+#include "paimon/common/io/memory_segment_output_stream.h"
+#include "paimon/common/predicate/literal_converter.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/common/utils/delta_varint_compressor.h"
+#include "paimon/common/utils/field_type_utils.h"
+#include "paimon/common/utils/options_utils.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/global_index/bitmap_global_index_result.h"
+#include "paimon/global_index/io/global_index_file_reader.h"
+#include "paimon/global_index/io/global_index_file_writer.h"
+#include "paimon/io/byte_array_input_stream.h"
+#include "paimon/io/data_input_stream.h"
+
+namespace paimon {
+namespace {
+Status CheckKeyType(FieldType key_type) {
+    switch (key_type) {
+        case FieldType::TINYINT:
+        case FieldType::SMALLINT:
+        case FieldType::INT:
+        case FieldType::DATE:
+        case FieldType::BIGINT:
+        case FieldType::FLOAT:
+        case FieldType::DOUBLE:
+        case FieldType::STRING:
+        case FieldType::BINARY:
+            return Status::OK();
+        default:
+            return Status::Invalid(fmt::format("sorted global index does not support type {}",
+                                               FieldTypeUtils::FieldTypeToString(key_type)));
+    }
+}
+
+Result<FieldType> GetKeyType(const std::shared_ptr<arrow::DataType>& arrow_type) {
+    PAIMON_ASSIGN_OR_RAISE(FieldType data_type,
+                           FieldTypeUtils::ConvertToFieldType(arrow_type->id()));
+    FieldType key_type = BitmapFileIndex::ConvertType(data_type);
+    PAIMON_RETURN_NOT_OK(CheckKeyType(key_type));
+    return key_type;
+}
+
+Status WriteSegments(const MemorySegmentOutputStream& segments, OutputStream* out) {
+    int64_t remaining = segments.CurrentSize();
+    for (const auto& segment : segments.Segments()) {
+        auto length = static_cast<int32_t>(std::min<int64_t>(remaining, segment.Size()));
+        if (length == 0) {
+            break;
+        }
+        PAIMON_ASSIGN_OR_RAISE(int32_t actual_length,
+                               out->Write(segment.GetArray()->data(), length));
+        if (actual_length != length) {
+            return Status::IOError(fmt::format("expect write len {} mismatch actual write len {}",
+                                               length, actual_length));
+        }
+        remaining -= length;
+    }
+    return Status::OK();
+}
+}  // namespace
+
+Result<std::shared_ptr<GlobalIndexWriter>> SortedGlobalIndex::CreateWriter(
+    const std::string& field_name, ::ArrowSchema* c_arrow_schema,
+    const std::shared_ptr<GlobalIndexFileWriter>& file_writer,
+    const std::shared_ptr<MemoryPool>& pool) const {
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Schema> arrow_schema,
+                                      arrow::ImportSchema(c_arrow_schema));
+    auto arrow_field = arrow_schema->GetFieldByName(field_name);
+    if (!arrow_field) {
+        return Status::Invalid(
+            fmt::format("field {} not in arrow_schema for SortedGlobalIndexWriter", field_name));
+    }
+    return SortedGlobalIndexWriter::Create(arrow_field, options_, file_writer, pool);
+}
+
+Result<std::shared_ptr<GlobalIndexReader>> SortedGlobalIndex::CreateReader(
+    ::ArrowSchema* c_arrow_schema, const std::shared_ptr<GlobalIndexFileReader>& file_reader,
+    const std::vector<GlobalIndexIOMeta>& files, const std::shared_ptr<MemoryPool>& pool) const {
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Schema> arrow_schema,
+                                      arrow::ImportSchema(c_arrow_schema));
+    if (arrow_schema->num_fields() != 1) {
+        return Status::Invalid(
+            "invalid schema for SortedGlobalIndexReader, supposed to have single field.");
+    }
+    if (files.size() != 1) {
+        return Status::Invalid(
+            "invalid GlobalIndexIOMeta for SortedGlobalIndex, exist multiple metas");
+    }
+    const auto& meta = files[0];
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<InputStream> in,
+                           file_reader->GetInputStream(meta.file_name));
+    return SortedGlobalIndexReader::Create(arrow_schema->field(0)->type(), in, meta.range_end,
+                                           pool);
+}
+
+void SortedGlobalIndex::WriteKey(FieldType type, const Literal& key,
+                                 MemorySegmentOutputStream* out) {
+    switch (type) {
+        case FieldType::TINYINT:
+            out->WriteValue<int8_t>(key.GetValue<int8_t>());
+            break;
+        case FieldType::SMALLINT:
+            out->WriteValue<int16_t>(key.GetValue<int16_t>());
+            break;
+        case FieldType::DATE:
+        case FieldType::INT:
+            out->WriteValue<int32_t>(key.GetValue<int32_t>());
+            break;
+        case FieldType::BIGINT:
+            out->WriteValue<int64_t>(key.GetValue<int64_t>());
+            break;
+        case FieldType::FLOAT: {
+            auto value = key.GetValue<float>();
+            int32_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(bits));
+            out->WriteValue<int32_t>(bits);
+            break;
+        }
+        case FieldType::DOUBLE: {
+            auto value = key.GetValue<double>();
+            int64_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(bits));
+            out->WriteValue<int64_t>(bits);
+            break;
+        }
+        case FieldType::STRING:
+        case FieldType::BINARY: {
+            auto value = key.GetValue<std::string>();
+            out->WriteValue<int32_t>(static_cast<int32_t>(value.size()));
+            out->Write(value.data(), value.size());
+            break;
+        }
+        default:
+            assert(false);
+    }
+}
+
+Result<Literal> SortedGlobalIndex::ReadKey(FieldType type, const DataInputStream& in,
+                                           MemoryPool* pool) {
+    switch (type) {
+        case FieldType::TINYINT: {
+            PAIMON_ASSIGN_OR_RAISE(int8_t value, in.ReadValue<int8_t>());
+            return Literal(value);
+        }
+        case FieldType::SMALLINT: {
+            PAIMON_ASSIGN_OR_RAISE(int16_t value, in.ReadValue<int16_t>());
+            return Literal(value);
+        }
+        case FieldType::DATE: {
+            PAIMON_ASSIGN_OR_RAISE(int32_t value, in.ReadValue<int32_t>());
+            return Literal(FieldType::DATE, value);
+        }
+        case FieldType::INT: {
+            PAIMON_ASSIGN_OR_RAISE(int32_t value, in.ReadValue<int32_t>());
+            return Literal(value);
+        }
+        case FieldType::BIGINT: {
+            PAIMON_ASSIGN_OR_RAISE(int64_t value, in.ReadValue<int64_t>());
+            return Literal(value);
+        }
+        case FieldType::FLOAT: {
+            PAIMON_ASSIGN_OR_RAISE(int32_t bits, in.ReadValue<int32_t>());
+            float value = 0;
+            std::memcpy(&value, &bits, sizeof(value));
+            return Literal(value);
+        }
+        case FieldType::DOUBLE: {
+            PAIMON_ASSIGN_OR_RAISE(int64_t bits, in.ReadValue<int64_t>());
+            double value = 0;
+            std::memcpy(&value, &bits, sizeof(value));
+            return Literal(value);
+        }
+        case FieldType::STRING:
+        case FieldType::BINARY: {
+            PAIMON_ASSIGN_OR_RAISE(int32_t length, in.ReadValue<int32_t>());
+            if (length < 0) {
+                return Status::Invalid(
+                    fmt::format("invalid key length {} in sorted global index", length));
+            }
+            Bytes bytes(length, pool);
+            PAIMON_RETURN_NOT_OK(in.ReadBytes(&bytes));
+            return Literal(type, bytes.data(), bytes.size());
+        }
+        default:
+            return Status::Invalid(fmt::format("sorted global index does not support type {}",
+                                               FieldTypeUtils::FieldTypeToString(type)));
+    }
+}
+
+Result<std::shared_ptr<SortedGlobalIndexWriter>> SortedGlobalIndexWriter::Create(
+    const std::shared_ptr<arrow::Field>& arrow_field,
+    const std::map<std::string, std::string>& options,
+    const std::shared_ptr<GlobalIndexFileWriter>& file_writer,
+    const std::shared_ptr<MemoryPool>& pool) {
+    PAIMON_ASSIGN_OR_RAISE(FieldType key_type, GetKeyType(arrow_field->type()));
+    PAIMON_ASSIGN_OR_RAISE(int32_t block_size, OptionsUtils::GetValueFromMap<int32_t>(
+                                                   options, SortedGlobalIndex::BLOCK_SIZE,
+                                                   SortedGlobalIndex::DEFAULT_BLOCK_SIZE));
+    if (block_size <= 0) {
+        return Status::Invalid(
+            fmt::format("invalid block size {} for sorted global index, supposed to be positive",
+                        block_size));
+    }
+    return std::shared_ptr<SortedGlobalIndexWriter>(
+        new SortedGlobalIndexWriter(arrow_field, key_type, block_size, file_writer, pool));
+}
+
+SortedGlobalIndexWriter::SortedGlobalIndexWriter(
+    const std::shared_ptr<arrow::Field>& arrow_field, FieldType key_type, int32_t block_size,
+    const std::shared_ptr<GlobalIndexFileWriter>& file_writer,
+    const std::shared_ptr<MemoryPool>& pool)
+    : struct_type_(arrow::struct_({arrow_field})),
+      arrow_type_(arrow_field->type()),
+      key_type_(key_type),
+      block_size_(block_size),
+      file_writer_(file_writer),
+      pool_(pool) {}
+
+Status SortedGlobalIndexWriter::AddBatch(::ArrowArray* batch) {
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> arrow_array,
+                                      arrow::ImportArray(batch, struct_type_));
+    auto struct_array = std::dynamic_pointer_cast<arrow::StructArray>(arrow_array);
+    if (!struct_array || struct_array->num_fields() != 1) {
+        return Status::Invalid(
+            "invalid batch for SortedGlobalIndexWriter, supposed to be struct array with single "
+            "field.");
+    }
+    PAIMON_ASSIGN_OR_RAISE(
+        std::vector<Literal> values,
+        LiteralConverter::ConvertLiteralsFromArray(*(struct_array->field(0)), /*own_data=*/true));
+    for (const auto& value : values) {
+        if (value.IsNull()) {
+            null_bitmap_.Add(row_number_);
+        } else {
+            PAIMON_ASSIGN_OR_RAISE(Literal key,
+                                   BitmapFileIndex::ConvertLiteral(value, arrow_type_));
+            key_to_row_ids_[key].push_back(row_number_);
+        }
+        row_number_++;
+    }
+    return Status::OK();
+}
+
+Result<std::vector<GlobalIndexIOMeta>> SortedGlobalIndexWriter::Finish() {
+    if (row_number_ == 0) {
+        return std::vector<GlobalIndexIOMeta>();
+    }
+    std::vector<const std::pair<const Literal, std::vector<int64_t>>*> entries;
+    entries.reserve(key_to_row_ids_.size());
+    for (const auto& entry : key_to_row_ids_) {
+        entries.push_back(&entry);
+    }
+    Status compare_status = Status::OK();
+    std::sort(entries.begin(), entries.end(),
+              [&compare_status](const auto* left, const auto* right) {
+                  Result<int32_t> cmp = left->first.CompareTo(right->first);
+                  if (!cmp.ok()) {
+                      compare_status = cmp.status();
+                      return false;
+                  }
+                  return cmp.value() < 0;
+              });
+    PAIMON_RETURN_NOT_OK(compare_status);
+
+    // the blocks are written first to get their offsets for the block index
+    MemorySegmentOutputStream blocks(MemorySegmentOutputStream::DEFAULT_SEGMENT_SIZE, pool_);
+    MemorySegmentOutputStream header(MemorySegmentOutputStream::DEFAULT_SEGMENT_SIZE, pool_);
+    std::vector<std::pair<const Literal*, int64_t>> block_starts;
+    for (const auto* entry : entries) {
+        if (block_starts.empty() ||
+            blocks.CurrentSize() - block_starts.back().second >= block_size_) {
+            block_starts.emplace_back(&entry->first, blocks.CurrentSize());
+        }
+        SortedGlobalIndex::WriteKey(key_type_, entry->first, &blocks);
+        std::vector<char> postings = DeltaVarintCompressor::Compress(entry->second);
+        blocks.WriteValue<int32_t>(static_cast<int32_t>(postings.size()));
+        blocks.Write(postings.data(), postings.size());
+    }
+
+    header.WriteValue<int8_t>(SortedGlobalIndex::VERSION_1);
+    PAIMON_UNIQUE_PTR<Bytes> null_bitmap_bytes = null_bitmap_.Serialize(pool_.get());
+    header.WriteValue<int32_t>(static_cast<int32_t>(null_bitmap_bytes->size()));
+    header.Write(null_bitmap_bytes->data(), null_bitmap_bytes->size());
+    header.WriteValue<int32_t>(static_cast<int32_t>(block_starts.size()));
+    for (size_t i = 0; i < block_starts.size(); i++) {
+        int64_t block_end =
+            i + 1 < block_starts.size() ? block_starts[i + 1].second : blocks.CurrentSize();
+        SortedGlobalIndex::WriteKey(key_type_, *block_starts[i].first, &header);
+        header.WriteValue<int64_t>(block_starts[i].second);
+        header.WriteValue<int32_t>(static_cast<int32_t>(block_end - block_starts[i].second));
+    }
+
+    PAIMON_ASSIGN_OR_RAISE(std::string file_name, file_writer_->NewFileName("sorted"));
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<OutputStream> out,
+                           file_writer_->NewOutputStream(file_name));
+    PAIMON_RETURN_NOT_OK(WriteSegments(header, out.get()));
+    PAIMON_RETURN_NOT_OK(WriteSegments(blocks, out.get()));
+    PAIMON_RETURN_NOT_OK(out->Flush());
+    PAIMON_RETURN_NOT_OK(out->Close());
+    GlobalIndexIOMeta meta(file_name, /*file_size=*/header.CurrentSize() + blocks.CurrentSize(),
+                           /*range_end=*/row_number_ - 1, /*metadata=*/nullptr);
+    return std::vector<GlobalIndexIOMeta>({meta});
+}
+
+Result<std::shared_ptr<SortedGlobalIndexReader>> SortedGlobalIndexReader::Create(
+    const std::shared_ptr<arrow::DataType>& arrow_type,
+    const std::shared_ptr<InputStream>& input_stream, int64_t range_end,
+    const std::shared_ptr<MemoryPool>& pool) {
+    PAIMON_ASSIGN_OR_RAISE(FieldType key_type, GetKeyType(arrow_type));
+    auto reader = std::shared_ptr<SortedGlobalIndexReader>(
+        new SortedGlobalIndexReader(arrow_type, key_type, input_stream, range_end, pool));
+    PAIMON_RETURN_NOT_OK(reader->LoadHeader());
+    return reader;
+}
+
+SortedGlobalIndexReader::SortedGlobalIndexReader(
+    const std::shared_ptr<arrow::DataType>& arrow_type, FieldType key_type,
+    const std::shared_ptr<InputStream>& input_stream, int64_t range_end,
+    const std::shared_ptr<MemoryPool>& pool)
+    : arrow_type_(arrow_type),
+      key_type_(key_type),
+      input_stream_(input_stream),
+      range_end_(range_end),
+      pool_(pool) {}
+
+Status SortedGlobalIndexReader::LoadHeader() {
+    DataInputStream in(input_stream_);
+    PAIMON_RETURN_NOT_OK(in.Seek(0));
+    PAIMON_ASSIGN_OR_RAISE(int8_t version, in.ReadValue<int8_t>());
+    if (version != SortedGlobalIndex::VERSION_1) {
+        return Status::Invalid(fmt::format("unknown sorted global index version {}", version));
+    }
+    PAIMON_ASSIGN_OR_RAISE(int32_t null_bitmap_length, in.ReadValue<int32_t>());
+    if (null_bitmap_length < 0) {
+        return Status::Invalid(fmt::format(
+            "invalid null bitmap length {} in sorted global index", null_bitmap_length));
+    }
+    Bytes null_bitmap_bytes(null_bitmap_length, pool_.get());
+    PAIMON_RETURN_NOT_OK(in.ReadBytes(&null_bitmap_bytes));
+    PAIMON_RETURN_NOT_OK(
+        null_bitmap_.Deserialize(null_bitmap_bytes.data(), null_bitmap_bytes.size()));
+    PAIMON_ASSIGN_OR_RAISE(int32_t num_blocks, in.ReadValue<int32_t>());
+    if (num_blocks < 0) {
+        return Status::Invalid(
+            fmt::format("invalid num blocks {} in sorted global index", num_blocks));
+    }
+    block_index_.reserve(num_blocks);
+    for (int32_t i = 0; i < num_blocks; i++) {
+        PAIMON_ASSIGN_OR_RAISE(Literal first_key,
+                               SortedGlobalIndex::ReadKey(key_type_, in, pool_.get()));
+        PAIMON_ASSIGN_OR_RAISE(int64_t offset, in.ReadValue<int64_t>());
+        PAIMON_ASSIGN_OR_RAISE(int32_t length, in.ReadValue<int32_t>());
+        block_index_.push_back({std::move(first_key), offset, length});
+    }
+    PAIMON_ASSIGN_OR_RAISE(blocks_start_, in.GetPos());
+    return Status::OK();
+}
+
+Result<const SortedGlobalIndexReader::Block*> SortedGlobalIndexReader::ReadBlock(
+    int32_t block_id) {
+    if (cached_block_ && cached_block_->first == block_id) {
+        return &cached_block_->second;
+    }
+    cached_block_.reset();
+    const auto& meta = block_index_[block_id];
+    DataInputStream in(input_stream_);
+    PAIMON_RETURN_NOT_OK(in.Seek(blocks_start_ + meta.offset));
+    Bytes bytes(meta.length, pool_.get());
+    PAIMON_RETURN_NOT_OK(in.ReadBytes(&bytes));
+    num_block_reads_++;
+
+    auto block_stream = std::make_shared<ByteArrayInputStream>(bytes.data(), bytes.size());
+    DataInputStream block_in(block_stream);
+    Block block;
+    while (true) {
+        PAIMON_ASSIGN_OR_RAISE(int64_t pos, block_in.GetPos());
+        if (pos >= meta.length) {
+            break;
+        }
+        PAIMON_ASSIGN_OR_RAISE(Literal key,
+                               SortedGlobalIndex::ReadKey(key_type_, block_in, pool_.get()));
+        PAIMON_ASSIGN_OR_RAISE(int32_t postings_length, block_in.ReadValue<int32_t>());
+        PAIMON_ASSIGN_OR_RAISE(pos, block_in.GetPos());
+        if (postings_length < 0 || pos + postings_length > meta.length) {
+            return Status::Invalid(fmt::format(
+                "invalid postings length {} in block {} of sorted global index", postings_length,
+                block_id));
+        }
+        std::vector<char> postings(postings_length);
+        PAIMON_RETURN_NOT_OK(block_in.Read(postings.data(), postings_length));
+        PAIMON_ASSIGN_OR_RAISE(std::vector<int64_t> row_ids,
+                               DeltaVarintCompressor::Decompress(postings));
+        block.emplace_back(std::move(key), RoaringBitmap64::From(row_ids));
+    }
+    cached_block_.emplace(block_id, std::move(block));
+    return &cached_block_->second;
+}
+
+Result<int32_t> SortedGlobalIndexReader::FindBlock(const Literal& key) const {
+    // binary search the first block whose first key is greater than key
+    int32_t low = 0;
+    int32_t high = NumBlocks();
+    while (low < high) {
+        int32_t mid = low + (high - low) / 2;
+        PAIMON_ASSIGN_OR_RAISE(int32_t cmp, block_index_[mid].first_key.CompareTo(key));
+        if (cmp <= 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return std::max(low - 1, 0);
+}
+
+Result<RoaringBitmap64> SortedGlobalIndexReader::GetInBitmap(
+    const std::vector<Literal>& literals) {
+    if (literals.empty()) {
+        return Status::Invalid("literals cannot be empty in In predicate");
+    }
+    // look up the keys block by block, so that each block is read once
+    std::vector<std::pair<int32_t, Literal>> block_keys;
+    block_keys.reserve(literals.size());
+    for (const auto& literal : literals) {
+        if (literal.IsNull()) {
+            continue;
+        }
+        PAIMON_ASSIGN_OR_RAISE(Literal key, BitmapFileIndex::ConvertLiteral(literal, arrow_type_));
+        PAIMON_ASSIGN_OR_RAISE(int32_t block_id, FindBlock(key));
+        block_keys.emplace_back(block_id, std::move(key));
+    }
+    std::stable_sort(block_keys.begin(), block_keys.end(),
+                     [](const auto& left, const auto& right) { return left.first < right.first; });
+    RoaringBitmap64 result;
+    if (block_index_.empty()) {
+        return result;
+    }
+    for (const auto& [block_id, key] : block_keys) {
+        PAIMON_ASSIGN_OR_RAISE(const Block* block, ReadBlock(block_id));
+        int32_t low = 0;
+        auto high = static_cast<int32_t>(block->size());
+        while (low < high) {
+            int32_t mid = low + (high - low) / 2;
+            PAIMON_ASSIGN_OR_RAISE(int32_t cmp, (*block)[mid].first.CompareTo(key));
+            if (cmp == 0) {
+                result |= (*block)[mid].second;
+                break;
+            } else if (cmp < 0) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+    }
+    return result;
+}
+
+Result<RoaringBitmap64> SortedGlobalIndexReader::GetRangeBitmap(const Literal& lower,
+                                                                bool lower_inclusive,
+                                                                const Literal& upper,
+                                                                bool upper_inclusive) {
+    PAIMON_ASSIGN_OR_RAISE(Literal lower_key, BitmapFileIndex::ConvertLiteral(lower, arrow_type_));
+    PAIMON_ASSIGN_OR_RAISE(Literal upper_key, BitmapFileIndex::ConvertLiteral(upper, arrow_type_));
+    RoaringBitmap64 result;
+    int32_t start_block = 0;
+    if (!lower_key.IsNull()) {
+        PAIMON_ASSIGN_OR_RAISE(start_block, FindBlock(lower_key));
+    }
+    for (int32_t block_id = start_block; block_id < NumBlocks(); block_id++) {
+        if (!upper_key.IsNull()) {
+            PAIMON_ASSIGN_OR_RAISE(int32_t cmp,
+                                   block_index_[block_id].first_key.CompareTo(upper_key));
+            if (cmp > 0 || (cmp == 0 && !upper_inclusive)) {
+                break;
+            }
+        }
+        PAIMON_ASSIGN_OR_RAISE(const Block* block, ReadBlock(block_id));
+        for (const auto& [key, row_ids] : *block) {
+            if (!lower_key.IsNull()) {
+                PAIMON_ASSIGN_OR_RAISE(int32_t cmp, key.CompareTo(lower_key));
+                if (cmp < 0 || (cmp == 0 && !lower_inclusive)) {
+                    continue;
+                }
+            }
+            if (!upper_key.IsNull()) {
+                PAIMON_ASSIGN_OR_RAISE(int32_t cmp, key.CompareTo(upper_key));
+                if (cmp > 0 || (cmp == 0 && !upper_inclusive)) {
+                    return result;
+                }
+            }
+            result |= row_ids;
+        }
+    }
+    return result;
+}
+
+RoaringBitmap64 SortedGlobalIndexReader::GetNotNullBitmap() const {
+    RoaringBitmap64 bitmap;
+    bitmap.AddRange(0, range_end_ + 1);
+    bitmap -= null_bitmap_;
+    return bitmap;
+}
+
+std::shared_ptr<GlobalIndexResult> SortedGlobalIndexReader::ToGlobalIndexResult(
+    RoaringBitmap64&& bitmap) {
+    return std::make_shared<BitmapGlobalIndexResult>(
+        [bitmap = std::move(bitmap)]() -> Result<RoaringBitmap64> { return bitmap; });
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> SortedGlobalIndexReader::VisitIsNotNull() {
+    return ToGlobalIndexResult(GetNotNullBitmap());
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> SortedGlobalIndexReader::VisitIsNull() {
+    return ToGlobalIndexResult(RoaringBitmap64(null_bitmap_));
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> SortedGlobalIndexReader::VisitEqual(
+    const Literal& literal) {
+    return VisitIn({literal});
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> SortedGlobalIndexReader::VisitNotEqual(
+    const Literal& literal) {
+    return VisitNotIn({literal});
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> SortedGlobalIndexReader::VisitLessThan(
+    const Literal& literal) {
+    PAIMON_ASSIGN_OR_RAISE(RoaringBitmap64 bitmap,
+                           GetRangeBitmap(Literal(literal.GetType()), /*lower_inclusive=*/false,
+                                          literal, /*upper_inclusive=*/false));
+    return ToGlobalIndexResult(std::move(bitmap));
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> SortedGlobalIndexReader::VisitLessOrEqual(
+    const Literal& literal) {
+    PAIMON_ASSIGN_OR_RAISE(RoaringBitmap64 bitmap,
+                           GetRangeBitmap(Literal(literal.GetType()), /*lower_inclusive=*/false,
+                                          literal, /*upper_inclusive=*/true));
+    return ToGlobalIndexResult(std::move(bitmap));
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> SortedGlobalIndexReader::VisitGreaterThan(
+    const Literal& literal) {
+    PAIMON_ASSIGN_OR_RAISE(RoaringBitmap64 bitmap,
+                           GetRangeBitmap(literal, /*lower_inclusive=*/false,
+                                          Literal(literal.GetType()), /*upper_inclusive=*/false));
+    return ToGlobalIndexResult(std::move(bitmap));
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> SortedGlobalIndexReader::VisitGreaterOrEqual(
+    const Literal& literal) {
+    PAIMON_ASSIGN_OR_RAISE(RoaringBitmap64 bitmap,
+                           GetRangeBitmap(literal, /*lower_inclusive=*/true,
+                                          Literal(literal.GetType()), /*upper_inclusive=*/false));
+    return ToGlobalIndexResult(std::move(bitmap));
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> SortedGlobalIndexReader::VisitIn(
+    const std::vector<Literal>& literals) {
+    PAIMON_ASSIGN_OR_RAISE(RoaringBitmap64 bitmap, GetInBitmap(literals));
+    return ToGlobalIndexResult(std::move(bitmap));
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> SortedGlobalIndexReader::VisitNotIn(
+    const std::vector<Literal>& literals) {
+    PAIMON_ASSIGN_OR_RAISE(RoaringBitmap64 in_bitmap, GetInBitmap(literals));
+    RoaringBitmap64 bitmap = GetNotNullBitmap();
+    bitmap -= in_bitmap;
+    return ToGlobalIndexResult(std::move(bitmap));
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> SortedGlobalIndexReader::VisitStartsWith(
+    const Literal& prefix) {
+    return BitmapGlobalIndexResult::FromRanges({Range(0, range_end_)});
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> SortedGlobalIndexReader::VisitEndsWith(
+    const Literal& suffix) {
+    return BitmapGlobalIndexResult::FromRanges({Range(0, range_end_)});
+}
+
+Result<std::shared_ptr<GlobalIndexResult>> SortedGlobalIndexReader::VisitContains(
+    const Literal& literal) {
+    return BitmapGlobalIndexResult::FromRanges({Range(0, range_end_)});
+}
+
+Result<std::shared_ptr<VectorSearchGlobalIndexResult>> SortedGlobalIndexReader::VisitVectorSearch(
+    const std::shared_ptr<VectorSearch>& vector_search) {
+    return Status::Invalid("SortedGlobalIndexReader is not supposed to handle vector search query");
+}
+
+}  // namespace paimon
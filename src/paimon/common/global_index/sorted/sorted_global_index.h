@@ -0,0 +1,233 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/api.h"
+#include "paimon/defs.h"
+#include "paimon/global_index/global_index_reader.h"
+#include "paimon/global_index/global_index_writer.h"
+#include "paimon/global_index/global_indexer.h"
+#include "paimon/memory/bytes.h"
+#include "paimon/predicate/literal.h"
+#include "paimon/utils/roaring_bitmap64.h"
+
+namespace paimon {
+class DataInputStream;
+class InputStream;
+class MemorySegmentOutputStream;
+
+/// Sorted global index, which serves point and range predicates on high cardinality fields.
+///
+/// The distinct keys are sorted and stored with their row ids in blocks of about
+/// `sorted.block-size` bytes, and a sparse index keeps the first key of each block. The header
+/// and the sparse index are loaded when the reader is created, then a point lookup reads one
+/// block and a range predicate reads the blocks overlapping the range only.
+///
+/// <pre>
+/// Sorted global index format
+/// +-------------------------------------------------+
+/// | version (1 byte)                                |
+/// +-------------------------------------------------+
+/// | null bitmap length (4 bytes int)                |
+/// +-------------------------------------------------+
+/// | null bitmap (serialized RoaringBitmap64)        |
+/// +-------------------------------------------------+
+/// | num blocks (4 bytes int)                        |
+/// +-------------------------------------------------+
+/// | block index: first key, block offset (8 bytes   |
+/// | long), block length (4 bytes int) of each block |
+/// +-------------------------------------------------+
+/// | blocks                                          |
+/// +-------------------------------------------------+
+///
+/// Block format
+/// +-------------------------------------------------+
+/// | key, postings length (4 bytes int), postings    |
+/// | (delta varint encoded row ids) of each key,     |
+/// | until the end of the block                      |
+/// +-------------------------------------------------+
+/// </pre>
+///
+/// Block offsets are relative to the start of the blocks. Integers are big endian, strings are
+/// stored as length (4 bytes int) and bytes, and timestamps are stored as long like
+/// `BitmapFileIndex`.
+class SortedGlobalIndex : public GlobalIndexer {
+ public:
+    explicit SortedGlobalIndex(const std::map<std::string, std::string>& options)
+        : options_(options) {}
+
+    Result<std::shared_ptr<GlobalIndexWriter>> CreateWriter(
+        const std::string& field_name, ::ArrowSchema* arrow_schema,
+        const std::shared_ptr<GlobalIndexFileWriter>& file_writer,
+        const std::shared_ptr<MemoryPool>& pool) const override;
+
+    Result<std::shared_ptr<GlobalIndexReader>> CreateReader(
+        ::ArrowSchema* arrow_schema, const std::shared_ptr<GlobalIndexFileReader>& file_reader,
+        const std::vector<GlobalIndexIOMeta>& files,
+        const std::shared_ptr<MemoryPool>& pool) const override;
+
+    /// Write a non-null key of `type` to `out`.
+    static void WriteKey(FieldType type, const Literal& key, MemorySegmentOutputStream* out);
+
+    /// Read a key of `type` from `in`.
+    static Result<Literal> ReadKey(FieldType type, const DataInputStream& in, MemoryPool* pool);
+
+ public:
+    static constexpr int8_t VERSION_1 = 1;
+    /// Expected serialized size of a block in bytes.
+    static constexpr char BLOCK_SIZE[] = "sorted.block-size";
+    static constexpr int32_t DEFAULT_BLOCK_SIZE = 16 * 1024;
+
+ private:
+    std::map<std::string, std::string> options_;
+};
+
+class SortedGlobalIndexWriter : public GlobalIndexWriter {
+ public:
+    static Result<std::shared_ptr<SortedGlobalIndexWriter>> Create(
+        const std::shared_ptr<arrow::Field>& arrow_field,
+        const std::map<std::string, std::string>& options,
+        const std::shared_ptr<GlobalIndexFileWriter>& file_writer,
+        const std::shared_ptr<MemoryPool>& pool);
+
+    Status AddBatch(::ArrowArray* arrow_array) override;
+
+    Result<std::vector<GlobalIndexIOMeta>> Finish() override;
+
+ private:
+    SortedGlobalIndexWriter(const std::shared_ptr<arrow::Field>& arrow_field, FieldType key_type,
+                            int32_t block_size,
+                            const std::shared_ptr<GlobalIndexFileWriter>& file_writer,
+                            const std::shared_ptr<MemoryPool>& pool);
+
+ private:
+    std::shared_ptr<arrow::DataType> struct_type_;
+    std::shared_ptr<arrow::DataType> arrow_type_;
+    FieldType key_type_;
+    int32_t block_size_;
+    std::shared_ptr<GlobalIndexFileWriter> file_writer_;
+    std::shared_ptr<MemoryPool> pool_;
+    int64_t row_number_ = 0;
+    RoaringBitmap64 null_bitmap_;
+    // row ids of each key are in ascending order
+    std::unordered_map<Literal, std::vector<int64_t>> key_to_row_ids_;
+};
+
+class SortedGlobalIndexReader : public GlobalIndexReader {
+ public:
+    static Result<std::shared_ptr<SortedGlobalIndexReader>> Create(
+        const std::shared_ptr<arrow::DataType>& arrow_type,
+        const std::shared_ptr<InputStream>& input_stream, int64_t range_end,
+        const std::shared_ptr<MemoryPool>& pool);
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitIsNotNull() override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitIsNull() override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitEqual(const Literal& literal) override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitNotEqual(const Literal& literal) override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitLessThan(const Literal& literal) override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitLessOrEqual(const Literal& literal) override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitGreaterThan(const Literal& literal) override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitGreaterOrEqual(
+        const Literal& literal) override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitIn(
+        const std::vector<Literal>& literals) override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitNotIn(
+        const std::vector<Literal>& literals) override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitStartsWith(const Literal& prefix) override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitEndsWith(const Literal& suffix) override;
+
+    Result<std::shared_ptr<GlobalIndexResult>> VisitContains(const Literal& literal) override;
+
+    Result<std::shared_ptr<VectorSearchGlobalIndexResult>> VisitVectorSearch(
+        const std::shared_ptr<VectorSearch>& vector_search) override;
+
+    /// @return The row ids of non-null keys in the range, a null bound indicates the range is
+    /// unbounded on that side.
+    Result<RoaringBitmap64> GetRangeBitmap(const Literal& lower, bool lower_inclusive,
+                                           const Literal& upper, bool upper_inclusive);
+
+    int32_t NumBlocks() const {
+        return static_cast<int32_t>(block_index_.size());
+    }
+
+    /// @return The number of blocks read from the input stream so far.
+    int64_t NumBlockReads() const {
+        return num_block_reads_;
+    }
+
+ private:
+    struct BlockMeta {
+        Literal first_key;
+        int64_t offset;
+        int32_t length;
+    };
+
+    // keys and row ids of a block, keys are in ascending order
+    using Block = std::vector<std::pair<Literal, RoaringBitmap64>>;
+
+    SortedGlobalIndexReader(const std::shared_ptr<arrow::DataType>& arrow_type,
+                            FieldType key_type, const std::shared_ptr<InputStream>& input_stream,
+                            int64_t range_end, const std::shared_ptr<MemoryPool>& pool);
+
+    Status LoadHeader();
+
+    Result<const Block*> ReadBlock(int32_t block_id);
+
+    /// @return The last block whose first key is not greater than `key`, or 0 if no such block.
+    Result<int32_t> FindBlock(const Literal& key) const;
+
+    Result<RoaringBitmap64> GetInBitmap(const std::vector<Literal>& literals);
+
+    RoaringBitmap64 GetNotNullBitmap() const;
+
+    static std::shared_ptr<GlobalIndexResult> ToGlobalIndexResult(RoaringBitmap64&& bitmap);
+
+ private:
+    std::shared_ptr<arrow::DataType> arrow_type_;
+    FieldType key_type_;
+    std::shared_ptr<InputStream> input_stream_;
+    int64_t range_end_;
+    std::shared_ptr<MemoryPool> pool_;
+    RoaringBitmap64 null_bitmap_;
+    int64_t blocks_start_ = 0;
+    std::vector<BlockMeta> block_index_;
+    int64_t num_block_reads_ = 0;
+    // the last read block, consecutive lookups often hit the same block
+    std::optional<std::pair<int32_t, Block>> cached_block_;
+};
+
+}  // namespace paimon
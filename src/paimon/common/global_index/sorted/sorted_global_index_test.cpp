@@ -0,0 +1,252 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/global_index/sorted/sorted_global_index.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/c/bridge.h"
+#include "arrow/ipc/api.h"
+#include "gtest/gtest.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/common/utils/path_util.h"
+#include "paimon/common/utils/string_utils.h"
+#include "paimon/core/global_index/global_index_file_manager.h"
+#include "paimon/core/index/index_path_factory.h"
+#include "paimon/fs/local/local_file_system.h"
+#include "paimon/global_index/bitmap_global_index_result.h"
+#include "paimon/global_index/global_index_result.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+class SortedGlobalIndexTest : public ::testing::Test {
+ public:
+    void SetUp() override {
+        test_root_dir_ = UniqueTestDirectory::Create();
+        ASSERT_TRUE(test_root_dir_);
+    }
+    void TearDown() override {}
+
+    class FakeIndexPathFactory : public IndexPathFactory {
+     public:
+        explicit FakeIndexPathFactory(const std::string& index_path) : index_path_(index_path) {}
+        std::string NewPath() const override {
+            assert(false);
+            return "";
+        }
+        std::string ToPath(const std::shared_ptr<IndexFileMeta>& file) const override {
+            assert(false);
+            return "";
+        }
+        std::string ToPath(const std::string& file_name) const override {
+            return PathUtil::JoinPath(index_path_, file_name);
+        }
+        bool IsExternalPath() const override {
+            return false;
+        }
+
+     private:
+        std::string index_path_;
+    };
+
+    std::unique_ptr<::ArrowSchema> CreateArrowSchema(
+        const std::shared_ptr<arrow::DataType>& data_type) const {
+        auto schema = arrow::schema({arrow::field("f0", data_type)});
+        auto c_schema = std::make_unique<::ArrowSchema>();
+        EXPECT_TRUE(arrow::ExportSchema(*schema, c_schema.get()).ok());
+        return c_schema;
+    }
+
+    std::shared_ptr<GlobalIndexFileManager> CreateFileManager() const {
+        auto path_factory = std::make_shared<FakeIndexPathFactory>(test_root_dir_->Str());
+        return std::make_shared<GlobalIndexFileManager>(fs_, path_factory);
+    }
+
+    Result<GlobalIndexIOMeta> WriteGlobalIndex(
+        const std::shared_ptr<arrow::DataType>& type, const std::shared_ptr<arrow::Array>& array,
+        const std::map<std::string, std::string>& options = {}) const {
+        SortedGlobalIndex global_index(options);
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<GlobalIndexWriter> global_writer,
+                               global_index.CreateWriter("f0", CreateArrowSchema(type).get(),
+                                                         CreateFileManager(), pool_));
+        ArrowArray c_array;
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(*array, &c_array));
+        PAIMON_RETURN_NOT_OK(global_writer->AddBatch(&c_array));
+        PAIMON_ASSIGN_OR_RAISE(auto result_metas, global_writer->Finish());
+        EXPECT_EQ(result_metas.size(), 1);
+        EXPECT_TRUE(StringUtils::StartsWith(result_metas[0].file_name, "sorted-global-index-"));
+        EXPECT_EQ(result_metas[0].range_end, array->length() - 1);
+        EXPECT_FALSE(result_metas[0].metadata);
+        return result_metas[0];
+    }
+
+    std::shared_ptr<SortedGlobalIndexReader> CreateGlobalIndexReader(
+        const std::shared_ptr<arrow::DataType>& type, const GlobalIndexIOMeta& meta) const {
+        SortedGlobalIndex global_index({});
+        EXPECT_OK_AND_ASSIGN(auto global_index_reader,
+                             global_index.CreateReader(CreateArrowSchema(type).get(),
+                                                       CreateFileManager(), {meta}, pool_));
+        auto sorted_reader =
+            std::dynamic_pointer_cast<SortedGlobalIndexReader>(global_index_reader);
+        EXPECT_TRUE(sorted_reader);
+        return sorted_reader;
+    }
+
+    void CheckResult(const Result<std::shared_ptr<GlobalIndexResult>>& result,
+                     const std::vector<int64_t>& expected) const {
+        ASSERT_OK(result);
+        auto typed_result = std::dynamic_pointer_cast<BitmapGlobalIndexResult>(result.value());
+        ASSERT_TRUE(typed_result);
+        ASSERT_OK_AND_ASSIGN(const RoaringBitmap64* bitmap, typed_result->GetBitmap());
+        ASSERT_TRUE(bitmap);
+        ASSERT_EQ(*bitmap, RoaringBitmap64::From(expected))
+            << "result=" << bitmap->ToString()
+            << ", expected=" << RoaringBitmap64::From(expected).ToString();
+    }
+
+ private:
+    std::shared_ptr<MemoryPool> pool_ = GetDefaultPool();
+    std::shared_ptr<FileSystem> fs_ = std::make_shared<LocalFileSystem>();
+    std::unique_ptr<UniqueTestDirectory> test_root_dir_;
+};
+
+TEST_F(SortedGlobalIndexTest, TestStringType) {
+    auto type = arrow::utf8();
+    auto array = arrow::ipc::internal::json::ArrayFromJSON(
+                     arrow::struct_({arrow::field("f0", type)}),
+                     R"([["b"], [null], ["a"], ["c"], ["a"], [null], ["d"]])")
+                     .ValueOrDie();
+    ASSERT_OK_AND_ASSIGN(auto meta, WriteGlobalIndex(type, array));
+    auto reader = CreateGlobalIndexReader(type, meta);
+    ASSERT_EQ(1, reader->NumBlocks());
+
+    Literal lit_a(FieldType::STRING, "a", 1);
+    Literal lit_b(FieldType::STRING, "b", 1);
+    Literal lit_c(FieldType::STRING, "c", 1);
+    Literal lit_e(FieldType::STRING, "e", 1);
+    CheckResult(reader->VisitEqual(lit_a), {2, 4});
+    CheckResult(reader->VisitEqual(lit_e), {});
+    CheckResult(reader->VisitNotEqual(lit_a), {0, 3, 6});
+    CheckResult(reader->VisitIn({lit_a, lit_c, lit_e}), {2, 3, 4});
+    CheckResult(reader->VisitNotIn({lit_a, lit_c}), {0, 6});
+    CheckResult(reader->VisitIsNull(), {1, 5});
+    CheckResult(reader->VisitIsNotNull(), {0, 2, 3, 4, 6});
+    CheckResult(reader->VisitLessThan(lit_c), {0, 2, 4});
+    CheckResult(reader->VisitLessOrEqual(lit_c), {0, 2, 3, 4});
+    CheckResult(reader->VisitGreaterThan(lit_b), {3, 6});
+    CheckResult(reader->VisitGreaterOrEqual(lit_b), {0, 3, 6});
+    CheckResult(reader->VisitStartsWith(lit_a), {0, 1, 2, 3, 4, 5, 6});
+    ASSERT_NOK_WITH_MSG(reader->VisitVectorSearch(nullptr),
+                        "SortedGlobalIndexReader is not supposed to handle vector search query");
+}
+
+TEST_F(SortedGlobalIndexTest, TestMultipleBlocks) {
+    auto type = arrow::int64();
+    arrow::StructBuilder struct_builder(arrow::struct_({arrow::field("f0", type)}),
+                                        arrow::default_memory_pool(),
+                                        {std::make_shared<arrow::Int64Builder>()});
+    auto long_builder = static_cast<arrow::Int64Builder*>(struct_builder.field_builder(0));
+    // values are 0, 2, 4, ... in reversed order, each value appears twice
+    int64_t items = 1000;
+    for (int64_t i = 0; i < items * 2; i++) {
+        ASSERT_TRUE(struct_builder.Append().ok());
+        ASSERT_TRUE(long_builder->Append((items - 1 - i % items) * 2).ok());
+    }
+    std::shared_ptr<arrow::Array> array;
+    ASSERT_TRUE(struct_builder.Finish(&array).ok());
+    ASSERT_OK_AND_ASSIGN(auto meta,
+                         WriteGlobalIndex(type, array, {{SortedGlobalIndex::BLOCK_SIZE, "256"}}));
+    auto reader = CreateGlobalIndexReader(type, meta);
+    ASSERT_GT(reader->NumBlocks(), 10);
+
+    auto row_ids_of = [&](int64_t value) -> std::vector<int64_t> {
+        int64_t row_id = items - 1 - value / 2;
+        return {row_id, row_id + items};
+    };
+    for (int64_t value = 0; value < items * 2; value += 2) {
+        CheckResult(reader->VisitEqual(Literal(value)), row_ids_of(value));
+        CheckResult(reader->VisitEqual(Literal(value + 1)), {});
+    }
+    CheckResult(reader->VisitEqual(Literal(static_cast<int64_t>(-1))), {});
+
+    // a point lookup reads a single block
+    int64_t num_block_reads = reader->NumBlockReads();
+    CheckResult(reader->VisitEqual(Literal(static_cast<int64_t>(1000))), row_ids_of(1000));
+    ASSERT_EQ(num_block_reads + 1, reader->NumBlockReads());
+
+    // a narrow range reads the overlapping blocks only
+    num_block_reads = reader->NumBlockReads();
+    ASSERT_OK_AND_ASSIGN(RoaringBitmap64 bitmap,
+                         reader->GetRangeBitmap(Literal(static_cast<int64_t>(100)), true,
+                                                Literal(static_cast<int64_t>(110)), false));
+    std::vector<int64_t> expected;
+    for (int64_t value = 100; value < 110; value += 2) {
+        auto row_ids = row_ids_of(value);
+        expected.insert(expected.end(), row_ids.begin(), row_ids.end());
+    }
+    ASSERT_EQ(RoaringBitmap64::From(expected), bitmap);
+    ASSERT_LE(reader->NumBlockReads() - num_block_reads, 2);
+
+    CheckResult(reader->VisitGreaterThan(Literal(static_cast<int64_t>(1994))),
+                {0, 1, items, items + 1});
+    ASSERT_OK_AND_ASSIGN(bitmap,
+                         reader->GetRangeBitmap(Literal(FieldType::BIGINT), false,
+                                                Literal(static_cast<int64_t>(1000)), false));
+    ASSERT_EQ(items, bitmap.Cardinality());
+    CheckResult(reader->VisitIn({Literal(static_cast<int64_t>(0)),
+                                 Literal(static_cast<int64_t>(1998))}),
+                {0, items - 1, items, items * 2 - 1});
+}
+
+TEST_F(SortedGlobalIndexTest, TestNumericTypes) {
+    auto check_type = [&](const std::shared_ptr<arrow::DataType>& type,
+                          const Literal& lower, const Literal& upper) {
+        auto array = arrow::ipc::internal::json::ArrayFromJSON(
+                         arrow::struct_({arrow::field("f0", type)}),
+                         R"([[3], [-1], [null], [2], [0], [-1]])")
+                         .ValueOrDie();
+        ASSERT_OK_AND_ASSIGN(auto meta, WriteGlobalIndex(type, array));
+        auto reader = CreateGlobalIndexReader(type, meta);
+        CheckResult(reader->VisitEqual(lower), {1, 5});
+        CheckResult(reader->VisitGreaterOrEqual(lower), {0, 1, 3, 4, 5});
+        CheckResult(reader->VisitLessThan(upper), {1, 3, 4, 5});
+        CheckResult(reader->VisitNotEqual(upper), {1, 3, 4, 5});
+    };
+    check_type(arrow::int8(), Literal(static_cast<int8_t>(-1)), Literal(static_cast<int8_t>(3)));
+    check_type(arrow::int16(), Literal(static_cast<int16_t>(-1)),
+               Literal(static_cast<int16_t>(3)));
+    check_type(arrow::int32(), Literal(-1), Literal(3));
+    check_type(arrow::float32(), Literal(-1.0f), Literal(3.0f));
+    check_type(arrow::float64(), Literal(-1.0), Literal(3.0));
+}
+
+TEST_F(SortedGlobalIndexTest, TestInvalid) {
+    auto type = arrow::boolean();
+    SortedGlobalIndex global_index({});
+    ASSERT_NOK_WITH_MSG(global_index.CreateWriter("f0", CreateArrowSchema(type).get(),
+                                                  CreateFileManager(), pool_),
+                        "sorted global index does not support type");
+    SortedGlobalIndex invalid_block_size({{SortedGlobalIndex::BLOCK_SIZE, "0"}});
+    ASSERT_NOK_WITH_MSG(invalid_block_size.CreateWriter("f0",
+                                                        CreateArrowSchema(arrow::int32()).get(),
+                                                        CreateFileManager(), pool_),
+                        "invalid block size 0 for sorted global index");
+}
+
+}  // namespace paimon::test
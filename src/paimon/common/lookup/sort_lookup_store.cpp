@@ -0,0 +1,356 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/lookup/sort_lookup_store.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "fmt/format.h"
+#include "paimon/common/fs/block_cache.h"
+#include "paimon/common/utils/murmurhash_utils.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/memory/bytes.h"
+
+namespace paimon {
+namespace {
+// index offset, index size, bloom filter offset, bloom filter size, bloom filter hash function
+// count, entry count and magic number
+constexpr size_t FOOTER_SIZE = 8 + 4 + 8 + 4 + 4 + 8 + 4;
+constexpr int32_t MAGIC_NUMBER = 0x50534c4b;
+
+template <typename T>
+void AppendValue(T value, std::string* buffer) {
+    buffer->append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T ReadValue(const char* data) {
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+int64_t HashKey(std::string_view key) {
+    int32_t length = static_cast<int32_t>(key.size());
+    int32_t hash1 = MurmurHashUtils::HashUnsafeBytes(key.data(), 0, length);
+    int32_t hash2 = MurmurHashUtils::HashUnsafeBytes(key.data(), 0, length, hash1);
+    return (static_cast<int64_t>(hash1) << 32) | static_cast<uint32_t>(hash2);
+}
+
+int32_t CompareKeys(const SortLookupStoreKeyComparator& comparator, std::string_view lhs,
+                    std::string_view rhs) {
+    if (comparator) {
+        return comparator(lhs, rhs);
+    }
+    return lhs.compare(rhs);
+}
+}  // namespace
+
+Result<std::unique_ptr<SortLookupStoreWriter>> SortLookupStoreWriter::Create(
+    const std::shared_ptr<FileSystem>& fs, const std::string& path,
+    const SortLookupStoreOptions& options, int64_t expected_entries,
+    const SortLookupStoreKeyComparator& comparator, const std::shared_ptr<MemoryPool>& pool) {
+    if (options.block_size <= 0) {
+        return Status::Invalid(
+            fmt::format("block size of lookup store must be positive, but is {}",
+                        options.block_size));
+    }
+    std::unique_ptr<BloomFilter64> bloom_filter;
+    if (options.bloom_filter_enabled) {
+        bloom_filter = std::make_unique<BloomFilter64>(std::max<int64_t>(expected_entries, 1),
+                                                       options.bloom_filter_fpp, pool);
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<OutputStream> out,
+                           fs->Create(path, /*overwrite=*/true));
+    return std::unique_ptr<SortLookupStoreWriter>(new SortLookupStoreWriter(
+        path, std::move(out), options, comparator, std::move(bloom_filter)));
+}
+
+SortLookupStoreWriter::SortLookupStoreWriter(const std::string& path,
+                                             std::unique_ptr<OutputStream>&& out,
+                                             const SortLookupStoreOptions& options,
+                                             const SortLookupStoreKeyComparator& comparator,
+                                             std::unique_ptr<BloomFilter64>&& bloom_filter)
+    : path_(path),
+      out_(std::move(out)),
+      options_(options),
+      comparator_(comparator),
+      bloom_filter_(std::move(bloom_filter)) {}
+
+SortLookupStoreWriter::~SortLookupStoreWriter() {
+    if (out_) {
+        // close quietly will ignore any status error
+        auto status = out_->Close();
+        (void)status;
+    }
+}
+
+Status SortLookupStoreWriter::Put(std::string_view key, std::string_view value) {
+    if (finished_) {
+        return Status::Invalid(fmt::format("lookup file '{}' is already finished", path_));
+    }
+    if (entry_count_ > 0 && CompareKeys(comparator_, key, last_key_) <= 0) {
+        return Status::Invalid(
+            fmt::format("keys of lookup file '{}' must be put in strictly ascending order", path_));
+    }
+    block_entry_offsets_.push_back(static_cast<int32_t>(block_.size()));
+    AppendValue<int32_t>(static_cast<int32_t>(key.size()), &block_);
+    block_.append(key.data(), key.size());
+    AppendValue<int32_t>(static_cast<int32_t>(value.size()), &block_);
+    block_.append(value.data(), value.size());
+    last_key_.assign(key.data(), key.size());
+    if (bloom_filter_) {
+        bloom_filter_->AddHash(HashKey(key));
+    }
+    entry_count_++;
+    if (static_cast<int64_t>(block_.size()) >= options_.block_size) {
+        return FlushBlock();
+    }
+    return Status::OK();
+}
+
+Status SortLookupStoreWriter::FlushBlock() {
+    if (block_entry_offsets_.empty()) {
+        return Status::OK();
+    }
+    for (int32_t offset : block_entry_offsets_) {
+        AppendValue<int32_t>(offset, &block_);
+    }
+    AppendValue<int32_t>(static_cast<int32_t>(block_entry_offsets_.size()), &block_);
+    PAIMON_RETURN_NOT_OK(WriteFully(block_.data(), block_.size()));
+
+    AppendValue<int32_t>(static_cast<int32_t>(last_key_.size()), &index_block_);
+    index_block_.append(last_key_);
+    AppendValue<int64_t>(file_offset_, &index_block_);
+    AppendValue<int32_t>(static_cast<int32_t>(block_.size()), &index_block_);
+
+    file_offset_ += block_.size();
+    block_.clear();
+    block_entry_offsets_.clear();
+    return Status::OK();
+}
+
+Result<int64_t> SortLookupStoreWriter::Finish() {
+    if (finished_) {
+        return Status::Invalid(fmt::format("lookup file '{}' is already finished", path_));
+    }
+    PAIMON_RETURN_NOT_OK(FlushBlock());
+    int64_t index_offset = file_offset_;
+    PAIMON_RETURN_NOT_OK(WriteFully(index_block_.data(), index_block_.size()));
+    file_offset_ += index_block_.size();
+
+    int64_t bloom_filter_offset = file_offset_;
+    int32_t bloom_filter_size = 0;
+    int32_t num_hash_functions = 0;
+    if (bloom_filter_) {
+        const std::shared_ptr<Bytes>& bytes = bloom_filter_->GetBitSet().GetBytes();
+        bloom_filter_size = static_cast<int32_t>(bytes->size());
+        num_hash_functions = bloom_filter_->GetNumHashFunctions();
+        PAIMON_RETURN_NOT_OK(WriteFully(bytes->data(), bytes->size()));
+        file_offset_ += bloom_filter_size;
+    }
+
+    std::string footer;
+    footer.reserve(FOOTER_SIZE);
+    AppendValue<int64_t>(index_offset, &footer);
+    AppendValue<int32_t>(static_cast<int32_t>(index_block_.size()), &footer);
+    AppendValue<int64_t>(bloom_filter_offset, &footer);
+    AppendValue<int32_t>(bloom_filter_size, &footer);
+    AppendValue<int32_t>(num_hash_functions, &footer);
+    AppendValue<int64_t>(entry_count_, &footer);
+    AppendValue<int32_t>(MAGIC_NUMBER, &footer);
+    PAIMON_RETURN_NOT_OK(WriteFully(footer.data(), footer.size()));
+    file_offset_ += footer.size();
+
+    finished_ = true;
+    std::unique_ptr<OutputStream> out = std::move(out_);
+    PAIMON_RETURN_NOT_OK(out->Flush());
+    PAIMON_RETURN_NOT_OK(out->Close());
+    return file_offset_;
+}
+
+Status SortLookupStoreWriter::WriteFully(const char* data, size_t size) {
+    size_t written = 0;
+    while (written < size) {
+        PAIMON_ASSIGN_OR_RAISE(int32_t length,
+                               out_->Write(data + written, static_cast<uint32_t>(size - written)));
+        if (length <= 0) {
+            return Status::IOError(fmt::format("write lookup file '{}' fail, written {} of {}",
+                                               path_, written, size));
+        }
+        written += static_cast<size_t>(length);
+    }
+    return Status::OK();
+}
+
+Result<std::unique_ptr<SortLookupStoreReader>> SortLookupStoreReader::Open(
+    const std::shared_ptr<FileSystem>& fs, const std::string& path,
+    const SortLookupStoreKeyComparator& comparator,
+    const std::shared_ptr<BlockCache>& block_cache, const std::shared_ptr<MemoryPool>& pool) {
+    Result<std::unique_ptr<InputStream>> in = fs->Open(path);
+    if (!in.ok()) {
+        return Status::IOError(
+            fmt::format("open lookup file '{}' fail, {}", path, in.status().ToString()));
+    }
+    PAIMON_ASSIGN_OR_RAISE(uint64_t size, in.value()->Length());
+    if (size < FOOTER_SIZE) {
+        return Status::Invalid(
+            fmt::format("lookup file '{}' is corrupted, file size {} is too small", path, size));
+    }
+    auto reader = std::unique_ptr<SortLookupStoreReader>(new SortLookupStoreReader(
+        path, std::move(in).value(), size, comparator, block_cache, pool));
+    PAIMON_RETURN_NOT_OK(reader->Init());
+    return reader;
+}
+
+SortLookupStoreReader::SortLookupStoreReader(const std::string& path,
+                                             std::unique_ptr<InputStream>&& in, uint64_t size,
+                                             const SortLookupStoreKeyComparator& comparator,
+                                             const std::shared_ptr<BlockCache>& block_cache,
+                                             const std::shared_ptr<MemoryPool>& pool)
+    : path_(path),
+      in_(std::move(in)),
+      size_(size),
+      comparator_(comparator),
+      block_cache_(block_cache),
+      pool_(pool) {}
+
+SortLookupStoreReader::~SortLookupStoreReader() {
+    if (block_cache_) {
+        // the file is about to be deleted, its blocks will never be looked up again
+        block_cache_->Invalidate(path_);
+    }
+    if (in_) {
+        // close quietly will ignore any status error
+        auto status = in_->Close();
+        (void)status;
+    }
+}
+
+Status SortLookupStoreReader::Init() {
+    char footer[FOOTER_SIZE];
+    PAIMON_RETURN_NOT_OK(in_->Read(footer, FOOTER_SIZE, size_ - FOOTER_SIZE));
+    auto index_offset = ReadValue<int64_t>(footer);
+    auto index_size = ReadValue<int32_t>(footer + 8);
+    auto bloom_filter_offset = ReadValue<int64_t>(footer + 12);
+    auto bloom_filter_size = ReadValue<int32_t>(footer + 20);
+    auto num_hash_functions = ReadValue<int32_t>(footer + 24);
+    entry_count_ = ReadValue<int64_t>(footer + 28);
+    auto magic = ReadValue<int32_t>(footer + 36);
+    auto footer_offset = static_cast<int64_t>(size_ - FOOTER_SIZE);
+    if (magic != MAGIC_NUMBER || index_offset < 0 || index_size < 0 ||
+        index_offset + index_size > footer_offset || bloom_filter_offset < 0 ||
+        bloom_filter_size < 0 || bloom_filter_offset + bloom_filter_size > footer_offset) {
+        return Status::Invalid(fmt::format("lookup file '{}' is corrupted", path_));
+    }
+
+    index_block_.resize(index_size);
+    if (index_size > 0) {
+        PAIMON_RETURN_NOT_OK(in_->Read(index_block_.data(), index_size, index_offset));
+    }
+    const char* index = index_block_.data();
+    const char* index_end = index + index_size;
+    while (index < index_end) {
+        auto key_size = ReadValue<int32_t>(index);
+        index += sizeof(int32_t);
+        std::string_view last_key(index, key_size);
+        index += key_size;
+        auto block_offset = ReadValue<int64_t>(index);
+        index += sizeof(int64_t);
+        auto block_size = ReadValue<int32_t>(index);
+        index += sizeof(int32_t);
+        blocks_.push_back({last_key, block_offset, block_size});
+    }
+
+    if (bloom_filter_size > 0) {
+        std::shared_ptr<Bytes> bytes = Bytes::AllocateBytes(bloom_filter_size, pool_.get());
+        PAIMON_RETURN_NOT_OK(in_->Read(bytes->data(), bloom_filter_size, bloom_filter_offset));
+        bloom_filter_ = std::make_unique<BloomFilter64>(
+            num_hash_functions, std::make_unique<BloomFilter64::BitSet>(bytes, /*offset=*/0));
+    }
+    return Status::OK();
+}
+
+int32_t SortLookupStoreReader::Compare(std::string_view lhs, std::string_view rhs) const {
+    return CompareKeys(comparator_, lhs, rhs);
+}
+
+Result<std::optional<std::string>> SortLookupStoreReader::Lookup(std::string_view key) const {
+    if (bloom_filter_ && !bloom_filter_->TestHash(HashKey(key))) {
+        return std::optional<std::string>();
+    }
+    // the first block whose last key is not less than the key
+    auto iter = std::lower_bound(blocks_.begin(), blocks_.end(), key,
+                                 [this](const BlockHandle& block, std::string_view target) {
+                                     return Compare(block.last_key, target) < 0;
+                                 });
+    if (iter == blocks_.end()) {
+        return std::optional<std::string>();
+    }
+    return LookupInBlock(static_cast<size_t>(iter - blocks_.begin()), key);
+}
+
+Result<std::shared_ptr<Bytes>> SortLookupStoreReader::ReadBlock(size_t block_index) const {
+    const BlockHandle& block = blocks_[block_index];
+    auto loader = [this, &block]() -> Result<std::shared_ptr<Bytes>> {
+        // read with offset does not change the position of the stream, so lookups may run
+        // concurrently
+        std::shared_ptr<Bytes> bytes = Bytes::AllocateBytes(block.size, pool_.get());
+        PAIMON_RETURN_NOT_OK(in_->Read(bytes->data(), block.size, block.offset));
+        return bytes;
+    };
+    if (block_cache_ == nullptr) {
+        return loader();
+    }
+    return block_cache_->GetOrLoad(BlockKey{path_, size_, block_index}, loader);
+}
+
+Result<std::optional<std::string>> SortLookupStoreReader::LookupInBlock(
+    size_t block_index, std::string_view key) const {
+    const BlockHandle& block = blocks_[block_index];
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<Bytes> buffer, ReadBlock(block_index));
+    const char* block_data = buffer->data();
+    const char* block_end = block_data + block.size;
+    auto entry_count = ReadValue<int32_t>(block_end - sizeof(int32_t));
+    const char* entry_offsets = block_end - sizeof(int32_t) * (entry_count + 1);
+    if (entry_count <= 0 || entry_offsets < block_data) {
+        return Status::Invalid(fmt::format("block at offset {} of lookup file '{}' is corrupted",
+                                           block.offset, path_));
+    }
+    int32_t low = 0;
+    int32_t high = entry_count - 1;
+    while (low <= high) {
+        int32_t mid = low + (high - low) / 2;
+        const char* entry = block_data + ReadValue<int32_t>(entry_offsets + sizeof(int32_t) * mid);
+        auto key_size = ReadValue<int32_t>(entry);
+        std::string_view entry_key(entry + sizeof(int32_t), key_size);
+        int32_t result = Compare(entry_key, key);
+        if (result < 0) {
+            low = mid + 1;
+        } else if (result > 0) {
+            high = mid - 1;
+        } else {
+            const char* value = entry + sizeof(int32_t) + key_size;
+            auto value_size = ReadValue<int32_t>(value);
+            return std::optional<std::string>(std::string(value + sizeof(int32_t), value_size));
+        }
+    }
+    return std::optional<std::string>();
+}
+
+}  // namespace paimon
@@ -0,0 +1,166 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "paimon/common/utils/bloom_filter64.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace paimon {
+class BlockCache;
+class Bytes;
+class FileSystem;
+class InputStream;
+class MemoryPool;
+class OutputStream;
+
+/// Compares two keys of a sort lookup store, returns a negative value, zero or a positive value
+/// if the first key is less than, equal to or greater than the second one.
+using SortLookupStoreKeyComparator = std::function<int32_t(std::string_view, std::string_view)>;
+
+/// Options of a sort lookup store file.
+struct SortLookupStoreOptions {
+    /// Target size of a data block, a block is sealed once its size exceeds this value.
+    int64_t block_size = 64 * 1024;
+    bool bloom_filter_enabled = true;
+    double bloom_filter_fpp = 0.05;
+};
+
+/// Writes a key-value file whose keys are ordered by a `SortLookupStoreKeyComparator`, or by
+/// their bytes if no comparator is given. Keys must be put in strictly ascending order, so a
+/// sorted input can be written without buffering it.
+///
+/// The file is laid out as:
+/// ```
+/// +--------------+-----+--------------+-------------+--------------+--------+
+/// | data block 0 | ... | data block n | index block | bloom filter | footer |
+/// +--------------+-----+--------------+-------------+--------------+--------+
+/// ```
+/// A data block holds its entries (key length, key, value length, value) followed by the
+/// offsets of the entries and the entry count, so that a block can be binary searched. The index
+/// block holds the last key, offset and size of each data block.
+class SortLookupStoreWriter {
+ public:
+    /// @param expected_entries Number of entries expected to be put, used to size the bloom filter.
+    /// @param comparator Comparator of the keys, may be nullptr to compare keys by their bytes.
+    static Result<std::unique_ptr<SortLookupStoreWriter>> Create(
+        const std::shared_ptr<FileSystem>& fs, const std::string& path,
+        const SortLookupStoreOptions& options, int64_t expected_entries,
+        const SortLookupStoreKeyComparator& comparator, const std::shared_ptr<MemoryPool>& pool);
+
+    ~SortLookupStoreWriter();
+
+    Status Put(std::string_view key, std::string_view value);
+
+    /// Flushes the remaining entries, index block, bloom filter and footer to the file.
+    /// @return The size of the file.
+    Result<int64_t> Finish();
+
+ private:
+    SortLookupStoreWriter(const std::string& path, std::unique_ptr<OutputStream>&& out,
+                          const SortLookupStoreOptions& options,
+                          const SortLookupStoreKeyComparator& comparator,
+                          std::unique_ptr<BloomFilter64>&& bloom_filter);
+
+    Status FlushBlock();
+    Status WriteFully(const char* data, size_t size);
+
+ private:
+    std::string path_;
+    std::unique_ptr<OutputStream> out_;
+    SortLookupStoreOptions options_;
+    SortLookupStoreKeyComparator comparator_;
+    std::unique_ptr<BloomFilter64> bloom_filter_;
+
+    std::string block_;
+    std::vector<int32_t> block_entry_offsets_;
+    std::string last_key_;
+    std::string index_block_;
+    int64_t file_offset_ = 0;
+    int64_t entry_count_ = 0;
+    bool finished_ = false;
+};
+
+/// Reads a file written by `SortLookupStoreWriter`. The index block and bloom filter are loaded
+/// when the file is opened, a lookup first checks the bloom filter, then binary searches the
+/// index block and the only data block which may contain the key. The data blocks are kept in
+/// the block cache if any, so that the lookups of hot keys do not read the file again. Lookups
+/// may run concurrently.
+class SortLookupStoreReader {
+ public:
+    /// @param comparator Comparator of the keys, must be the same as the one of the writer.
+    /// @param block_cache Cache of the data blocks, which may be shared by many readers. The
+    /// blocks are read from the file on each lookup if it is nullptr.
+    static Result<std::unique_ptr<SortLookupStoreReader>> Open(
+        const std::shared_ptr<FileSystem>& fs, const std::string& path,
+        const SortLookupStoreKeyComparator& comparator,
+        const std::shared_ptr<BlockCache>& block_cache, const std::shared_ptr<MemoryPool>& pool);
+
+    ~SortLookupStoreReader();
+
+    /// @return The value of the key, or std::nullopt if the key does not exist.
+    Result<std::optional<std::string>> Lookup(std::string_view key) const;
+
+    int64_t FileSize() const {
+        return static_cast<int64_t>(size_);
+    }
+    int64_t EntryCount() const {
+        return entry_count_;
+    }
+
+ private:
+    struct BlockHandle {
+        std::string_view last_key;
+        int64_t offset;
+        int32_t size;
+    };
+
+    SortLookupStoreReader(const std::string& path, std::unique_ptr<InputStream>&& in,
+                          uint64_t size, const SortLookupStoreKeyComparator& comparator,
+                          const std::shared_ptr<BlockCache>& block_cache,
+                          const std::shared_ptr<MemoryPool>& pool);
+
+    Status Init();
+    int32_t Compare(std::string_view lhs, std::string_view rhs) const;
+    Result<std::shared_ptr<Bytes>> ReadBlock(size_t block_index) const;
+    Result<std::optional<std::string>> LookupInBlock(size_t block_index,
+                                                     std::string_view key) const;
+
+ private:
+    std::string path_;
+    std::unique_ptr<InputStream> in_;
+    uint64_t size_;
+    SortLookupStoreKeyComparator comparator_;
+    std::shared_ptr<BlockCache> block_cache_;
+    std::shared_ptr<MemoryPool> pool_;
+    int64_t entry_count_ = 0;
+    // holds the last keys of the blocks
+    std::string index_block_;
+    std::vector<BlockHandle> blocks_;
+    std::unique_ptr<BloomFilter64> bloom_filter_;
+};
+
+}  // namespace paimon
@@ -0,0 +1,206 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/lookup/sort_lookup_store.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "fmt/format.h"
+#include "gtest/gtest.h"
+#include "paimon/common/fs/block_cache.h"
+#include "paimon/common/utils/path_util.h"
+#include "paimon/fs/local/local_file_system.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/metrics.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+class SortLookupStoreTest : public ::testing::TestWithParam<bool> {
+ public:
+    void SetUp() override {
+        dir_ = UniqueTestDirectory::Create();
+        ASSERT_TRUE(dir_);
+        fs_ = std::make_shared<LocalFileSystem>();
+        pool_ = GetDefaultPool();
+    }
+
+    static std::string Key(int32_t i) {
+        return fmt::format("key-{:06d}", i);
+    }
+
+ protected:
+    std::unique_ptr<UniqueTestDirectory> dir_;
+    std::shared_ptr<FileSystem> fs_;
+    std::shared_ptr<MemoryPool> pool_;
+};
+
+TEST_P(SortLookupStoreTest, TestWriteAndLookup) {
+    SortLookupStoreOptions options;
+    // use a small block size to write multiple blocks
+    options.block_size = 256;
+    options.bloom_filter_enabled = GetParam();
+    std::string path = PathUtil::JoinPath(dir_->Str(), "test.lookup");
+    int32_t entry_count = 1000;
+    ASSERT_OK_AND_ASSIGN(auto writer,
+                         SortLookupStoreWriter::Create(fs_, path, options, entry_count,
+                                                       /*comparator=*/nullptr, pool_));
+    // only put even keys
+    for (int32_t i = 0; i < entry_count * 2; i += 2) {
+        ASSERT_OK(writer->Put(Key(i), "value-" + std::to_string(i)));
+    }
+    ASSERT_OK_AND_ASSIGN(int64_t file_size, writer->Finish());
+
+    ASSERT_OK_AND_ASSIGN(auto reader, SortLookupStoreReader::Open(
+                                          fs_, path, /*comparator=*/nullptr,
+                                          /*block_cache=*/nullptr, pool_));
+    ASSERT_EQ(file_size, reader->FileSize());
+    ASSERT_EQ(entry_count, reader->EntryCount());
+    for (int32_t i = 0; i < entry_count * 2; i++) {
+        ASSERT_OK_AND_ASSIGN(std::optional<std::string> value, reader->Lookup(Key(i)));
+        if (i % 2 == 0) {
+            ASSERT_TRUE(value);
+            ASSERT_EQ("value-" + std::to_string(i), value.value());
+        } else {
+            ASSERT_FALSE(value);
+        }
+    }
+    ASSERT_OK_AND_ASSIGN(std::optional<std::string> value, reader->Lookup("zzz"));
+    ASSERT_FALSE(value);
+    ASSERT_OK_AND_ASSIGN(value, reader->Lookup(""));
+    ASSERT_FALSE(value);
+}
+
+TEST_P(SortLookupStoreTest, TestEmptyFile) {
+    SortLookupStoreOptions options;
+    options.bloom_filter_enabled = GetParam();
+    std::string path = PathUtil::JoinPath(dir_->Str(), "empty.lookup");
+    ASSERT_OK_AND_ASSIGN(auto writer, SortLookupStoreWriter::Create(fs_, path, options, 0,
+                                                                    /*comparator=*/nullptr, pool_));
+    ASSERT_OK(writer->Finish());
+    ASSERT_OK_AND_ASSIGN(auto reader, SortLookupStoreReader::Open(
+                                          fs_, path, /*comparator=*/nullptr,
+                                          /*block_cache=*/nullptr, pool_));
+    ASSERT_EQ(0, reader->EntryCount());
+    ASSERT_OK_AND_ASSIGN(std::optional<std::string> value, reader->Lookup(Key(0)));
+    ASSERT_FALSE(value);
+}
+
+TEST_P(SortLookupStoreTest, TestInvalidCase) {
+    SortLookupStoreOptions options;
+    options.bloom_filter_enabled = GetParam();
+    std::string path = PathUtil::JoinPath(dir_->Str(), "invalid.lookup");
+    ASSERT_OK_AND_ASSIGN(auto writer, SortLookupStoreWriter::Create(fs_, path, options, 2,
+                                                                    /*comparator=*/nullptr, pool_));
+    ASSERT_OK(writer->Put(Key(1), "v1"));
+    ASSERT_NOK_WITH_MSG(writer->Put(Key(1), "v1"), "must be put in strictly ascending order");
+    ASSERT_NOK_WITH_MSG(writer->Put(Key(0), "v0"), "must be put in strictly ascending order");
+    ASSERT_OK(writer->Finish());
+    ASSERT_NOK_WITH_MSG(writer->Put(Key(2), "v2"), "is already finished");
+
+    ASSERT_NOK_WITH_MSG(SortLookupStoreReader::Open(fs_, dir_->Str() + "/non-exist",
+                                                    /*comparator=*/nullptr,
+                                                    /*block_cache=*/nullptr, pool_),
+                        "open lookup file");
+}
+
+TEST_P(SortLookupStoreTest, TestKeyComparator) {
+    SortLookupStoreOptions options;
+    options.block_size = 64;
+    options.bloom_filter_enabled = GetParam();
+    // keys are ordered by their numeric values, which differs from their byte order
+    SortLookupStoreKeyComparator comparator = [](std::string_view lhs, std::string_view rhs) {
+        int64_t lhs_value = std::stoll(std::string(lhs));
+        int64_t rhs_value = std::stoll(std::string(rhs));
+        return lhs_value < rhs_value ? -1 : (lhs_value > rhs_value ? 1 : 0);
+    };
+    std::string path = PathUtil::JoinPath(dir_->Str(), "comparator.lookup");
+    int32_t entry_count = 200;
+    ASSERT_OK_AND_ASSIGN(auto writer, SortLookupStoreWriter::Create(
+                                          fs_, path, options, entry_count, comparator, pool_));
+    for (int32_t i = 0; i < entry_count; i++) {
+        ASSERT_OK(writer->Put(std::to_string(i * 3), "value-" + std::to_string(i * 3)));
+    }
+    ASSERT_NOK_WITH_MSG(writer->Put("100", "v"), "must be put in strictly ascending order");
+    ASSERT_OK(writer->Finish());
+
+    ASSERT_OK_AND_ASSIGN(auto reader,
+                         SortLookupStoreReader::Open(fs_, path, comparator,
+                                                     /*block_cache=*/nullptr, pool_));
+    for (int32_t i = 0; i < entry_count * 3; i++) {
+        ASSERT_OK_AND_ASSIGN(std::optional<std::string> value,
+                             reader->Lookup(std::to_string(i)));
+        if (i % 3 == 0) {
+            ASSERT_TRUE(value);
+            ASSERT_EQ("value-" + std::to_string(i), value.value());
+        } else {
+            ASSERT_FALSE(value);
+        }
+    }
+}
+
+TEST_P(SortLookupStoreTest, TestBlockCache) {
+    SortLookupStoreOptions options;
+    options.block_size = 256;
+    options.bloom_filter_enabled = GetParam();
+    std::string path = PathUtil::JoinPath(dir_->Str(), "cached.lookup");
+    int32_t entry_count = 100;
+    ASSERT_OK_AND_ASSIGN(auto writer, SortLookupStoreWriter::Create(fs_, path, options, entry_count,
+                                                                    /*comparator=*/nullptr, pool_));
+    for (int32_t i = 0; i < entry_count; i++) {
+        ASSERT_OK(writer->Put(Key(i), "value-" + std::to_string(i)));
+    }
+    ASSERT_OK(writer->Finish());
+
+    ASSERT_OK_AND_ASSIGN(auto block_cache,
+                         BlockCache::Create(dir_->Str(), options.block_size,
+                                            /*max_memory_size=*/1024 * 1024, /*max_disk_size=*/0,
+                                            /*executor=*/nullptr, pool_));
+    auto get_counter = [&](const std::string& name) {
+        return block_cache->GetMetrics()->GetCounter(name).value();
+    };
+    ASSERT_OK_AND_ASSIGN(auto reader, SortLookupStoreReader::Open(fs_, path,
+                                                                  /*comparator=*/nullptr,
+                                                                  block_cache, pool_));
+    for (int32_t i = 0; i < entry_count; i++) {
+        ASSERT_OK_AND_ASSIGN(std::optional<std::string> value, reader->Lookup(Key(i)));
+        ASSERT_EQ("value-" + std::to_string(i), value.value());
+    }
+    // each data block is read from the file only once
+    uint64_t block_count = get_counter(BlockCacheMetrics::BLOCK_CACHE_MISS_COUNT);
+    ASSERT_GT(block_count, 1U);
+    ASSERT_EQ(entry_count - block_count,
+              get_counter(BlockCacheMetrics::BLOCK_CACHE_MEMORY_HIT_COUNT));
+    for (int32_t i = 0; i < entry_count; i++) {
+        ASSERT_OK_AND_ASSIGN(std::optional<std::string> value, reader->Lookup(Key(i)));
+        ASSERT_EQ("value-" + std::to_string(i), value.value());
+    }
+    ASSERT_EQ(block_count, get_counter(BlockCacheMetrics::BLOCK_CACHE_MISS_COUNT));
+    ASSERT_EQ(2 * entry_count - block_count,
+              get_counter(BlockCacheMetrics::BLOCK_CACHE_MEMORY_HIT_COUNT));
+    ASSERT_GT(block_cache->MemorySize(), 0);
+
+    // the blocks are dropped with the reader
+    reader.reset();
+    ASSERT_EQ(0, block_cache->MemorySize());
+}
+
+INSTANTIATE_TEST_SUITE_P(BloomFilterEnabled, SortLookupStoreTest, ::testing::Values(false, true));
+
+}  // namespace paimon::test
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/metrics/histogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace paimon {
+
+Histogram::Histogram() : min_(std::numeric_limits<uint64_t>::max()) {
+    for (auto& bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+int32_t Histogram::BucketIndex(uint64_t value) {
+    if (value < static_cast<uint64_t>(SUB_BUCKET_COUNT)) {
+        return static_cast<int32_t>(value);
+    }
+    int32_t highest_bit = 63 - __builtin_clzll(value);
+    int32_t shift = highest_bit - SUB_BUCKET_BITS;
+    auto sub_bucket = static_cast<int32_t>((value >> shift) & (SUB_BUCKET_COUNT - 1));
+    return (shift + 1) * SUB_BUCKET_COUNT + sub_bucket;
+}
+
+uint64_t Histogram::BucketUpperBound(int32_t index) {
+    if (index < SUB_BUCKET_COUNT) {
+        return static_cast<uint64_t>(index);
+    }
+    int32_t shift = index / SUB_BUCKET_COUNT - 1;
+    auto sub_bucket = static_cast<uint64_t>(index % SUB_BUCKET_COUNT);
+    uint64_t lower_bound = (static_cast<uint64_t>(SUB_BUCKET_COUNT) + sub_bucket) << shift;
+    return lower_bound + ((static_cast<uint64_t>(1) << shift) - 1);
+}
+
+void Histogram::Record(uint64_t value) {
+    buckets_[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+    uint64_t current_min = min_.load(std::memory_order_relaxed);
+    while (value < current_min &&
+           !min_.compare_exchange_weak(current_min, value, std::memory_order_relaxed)) {
+    }
+    uint64_t current_max = max_.load(std::memory_order_relaxed);
+    while (value > current_max &&
+           !max_.compare_exchange_weak(current_max, value, std::memory_order_relaxed)) {
+    }
+}
+
+void Histogram::Merge(const Histogram& other) {
+    if (this == &other || other.Count() == 0) {
+        return;
+    }
+    for (int32_t i = 0; i < BUCKET_COUNT; i++) {
+        uint64_t bucket_count = other.buckets_[i].load(std::memory_order_relaxed);
+        if (bucket_count > 0) {
+            buckets_[i].fetch_add(bucket_count, std::memory_order_relaxed);
+        }
+    }
+    count_.fetch_add(other.count_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    sum_.fetch_add(other.sum_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    uint64_t other_min = other.min_.load(std::memory_order_relaxed);
+    uint64_t current_min = min_.load(std::memory_order_relaxed);
+    while (other_min < current_min &&
+           !min_.compare_exchange_weak(current_min, other_min, std::memory_order_relaxed)) {
+    }
+    uint64_t other_max = other.max_.load(std::memory_order_relaxed);
+    uint64_t current_max = max_.load(std::memory_order_relaxed);
+    while (other_max > current_max &&
+           !max_.compare_exchange_weak(current_max, other_max, std::memory_order_relaxed)) {
+    }
+}
+
+uint64_t Histogram::ValueAtPercentile(double percentile) const {
+    uint64_t count = Count();
+    if (count == 0) {
+        return 0;
+    }
+    percentile = std::clamp(percentile, 0.0, 100.0);
+    auto rank = static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(count)));
+    rank = std::max<uint64_t>(rank, 1);
+    uint64_t accumulated = 0;
+    for (int32_t i = 0; i < BUCKET_COUNT; i++) {
+        accumulated += buckets_[i].load(std::memory_order_relaxed);
+        if (accumulated >= rank) {
+            uint64_t value = std::min(BucketUpperBound(i), max_.load(std::memory_order_relaxed));
+            return std::max(value, min_.load(std::memory_order_relaxed));
+        }
+    }
+    return max_.load(std::memory_order_relaxed);
+}
+
+HistogramStats Histogram::GetStats() const {
+    HistogramStats stats;
+    stats.count = Count();
+    if (stats.count == 0) {
+        return stats;
+    }
+    stats.min = min_.load(std::memory_order_relaxed);
+    stats.max = max_.load(std::memory_order_relaxed);
+    stats.mean = static_cast<double>(sum_.load(std::memory_order_relaxed)) /
+                 static_cast<double>(stats.count);
+    stats.p50 = ValueAtPercentile(50);
+    stats.p95 = ValueAtPercentile(95);
+    stats.p99 = ValueAtPercentile(99);
+    return stats;
+}
+
+}  // namespace paimon
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "paimon/metrics.h"
+#include "paimon/visibility.h"
+
+namespace paimon {
+
+/// A lock-free histogram of non-negative values, e.g., latencies in microseconds.
+///
+/// Values are counted in log-linear buckets: every power of two range is split into
+/// `SUB_BUCKET_COUNT` linear sub buckets, so a percentile is reported with a relative error of
+/// at most 1 / `SUB_BUCKET_COUNT`. Recording a value only touches atomic counters, so a histogram
+/// can be shared by multiple threads.
+class PAIMON_EXPORT Histogram {
+ public:
+    static constexpr int32_t SUB_BUCKET_BITS = 4;
+    static constexpr int32_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+    static constexpr int32_t BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+    Histogram();
+    Histogram(const Histogram&) = delete;
+    Histogram& operator=(const Histogram&) = delete;
+
+    void Record(uint64_t value);
+
+    /// Adds all values recorded by `other` to this histogram.
+    void Merge(const Histogram& other);
+
+    uint64_t Count() const {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+    /// @param percentile Percentile in [0, 100].
+    /// @return The upper bound of the bucket which holds the value at the percentile, or 0 if the
+    /// histogram is empty.
+    uint64_t ValueAtPercentile(double percentile) const;
+
+    HistogramStats GetStats() const;
+
+ private:
+    static int32_t BucketIndex(uint64_t value);
+    static uint64_t BucketUpperBound(int32_t index);
+
+ private:
+    std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets_;
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sum_{0};
+    std::atomic<uint64_t> min_;
+    std::atomic<uint64_t> max_{0};
+};
+
+}  // namespace paimon
@@ -0,0 +1,146 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/metrics/histogram.h"
+
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "paimon/common/metrics/metrics_impl.h"
+#include "paimon/common/metrics/scoped_timer.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+TEST(HistogramTest, TestEmpty) {
+    Histogram histogram;
+    HistogramStats stats = histogram.GetStats();
+    ASSERT_EQ(0, stats.count);
+    ASSERT_EQ(0, stats.min);
+    ASSERT_EQ(0, stats.max);
+    ASSERT_EQ(0, stats.p99);
+    ASSERT_EQ(0, histogram.ValueAtPercentile(50));
+}
+
+TEST(HistogramTest, TestSmallValuesAreExact) {
+    Histogram histogram;
+    for (uint64_t i = 1; i <= 10; i++) {
+        histogram.Record(i);
+    }
+    HistogramStats stats = histogram.GetStats();
+    ASSERT_EQ(10, stats.count);
+    ASSERT_EQ(1, stats.min);
+    ASSERT_EQ(10, stats.max);
+    ASSERT_DOUBLE_EQ(5.5, stats.mean);
+    ASSERT_EQ(5, stats.p50);
+    ASSERT_EQ(10, stats.p95);
+    ASSERT_EQ(10, stats.p99);
+    ASSERT_EQ(1, histogram.ValueAtPercentile(0));
+}
+
+TEST(HistogramTest, TestPercentileRelativeError) {
+    Histogram histogram;
+    for (uint64_t i = 1; i <= 100000; i++) {
+        histogram.Record(i);
+    }
+    for (double percentile : {10.0, 50.0, 90.0, 95.0, 99.0, 99.9}) {
+        auto expected = static_cast<double>(percentile * 1000);
+        auto actual = static_cast<double>(histogram.ValueAtPercentile(percentile));
+        ASSERT_GE(actual, expected) << percentile;
+        ASSERT_LE(actual, expected * (1 + 1.0 / Histogram::SUB_BUCKET_COUNT)) << percentile;
+    }
+    ASSERT_EQ(100000, histogram.ValueAtPercentile(100));
+}
+
+TEST(HistogramTest, TestExtremeValues) {
+    Histogram histogram;
+    histogram.Record(0);
+    histogram.Record(std::numeric_limits<uint64_t>::max());
+    HistogramStats stats = histogram.GetStats();
+    ASSERT_EQ(0, stats.min);
+    ASSERT_EQ(std::numeric_limits<uint64_t>::max(), stats.max);
+    ASSERT_EQ(0, stats.p50);
+    ASSERT_EQ(std::numeric_limits<uint64_t>::max(), stats.p99);
+}
+
+TEST(HistogramTest, TestMerge) {
+    Histogram histogram;
+    histogram.Record(100);
+    Histogram other;
+    other.Record(1);
+    other.Record(1000);
+    histogram.Merge(other);
+    histogram.Merge(histogram);
+    HistogramStats stats = histogram.GetStats();
+    ASSERT_EQ(3, stats.count);
+    ASSERT_EQ(1, stats.min);
+    ASSERT_EQ(1000, stats.max);
+    ASSERT_DOUBLE_EQ(367.0, stats.mean);
+}
+
+TEST(HistogramTest, TestConcurrentRecord) {
+    Histogram histogram;
+    int32_t thread_count = 4;
+    int32_t record_count = 10000;
+    std::vector<std::thread> threads;
+    for (int32_t i = 0; i < thread_count; i++) {
+        threads.emplace_back([&histogram, record_count]() {
+            for (int32_t j = 1; j <= record_count; j++) {
+                histogram.Record(j);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    HistogramStats stats = histogram.GetStats();
+    ASSERT_EQ(thread_count * record_count, stats.count);
+    ASSERT_EQ(1, stats.min);
+    ASSERT_EQ(record_count, stats.max);
+    ASSERT_DOUBLE_EQ((record_count + 1) / 2.0, stats.mean);
+}
+
+TEST(HistogramTest, TestScopedTimer) {
+    auto metrics = std::make_shared<MetricsImpl>();
+    std::shared_ptr<Histogram> histogram = metrics->GetOrCreateHistogram("latency");
+    {
+        ScopedTimer timer(histogram.get());
+        ScopedTimer named_timer(metrics.get(), "named_latency");
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        named_timer.Stop();
+        // stop twice is no-op
+        named_timer.Stop();
+    }
+    ASSERT_OK_AND_ASSIGN(HistogramStats stats, metrics->GetHistogram("latency"));
+    ASSERT_EQ(1, stats.count);
+    ASSERT_GE(stats.max, 2000);
+    ASSERT_OK_AND_ASSIGN(stats, metrics->GetHistogram("named_latency"));
+    ASSERT_EQ(1, stats.count);
+    ASSERT_GE(stats.max, 2000);
+}
+
+TEST(HistogramTest, TestStopWatch) {
+    StopWatch watch;
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    uint64_t elapsed_us = watch.ElapsedUs();
+    ASSERT_GE(elapsed_us, 2000);
+    ASSERT_GE(watch.ElapsedUs(), elapsed_us);
+}
+
+}  // namespace paimon::test
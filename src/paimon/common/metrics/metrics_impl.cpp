@@ -46,6 +46,41 @@ std::map<std::string, uint64_t> MetricsImpl::GetAllCounters() const {
     return counters_;
 }
 
+void MetricsImpl::ObserveHistogram(const std::string& metric_name, uint64_t value) {
+    GetOrCreateHistogram(metric_name)->Record(value);
+}
+
+std::shared_ptr<Histogram> MetricsImpl::GetOrCreateHistogram(const std::string& metric_name) {
+    std::lock_guard<std::mutex> guard(histogram_lock_);
+    std::shared_ptr<Histogram>& histogram = histograms_[metric_name];
+    if (!histogram) {
+        histogram = std::make_shared<Histogram>();
+    }
+    return histogram;
+}
+
+Result<HistogramStats> MetricsImpl::GetHistogram(const std::string& metric_name) const {
+    std::lock_guard<std::mutex> guard(histogram_lock_);
+    auto iter = histograms_.find(metric_name);
+    if (iter != histograms_.end()) {
+        return iter->second->GetStats();
+    }
+    return Status::KeyError(fmt::format("metric '{}' not found", metric_name));
+}
+
+std::map<std::string, HistogramStats> MetricsImpl::GetAllHistograms() const {
+    std::map<std::string, HistogramStats> stats;
+    for (const auto& [name, histogram] : GetHistogramsSnapshot()) {
+        stats[name] = histogram->GetStats();
+    }
+    return stats;
+}
+
+std::map<std::string, std::shared_ptr<Histogram>> MetricsImpl::GetHistogramsSnapshot() const {
+    std::lock_guard<std::mutex> guard(histogram_lock_);
+    return histograms_;
+}
+
 void MetricsImpl::Merge(const std::shared_ptr<Metrics>& other) {
     if (other && this != other.get()) {
         std::map<std::string, uint64_t> other_counters = other->GetAllCounters();
@@ -58,14 +93,34 @@ void MetricsImpl::Merge(const std::shared_ptr<Metrics>& other) {
                 counters_[kv.first] += kv.second;
             }
         }
+        auto other_impl = std::dynamic_pointer_cast<MetricsImpl>(other);
+        if (other_impl) {
+            for (const auto& [name, histogram] : other_impl->GetHistogramsSnapshot()) {
+                GetOrCreateHistogram(name)->Merge(*histogram);
+            }
+        }
     }
 }
 
 void MetricsImpl::Overwrite(const std::shared_ptr<Metrics>& other) {
     if (other && this != other.get()) {
         std::map<std::string, uint64_t> other_counters = other->GetAllCounters();
-        std::lock_guard<std::mutex> guard(counter_lock_);
-        counters_.swap(other_counters);
+        {
+            std::lock_guard<std::mutex> guard(counter_lock_);
+            counters_.swap(other_counters);
+        }
+        std::map<std::string, std::shared_ptr<Histogram>> histograms;
+        auto other_impl = std::dynamic_pointer_cast<MetricsImpl>(other);
+        if (other_impl) {
+            // copy the histograms, so that later records of other do not affect this
+            for (const auto& [name, histogram] : other_impl->GetHistogramsSnapshot()) {
+                auto copied = std::make_shared<Histogram>();
+                copied->Merge(*histogram);
+                histograms[name] = copied;
+            }
+        }
+        std::lock_guard<std::mutex> guard(histogram_lock_);
+        histograms_.swap(histograms);
     }
 }
 
@@ -81,6 +136,18 @@ std::string MetricsImpl::ToString() const {
         doc.AddMember(rapidjson::Value(kv.first, allocator), rapidjson::Value(kv.second),
                       allocator);
     }
+    std::map<std::string, HistogramStats> histograms = GetAllHistograms();
+    for (const auto& [name, stats] : histograms) {
+        rapidjson::Value value(rapidjson::kObjectType);
+        value.AddMember("count", stats.count, allocator);
+        value.AddMember("min", stats.min, allocator);
+        value.AddMember("max", stats.max, allocator);
+        value.AddMember("mean", stats.mean, allocator);
+        value.AddMember("p50", stats.p50, allocator);
+        value.AddMember("p95", stats.p95, allocator);
+        value.AddMember("p99", stats.p99, allocator);
+        doc.AddMember(rapidjson::Value(name, allocator), value, allocator);
+    }
     rapidjson::StringBuffer s;
     RapidWriter writer(s);
     doc.Accept(writer);
@@ -22,6 +22,7 @@
 #include <mutex>
 #include <string>
 
+#include "paimon/common/metrics/histogram.h"
 #include "paimon/metrics.h"
 #include "paimon/visibility.h"
 
@@ -34,10 +35,17 @@ class PAIMON_EXPORT MetricsImpl : public Metrics {
     void SetCounter(const std::string& metric_name, uint64_t metric_value) override;
     Result<uint64_t> GetCounter(const std::string& metric_name) const override;
     std::map<std::string, uint64_t> GetAllCounters() const override;
+    void ObserveHistogram(const std::string& metric_name, uint64_t value) override;
+    Result<HistogramStats> GetHistogram(const std::string& metric_name) const override;
+    std::map<std::string, HistogramStats> GetAllHistograms() const override;
     void Merge(const std::shared_ptr<Metrics>& other) override;
     std::string ToString() const override;
     void Overwrite(const std::shared_ptr<Metrics>& metrics);
 
+    /// @return The histogram of the metric name, which is created if it doesn't exist. Hot paths
+    /// can keep the histogram and record into it without looking up the metric by name.
+    std::shared_ptr<Histogram> GetOrCreateHistogram(const std::string& metric_name);
+
     template <typename T>
     static std::shared_ptr<Metrics> CollectReadMetrics(const T& readers) {
         auto res_metrics = std::make_shared<MetricsImpl>();
@@ -53,9 +61,14 @@ class PAIMON_EXPORT MetricsImpl : public Metrics {
         return res_metrics;
     }
 
+ private:
+    std::map<std::string, std::shared_ptr<Histogram>> GetHistogramsSnapshot() const;
+
  private:
     mutable std::mutex counter_lock_;
     std::map<std::string, uint64_t> counters_;
+    mutable std::mutex histogram_lock_;
+    std::map<std::string, std::shared_ptr<Histogram>> histograms_;
 };
 
 }  // namespace paimon
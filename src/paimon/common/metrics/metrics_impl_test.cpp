@@ -16,6 +16,10 @@
 
 #include "paimon/common/metrics/metrics_impl.h"
 
+#include <map>
+#include <memory>
+#include <string>
+
 #include "gtest/gtest.h"
 #include "paimon/testing/utils/testharness.h"
 
@@ -61,4 +65,83 @@ TEST(MetricsImplTest, TestToString) {
     EXPECT_EQ(metrics1->ToString(), "{\"k1\":1,\"k2\":7,\"m1\":3,\"m2\":4}");
 }
 
+TEST(MetricsImplTest, TestHistogram) {
+    auto metrics = std::make_shared<MetricsImpl>();
+    metrics->ObserveHistogram("latency", 10);
+    metrics->ObserveHistogram("latency", 20);
+    ASSERT_OK_AND_ASSIGN(HistogramStats stats, metrics->GetHistogram("latency"));
+    ASSERT_EQ(2, stats.count);
+    ASSERT_EQ(10, stats.min);
+    ASSERT_EQ(20, stats.max);
+    ASSERT_NOK_WITH_MSG(metrics->GetHistogram("some_metric"),
+                        "Key error: metric 'some_metric' not found");
+
+    auto other = std::make_shared<MetricsImpl>();
+    other->ObserveHistogram("latency", 30);
+    other->ObserveHistogram("latency_2", 40);
+    metrics->Merge(other);
+    ASSERT_OK_AND_ASSIGN(stats, metrics->GetHistogram("latency"));
+    ASSERT_EQ(3, stats.count);
+    ASSERT_EQ(30, stats.max);
+    ASSERT_EQ(2, metrics->GetAllHistograms().size());
+
+    metrics->Overwrite(other);
+    ASSERT_OK_AND_ASSIGN(stats, metrics->GetHistogram("latency"));
+    ASSERT_EQ(1, stats.count);
+    // later records of other do not affect the overwritten metrics
+    other->ObserveHistogram("latency", 50);
+    ASSERT_OK_AND_ASSIGN(stats, metrics->GetHistogram("latency"));
+    ASSERT_EQ(1, stats.count);
+}
+
+TEST(MetricsImplTest, TestHistogramToString) {
+    auto metrics = std::make_shared<MetricsImpl>();
+    metrics->SetCounter("k1", 1);
+    metrics->ObserveHistogram("latency", 10);
+    metrics->ObserveHistogram("latency", 20);
+    EXPECT_EQ(metrics->ToString(),
+              "{\"k1\":1,\"latency\":{\"count\":2,\"min\":10,\"max\":20,\"mean\":15.0,"
+              "\"p50\":10,\"p95\":20,\"p99\":20}}");
+}
+
+TEST(MetricsImplTest, TestDefaultHistogramsOfCustomMetrics) {
+    // metrics implemented outside paimon may only support counters
+    class CounterOnlyMetrics : public Metrics {
+     public:
+        void SetCounter(const std::string& metric_name, uint64_t metric_value) override {
+            counters_[metric_name] = metric_value;
+        }
+        Result<uint64_t> GetCounter(const std::string& metric_name) const override {
+            auto iter = counters_.find(metric_name);
+            if (iter == counters_.end()) {
+                return Status::KeyError("metric '", metric_name, "' not found");
+            }
+            return iter->second;
+        }
+        std::map<std::string, uint64_t> GetAllCounters() const override {
+            return counters_;
+        }
+        void Merge(const std::shared_ptr<Metrics>& other) override {}
+        std::string ToString() const override {
+            return "";
+        }
+
+     private:
+        std::map<std::string, uint64_t> counters_;
+    };
+
+    auto metrics = std::make_shared<CounterOnlyMetrics>();
+    metrics->ObserveHistogram("latency", 10);
+    ASSERT_TRUE(metrics->GetHistogram("latency").status().IsKeyError());
+    ASSERT_TRUE(metrics->GetAllHistograms().empty());
+
+    // merging into MetricsImpl only copies the counters
+    metrics->SetCounter("k1", 1);
+    auto merged = std::make_shared<MetricsImpl>();
+    merged->Merge(metrics);
+    ASSERT_OK_AND_ASSIGN(uint64_t counter, merged->GetCounter("k1"));
+    ASSERT_EQ(1, counter);
+    ASSERT_TRUE(merged->GetAllHistograms().empty());
+}
+
 }  // namespace paimon::test
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include "paimon/common/metrics/histogram.h"
+#include "paimon/metrics.h"
+
+namespace paimon {
+
+/// Measures the elapsed microseconds since construction.
+class StopWatch {
+ public:
+    StopWatch() : start_(std::chrono::steady_clock::now()) {}
+
+    uint64_t ElapsedUs() const {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::steady_clock::now() - start_)
+            .count();
+    }
+
+ private:
+    std::chrono::steady_clock::time_point start_;
+};
+
+/// Records the elapsed microseconds of a scope into a histogram when the timer is stopped or
+/// destroyed. Hot paths should record into a `Histogram` obtained once from
+/// `MetricsImpl::GetOrCreateHistogram()`, which avoids looking up the metric by name.
+class ScopedTimer {
+ public:
+    explicit ScopedTimer(Histogram* histogram) : histogram_(histogram) {}
+
+    ScopedTimer(Metrics* metrics, const char* metric_name)
+        : metrics_(metrics), metric_name_(metric_name) {}
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    ~ScopedTimer() {
+        Stop();
+    }
+
+    /// Records the elapsed time now instead of at the end of the scope, later calls are no-op.
+    void Stop() {
+        if (histogram_) {
+            histogram_->Record(ElapsedUs());
+        } else if (metrics_) {
+            metrics_->ObserveHistogram(metric_name_, ElapsedUs());
+        }
+        histogram_ = nullptr;
+        metrics_ = nullptr;
+    }
+
+    uint64_t ElapsedUs() const {
+        return watch_.ElapsedUs();
+    }
+
+ private:
+    Histogram* histogram_ = nullptr;
+    Metrics* metrics_ = nullptr;
+    const char* metric_name_ = nullptr;
+    StopWatch watch_;
+};
+
+}  // namespace paimon
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/reader/arrow_batch_reader.h"
+
+#include <cassert>
+#include <utility>
+
+#include "arrow/api.h"
+#include "arrow/c/abi.h"
+#include "arrow/c/bridge.h"
+#include "paimon/common/reader/reader_utils.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/status.h"
+
+namespace paimon {
+
+Result<BatchReader::ReadBatchWithBitmap> ArrowBatchReader::NextBatchWithBitmap() {
+    PAIMON_ASSIGN_OR_RAISE(ArrowBatchWithBitmap batch_with_bitmap, NextArrowBatchWithBitmap());
+    return ExportArrowBatch(std::move(batch_with_bitmap));
+}
+
+Result<ArrowBatchReader::ArrowBatchWithBitmap> ArrowBatchReader::NextArrowBatchOf(
+    BatchReader* reader) {
+    auto arrow_batch_reader = dynamic_cast<ArrowBatchReader*>(reader);
+    if (arrow_batch_reader) {
+        return arrow_batch_reader->NextArrowBatchWithBitmap();
+    }
+    PAIMON_ASSIGN_OR_RAISE(ReadBatchWithBitmap batch_with_bitmap, reader->NextBatchWithBitmap());
+    if (BatchReader::IsEofBatch(batch_with_bitmap)) {
+        return MakeEofArrowBatch();
+    }
+    auto& [batch, bitmap] = batch_with_bitmap;
+    auto& [c_array, c_schema] = batch;
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> array,
+                                      arrow::ImportArray(c_array.get(), c_schema.get()));
+    return std::make_pair(std::move(array), std::move(bitmap));
+}
+
+Result<BatchReader::ReadBatchWithBitmap> ArrowBatchReader::ExportArrowBatch(
+    ArrowBatchWithBitmap&& batch_with_bitmap) {
+    if (IsEofArrowBatch(batch_with_bitmap)) {
+        return BatchReader::MakeEofBatchWithBitmap();
+    }
+    auto& [array, bitmap] = batch_with_bitmap;
+    PAIMON_ASSIGN_OR_RAISE(ReadBatch batch, ReaderUtils::ExportReadBatch(*array));
+    return std::make_pair(std::move(batch), std::move(bitmap));
+}
+
+Result<BatchReader::ReadBatch> ArrowBatchReader::ExportFilteredArrowBatch(
+    ArrowBatchWithBitmap&& batch_with_bitmap, arrow::MemoryPool* arrow_pool) {
+    if (IsEofArrowBatch(batch_with_bitmap)) {
+        return BatchReader::MakeEofBatch();
+    }
+    auto& [array, bitmap] = batch_with_bitmap;
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Array> filtered_array,
+                           ReaderUtils::ApplyBitmapToArray(array, bitmap, arrow_pool));
+    return ReaderUtils::ExportReadBatch(*filtered_array);
+}
+
+}  // namespace paimon
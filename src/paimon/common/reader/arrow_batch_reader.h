@@ -0,0 +1,69 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "paimon/reader/batch_reader.h"
+#include "paimon/result.h"
+#include "paimon/utils/roaring_bitmap32.h"
+
+namespace arrow {
+class Array;
+class MemoryPool;
+}  // namespace arrow
+
+namespace paimon {
+/// An inner batch reader which passes arrow arrays to the reader on top of it, instead of
+/// exporting each batch to the C data interface and importing it again at every stage of the read
+/// pipeline. A batch is exported only when it leaves the pipeline through `NextBatch()` or
+/// `NextBatchWithBitmap()`.
+class ArrowBatchReader : public BatchReader {
+ public:
+    /// An arrow array and the valid row ids in it, a nullptr array indicates eof.
+    using ArrowBatchWithBitmap = std::pair<std::shared_ptr<arrow::Array>, RoaringBitmap32>;
+
+    /// Retrieves the next batch as an arrow array, with the same semantics as
+    /// `NextBatchWithBitmap()`: returns a nullptr array at eof, otherwise the bitmap has at least
+    /// one valid row id.
+    virtual Result<ArrowBatchWithBitmap> NextArrowBatchWithBitmap() = 0;
+
+    /// The default implementation exports the batch from `NextArrowBatchWithBitmap()`.
+    Result<ReadBatchWithBitmap> NextBatchWithBitmap() override;
+
+    /// Retrieves the next arrow batch from `reader`. No data is exported or imported if `reader`
+    /// is an `ArrowBatchReader`, otherwise the batch from `NextBatchWithBitmap()` is imported.
+    static Result<ArrowBatchWithBitmap> NextArrowBatchOf(BatchReader* reader);
+
+    /// Exports the array in `batch_with_bitmap` to the C data interface, keeping the bitmap.
+    static Result<ReadBatchWithBitmap> ExportArrowBatch(ArrowBatchWithBitmap&& batch_with_bitmap);
+
+    /// Removes the invalid rows in `batch_with_bitmap` and exports the remaining rows to the C
+    /// data interface. This function may trigger data copy.
+    static Result<ReadBatch> ExportFilteredArrowBatch(ArrowBatchWithBitmap&& batch_with_bitmap,
+                                                      arrow::MemoryPool* arrow_pool);
+
+    static bool IsEofArrowBatch(const ArrowBatchWithBitmap& batch_with_bitmap) {
+        return batch_with_bitmap.first == nullptr;
+    }
+
+    static ArrowBatchWithBitmap MakeEofArrowBatch() {
+        return std::make_pair(std::shared_ptr<arrow::Array>(), RoaringBitmap32());
+    }
+};
+}  // namespace paimon
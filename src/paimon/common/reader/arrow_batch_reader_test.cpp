@@ -0,0 +1,165 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/reader/arrow_batch_reader.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/array/array_base.h"
+#include "arrow/array/array_nested.h"
+#include "arrow/c/abi.h"
+#include "arrow/c/bridge.h"
+#include "arrow/ipc/json_simple.h"
+#include "gtest/gtest.h"
+#include "paimon/common/reader/complete_row_kind_batch_reader.h"
+#include "paimon/common/reader/concat_batch_reader.h"
+#include "paimon/common/reader/predicate_batch_reader.h"
+#include "paimon/defs.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/predicate/literal.h"
+#include "paimon/predicate/predicate_builder.h"
+#include "paimon/status.h"
+#include "paimon/testing/mock/mock_file_batch_reader.h"
+#include "paimon/testing/utils/testharness.h"
+#include "paimon/utils/roaring_bitmap32.h"
+
+namespace paimon::test {
+namespace {
+/// Returns the given arrays as they are, so that tests can check whether the readers on top of it
+/// pass the same arrays without export and import.
+class ArraysBatchReader : public ArrowBatchReader {
+ public:
+    explicit ArraysBatchReader(const arrow::ArrayVector& arrays) : arrays_(arrays) {}
+
+    Result<ReadBatch> NextBatch() override {
+        PAIMON_ASSIGN_OR_RAISE(ArrowBatchWithBitmap batch_with_bitmap, NextArrowBatchWithBitmap());
+        return ExportFilteredArrowBatch(std::move(batch_with_bitmap), arrow::default_memory_pool());
+    }
+
+    Result<ArrowBatchWithBitmap> NextArrowBatchWithBitmap() override {
+        if (current_ >= arrays_.size()) {
+            return MakeEofArrowBatch();
+        }
+        const auto& array = arrays_[current_++];
+        RoaringBitmap32 bitmap;
+        bitmap.AddRange(0, array->length());
+        return std::make_pair(array, std::move(bitmap));
+    }
+
+    std::shared_ptr<Metrics> GetReaderMetrics() const override {
+        return nullptr;
+    }
+
+    void Close() override {}
+
+ private:
+    arrow::ArrayVector arrays_;
+    size_t current_ = 0;
+};
+}  // namespace
+
+class ArrowBatchReaderTest : public ::testing::Test {
+ public:
+    void SetUp() override {
+        pool_ = GetDefaultPool();
+        data_type_ = arrow::struct_({arrow::field("f0", arrow::int32())});
+    }
+
+    std::shared_ptr<arrow::Array> MakeArray(const std::string& json) const {
+        return arrow::ipc::internal::json::ArrayFromJSON(data_type_, json).ValueOrDie();
+    }
+
+ protected:
+    std::shared_ptr<MemoryPool> pool_;
+    std::shared_ptr<arrow::DataType> data_type_;
+};
+
+TEST_F(ArrowBatchReaderTest, TestPassArrayWithoutCopy) {
+    auto array1 = MakeArray("[[1], [2], [3]]");
+    auto array2 = MakeArray("[[4], [5]]");
+    std::vector<std::unique_ptr<BatchReader>> readers;
+    readers.push_back(std::make_unique<ArraysBatchReader>(arrow::ArrayVector({array1})));
+    readers.push_back(std::make_unique<ArraysBatchReader>(arrow::ArrayVector({array2})));
+    ConcatBatchReader concat_reader(std::move(readers), pool_);
+
+    ASSERT_OK_AND_ASSIGN(auto batch1, ArrowBatchReader::NextArrowBatchOf(&concat_reader));
+    ASSERT_EQ(array1, batch1.first);
+    ASSERT_EQ(3, batch1.second.Cardinality());
+    ASSERT_OK_AND_ASSIGN(auto batch2, ArrowBatchReader::NextArrowBatchOf(&concat_reader));
+    ASSERT_EQ(array2, batch2.first);
+    ASSERT_OK_AND_ASSIGN(auto eof_batch, ArrowBatchReader::NextArrowBatchOf(&concat_reader));
+    ASSERT_TRUE(ArrowBatchReader::IsEofArrowBatch(eof_batch));
+}
+
+TEST_F(ArrowBatchReaderTest, TestImportFromBatchReader) {
+    auto array = MakeArray("[[1], [2], [3], [4]]");
+    auto reader = std::make_unique<MockFileBatchReader>(
+        array, data_type_, RoaringBitmap32::From({0, 2, 3}), /*read_batch_size=*/10);
+    ASSERT_OK_AND_ASSIGN(auto batch, ArrowBatchReader::NextArrowBatchOf(reader.get()));
+    ASSERT_TRUE(batch.first->Equals(array));
+    ASSERT_EQ(RoaringBitmap32::From({0, 2, 3}), batch.second);
+    ASSERT_OK_AND_ASSIGN(auto eof_batch, ArrowBatchReader::NextArrowBatchOf(reader.get()));
+    ASSERT_TRUE(ArrowBatchReader::IsEofArrowBatch(eof_batch));
+}
+
+TEST_F(ArrowBatchReaderTest, TestExportAtBoundary) {
+    auto array = MakeArray("[[1], [2], [3], [4], [5]]");
+    std::unique_ptr<BatchReader> reader =
+        std::make_unique<ArraysBatchReader>(arrow::ArrayVector({array}));
+    reader = std::make_unique<CompleteRowKindBatchReader>(std::move(reader), pool_);
+    auto predicate = PredicateBuilder::GreaterThan(/*field_index=*/1, /*field_name=*/"f0",
+                                                   FieldType::INT, Literal(2));
+    ASSERT_OK_AND_ASSIGN(reader,
+                         PredicateBatchReader::Create(std::move(reader), predicate, pool_));
+
+    ASSERT_OK_AND_ASSIGN(BatchReader::ReadBatch batch, reader->NextBatch());
+    auto& [c_array, c_schema] = batch;
+    ASSERT_TRUE(c_array);
+    auto result = arrow::ImportArray(c_array.get(), c_schema.get()).ValueOrDie();
+    auto expected_type = arrow::struct_(
+        {arrow::field("_VALUE_KIND", arrow::int8()), arrow::field("f0", arrow::int32())});
+    auto expected =
+        arrow::ipc::internal::json::ArrayFromJSON(expected_type, "[[0, 3], [0, 4], [0, 5]]")
+            .ValueOrDie();
+    ASSERT_TRUE(result->Equals(expected)) << result->ToString();
+    ASSERT_OK_AND_ASSIGN(BatchReader::ReadBatch eof_batch, reader->NextBatch());
+    ASSERT_TRUE(BatchReader::IsEofBatch(eof_batch));
+}
+
+TEST_F(ArrowBatchReaderTest, TestExportFilteredArrowBatch) {
+    auto array = MakeArray("[[1], [2], [3], [4], [5]]");
+    ASSERT_OK_AND_ASSIGN(BatchReader::ReadBatch batch,
+                         ArrowBatchReader::ExportFilteredArrowBatch(
+                             std::make_pair(array, RoaringBitmap32::From({0, 3, 4})),
+                             arrow::default_memory_pool()));
+    auto result = arrow::ImportArray(batch.first.get(), batch.second.get()).ValueOrDie();
+    ASSERT_TRUE(result->Equals(MakeArray("[[1], [4], [5]]"))) << result->ToString();
+
+    ASSERT_NOK_WITH_MSG(ArrowBatchReader::ExportFilteredArrowBatch(
+                            std::make_pair(array, RoaringBitmap32()), arrow::default_memory_pool()),
+                        "at least one valid row");
+    ASSERT_OK_AND_ASSIGN(BatchReader::ReadBatch eof_batch,
+                         ArrowBatchReader::ExportFilteredArrowBatch(
+                             ArrowBatchReader::MakeEofArrowBatch(), arrow::default_memory_pool()));
+    ASSERT_TRUE(BatchReader::IsEofBatch(eof_batch));
+}
+
+}  // namespace paimon::test
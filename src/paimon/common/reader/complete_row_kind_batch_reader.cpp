@@ -22,10 +22,7 @@
 #include "arrow/array/array_base.h"
 #include "arrow/array/array_nested.h"
 #include "arrow/array/util.h"
-#include "arrow/c/abi.h"
-#include "arrow/c/bridge.h"
 #include "arrow/scalar.h"
-#include "paimon/common/reader/reader_utils.h"
 #include "paimon/common/table/special_fields.h"
 #include "paimon/common/types/data_field.h"
 #include "paimon/common/types/row_kind.h"
@@ -35,29 +32,24 @@
 namespace paimon {
 
 Result<BatchReader::ReadBatch> CompleteRowKindBatchReader::NextBatch() {
-    PAIMON_ASSIGN_OR_RAISE(BatchReader::ReadBatchWithBitmap batch_with_bitmap,
-                           NextBatchWithBitmap());
-    return ReaderUtils::ApplyBitmapToReadBatch(std::move(batch_with_bitmap), arrow_pool_.get());
+    PAIMON_ASSIGN_OR_RAISE(ArrowBatchWithBitmap batch_with_bitmap, NextArrowBatchWithBitmap());
+    return ExportFilteredArrowBatch(std::move(batch_with_bitmap), arrow_pool_.get());
 }
 
-Result<BatchReader::ReadBatchWithBitmap> CompleteRowKindBatchReader::NextBatchWithBitmap() {
-    PAIMON_ASSIGN_OR_RAISE(BatchReader::ReadBatchWithBitmap batch_with_bitmap,
-                           reader_->NextBatchWithBitmap());
-    if (BatchReader::IsEofBatch(batch_with_bitmap)) {
+Result<ArrowBatchReader::ArrowBatchWithBitmap>
+CompleteRowKindBatchReader::NextArrowBatchWithBitmap() {
+    PAIMON_ASSIGN_OR_RAISE(ArrowBatchWithBitmap batch_with_bitmap,
+                           NextArrowBatchOf(reader_.get()));
+    if (IsEofArrowBatch(batch_with_bitmap)) {
         return batch_with_bitmap;
     }
-    auto& [batch, bitmap] = batch_with_bitmap;
-    auto& [c_array, c_schema] = batch;
-    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> arrow_array,
-                                      arrow::ImportArray(c_array.get(), c_schema.get()));
+    auto& [arrow_array, bitmap] = batch_with_bitmap;
     auto struct_array = std::dynamic_pointer_cast<arrow::StructArray>(arrow_array);
     if (!struct_array) {
         return Status::Invalid("cannot cast array to StructArray in CompleteRowKindBatchReader");
     }
     if (struct_array->GetFieldByName(SpecialFields::ValueKind().Name())) {
         // batch returned by reader_ has value kind, just return
-        PAIMON_RETURN_NOT_OK_FROM_ARROW(
-            arrow::ExportArray(*struct_array, c_array.get(), c_schema.get()));
         return batch_with_bitmap;
     }
     // create value kind array, all are insert
@@ -69,10 +61,7 @@ Result<BatchReader::ReadBatchWithBitmap> CompleteRowKindBatchReader::NextBatchWi
     fields_with_row_kind.insert(fields_with_row_kind.end(), struct_array->fields().begin(),
                                 struct_array->fields().end());
     PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
-        std::shared_ptr<arrow::StructArray> array_with_row_kind,
-        arrow::StructArray::Make(fields_with_row_kind, field_names_with_row_kind_));
-    PAIMON_RETURN_NOT_OK_FROM_ARROW(
-        arrow::ExportArray(*array_with_row_kind, c_array.get(), c_schema.get()));
+        arrow_array, arrow::StructArray::Make(fields_with_row_kind, field_names_with_row_kind_));
     return batch_with_bitmap;
 }
 
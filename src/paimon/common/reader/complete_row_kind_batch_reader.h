@@ -24,6 +24,7 @@
 
 #include "arrow/api.h"
 #include "arrow/array/array_base.h"
+#include "paimon/common/reader/arrow_batch_reader.h"
 #include "paimon/common/utils/arrow/mem_utils.h"
 #include "paimon/reader/batch_reader.h"
 #include "paimon/result.h"
@@ -36,7 +37,7 @@ namespace paimon {
 class MemoryPool;
 class Metrics;
 
-class CompleteRowKindBatchReader : public BatchReader {
+class CompleteRowKindBatchReader : public ArrowBatchReader {
  public:
     CompleteRowKindBatchReader(std::unique_ptr<BatchReader>&& reader,
                                const std::shared_ptr<MemoryPool>& pool)
@@ -44,7 +45,7 @@ class CompleteRowKindBatchReader : public BatchReader {
 
     Result<ReadBatch> NextBatch() override;
 
-    Result<ReadBatchWithBitmap> NextBatchWithBitmap() override;
+    Result<ArrowBatchWithBitmap> NextArrowBatchWithBitmap() override;
 
     void Close() override {
         reader_->Close();
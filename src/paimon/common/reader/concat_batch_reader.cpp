@@ -63,4 +63,18 @@ Result<BatchReader::ReadBatchWithBitmap> ConcatBatchReader::NextBatchWithBitmap(
     return BatchReader::MakeEofBatchWithBitmap();
 }
 
+Result<ArrowBatchReader::ArrowBatchWithBitmap> ConcatBatchReader::NextArrowBatchWithBitmap() {
+    while (current_ < readers_.size()) {
+        auto& current_reader = readers_[current_];
+        PAIMON_ASSIGN_OR_RAISE(ArrowBatchWithBitmap result,
+                               NextArrowBatchOf(current_reader.get()));
+        if (!IsEofArrowBatch(result)) {
+            return result;
+        }
+        current_reader->Close();
+        current_++;
+    }
+    return MakeEofArrowBatch();
+}
+
 }  // namespace paimon
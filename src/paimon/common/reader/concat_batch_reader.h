@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "arrow/api.h"
+#include "paimon/common/reader/arrow_batch_reader.h"
 #include "paimon/metrics.h"
 #include "paimon/reader/batch_reader.h"
 #include "paimon/result.h"
@@ -30,13 +31,15 @@ class MemoryPool;
 
 /// This reader is to concatenate a list of BatchReaders and read them sequentially. The input list
 /// is already sorted by key and sequence number, and the key intervals do not overlap each other.
-class ConcatBatchReader : public BatchReader {
+class ConcatBatchReader : public ArrowBatchReader {
  public:
     ConcatBatchReader(std::vector<std::unique_ptr<BatchReader>>&& readers,
                       const std::shared_ptr<MemoryPool>& pool);
 
     Result<ReadBatch> NextBatch() override;
+    /// Forwards the batches of the inner readers without importing them.
     Result<ReadBatchWithBitmap> NextBatchWithBitmap() override;
+    Result<ArrowBatchWithBitmap> NextArrowBatchWithBitmap() override;
     void Close() override;
     std::shared_ptr<Metrics> GetReaderMetrics() const override;
 
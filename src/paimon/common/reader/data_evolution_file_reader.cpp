@@ -16,19 +16,23 @@
 
 #include "paimon/common/reader/data_evolution_file_reader.h"
 
-#include "arrow/c/abi.h"
-#include "arrow/c/bridge.h"
-#include "fmt/format.h"
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <vector>
+
 #include "paimon/common/metrics/metrics_impl.h"
 #include "paimon/common/reader/reader_utils.h"
 #include "paimon/common/utils/arrow/mem_utils.h"
 #include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/executor.h"
 namespace paimon {
 Result<std::unique_ptr<DataEvolutionFileReader>> DataEvolutionFileReader::Create(
     std::vector<std::unique_ptr<BatchReader>>&& readers,
     const std::shared_ptr<arrow::Schema>& read_schema, int32_t read_batch_size,
     const std::vector<int32_t>& reader_offsets, const std::vector<int32_t>& field_offsets,
-    const std::shared_ptr<MemoryPool>& pool) {
+    const std::shared_ptr<MemoryPool>& pool, const std::shared_ptr<Executor>& executor) {
     if (read_schema->num_fields() == 0) {
         return Status::Invalid("read schema must not be empty");
     }
@@ -42,33 +46,95 @@ Result<std::unique_ptr<DataEvolutionFileReader>> DataEvolutionFileReader::Create
     }
     return std::unique_ptr<DataEvolutionFileReader>(
         new DataEvolutionFileReader(std::move(readers), read_schema, read_batch_size,
-                                    reader_offsets, field_offsets, GetArrowPool(pool)));
+                                    reader_offsets, field_offsets, GetArrowPool(pool), executor));
+}
+
+/// The fetch task is claimed either by the executor or by the reading thread, whichever comes
+/// first, so the reading thread never waits for a task which is not started.
+class DataEvolutionFileReader::PendingFetch {
+ public:
+    bool TryClaim() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (claimed_) {
+            return false;
+        }
+        claimed_ = true;
+        return true;
+    }
+
+    void Finish(Result<FetchedBatch>&& result) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        result_ = std::move(result);
+        cv_.notify_all();
+    }
+
+    bool IsFinished() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return result_.has_value();
+    }
+
+    /// Waits for the claimed task.
+    Result<FetchedBatch> Wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]() { return result_.has_value(); });
+        return std::move(result_).value();
+    }
+
+ private:
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    bool claimed_ = false;
+    std::optional<Result<FetchedBatch>> result_;
+};
+
+DataEvolutionFileReader::~DataEvolutionFileReader() {
+    CancelReadAhead();
 }
 
-Result<BatchReader::ReadBatchWithBitmap> DataEvolutionFileReader::NextBatchWithBitmap() {
+Result<ArrowBatchReader::ArrowBatchWithBitmap>
+DataEvolutionFileReader::NextArrowBatchWithBitmap() {
+    PAIMON_RETURN_NOT_OK(SubmitReadAhead());
+    // the batch is aligned to the shortest first queued array of the inner readers
+    int64_t array_length = read_batch_size_;
+    bool has_eof_reader = false;
+    bool has_remaining_reader = false;
+    for (size_t i = 0; i < readers_.size(); i++) {
+        if (!readers_[i]) {
+            continue;
+        }
+        PAIMON_RETURN_NOT_OK(WaitForQueuedRows(i));
+        const auto& queue = read_ahead_queues_[i];
+        if (queue.arrays.empty()) {
+            has_eof_reader = true;
+        } else {
+            has_remaining_reader = true;
+            array_length = std::min(array_length, queue.arrays.front()->length());
+        }
+    }
+    if (has_eof_reader) {
+        if (has_remaining_reader) {
+            return Status::Invalid("array for single reader length mismatch others");
+        }
+        // read eof
+        return MakeEofArrowBatch();
+    }
     std::vector<std::shared_ptr<arrow::StructArray>> array_for_each_reader;
     array_for_each_reader.reserve(readers_.size());
-    int64_t array_length = -1;
     for (size_t i = 0; i < readers_.size(); i++) {
         if (!readers_[i]) {
             // no read field from readers_[i]
             array_for_each_reader.push_back(nullptr);
             continue;
         }
-        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Array> array, NextBatchForSingleReader(i));
-        if (array == nullptr) {
-            // read eof
-            return BatchReader::MakeEofBatchWithBitmap();
-        }
-        if (array_length == -1) {
-            array_length = array->length();
-        } else if (array_length != array->length()) {
-            return Status::Invalid("array for single reader length mismatch others");
-        }
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Array> array,
+                               NextBatchForSingleReader(i, array_length));
+        assert(array && array->length() == array_length);
         auto struct_array = arrow::internal::checked_pointer_cast<arrow::StructArray>(array);
         assert(struct_array);
         array_for_each_reader.push_back(struct_array);
     }
+    // fetch the next batches while the caller processes this one
+    PAIMON_RETURN_NOT_OK(SubmitReadAhead());
     int32_t read_field_count = read_schema_->num_fields();
     arrow::ArrayVector target_sub_array_vec;
     target_sub_array_vec.reserve(read_field_count);
@@ -86,12 +152,9 @@ Result<BatchReader::ReadBatchWithBitmap> DataEvolutionFileReader::NextBatchWithB
     PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
         std::shared_ptr<arrow::Array> target_array,
         arrow::StructArray::Make(target_sub_array_vec, read_schema_->field_names()));
-    std::unique_ptr<ArrowArray> target_c_arrow_array = std::make_unique<ArrowArray>();
-    std::unique_ptr<ArrowSchema> target_c_schema = std::make_unique<ArrowSchema>();
-    PAIMON_RETURN_NOT_OK_FROM_ARROW(
-        arrow::ExportArray(*target_array, target_c_arrow_array.get(), target_c_schema.get()));
-    auto target_batch = std::make_pair(std::move(target_c_arrow_array), std::move(target_c_schema));
-    return ReaderUtils::AddAllValidBitmap(std::move(target_batch));
+    RoaringBitmap32 all_valid;
+    all_valid.AddRange(0, target_array->length());
+    return std::make_pair(std::move(target_array), std::move(all_valid));
 }
 
 Result<std::shared_ptr<arrow::Array>> DataEvolutionFileReader::GetOrCreateNonExistArray(
@@ -109,76 +172,126 @@ Result<std::shared_ptr<arrow::Array>> DataEvolutionFileReader::GetOrCreateNonExi
     return non_exist_array_vec_[field_idx]->Slice(0, array_length);
 }
 
-int64_t DataEvolutionFileReader::CalculateCachedArrayLength(size_t reader_idx) const {
-    int64_t total_length = 0;
-    for (const auto& array : cached_array_vec_[reader_idx]) {
-        total_length += array->length();
+bool DataEvolutionFileReader::NeedReadAhead(size_t reader_idx, int64_t target_length) const {
+    const auto& queue = read_ahead_queues_[reader_idx];
+    return !queue.eof && queue.length < target_length;
+}
+
+Status DataEvolutionFileReader::SubmitReadAhead() {
+    if (!executor_) {
+        // without executor the inner readers are only read on demand in WaitForQueuedRows
+        return Status::OK();
     }
-    return total_length;
+    size_t max_pending_count = std::max<uint32_t>(executor_->GetParallelism(), 1) - 1;
+    size_t pending_count = 0;
+    for (size_t i = 0; i < readers_.size(); i++) {
+        auto& queue = read_ahead_queues_[i];
+        if (queue.pending_fetch == nullptr) {
+            continue;
+        }
+        if (queue.pending_fetch->IsFinished()) {
+            std::shared_ptr<PendingFetch> fetch = std::move(queue.pending_fetch);
+            PAIMON_RETURN_NOT_OK(AppendFetchedBatch(i, fetch->Wait()));
+        } else {
+            pending_count++;
+        }
+    }
+    int64_t target_length = static_cast<int64_t>(read_batch_size_) * READ_AHEAD_DEPTH;
+    for (size_t i = 0; i < readers_.size() && pending_count < max_pending_count; i++) {
+        auto& queue = read_ahead_queues_[i];
+        if (!readers_[i] || queue.pending_fetch || !NeedReadAhead(i, target_length)) {
+            continue;
+        }
+        auto fetch = std::make_shared<PendingFetch>();
+        // `this` is only used after the task is claimed, the reader claims or waits for all the
+        // pending fetches before it is destroyed
+        executor_->Add([this, fetch, i]() {
+            if (fetch->TryClaim()) {
+                fetch->Finish(FetchBatch(i));
+            }
+        });
+        queue.pending_fetch = std::move(fetch);
+        pending_count++;
+    }
+    return Status::OK();
 }
 
-Result<std::shared_ptr<arrow::Array>> DataEvolutionFileReader::NextBatchForSingleReader(
+Status DataEvolutionFileReader::WaitForQueuedRows(size_t reader_idx) {
+    auto& queue = read_ahead_queues_[reader_idx];
+    while (queue.arrays.empty() && !queue.eof) {
+        std::shared_ptr<PendingFetch> fetch = std::move(queue.pending_fetch);
+        if (fetch && !fetch->TryClaim()) {
+            PAIMON_RETURN_NOT_OK(AppendFetchedBatch(reader_idx, fetch->Wait()));
+        } else {
+            PAIMON_RETURN_NOT_OK(AppendFetchedBatch(reader_idx, FetchBatch(reader_idx)));
+        }
+    }
+    return Status::OK();
+}
+
+Result<DataEvolutionFileReader::FetchedBatch> DataEvolutionFileReader::FetchBatch(
     size_t reader_idx) {
-    int64_t total_array_length = CalculateCachedArrayLength(reader_idx);
-    if (total_array_length >= read_batch_size_) {
-        assert(false);
-        return Status::Invalid(fmt::format(
-            "Unexpected: the length of cached array in last turn {} exceed read batch size {}",
-            total_array_length, read_batch_size_));
-    }
-    // array left for last turn
-    arrow::ArrayVector concat_array_vec = std::move(cached_array_vec_[reader_idx]);
-    cached_array_vec_[reader_idx].clear();
-    while (total_array_length < read_batch_size_) {
-        PAIMON_ASSIGN_OR_RAISE(ReadBatchWithBitmap src_array_with_bitmap,
-                               readers_[reader_idx]->NextBatchWithBitmap());
-        if (BatchReader::IsEofBatch(src_array_with_bitmap)) {
-            // read finish
-            break;
+    PAIMON_ASSIGN_OR_RAISE(ArrowBatchWithBitmap src_array_with_bitmap,
+                           NextArrowBatchOf(readers_[reader_idx].get()));
+    FetchedBatch fetched_batch;
+    if (IsEofArrowBatch(src_array_with_bitmap)) {
+        fetched_batch.eof = true;
+        return fetched_batch;
+    }
+    const auto& [src_array, bitmap] = src_array_with_bitmap;
+    PAIMON_ASSIGN_OR_RAISE(fetched_batch.arrays,
+                           ReaderUtils::GenerateFilteredArrayVector(src_array, bitmap));
+    return fetched_batch;
+}
+
+Status DataEvolutionFileReader::AppendFetchedBatch(size_t reader_idx,
+                                                   Result<FetchedBatch>&& fetched_batch) {
+    PAIMON_ASSIGN_OR_RAISE(FetchedBatch batch, std::move(fetched_batch));
+    auto& queue = read_ahead_queues_[reader_idx];
+    if (batch.eof) {
+        queue.eof = true;
+        return Status::OK();
+    }
+    for (auto& array : batch.arrays) {
+        if (array->length() == 0) {
+            continue;
         }
-        auto& [read_batch, bitmap] = src_array_with_bitmap;
-        auto& [c_array, c_schema] = read_batch;
-        PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> src_array,
-                                          arrow::ImportArray(c_array.get(), c_schema.get()));
-        PAIMON_ASSIGN_OR_RAISE(arrow::ArrayVector selected_array_vec,
-                               ReaderUtils::GenerateFilteredArrayVector(src_array, bitmap));
-        for (const auto& selected_array : selected_array_vec) {
-            if (total_array_length + selected_array->length() > read_batch_size_) {
-                // need truncate current array to align read_batch_size_
-                int64_t truncated_length = read_batch_size_ - total_array_length;
-                if (truncated_length == 0) {
-                    // total_array_length equals to read_batch_size_, all selected_array left will
-                    // be added to cached_array_vec_
-                    cached_array_vec_[reader_idx].push_back(selected_array);
-                } else {
-                    concat_array_vec.push_back(selected_array->Slice(0, truncated_length));
-                    cached_array_vec_[reader_idx].push_back(
-                        selected_array->Slice(truncated_length));
-                    total_array_length += truncated_length;
-                }
-            } else {
-                concat_array_vec.push_back(selected_array);
-                total_array_length += selected_array->length();
-            }
+        queue.length += array->length();
+        queue.arrays.push_back(std::move(array));
+    }
+    return Status::OK();
+}
+
+void DataEvolutionFileReader::CancelReadAhead() {
+    for (auto& queue : read_ahead_queues_) {
+        std::shared_ptr<PendingFetch> fetch = std::move(queue.pending_fetch);
+        if (fetch && !fetch->TryClaim()) {
+            [[maybe_unused]] auto result = fetch->Wait();
         }
     }
-    if (concat_array_vec.empty()) {
+}
+
+Result<std::shared_ptr<arrow::Array>> DataEvolutionFileReader::NextBatchForSingleReader(
+    size_t reader_idx, int64_t max_length) {
+    PAIMON_RETURN_NOT_OK(WaitForQueuedRows(reader_idx));
+    auto& queue = read_ahead_queues_[reader_idx];
+    if (queue.arrays.empty()) {
         return std::shared_ptr<arrow::Array>();
     }
-    if (concat_array_vec.size() == 1) {
-        // avoid data copy
-        return concat_array_vec[0];
+    std::shared_ptr<arrow::Array> array = std::move(queue.arrays.front());
+    queue.arrays.pop_front();
+    if (array->length() > max_length) {
+        // the rows left stay in the queue for the next batch
+        queue.arrays.push_front(array->Slice(max_length));
+        array = array->Slice(0, max_length);
     }
-    // TODO(xinyu.lxy) remove data copy for efficiency
-    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> concat_array,
-                                      arrow::Concatenate(concat_array_vec, arrow_pool_.get()));
-    assert(concat_array->length() == total_array_length);
-    assert(concat_array->length() <= read_batch_size_);
-    return concat_array;
+    queue.length -= array->length();
+    return array;
 }
 
 void DataEvolutionFileReader::Close() {
-    cached_array_vec_.clear();
+    CancelReadAhead();
+    read_ahead_queues_.clear();
     non_exist_array_vec_.clear();
     for (const auto& reader : readers_) {
         if (reader) {
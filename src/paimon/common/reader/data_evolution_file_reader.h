@@ -16,16 +16,20 @@
 
 #pragma once
 
+#include <deque>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "arrow/api.h"
+#include "paimon/common/reader/arrow_batch_reader.h"
 #include "paimon/metrics.h"
 #include "paimon/reader/batch_reader.h"
 #include "paimon/result.h"
 
 namespace paimon {
+class Executor;
+
 /// This is a union reader which contains multiple inner readers.
 ///
 /// This reader, assembling multiple reader into one big and great reader. The row it produces
@@ -48,55 +52,108 @@ namespace paimon {
 /// - The sixth field comes from reader1, and it is at offset 0 in reader1.
 ///
 /// These three readers work together, package out final and complete rows.
-class DataEvolutionFileReader : public BatchReader {
+///
+/// The inner readers usually read files in different paths. If the executor is set, the next
+/// batches of the inner readers are fetched in the background on the executor, while the rows
+/// fetched before are returned, until each of them has queued `READ_AHEAD_DEPTH` batches of
+/// `read_batch_size` rows or reaches eof. The batches of the inner readers may have different
+/// boundaries, each returned batch is sliced to the shortest queued array of all the inner
+/// readers, so no rows are copied to align them.
+class DataEvolutionFileReader : public ArrowBatchReader {
  public:
     static Result<std::unique_ptr<DataEvolutionFileReader>> Create(
         std::vector<std::unique_ptr<BatchReader>>&& readers,
         const std::shared_ptr<arrow::Schema>& read_schema, int32_t read_batch_size,
         const std::vector<int32_t>& reader_offsets, const std::vector<int32_t>& field_offsets,
-        const std::shared_ptr<MemoryPool>& pool);
+        const std::shared_ptr<MemoryPool>& pool, const std::shared_ptr<Executor>& executor);
+
+    ~DataEvolutionFileReader() override;
 
     Result<ReadBatch> NextBatch() override {
         return Status::Invalid(
             "paimon inner reader DataEvolutionFileReader should use NextBatchWithBitmap");
     }
 
-    Result<ReadBatchWithBitmap> NextBatchWithBitmap() override;
+    Result<ArrowBatchWithBitmap> NextArrowBatchWithBitmap() override;
 
     void Close() override;
 
     std::shared_ptr<Metrics> GetReaderMetrics() const override;
 
  private:
+    /// The rows of a batch read from an inner reader.
+    struct FetchedBatch {
+        arrow::ArrayVector arrays;
+        bool eof = false;
+    };
+
+    class PendingFetch;
+
+    /// Rows read from an inner reader but not returned yet.
+    struct ReadAheadQueue {
+        std::deque<std::shared_ptr<arrow::Array>> arrays;
+        // total length of `arrays`
+        int64_t length = 0;
+        bool eof = false;
+        // not null if the next batch is being fetched on the executor
+        std::shared_ptr<PendingFetch> pending_fetch;
+    };
+
+    static constexpr int32_t READ_AHEAD_DEPTH = 2;
+
     DataEvolutionFileReader(std::vector<std::unique_ptr<BatchReader>>&& readers,
                             const std::shared_ptr<arrow::Schema>& read_schema,
                             int32_t read_batch_size, const std::vector<int32_t>& reader_offsets,
                             const std::vector<int32_t>& field_offsets,
-                            const std::shared_ptr<arrow::MemoryPool>& arrow_pool)
+                            const std::shared_ptr<arrow::MemoryPool>& arrow_pool,
+                            const std::shared_ptr<Executor>& executor)
         : arrow_pool_(arrow_pool),
+          executor_(executor),
           readers_(std::move(readers)),
           read_schema_(read_schema),
           read_batch_size_(read_batch_size),
           reader_offsets_(reader_offsets),
           field_offsets_(field_offsets),
-          cached_array_vec_(readers_.size()),
+          read_ahead_queues_(readers_.size()),
           non_exist_array_vec_(read_schema->num_fields(), nullptr) {}
 
-    int64_t CalculateCachedArrayLength(size_t reader_idx) const;
+    bool NeedReadAhead(size_t reader_idx, int64_t target_length) const;
+
+    /// Collects the finished fetches and submits the next ones of the inner readers whose queues
+    /// are not full, does nothing if the executor is not set. At most one fetch of each inner
+    /// reader and at most `GetParallelism() - 1` fetches in total are pending, which leaves a
+    /// thread for the tasks the inner readers may wait for, e.g. of the prefetch readers.
+    Status SubmitReadAhead();
+
+    /// Waits until the queue of `reader_idx` has rows or reaches eof. A pending fetch which is
+    /// not started by the executor yet runs in the calling thread.
+    Status WaitForQueuedRows(size_t reader_idx);
+
+    /// Reads the next batch of `reader_idx`, may run on the executor.
+    Result<FetchedBatch> FetchBatch(size_t reader_idx);
+
+    Status AppendFetchedBatch(size_t reader_idx, Result<FetchedBatch>&& fetched_batch);
+
+    /// Waits for the pending fetches, as they reference the inner readers.
+    void CancelReadAhead();
 
-    Result<std::shared_ptr<arrow::Array>> NextBatchForSingleReader(size_t reader_idx);
+    /// @return The first queued array of `reader_idx`, sliced to at most `max_length` rows
+    /// without copying, or nullptr if eof.
+    Result<std::shared_ptr<arrow::Array>> NextBatchForSingleReader(size_t reader_idx,
+                                                                   int64_t max_length);
 
     Result<std::shared_ptr<arrow::Array>> GetOrCreateNonExistArray(int32_t field_idx,
                                                                    int64_t array_length);
 
  private:
     std::shared_ptr<arrow::MemoryPool> arrow_pool_;
+    std::shared_ptr<Executor> executor_;
     std::vector<std::unique_ptr<BatchReader>> readers_;
     std::shared_ptr<arrow::Schema> read_schema_;
     int32_t read_batch_size_;
     std::vector<int32_t> reader_offsets_;
     std::vector<int32_t> field_offsets_;
-    std::vector<arrow::ArrayVector> cached_array_vec_;
+    std::vector<ReadAheadQueue> read_ahead_queues_;
     arrow::ArrayVector non_exist_array_vec_;
 };
 }  // namespace paimon
@@ -26,6 +26,7 @@
 #include "arrow/util/range.h"
 #include "gtest/gtest.h"
 #include "paimon/common/utils/arrow/mem_utils.h"
+#include "paimon/executor.h"
 #include "paimon/memory/memory_pool.h"
 #include "paimon/testing/mock/mock_file_batch_reader.h"
 #include "paimon/testing/utils/read_result_collector.h"
@@ -50,6 +51,21 @@ class DataEvolutionFileReaderTest : public ::testing::Test,
                      const std::shared_ptr<arrow::Array>& expected_array,
                      const std::optional<RoaringBitmap32>& selection_bitmap = std::nullopt) const {
         for (auto batch_size : arrow::internal::Iota(1, 10)) {
+            CheckResult(src_array_vec, read_schema, reader_offsets, field_offsets, expected_array,
+                        selection_bitmap, batch_size, /*executor=*/nullptr);
+            CheckResult(src_array_vec, read_schema, reader_offsets, field_offsets, expected_array,
+                        selection_bitmap, batch_size, executor_);
+        }
+    }
+
+    void CheckResult(const arrow::ArrayVector& src_array_vec,
+                     const std::shared_ptr<arrow::Schema>& read_schema,
+                     const std::vector<int32_t>& reader_offsets,
+                     const std::vector<int32_t>& field_offsets,
+                     const std::shared_ptr<arrow::Array>& expected_array,
+                     const std::optional<RoaringBitmap32>& selection_bitmap, int32_t batch_size,
+                     const std::shared_ptr<Executor>& executor) const {
+        {
             int32_t total_row_count = 0;
             std::vector<std::unique_ptr<BatchReader>> readers;
             for (const auto& array : src_array_vec) {
@@ -74,7 +90,7 @@ class DataEvolutionFileReaderTest : public ::testing::Test,
             ASSERT_OK_AND_ASSIGN(
                 auto data_evolution_file_reader,
                 DataEvolutionFileReader::Create(std::move(readers), read_schema, batch_size,
-                                                reader_offsets, field_offsets, pool_));
+                                                reader_offsets, field_offsets, pool_, executor));
             // check metrics, data_evolution_file_reader collects all row of each
             // MockFileBatchReader
             auto metrics = data_evolution_file_reader->GetReaderMetrics();
@@ -109,27 +125,30 @@ class DataEvolutionFileReaderTest : public ::testing::Test,
         readers.push_back(std::move(file_batch_reader));
         DataEvolutionFileReader fake_data_evolution_reader(
             std::move(readers), /*read_schema=*/arrow::schema({}), read_batch_size,
-            /*reader_offsets=*/{}, /*field_offsets=*/{}, GetArrowPool(pool_));
+            /*reader_offsets=*/{}, /*field_offsets=*/{}, GetArrowPool(pool_),
+            /*executor=*/nullptr);
         arrow::ArrayVector result_array_vec;
         while (true) {
             ASSERT_OK_AND_ASSIGN(auto result_array,
-                                 fake_data_evolution_reader.NextBatchForSingleReader(0));
+                                 fake_data_evolution_reader.NextBatchForSingleReader(
+                                     0, /*max_length=*/read_batch_size));
             if (result_array == nullptr) {
                 break;
             }
             result_array_vec.push_back(result_array);
         }
-        ASSERT_EQ(result_array_vec.size(),
+        ASSERT_GE(result_array_vec.size(),
                   std::ceil(static_cast<double>(expected_array->length()) / read_batch_size));
-        // except for last batch, the length each array is expected to be aligned to read_batch_size
-        for (size_t i = 0; i < result_array_vec.size() - 1; i++) {
-            ASSERT_EQ(result_array_vec[i]->length(), read_batch_size);
+        // the queued arrays are sliced to read_batch_size, never concatenated
+        for (const auto& result_array : result_array_vec) {
+            ASSERT_GT(result_array->length(), 0);
+            ASSERT_LE(result_array->length(), read_batch_size);
         }
-        if (expected_array->length() % read_batch_size == 0) {
-            ASSERT_EQ(result_array_vec.back()->length(), read_batch_size);
-        } else {
-            ASSERT_EQ(result_array_vec.back()->length(),
-                      expected_array->length() % read_batch_size);
+        if (!GetParam() && inner_batch_size >= read_batch_size && !selection_bitmap) {
+            // except for last batch, the length each array is expected to be read_batch_size
+            for (size_t i = 0; i + 1 < result_array_vec.size(); i++) {
+                ASSERT_EQ(result_array_vec[i]->length(), read_batch_size);
+            }
         }
         auto result_chunk_array = std::make_shared<arrow::ChunkedArray>(result_array_vec);
         auto expected_chunk_array = std::make_shared<arrow::ChunkedArray>(expected_array);
@@ -138,6 +157,7 @@ class DataEvolutionFileReaderTest : public ::testing::Test,
 
  private:
     std::shared_ptr<MemoryPool> pool_;
+    std::shared_ptr<Executor> executor_ = CreateDefaultExecutor(/*thread_count=*/2);
 };
 
 TEST_F(DataEvolutionFileReaderTest, TestInvalid) {
@@ -145,7 +165,8 @@ TEST_F(DataEvolutionFileReaderTest, TestInvalid) {
         arrow::FieldVector read_fields;
         auto read_schema = arrow::schema(read_fields);
         ASSERT_NOK_WITH_MSG(
-            DataEvolutionFileReader::Create({}, read_schema, /*read_batch_size=*/10, {}, {}, pool_),
+            DataEvolutionFileReader::Create({}, read_schema, /*read_batch_size=*/10, {}, {},
+                                            pool_, /*executor=*/nullptr),
             "read schema must not be empty");
     }
     {
@@ -159,7 +180,8 @@ TEST_F(DataEvolutionFileReaderTest, TestInvalid) {
         std::vector<int32_t> reader_offsets = {0, 0, 1};
         std::vector<int32_t> field_offsets = {0, 1, 0};
         ASSERT_NOK_WITH_MSG(DataEvolutionFileReader::Create({}, read_schema, /*read_batch_size=*/10,
-                                                            reader_offsets, field_offsets, pool_),
+                                                            reader_offsets, field_offsets, pool_,
+                                                            /*executor=*/nullptr),
                             "read schema, row offsets and field offsets must have the same size");
     }
     {
@@ -177,7 +199,8 @@ TEST_F(DataEvolutionFileReaderTest, TestInvalid) {
         std::vector<int32_t> field_offsets = {0, 1, 1, 0};
         ASSERT_NOK_WITH_MSG(
             DataEvolutionFileReader::Create(std::move(readers), read_schema, /*read_batch_size=*/10,
-                                            reader_offsets, field_offsets, pool_),
+                                            reader_offsets, field_offsets, pool_,
+                                            /*executor=*/nullptr),
             "readers size is supposed to be more than 1");
     }
 }
@@ -308,6 +331,54 @@ TEST_P(DataEvolutionFileReaderTest, TestNextBatchForSingleReader) {
     }
 }
 
+TEST_F(DataEvolutionFileReaderTest, TestAlignBatchesOfDifferentBoundaries) {
+    arrow::FieldVector read_fields = {arrow::field("f0", arrow::int32()),
+                                      arrow::field("f1", arrow::int32())};
+    auto read_schema = arrow::schema(read_fields);
+    auto array0 = arrow::ipc::internal::json::ArrayFromJSON(arrow::struct_({read_fields[0]}),
+                                                            R"([[0], [1], [2], [3], [4], [5]])")
+                      .ValueOrDie();
+    auto array1 =
+        arrow::ipc::internal::json::ArrayFromJSON(arrow::struct_({read_fields[1]}),
+                                                  R"([[10], [11], [12], [13], [14], [15]])")
+            .ValueOrDie();
+    auto expected_array =
+        arrow::ipc::internal::json::ArrayFromJSON(arrow::struct_(read_fields), R"([
+        [0, 10], [1, 11], [2, 12], [3, 13], [4, 14], [5, 15]
+])")
+            .ValueOrDie();
+    for (const auto& executor : {std::shared_ptr<Executor>(), executor_}) {
+        std::vector<std::unique_ptr<BatchReader>> readers;
+        readers.push_back(std::make_unique<MockFileBatchReader>(array0, array0->type(),
+                                                                /*read_batch_size=*/2));
+        readers.push_back(std::make_unique<MockFileBatchReader>(array1, array1->type(),
+                                                                /*read_batch_size=*/3));
+        ASSERT_OK_AND_ASSIGN(auto data_evolution_file_reader,
+                             DataEvolutionFileReader::Create(
+                                 std::move(readers), read_schema, /*read_batch_size=*/4,
+                                 /*reader_offsets=*/{0, 1}, /*field_offsets=*/{0, 0}, pool_,
+                                 executor));
+        // inner batches: [0, 1] [2, 3] [4, 5] and [10, 11, 12] [13, 14, 15], each batch ends at
+        // the first boundary of either reader
+        std::vector<int64_t> batch_lengths;
+        arrow::ArrayVector result_array_vec;
+        while (true) {
+            ASSERT_OK_AND_ASSIGN(auto batch_with_bitmap,
+                                 data_evolution_file_reader->NextArrowBatchWithBitmap());
+            if (batch_with_bitmap.first == nullptr) {
+                break;
+            }
+            batch_lengths.push_back(batch_with_bitmap.first->length());
+            result_array_vec.push_back(batch_with_bitmap.first);
+        }
+        data_evolution_file_reader->Close();
+        ASSERT_EQ(batch_lengths, std::vector<int64_t>({2, 1, 1, 2}));
+        auto result_chunk_array = std::make_shared<arrow::ChunkedArray>(result_array_vec);
+        auto expected_chunk_array = std::make_shared<arrow::ChunkedArray>(expected_array);
+        ASSERT_TRUE(result_chunk_array->Equals(expected_chunk_array));
+    }
+}
+
 TEST_P(DataEvolutionFileReaderTest, TestSimple) {
     arrow::FieldVector read_fields = {
         arrow::field("f0", arrow::int32()), arrow::field("f1", arrow::int32()),
@@ -619,7 +690,7 @@ TEST_P(DataEvolutionFileReaderTest, TestSingleReaderRowCountMismatch) {
     ASSERT_OK_AND_ASSIGN(
         auto data_evolution_file_reader,
         DataEvolutionFileReader::Create(std::move(readers), read_schema, /*read_batch_size=*/10,
-                                        reader_offsets, field_offsets, pool_));
+                                        reader_offsets, field_offsets, pool_, executor_));
     // array0 has 6 rows but array1 only has 5 rows
     ASSERT_NOK_WITH_MSG(
         paimon::test::ReadResultCollector::CollectResult(data_evolution_file_reader.get()),
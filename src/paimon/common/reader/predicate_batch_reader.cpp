@@ -24,14 +24,12 @@
 #include <vector>
 
 #include "arrow/array/array_base.h"
-#include "arrow/c/abi.h"
-#include "arrow/c/bridge.h"
 #include "arrow/memory_pool.h"
 #include "fmt/format.h"
+#include "paimon/common/metrics/metrics_impl.h"
+#include "paimon/common/metrics/scoped_timer.h"
 #include "paimon/common/predicate/predicate_filter.h"
-#include "paimon/common/reader/reader_utils.h"
 #include "paimon/common/utils/arrow/mem_utils.h"
-#include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/predicate/predicate.h"
 #include "paimon/status.h"
 
@@ -43,7 +41,9 @@ PredicateBatchReader::PredicateBatchReader(std::unique_ptr<BatchReader>&& reader
                                            const std::shared_ptr<MemoryPool>& pool)
     : arrow_pool_(GetArrowPool(pool)),
       reader_(std::move(reader)),
-      predicate_filter_(predicate_filter) {}
+      predicate_filter_(predicate_filter),
+      metrics_(std::make_shared<MetricsImpl>()),
+      filter_latency_(metrics_->GetOrCreateHistogram(FILTER_DURATION)) {}
 
 Result<std::unique_ptr<PredicateBatchReader>> PredicateBatchReader::Create(
     std::unique_ptr<BatchReader>&& reader, const std::shared_ptr<Predicate>& predicate,
@@ -58,33 +58,36 @@ Result<std::unique_ptr<PredicateBatchReader>> PredicateBatchReader::Create(
 }
 
 Result<BatchReader::ReadBatch> PredicateBatchReader::NextBatch() {
-    PAIMON_ASSIGN_OR_RAISE(BatchReader::ReadBatchWithBitmap batch_with_bitmap,
-                           NextBatchWithBitmap());
-    return ReaderUtils::ApplyBitmapToReadBatch(std::move(batch_with_bitmap), arrow_pool_.get());
+    PAIMON_ASSIGN_OR_RAISE(ArrowBatchWithBitmap batch_with_bitmap, NextArrowBatchWithBitmap());
+    return ExportFilteredArrowBatch(std::move(batch_with_bitmap), arrow_pool_.get());
 }
 
-Result<BatchReader::ReadBatchWithBitmap> PredicateBatchReader::NextBatchWithBitmap() {
+Result<ArrowBatchReader::ArrowBatchWithBitmap> PredicateBatchReader::NextArrowBatchWithBitmap() {
     while (true) {
-        PAIMON_ASSIGN_OR_RAISE(BatchReader::ReadBatchWithBitmap batch_with_bitmap,
-                               reader_->NextBatchWithBitmap());
-        if (BatchReader::IsEofBatch(batch_with_bitmap)) {
+        PAIMON_ASSIGN_OR_RAISE(ArrowBatchWithBitmap batch_with_bitmap,
+                               NextArrowBatchOf(reader_.get()));
+        if (IsEofArrowBatch(batch_with_bitmap)) {
             return batch_with_bitmap;
         }
-        auto& [batch, bitmap] = batch_with_bitmap;
-        auto& [c_array, c_schema] = batch;
-        assert(c_array);
-        PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> array,
-                                          arrow::ImportArray(c_array.get(), c_schema.get()));
+        auto& [array, bitmap] = batch_with_bitmap;
+        ScopedTimer timer(filter_latency_.get());
         PAIMON_ASSIGN_OR_RAISE(RoaringBitmap32 valid_bitmap, Filter(array));
+        timer.Stop();
         bitmap &= valid_bitmap;
         if (bitmap.IsEmpty()) {
             continue;
         }
-        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(*array, c_array.get(), c_schema.get()));
         return batch_with_bitmap;
     }
 }
 
+std::shared_ptr<Metrics> PredicateBatchReader::GetReaderMetrics() const {
+    auto metrics = std::make_shared<MetricsImpl>();
+    metrics->Merge(reader_->GetReaderMetrics());
+    metrics->Merge(metrics_);
+    return metrics;
+}
+
 Result<RoaringBitmap32> PredicateBatchReader::Filter(
     const std::shared_ptr<arrow::Array>& array) const {
     PAIMON_ASSIGN_OR_RAISE(std::vector<char> result, predicate_filter_->Test(*array));
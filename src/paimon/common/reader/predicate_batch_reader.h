@@ -19,6 +19,7 @@
 #include <memory>
 
 #include "arrow/memory_pool.h"
+#include "paimon/common/reader/arrow_batch_reader.h"
 #include "paimon/reader/batch_reader.h"
 #include "paimon/result.h"
 #include "paimon/utils/roaring_bitmap32.h"
@@ -28,13 +29,18 @@ class Array;
 }  // namespace arrow
 
 namespace paimon {
+class Histogram;
 class MemoryPool;
 class Metrics;
+class MetricsImpl;
 class Predicate;
 class PredicateFilter;
 
-class PredicateBatchReader : public BatchReader {
+class PredicateBatchReader : public ArrowBatchReader {
  public:
+    /// Histogram of the latencies in microseconds to filter a batch by the predicate.
+    static constexpr char FILTER_DURATION[] = "readPredicateFilterDuration";
+
     static Result<std::unique_ptr<PredicateBatchReader>> Create(
         std::unique_ptr<BatchReader>&& reader, const std::shared_ptr<Predicate>& predicate,
         const std::shared_ptr<MemoryPool>& pool);
@@ -43,15 +49,13 @@ class PredicateBatchReader : public BatchReader {
 
     Result<BatchReader::ReadBatch> NextBatch() override;
 
-    Result<BatchReader::ReadBatchWithBitmap> NextBatchWithBitmap() override;
+    Result<ArrowBatchWithBitmap> NextArrowBatchWithBitmap() override;
 
     void Close() override {
         return reader_->Close();
     }
 
-    std::shared_ptr<Metrics> GetReaderMetrics() const override {
-        return reader_->GetReaderMetrics();
-    }
+    std::shared_ptr<Metrics> GetReaderMetrics() const override;
 
  private:
     PredicateBatchReader(std::unique_ptr<BatchReader>&& reader,
@@ -63,5 +67,7 @@ class PredicateBatchReader : public BatchReader {
     std::unique_ptr<arrow::MemoryPool> arrow_pool_;
     std::unique_ptr<BatchReader> reader_;
     std::shared_ptr<PredicateFilter> predicate_filter_;
+    std::shared_ptr<MetricsImpl> metrics_;
+    std::shared_ptr<Histogram> filter_latency_;
 };
 }  // namespace paimon
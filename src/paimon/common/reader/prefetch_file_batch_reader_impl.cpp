@@ -62,17 +62,28 @@ Result<std::unique_ptr<PrefetchFileBatchReaderImpl>> PrefetchFileBatchReaderImpl
         return Status::Invalid("executor should not be nullptr.");
     }
 
+    auto build_reader = [&fs, &data_file_path,
+                         &reader_builder]() -> Result<std::unique_ptr<FileBatchReader>> {
+        PAIMON_ASSIGN_OR_RAISE(auto input_stream, fs->Open(data_file_path));
+        return reader_builder->Build(std::move(input_stream));
+    };
+    // with the footer cache enabled, build the first reader before the others so that they
+    // reuse its footer, otherwise build all of them in parallel
+    std::vector<Result<std::unique_ptr<FileBatchReader>>> file_batch_readers;
+    uint32_t parallel_begin = 0;
+    if (reader_builder->FooterCacheEnabled()) {
+        file_batch_readers.push_back(build_reader());
+        parallel_begin = 1;
+    }
     std::vector<std::future<Result<std::unique_ptr<FileBatchReader>>>> futures;
-    for (uint32_t i = 0; i < prefetch_max_parallel_num; i++) {
-        futures.push_back(Via(
-            executor.get(),
-            [&fs, &data_file_path, &reader_builder]() -> Result<std::unique_ptr<FileBatchReader>> {
-                PAIMON_ASSIGN_OR_RAISE(auto input_stream, fs->Open(data_file_path));
-                return reader_builder->Build(std::move(input_stream));
-            }));
+    for (uint32_t i = parallel_begin; i < prefetch_max_parallel_num; i++) {
+        futures.push_back(Via(executor.get(), build_reader));
     }
-    std::vector<std::shared_ptr<PrefetchFileBatchReader>> readers;
     for (auto& file_batch_reader : CollectAll(futures)) {
+        file_batch_readers.push_back(std::move(file_batch_reader));
+    }
+    std::vector<std::shared_ptr<PrefetchFileBatchReader>> readers;
+    for (auto& file_batch_reader : file_batch_readers) {
         if (!file_batch_reader.ok()) {
             return file_batch_reader.status();
         }
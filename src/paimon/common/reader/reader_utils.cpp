@@ -85,16 +85,36 @@ Result<BatchReader::ReadBatch> ReaderUtils::ApplyBitmapToReadBatch(
     }
     PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> arrow_array,
                                       arrow::ImportArray(c_array.get(), c_schema.get()));
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Array> result,
+                           ApplyBitmapToArray(arrow_array, bitmap, arrow_pool));
+    return ExportReadBatch(*result);
+}
+
+Result<std::shared_ptr<arrow::Array>> ReaderUtils::ApplyBitmapToArray(
+    const std::shared_ptr<arrow::Array>& array, const RoaringBitmap32& bitmap,
+    arrow::MemoryPool* arrow_pool) {
+    if (bitmap.IsEmpty()) {
+        return Status::Invalid(
+            "NextBatchWithBitmap should always return the result with at least one valid row "
+            "except eof");
+    }
+    if (bitmap.Cardinality() == array->length()) {
+        // indicates all rows in array are valid
+        return array;
+    }
     PAIMON_ASSIGN_OR_RAISE(arrow::ArrayVector array_vec,
-                           GenerateFilteredArrayVector(arrow_array, bitmap));
+                           GenerateFilteredArrayVector(array, bitmap));
     PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> result,
                                       arrow::Concatenate(array_vec, arrow_pool));
     assert(result && result->length() > 0);
-    std::unique_ptr<ArrowArray> result_c_array = std::make_unique<ArrowArray>();
-    std::unique_ptr<ArrowSchema> result_c_schema = std::make_unique<ArrowSchema>();
-    PAIMON_RETURN_NOT_OK_FROM_ARROW(
-        arrow::ExportArray(*result, result_c_array.get(), result_c_schema.get()));
-    return make_pair(std::move(result_c_array), std::move(result_c_schema));
+    return result;
+}
+
+Result<BatchReader::ReadBatch> ReaderUtils::ExportReadBatch(const arrow::Array& array) {
+    std::unique_ptr<ArrowArray> c_array = std::make_unique<ArrowArray>();
+    std::unique_ptr<ArrowSchema> c_schema = std::make_unique<ArrowSchema>();
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(array, c_array.get(), c_schema.get()));
+    return std::make_pair(std::move(c_array), std::move(c_schema));
 }
 
 BatchReader::ReadBatchWithBitmap ReaderUtils::AddAllValidBitmap(BatchReader::ReadBatch&& batch) {
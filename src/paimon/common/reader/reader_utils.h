@@ -41,6 +41,15 @@ class ReaderUtils {
     /// This function may trigger data copy.
     static Result<BatchReader::ReadBatch> ApplyBitmapToReadBatch(
         BatchReader::ReadBatchWithBitmap&& batch_with_bitmap, arrow::MemoryPool* arrow_pool);
+    /// Same as `ApplyBitmapToReadBatch()` but on an arrow array, the input array is returned if
+    /// all rows are valid.
+    static Result<std::shared_ptr<arrow::Array>> ApplyBitmapToArray(
+        const std::shared_ptr<arrow::Array>& array, const RoaringBitmap32& bitmap,
+        arrow::MemoryPool* arrow_pool);
+
+    /// Export an arrow array to the c array and c schema of a read batch.
+    static Result<BatchReader::ReadBatch> ExportReadBatch(const arrow::Array& array);
+
     /// @param batch a read batch
     /// @return return the input batch and a all valid bitmap
     static BatchReader::ReadBatchWithBitmap AddAllValidBitmap(BatchReader::ReadBatch&& batch);
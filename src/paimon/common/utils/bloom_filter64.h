@@ -52,6 +52,9 @@ class PAIMON_EXPORT BloomFilter64 {
         void Set(int32_t index);
         bool Get(int32_t index) const;
         int32_t BitSize() const;
+        const std::shared_ptr<Bytes>& GetBytes() const {
+            return bytes_;
+        }
 
      private:
         static constexpr int8_t MASK = 0x07;
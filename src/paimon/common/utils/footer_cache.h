@@ -0,0 +1,130 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace paimon {
+
+/// A thread safe LRU cache of the parsed footers of immutable files, keyed by the file path and
+/// length, so that the readers of a file skip reading and decoding its footer again. The least
+/// recently used footers are evicted once the total weight exceeds the max weight.
+template <typename Footer>
+class FooterCache {
+ public:
+    static constexpr int64_t DEFAULT_MAX_WEIGHT = 64 * 1024 * 1024;
+
+    explicit FooterCache(int64_t max_weight) : max_weight_(max_weight) {}
+
+    // No copying allowed
+    FooterCache(const FooterCache&) = delete;
+    void operator=(const FooterCache&) = delete;
+
+    /// @return A process wide cache for the footer type.
+    static FooterCache* Global() {
+        static FooterCache cache(DEFAULT_MAX_WEIGHT);
+        return &cache;
+    }
+
+    /// @return The cached footer, or nullptr if it is not cached.
+    std::shared_ptr<Footer> Get(const std::string& path, uint64_t length) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = footers_.find({path, length});
+        if (iter == footers_.end()) {
+            miss_count_++;
+            return nullptr;
+        }
+        hit_count_++;
+        lru_list_.splice(lru_list_.begin(), lru_list_, iter->second.lru_iter);
+        return iter->second.footer;
+    }
+
+    /// @param weight Weight of the footer, usually its serialized size.
+    void Put(const std::string& path, uint64_t length, const std::shared_ptr<Footer>& footer,
+             int64_t weight) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Key key(path, length);
+        auto iter = footers_.find(key);
+        if (iter != footers_.end()) {
+            weight_ -= iter->second.weight;
+            lru_list_.erase(iter->second.lru_iter);
+            footers_.erase(iter);
+        }
+        lru_list_.push_front(key);
+        footers_.emplace(key, Entry{footer, weight, lru_list_.begin()});
+        weight_ += weight;
+        while (weight_ > max_weight_ && !lru_list_.empty()) {
+            auto eldest = footers_.find(lru_list_.back());
+            weight_ -= eldest->second.weight;
+            footers_.erase(eldest);
+            lru_list_.pop_back();
+        }
+    }
+
+    /// Removes all footers and resets the hit and miss counts.
+    void Clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        footers_.clear();
+        lru_list_.clear();
+        weight_ = 0;
+        hit_count_ = 0;
+        miss_count_ = 0;
+    }
+
+    size_t Size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return footers_.size();
+    }
+    int64_t Weight() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return weight_;
+    }
+    uint64_t HitCount() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return hit_count_;
+    }
+    uint64_t MissCount() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return miss_count_;
+    }
+
+ private:
+    using Key = std::pair<std::string, uint64_t>;
+    using LruList = std::list<Key>;
+    struct Entry {
+        std::shared_ptr<Footer> footer;
+        int64_t weight;
+        typename LruList::iterator lru_iter;
+    };
+
+    int64_t max_weight_;
+    mutable std::mutex mutex_;
+    // the most recently used footer is at the front
+    LruList lru_list_;
+    std::map<Key, Entry> footers_;
+    int64_t weight_ = 0;
+    uint64_t hit_count_ = 0;
+    uint64_t miss_count_ = 0;
+};
+
+}  // namespace paimon
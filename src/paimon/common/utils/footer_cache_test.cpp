@@ -0,0 +1,65 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/utils/footer_cache.h"
+
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace paimon::test {
+
+TEST(FooterCacheTest, TestGetAndPut) {
+    FooterCache<std::string> cache(/*max_weight=*/10);
+    ASSERT_FALSE(cache.Get("/t/data-0.orc", 100));
+    cache.Put("/t/data-0.orc", 100, std::make_shared<std::string>("footer-0"), /*weight=*/4);
+    auto footer = cache.Get("/t/data-0.orc", 100);
+    ASSERT_TRUE(footer);
+    ASSERT_EQ("footer-0", *footer);
+    // a file rewritten with another length does not hit
+    ASSERT_FALSE(cache.Get("/t/data-0.orc", 200));
+    ASSERT_EQ(1, cache.HitCount());
+    ASSERT_EQ(2, cache.MissCount());
+
+    // data-0 is the most recently used footer, data-1 is evicted
+    cache.Put("/t/data-1.orc", 100, std::make_shared<std::string>("footer-1"), /*weight=*/4);
+    ASSERT_TRUE(cache.Get("/t/data-0.orc", 100));
+    cache.Put("/t/data-2.orc", 100, std::make_shared<std::string>("footer-2"), /*weight=*/4);
+    ASSERT_EQ(2, cache.Size());
+    ASSERT_EQ(8, cache.Weight());
+    ASSERT_FALSE(cache.Get("/t/data-1.orc", 100));
+    ASSERT_TRUE(cache.Get("/t/data-0.orc", 100));
+    ASSERT_TRUE(cache.Get("/t/data-2.orc", 100));
+
+    // replace the footer of a cached file
+    cache.Put("/t/data-2.orc", 100, std::make_shared<std::string>("new-footer-2"), /*weight=*/5);
+    ASSERT_EQ("new-footer-2", *cache.Get("/t/data-2.orc", 100));
+    ASSERT_EQ(9, cache.Weight());
+    // a footer heavier than the max weight is not kept
+    cache.Put("/t/data-3.orc", 100, std::make_shared<std::string>("footer-3"), /*weight=*/11);
+    ASSERT_EQ(0, cache.Size());
+    ASSERT_EQ(0, cache.Weight());
+
+    cache.Put("/t/data-4.orc", 100, std::make_shared<std::string>("footer-4"), /*weight=*/1);
+    cache.Clear();
+    ASSERT_EQ(0, cache.Size());
+    ASSERT_EQ(0, cache.HitCount());
+    ASSERT_EQ(0, cache.MissCount());
+    ASSERT_EQ(FooterCache<std::string>::Global(), FooterCache<std::string>::Global());
+}
+
+}  // namespace paimon::test
@@ -0,0 +1,418 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/utils/hll_sketch_util.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "fmt/format.h"
+#include "paimon/status.h"
+
+namespace paimon {
+namespace {
+// Layout of the preamble, see PreambleUtil of DataSketches.
+constexpr size_t PREAMBLE_INTS_BYTE = 0;
+constexpr size_t SER_VER_BYTE = 1;
+constexpr size_t FAMILY_BYTE = 2;
+constexpr size_t LG_K_BYTE = 3;
+constexpr size_t LG_ARR_BYTE = 4;
+constexpr size_t FLAGS_BYTE = 5;
+constexpr size_t LIST_COUNT_BYTE = 6;
+constexpr size_t HLL_CUR_MIN_BYTE = 6;
+constexpr size_t MODE_BYTE = 7;
+constexpr size_t LIST_INT_ARR_START = 8;
+constexpr size_t HASH_SET_COUNT_INT = 8;
+constexpr size_t HASH_SET_INT_ARR_START = 12;
+constexpr size_t HIP_ACCUM_DOUBLE = 8;
+constexpr size_t KXQ0_DOUBLE = 16;
+constexpr size_t KXQ1_DOUBLE = 24;
+constexpr size_t CUR_MIN_COUNT_INT = 32;
+constexpr size_t AUX_COUNT_INT = 36;
+constexpr size_t HLL_BYTE_ARR_START = 40;
+
+constexpr uint8_t LIST_PREINTS = 2;
+constexpr uint8_t HASH_SET_PREINTS = 3;
+constexpr uint8_t HLL_PREINTS = 10;
+constexpr uint8_t SER_VER = 1;
+constexpr uint8_t FAMILY_ID = 7;
+
+constexpr uint8_t EMPTY_FLAG_MASK = 4;
+constexpr uint8_t COMPACT_FLAG_MASK = 8;
+constexpr uint8_t OUT_OF_ORDER_FLAG_MASK = 16;
+
+constexpr uint8_t CUR_MODE_LIST = 0;
+constexpr uint8_t CUR_MODE_SET = 1;
+constexpr uint8_t CUR_MODE_HLL = 2;
+constexpr uint8_t TGT_HLL_4 = 0;
+constexpr uint8_t TGT_HLL_6 = 1;
+constexpr uint8_t TGT_HLL_8 = 2;
+
+constexpr int32_t KEY_BITS_26 = 26;
+constexpr int32_t KEY_MASK_26 = (1 << KEY_BITS_26) - 1;
+constexpr int32_t AUX_TOKEN = 15;
+constexpr int32_t LG_INIT_LIST_SIZE = 3;
+constexpr int32_t LG_INIT_SET_SIZE = 5;
+constexpr int32_t RESIZE_NUMER = 3;
+constexpr int32_t RESIZE_DENOM = 4;
+constexpr int32_t EMPTY_COUPON = 0;
+
+/// The coupons or the registers of a serialized sketch.
+struct HllSketchData {
+    int32_t lg_k = 0;
+    bool is_hll_mode = false;
+    std::vector<int32_t> coupons;
+    std::vector<uint8_t> registers;
+};
+
+template <typename T>
+T ReadValue(std::string_view sketch, size_t offset) {
+    T value;
+    std::memcpy(&value, sketch.data() + offset, sizeof(T));
+    return value;
+}
+
+template <typename T>
+void WriteValue(char* data, size_t offset, T value) {
+    std::memcpy(data + offset, &value, sizeof(T));
+}
+
+int32_t CouponSlot(int32_t coupon, int32_t lg_k) {
+    return (coupon & KEY_MASK_26) & ((1 << lg_k) - 1);
+}
+
+uint8_t CouponValue(int32_t coupon) {
+    return static_cast<uint8_t>(static_cast<uint32_t>(coupon) >> KEY_BITS_26);
+}
+
+Status CheckSize(std::string_view sketch, size_t expected_size) {
+    if (sketch.size() < expected_size) {
+        return Status::Invalid(fmt::format("invalid hll sketch, size {} is less than {}",
+                                           sketch.size(), expected_size));
+    }
+    return Status::OK();
+}
+
+/// Reads coupons of a compact array, or non-empty coupons of an updatable array.
+Status ReadCoupons(std::string_view sketch, size_t offset, bool compact, int32_t count,
+                   int32_t lg_arr, std::vector<int32_t>* coupons) {
+    if (!compact && (lg_arr < 0 || lg_arr > KEY_BITS_26)) {
+        return Status::Invalid(fmt::format("invalid hll sketch, lg_arr {}", lg_arr));
+    }
+    size_t array_length =
+        compact ? static_cast<size_t>(count) : (static_cast<size_t>(1) << lg_arr);
+    PAIMON_RETURN_NOT_OK(CheckSize(sketch, offset + array_length * sizeof(int32_t)));
+    coupons->reserve(coupons->size() + count);
+    for (size_t i = 0; i < array_length; i++) {
+        auto coupon = ReadValue<int32_t>(sketch, offset + i * sizeof(int32_t));
+        if (coupon != EMPTY_COUPON) {
+            coupons->push_back(coupon);
+        }
+    }
+    return Status::OK();
+}
+
+Status ReadHllRegisters(std::string_view sketch, uint8_t tgt_hll_type, bool compact,
+                        HllSketchData* data) {
+    PAIMON_RETURN_NOT_OK(CheckSize(sketch, HLL_BYTE_ARR_START));
+    int32_t k = 1 << data->lg_k;
+    data->registers.resize(k);
+    if (tgt_hll_type == TGT_HLL_8) {
+        PAIMON_RETURN_NOT_OK(CheckSize(sketch, HLL_BYTE_ARR_START + k));
+        std::memcpy(data->registers.data(), sketch.data() + HLL_BYTE_ARR_START, k);
+    } else if (tgt_hll_type == TGT_HLL_6) {
+        size_t register_bytes = ((static_cast<size_t>(k) * 3) >> 2) + 1;
+        PAIMON_RETURN_NOT_OK(CheckSize(sketch, HLL_BYTE_ARR_START + register_bytes));
+        for (int32_t slot = 0; slot < k; slot++) {
+            size_t start_bit = static_cast<size_t>(slot) * 6;
+            auto two_bytes =
+                ReadValue<uint16_t>(sketch, HLL_BYTE_ARR_START + (start_bit >> 3));
+            data->registers[slot] = static_cast<uint8_t>((two_bytes >> (start_bit & 7)) & 0x3F);
+        }
+    } else {
+        size_t register_bytes = static_cast<size_t>(k) >> 1;
+        PAIMON_RETURN_NOT_OK(CheckSize(sketch, HLL_BYTE_ARR_START + register_bytes));
+        auto cur_min = static_cast<uint8_t>(sketch[HLL_CUR_MIN_BYTE]);
+        for (int32_t slot = 0; slot < k; slot++) {
+            auto byte = static_cast<uint8_t>(sketch[HLL_BYTE_ARR_START + (slot >> 1)]);
+            uint8_t nibble = (slot & 1) ? (byte >> 4) : (byte & 0x0F);
+            // values exceeding the 4 bits window are stored in the aux array
+            data->registers[slot] = nibble == AUX_TOKEN ? 0 : cur_min + nibble;
+        }
+        auto aux_count = ReadValue<int32_t>(sketch, AUX_COUNT_INT);
+        auto lg_aux_arr = static_cast<int32_t>(sketch[LG_ARR_BYTE]);
+        if (aux_count < 0) {
+            return Status::Invalid(fmt::format("invalid hll sketch, aux count {}", aux_count));
+        }
+        std::vector<int32_t> aux_pairs;
+        PAIMON_RETURN_NOT_OK(ReadCoupons(sketch, HLL_BYTE_ARR_START + register_bytes, compact,
+                                         aux_count, lg_aux_arr, &aux_pairs));
+        for (int32_t pair : aux_pairs) {
+            int32_t slot = pair & KEY_MASK_26;
+            if (slot >= k) {
+                return Status::Invalid(
+                    fmt::format("invalid hll sketch, aux slot {} exceeds k {}", slot, k));
+            }
+            data->registers[slot] = CouponValue(pair);
+        }
+    }
+    return Status::OK();
+}
+
+Result<HllSketchData> ReadSketch(std::string_view sketch) {
+    PAIMON_RETURN_NOT_OK(CheckSize(sketch, LIST_INT_ARR_START));
+    auto ser_ver = static_cast<uint8_t>(sketch[SER_VER_BYTE]);
+    auto family = static_cast<uint8_t>(sketch[FAMILY_BYTE]);
+    if (ser_ver != SER_VER || family != FAMILY_ID) {
+        return Status::Invalid(
+            fmt::format("invalid hll sketch, serial version {}, family {}", ser_ver, family));
+    }
+    HllSketchData data;
+    data.lg_k = static_cast<int32_t>(sketch[LG_K_BYTE]);
+    if (data.lg_k < HllSketchUtil::MIN_LG_K || data.lg_k > HllSketchUtil::MAX_LG_K) {
+        return Status::Invalid(fmt::format("invalid hll sketch, lg_k {}", data.lg_k));
+    }
+    auto pre_ints = static_cast<uint8_t>(sketch[PREAMBLE_INTS_BYTE]);
+    auto flags = static_cast<uint8_t>(sketch[FLAGS_BYTE]);
+    auto mode = static_cast<uint8_t>(sketch[MODE_BYTE]);
+    uint8_t cur_mode = mode & 3;
+    uint8_t tgt_hll_type = (mode >> 2) & 3;
+    bool compact = flags & COMPACT_FLAG_MASK;
+    auto lg_arr = static_cast<int32_t>(sketch[LG_ARR_BYTE]);
+    if (tgt_hll_type > TGT_HLL_8) {
+        return Status::Invalid(fmt::format("invalid hll sketch, target type {}", tgt_hll_type));
+    }
+    if (cur_mode == CUR_MODE_LIST && pre_ints == LIST_PREINTS) {
+        if (flags & EMPTY_FLAG_MASK) {
+            return data;
+        }
+        auto count = static_cast<int32_t>(static_cast<uint8_t>(sketch[LIST_COUNT_BYTE]));
+        PAIMON_RETURN_NOT_OK(
+            ReadCoupons(sketch, LIST_INT_ARR_START, compact, count, lg_arr, &data.coupons));
+    } else if (cur_mode == CUR_MODE_SET && pre_ints == HASH_SET_PREINTS) {
+        PAIMON_RETURN_NOT_OK(CheckSize(sketch, HASH_SET_INT_ARR_START));
+        auto count = ReadValue<int32_t>(sketch, HASH_SET_COUNT_INT);
+        if (count < 0) {
+            return Status::Invalid(fmt::format("invalid hll sketch, coupon count {}", count));
+        }
+        PAIMON_RETURN_NOT_OK(
+            ReadCoupons(sketch, HASH_SET_INT_ARR_START, compact, count, lg_arr, &data.coupons));
+    } else if (cur_mode == CUR_MODE_HLL && pre_ints == HLL_PREINTS) {
+        data.is_hll_mode = true;
+        PAIMON_RETURN_NOT_OK(ReadHllRegisters(sketch, tgt_hll_type, compact, &data));
+    } else {
+        return Status::Invalid(
+            fmt::format("invalid hll sketch, mode {}, preamble ints {}", cur_mode, pre_ints));
+    }
+    return data;
+}
+
+void WritePreamble(char* data, uint8_t pre_ints, int32_t lg_k, int32_t lg_arr, uint8_t flags,
+                   uint8_t mode) {
+    data[PREAMBLE_INTS_BYTE] = static_cast<char>(pre_ints);
+    data[SER_VER_BYTE] = static_cast<char>(SER_VER);
+    data[FAMILY_BYTE] = static_cast<char>(FAMILY_ID);
+    data[LG_K_BYTE] = static_cast<char>(lg_k);
+    data[LG_ARR_BYTE] = static_cast<char>(lg_arr);
+    data[FLAGS_BYTE] = static_cast<char>(flags);
+    data[LIST_COUNT_BYTE] = 0;
+    data[MODE_BYTE] = static_cast<char>(mode);
+}
+
+PAIMON_UNIQUE_PTR<Bytes> WriteList(int32_t lg_k, const std::vector<int32_t>& coupons,
+                                   MemoryPool* pool) {
+    auto count = static_cast<int32_t>(coupons.size());
+    auto bytes = Bytes::AllocateBytes(LIST_INT_ARR_START + count * sizeof(int32_t), pool);
+    uint8_t flags = COMPACT_FLAG_MASK | (coupons.empty() ? EMPTY_FLAG_MASK : 0);
+    WritePreamble(bytes->data(), LIST_PREINTS, lg_k, LG_INIT_LIST_SIZE, flags,
+                  CUR_MODE_LIST | (TGT_HLL_4 << 2));
+    bytes->data()[LIST_COUNT_BYTE] = static_cast<char>(count);
+    if (count > 0) {
+        std::memcpy(bytes->data() + LIST_INT_ARR_START, coupons.data(), count * sizeof(int32_t));
+    }
+    return bytes;
+}
+
+PAIMON_UNIQUE_PTR<Bytes> WriteSet(int32_t lg_k, int32_t lg_arr, const std::vector<int32_t>& table,
+                                  int32_t count, MemoryPool* pool) {
+    auto bytes = Bytes::AllocateBytes(HASH_SET_INT_ARR_START + count * sizeof(int32_t), pool);
+    WritePreamble(bytes->data(), HASH_SET_PREINTS, lg_k, lg_arr,
+                  COMPACT_FLAG_MASK | OUT_OF_ORDER_FLAG_MASK, CUR_MODE_SET | (TGT_HLL_4 << 2));
+    WriteValue<int32_t>(bytes->data(), HASH_SET_COUNT_INT, count);
+    size_t offset = HASH_SET_INT_ARR_START;
+    for (int32_t coupon : table) {
+        if (coupon != EMPTY_COUPON) {
+            WriteValue<int32_t>(bytes->data(), offset, coupon);
+            offset += sizeof(int32_t);
+        }
+    }
+    assert(offset == bytes->size());
+    return bytes;
+}
+
+PAIMON_UNIQUE_PTR<Bytes> WriteHll(int32_t lg_k, const std::vector<uint8_t>& registers,
+                                  MemoryPool* pool) {
+    int32_t k = 1 << lg_k;
+    auto bytes = Bytes::AllocateBytes(HLL_BYTE_ARR_START + k, pool);
+    // the union result is out of order, so the composite estimator is used instead of the hip
+    // accumulator, which is left as zero
+    WritePreamble(bytes->data(), HLL_PREINTS, lg_k, /*lg_arr=*/0,
+                  COMPACT_FLAG_MASK | OUT_OF_ORDER_FLAG_MASK, CUR_MODE_HLL | (TGT_HLL_8 << 2));
+    // as in DataSketches, only HLL_4 maintains cur_min, HLL_6 and HLL_8 keep it as zero and
+    // count the zero registers
+    int32_t num_at_cur_min = 0;
+    double kxq0 = 0.0;
+    double kxq1 = 0.0;
+    for (uint8_t value : registers) {
+        if (value < 32) {
+            kxq0 += std::ldexp(1.0, -value);
+        } else {
+            kxq1 += std::ldexp(1.0, -value);
+        }
+        if (value == 0) {
+            num_at_cur_min++;
+        }
+    }
+    bytes->data()[HLL_CUR_MIN_BYTE] = 0;
+    WriteValue<double>(bytes->data(), HIP_ACCUM_DOUBLE, 0.0);
+    WriteValue<double>(bytes->data(), KXQ0_DOUBLE, kxq0);
+    WriteValue<double>(bytes->data(), KXQ1_DOUBLE, kxq1);
+    WriteValue<int32_t>(bytes->data(), CUR_MIN_COUNT_INT, num_at_cur_min);
+    WriteValue<int32_t>(bytes->data(), AUX_COUNT_INT, 0);
+    std::memcpy(bytes->data() + HLL_BYTE_ARR_START, registers.data(), k);
+    return bytes;
+}
+
+void UpdateRegisters(const std::vector<int32_t>& coupons, int32_t lg_k,
+                     std::vector<uint8_t>* registers) {
+    for (int32_t coupon : coupons) {
+        uint8_t& value = (*registers)[CouponSlot(coupon, lg_k)];
+        value = std::max(value, CouponValue(coupon));
+    }
+}
+
+/// Same as `CouponHashSet.find()` of DataSketches, so that the coupons are serialized in the
+/// same order.
+/// @return The index of the coupon, or the bitwise complement of the index of an empty slot.
+int32_t FindCoupon(const std::vector<int32_t>& table, int32_t lg_arr, int32_t coupon) {
+    int32_t mask = (1 << lg_arr) - 1;
+    int32_t probe = coupon & mask;
+    while (true) {
+        int32_t coupon_at_probe = table[probe];
+        if (coupon_at_probe == EMPTY_COUPON) {
+            return ~probe;
+        }
+        if (coupon_at_probe == coupon) {
+            return probe;
+        }
+        int32_t stride = ((coupon & KEY_MASK_26) >> lg_arr) | 1;
+        probe = (probe + stride) & mask;
+    }
+}
+
+/// Inserts coupons to a union gadget in LIST or SET mode, and promotes the gadget in the same
+/// way as DataSketches.
+PAIMON_UNIQUE_PTR<Bytes> UnionCoupons(int32_t lg_k, const std::vector<int32_t>& coupons,
+                                      MemoryPool* pool) {
+    std::vector<int32_t> list;
+    size_t pos = 0;
+    while (pos < coupons.size() && list.size() < (static_cast<size_t>(1) << LG_INIT_LIST_SIZE)) {
+        int32_t coupon = coupons[pos++];
+        if (std::find(list.begin(), list.end(), coupon) == list.end()) {
+            list.push_back(coupon);
+        }
+    }
+    if (list.size() < (static_cast<size_t>(1) << LG_INIT_LIST_SIZE)) {
+        return WriteList(lg_k, list, pool);
+    }
+    std::vector<uint8_t> registers(static_cast<size_t>(1) << lg_k, 0);
+    if (lg_k < 8) {
+        UpdateRegisters(coupons, lg_k, &registers);
+        return WriteHll(lg_k, registers, pool);
+    }
+    int32_t lg_arr = LG_INIT_SET_SIZE;
+    std::vector<int32_t> table(static_cast<size_t>(1) << lg_arr, EMPTY_COUPON);
+    int32_t count = 0;
+    auto insert = [&](int32_t coupon) {
+        int32_t index = FindCoupon(table, lg_arr, coupon);
+        if (index < 0) {
+            table[~index] = coupon;
+            count++;
+        }
+    };
+    for (int32_t coupon : list) {
+        insert(coupon);
+    }
+    for (; pos < coupons.size(); pos++) {
+        insert(coupons[pos]);
+        if (RESIZE_DENOM * count <= RESIZE_NUMER * (1 << lg_arr)) {
+            continue;
+        }
+        if (lg_arr == lg_k - 3) {
+            UpdateRegisters(coupons, lg_k, &registers);
+            return WriteHll(lg_k, registers, pool);
+        }
+        std::vector<int32_t> old_table = std::move(table);
+        lg_arr++;
+        table.assign(static_cast<size_t>(1) << lg_arr, EMPTY_COUPON);
+        count = 0;
+        for (int32_t coupon : old_table) {
+            if (coupon != EMPTY_COUPON) {
+                insert(coupon);
+            }
+        }
+    }
+    return WriteSet(lg_k, lg_arr, table, count, pool);
+}
+
+}  // namespace
+
+Result<PAIMON_UNIQUE_PTR<Bytes>> HllSketchUtil::Union(std::string_view sketch1,
+                                                      std::string_view sketch2,
+                                                      MemoryPool* pool) {
+    PAIMON_ASSIGN_OR_RAISE(HllSketchData data1, ReadSketch(sketch1));
+    PAIMON_ASSIGN_OR_RAISE(HllSketchData data2, ReadSketch(sketch2));
+    if (!data1.is_hll_mode && !data2.is_hll_mode) {
+        std::vector<int32_t> coupons = std::move(data1.coupons);
+        coupons.insert(coupons.end(), data2.coupons.begin(), data2.coupons.end());
+        return UnionCoupons(data1.lg_k, coupons, pool);
+    }
+    // the registers of the sketch with larger lg_k are down sampled to the smaller lg_k
+    int32_t lg_k = data1.lg_k;
+    if (data2.is_hll_mode) {
+        lg_k = std::min(lg_k, data2.lg_k);
+    }
+    int32_t mask = (1 << lg_k) - 1;
+    std::vector<uint8_t> registers(static_cast<size_t>(1) << lg_k, 0);
+    for (const HllSketchData* data : {&data1, &data2}) {
+        if (data->is_hll_mode) {
+            for (size_t slot = 0; slot < data->registers.size(); slot++) {
+                uint8_t& value = registers[slot & mask];
+                value = std::max(value, data->registers[slot]);
+            }
+        } else {
+            UpdateRegisters(data->coupons, lg_k, &registers);
+        }
+    }
+    return WriteHll(lg_k, registers, pool);
+}
+
+}  // namespace paimon
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <string_view>
+
+#include "paimon/memory/bytes.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/result.h"
+#include "paimon/visibility.h"
+
+namespace paimon {
+
+/// Utils of the serialized HLL sketches of Apache DataSketches, compatible with `HllSketchUtil`
+/// of Java Paimon.
+///
+/// Sketches in all modes (LIST, SET and HLL) and of all target types (HLL_4, HLL_6 and HLL_8) can
+/// be read. The union is performed on the coupons and registers read from the serialized sketches
+/// directly, without rebuilding the sketches.
+class PAIMON_EXPORT HllSketchUtil {
+ public:
+    HllSketchUtil() = delete;
+    ~HllSketchUtil() = delete;
+
+    /// Unions two serialized HLL sketches, with the lg_k of the first sketch as the max lg_k.
+    ///
+    /// @note Same as the union of DataSketches, the result stays in LIST or SET mode while the
+    /// number of distinct coupons is small. In HLL mode the result is serialized as HLL_8
+    /// instead of HLL_4, which can be read by any version of DataSketches.
+    static Result<PAIMON_UNIQUE_PTR<Bytes>> Union(std::string_view sketch1,
+                                                  std::string_view sketch2, MemoryPool* pool);
+
+ public:
+    static constexpr int32_t MIN_LG_K = 4;
+    static constexpr int32_t MAX_LG_K = 21;
+};
+
+}  // namespace paimon
@@ -0,0 +1,326 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/utils/hll_sketch_util.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+class HllSketchUtilTest : public ::testing::Test {
+ public:
+    static int32_t Coupon(int32_t slot, int32_t value) {
+        return (value << 26) | slot;
+    }
+
+    static std::vector<int32_t> RandomCoupons(int32_t count, std::mt19937* random) {
+        std::set<int32_t> slots;
+        std::vector<int32_t> coupons;
+        while (static_cast<int32_t>(coupons.size()) < count) {
+            int32_t slot = (*random)() & ((1 << 26) - 1);
+            if (slots.insert(slot).second) {
+                coupons.push_back(Coupon(slot, (*random)() % 40 + 1));
+            }
+        }
+        return coupons;
+    }
+
+    static std::string Preamble(int32_t pre_ints, int32_t lg_k, int32_t lg_arr, int32_t flags,
+                                int32_t mode) {
+        std::string sketch(8, '\0');
+        sketch[0] = static_cast<char>(pre_ints);
+        sketch[1] = 1;
+        sketch[2] = 7;
+        sketch[3] = static_cast<char>(lg_k);
+        sketch[4] = static_cast<char>(lg_arr);
+        sketch[5] = static_cast<char>(flags);
+        sketch[7] = static_cast<char>(mode);
+        return sketch;
+    }
+
+    static void AppendInt(int32_t value, std::string* sketch) {
+        sketch->append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    static std::string ListSketch(int32_t lg_k, const std::vector<int32_t>& coupons) {
+        std::string sketch = Preamble(2, lg_k, 3, coupons.empty() ? 12 : 8, 0);
+        sketch[6] = static_cast<char>(coupons.size());
+        for (int32_t coupon : coupons) {
+            AppendInt(coupon, &sketch);
+        }
+        return sketch;
+    }
+
+    static std::string HllPreamble(int32_t lg_k, int32_t tgt_hll_type) {
+        std::string sketch = Preamble(10, lg_k, 0, 8, 2 | (tgt_hll_type << 2));
+        sketch.resize(40, '\0');
+        return sketch;
+    }
+
+    static std::string Hll8Sketch(int32_t lg_k, const std::vector<uint8_t>& registers) {
+        std::string sketch = HllPreamble(lg_k, 2);
+        sketch.append(reinterpret_cast<const char*>(registers.data()), registers.size());
+        return sketch;
+    }
+
+    static std::string Hll6Sketch(int32_t lg_k, const std::vector<uint8_t>& registers) {
+        std::string sketch = HllPreamble(lg_k, 1);
+        std::string packed(((registers.size() * 3) >> 2) + 1, '\0');
+        for (size_t slot = 0; slot < registers.size(); slot++) {
+            size_t start_bit = slot * 6;
+            uint16_t two_bytes;
+            std::memcpy(&two_bytes, packed.data() + (start_bit >> 3), sizeof(two_bytes));
+            two_bytes |= static_cast<uint16_t>(registers[slot] << (start_bit & 7));
+            std::memcpy(packed.data() + (start_bit >> 3), &two_bytes, sizeof(two_bytes));
+        }
+        return sketch + packed;
+    }
+
+    static std::string Hll4Sketch(int32_t lg_k, const std::vector<uint8_t>& registers) {
+        std::string sketch = HllPreamble(lg_k, 0);
+        std::string nibbles(registers.size() / 2, '\0');
+        std::vector<int32_t> aux_pairs;
+        for (size_t slot = 0; slot < registers.size(); slot++) {
+            uint8_t nibble = registers[slot];
+            if (nibble >= 15) {
+                nibble = 15;
+                aux_pairs.push_back(Coupon(slot, registers[slot]));
+            }
+            nibbles[slot >> 1] |= static_cast<char>((slot & 1) ? (nibble << 4) : nibble);
+        }
+        int32_t aux_count = aux_pairs.size();
+        std::memcpy(sketch.data() + 36, &aux_count, sizeof(aux_count));
+        sketch += nibbles;
+        for (int32_t pair : aux_pairs) {
+            AppendInt(pair, &sketch);
+        }
+        return sketch;
+    }
+
+    static std::string FromBytes(const std::vector<uint8_t>& bytes) {
+        return std::string(bytes.begin(), bytes.end());
+    }
+
+    static std::vector<int32_t> ReadInts(const Bytes& bytes, size_t offset, int32_t count) {
+        std::vector<int32_t> values(count);
+        std::memcpy(values.data(), bytes.data() + offset, count * sizeof(int32_t));
+        return values;
+    }
+
+    static std::vector<uint8_t> ReadHll8Registers(const Bytes& bytes) {
+        EXPECT_EQ(10, bytes.data()[0]);
+        EXPECT_EQ(2 | (2 << 2), bytes.data()[7]);
+        int32_t k = 1 << bytes.data()[3];
+        EXPECT_EQ(40 + k, bytes.size());
+        return std::vector<uint8_t>(bytes.data() + 40, bytes.data() + 40 + k);
+    }
+
+    static void UpdateRegisters(const std::vector<int32_t>& coupons, int32_t lg_k,
+                                std::vector<uint8_t>* registers) {
+        for (int32_t coupon : coupons) {
+            uint8_t& value = (*registers)[coupon & ((1 << lg_k) - 1)];
+            value = std::max(value, static_cast<uint8_t>(static_cast<uint32_t>(coupon) >> 26));
+        }
+    }
+
+ protected:
+    std::shared_ptr<MemoryPool> pool_ = GetDefaultPool();
+};
+
+TEST_F(HllSketchUtilTest, TestUnionEmpty) {
+    std::string empty = ListSketch(12, {});
+    ASSERT_OK_AND_ASSIGN(auto result, HllSketchUtil::Union(empty, empty, pool_.get()));
+    ASSERT_EQ(empty, std::string(result->data(), result->size()));
+}
+
+TEST_F(HllSketchUtilTest, TestUnionList) {
+    std::vector<int32_t> coupons1 = {Coupon(1, 3), Coupon(2, 5), Coupon(3, 1)};
+    std::vector<int32_t> coupons2 = {Coupon(3, 1), Coupon(4, 2), Coupon(1, 4)};
+    ASSERT_OK_AND_ASSIGN(auto result, HllSketchUtil::Union(ListSketch(12, coupons1),
+                                                           ListSketch(10, coupons2), pool_.get()));
+    // coupons are kept in the insertion order, and the lg_k of the first sketch is used
+    std::vector<int32_t> expected = {Coupon(1, 3), Coupon(2, 5), Coupon(3, 1), Coupon(4, 2),
+                                     Coupon(1, 4)};
+    ASSERT_EQ(ListSketch(12, expected), std::string(result->data(), result->size()));
+
+    std::string empty = ListSketch(12, {});
+    ASSERT_OK_AND_ASSIGN(result,
+                         HllSketchUtil::Union(empty, ListSketch(12, coupons1), pool_.get()));
+    ASSERT_EQ(ListSketch(12, coupons1), std::string(result->data(), result->size()));
+}
+
+TEST_F(HllSketchUtilTest, TestUnionPromoteToSet) {
+    std::mt19937 random(42);
+    std::vector<int32_t> coupons = RandomCoupons(100, &random);
+    std::vector<int32_t> coupons1(coupons.begin(), coupons.begin() + 60);
+    std::vector<int32_t> coupons2(coupons.begin() + 40, coupons.end());
+    // a list holds at most 7 coupons, build the inputs by union
+    std::string sketch1 = ListSketch(12, {});
+    for (int32_t coupon : coupons1) {
+        ASSERT_OK_AND_ASSIGN(auto result,
+                             HllSketchUtil::Union(sketch1, ListSketch(12, {coupon}), pool_.get()));
+        sketch1 = std::string(result->data(), result->size());
+    }
+    std::string sketch2 = ListSketch(12, {});
+    for (int32_t coupon : coupons2) {
+        ASSERT_OK_AND_ASSIGN(auto result,
+                             HllSketchUtil::Union(sketch2, ListSketch(12, {coupon}), pool_.get()));
+        sketch2 = std::string(result->data(), result->size());
+    }
+    ASSERT_OK_AND_ASSIGN(auto result, HllSketchUtil::Union(sketch1, sketch2, pool_.get()));
+    ASSERT_EQ(3, result->data()[0]);
+    ASSERT_EQ(12, result->data()[3]);
+    // 100 coupons need a hash set of 2^8 slots
+    ASSERT_EQ(8, result->data()[4]);
+    ASSERT_EQ(1, result->data()[7]);
+    ASSERT_EQ(100, ReadInts(*result, 8, 1)[0]);
+    std::vector<int32_t> result_coupons = ReadInts(*result, 12, 100);
+    ASSERT_EQ(std::set<int32_t>(coupons.begin(), coupons.end()),
+              std::set<int32_t>(result_coupons.begin(), result_coupons.end()));
+}
+
+TEST_F(HllSketchUtilTest, TestUnionPromoteToHll) {
+    std::mt19937 random(42);
+    // with lg_k 8, a set holds at most 24 coupons
+    std::vector<int32_t> coupons = RandomCoupons(25, &random);
+    std::string sketch = ListSketch(8, {});
+    for (int32_t coupon : coupons) {
+        ASSERT_OK_AND_ASSIGN(auto result,
+                             HllSketchUtil::Union(sketch, ListSketch(8, {coupon}), pool_.get()));
+        sketch = std::string(result->data(), result->size());
+    }
+    ASSERT_EQ(2, sketch[7] & 3);
+    ASSERT_OK_AND_ASSIGN(auto result, HllSketchUtil::Union(sketch, sketch, pool_.get()));
+    std::vector<uint8_t> expected(1 << 8, 0);
+    UpdateRegisters(coupons, 8, &expected);
+    ASSERT_EQ(expected, ReadHll8Registers(*result));
+    // registers are not all set, so the min register is zero
+    int32_t num_zeros = std::count(expected.begin(), expected.end(), 0);
+    ASSERT_EQ(0, result->data()[6]);
+    ASSERT_EQ(num_zeros, ReadInts(*result, 32, 1)[0]);
+    double kxq0;
+    double kxq1;
+    std::memcpy(&kxq0, result->data() + 16, sizeof(kxq0));
+    std::memcpy(&kxq1, result->data() + 24, sizeof(kxq1));
+    double expected_kxq0 = 0.0;
+    double expected_kxq1 = 0.0;
+    for (uint8_t value : expected) {
+        double inv_pow2 = 1.0 / static_cast<double>(static_cast<uint64_t>(1) << value);
+        (value < 32 ? expected_kxq0 : expected_kxq1) += inv_pow2;
+    }
+    ASSERT_DOUBLE_EQ(expected_kxq0, kxq0);
+    ASSERT_DOUBLE_EQ(expected_kxq1, kxq1);
+}
+
+TEST_F(HllSketchUtilTest, TestUnionHllOfDifferentTypes) {
+    std::mt19937 random(42);
+    std::vector<uint8_t> registers1(1 << 10);
+    std::vector<uint8_t> registers2(1 << 8);
+    for (auto& value : registers1) {
+        value = random() % 20;
+    }
+    for (auto& value : registers2) {
+        value = random() % 20;
+    }
+    // the registers of lg_k 10 are down sampled to lg_k 8
+    std::vector<uint8_t> expected = registers2;
+    for (size_t slot = 0; slot < registers1.size(); slot++) {
+        expected[slot & 0xFF] = std::max(expected[slot & 0xFF], registers1[slot]);
+    }
+    for (const auto& sketch2 : {Hll4Sketch(8, registers2), Hll6Sketch(8, registers2),
+                                Hll8Sketch(8, registers2)}) {
+        ASSERT_OK_AND_ASSIGN(auto result, HllSketchUtil::Union(Hll8Sketch(10, registers1),
+                                                               sketch2, pool_.get()));
+        ASSERT_EQ(8, result->data()[3]);
+        ASSERT_EQ(expected, ReadHll8Registers(*result));
+    }
+}
+
+TEST_F(HllSketchUtilTest, TestUnionHllWithoutZeroRegister) {
+    std::mt19937 random(42);
+    std::vector<uint8_t> registers(1 << 8);
+    for (auto& value : registers) {
+        value = random() % 20 + 3;
+    }
+    ASSERT_OK_AND_ASSIGN(auto result, HllSketchUtil::Union(Hll8Sketch(8, registers),
+                                                           Hll6Sketch(8, registers), pool_.get()));
+    ASSERT_EQ(registers, ReadHll8Registers(*result));
+    // HLL_8 keeps cur_min as zero even if no register is zero, like DataSketches
+    ASSERT_EQ(0, result->data()[6]);
+    ASSERT_EQ(0, ReadInts(*result, 32, 1)[0]);
+}
+
+TEST_F(HllSketchUtilTest, TestUnionHllAndList) {
+    std::mt19937 random(42);
+    std::vector<uint8_t> registers(1 << 10);
+    for (auto& value : registers) {
+        value = random() % 10;
+    }
+    std::vector<int32_t> coupons = RandomCoupons(5, &random);
+    std::vector<uint8_t> expected = registers;
+    UpdateRegisters(coupons, 10, &expected);
+    ASSERT_OK_AND_ASSIGN(auto result, HllSketchUtil::Union(ListSketch(12, coupons),
+                                                           Hll8Sketch(10, registers), pool_.get()));
+    ASSERT_EQ(expected, ReadHll8Registers(*result));
+    ASSERT_OK_AND_ASSIGN(result, HllSketchUtil::Union(Hll4Sketch(10, registers),
+                                                      ListSketch(12, coupons), pool_.get()));
+    ASSERT_EQ(expected, ReadHll8Registers(*result));
+}
+
+TEST_F(HllSketchUtilTest, TestUnionDataSketchesSerialized) {
+    // compact serialized HllSketch of DataSketches with the default lg_k 12 and HLL_4, updated with
+    // the longs 1 to 5, 4 to 10 and 1 to 10, whose coupons are hashed by MurmurHash3 with seed 9001
+    std::string sketch1 = FromBytes({
+        0x02, 0x01, 0x07, 0x0C, 0x03, 0x08, 0x05, 0x00, 0x2B, 0xF2, 0xFB, 0x06, 0x86, 0x2F, 0xF9,
+        0x0D, 0x75, 0x81, 0x66, 0x07, 0x81, 0xBC, 0x5D, 0x06, 0x7B, 0x65, 0xE6, 0x08});
+    std::string sketch2 = FromBytes({
+        0x02, 0x01, 0x07, 0x0C, 0x03, 0x08, 0x07, 0x00, 0x81, 0xBC, 0x5D, 0x06, 0x7B, 0x65, 0xE6,
+        0x08, 0xFC, 0x2D, 0x42, 0x0A, 0xC1, 0xE9, 0x17, 0x05, 0xD2, 0x16, 0x73, 0x07, 0x34, 0xA2,
+        0x61, 0x0E, 0xB0, 0x5B, 0x46, 0x12});
+    std::string expected = FromBytes({
+        0x03, 0x01, 0x07, 0x0C, 0x05, 0x18, 0x00, 0x01, 0x0A, 0x00, 0x00, 0x00, 0x81, 0xBC, 0x5D,
+        0x06, 0x86, 0x2F, 0xF9, 0x0D, 0x2B, 0xF2, 0xFB, 0x06, 0xB0, 0x5B, 0x46, 0x12, 0xC1, 0xE9,
+        0x17, 0x05, 0xD2, 0x16, 0x73, 0x07, 0x34, 0xA2, 0x61, 0x0E, 0x75, 0x81, 0x66, 0x07, 0x7B,
+        0x65, 0xE6, 0x08, 0xFC, 0x2D, 0x42, 0x0A});
+    ASSERT_OK_AND_ASSIGN(auto result, HllSketchUtil::Union(sketch1, sketch2, pool_.get()));
+    ASSERT_EQ(expected, std::string(result->data(), result->size()));
+    // the union is in SET mode, whose estimate is based on the 10 distinct coupons
+    ASSERT_EQ(10, ReadInts(*result, 8, 1)[0]);
+}
+
+TEST_F(HllSketchUtilTest, TestInvalidSketch) {
+    std::string sketch = ListSketch(12, {Coupon(1, 1)});
+    ASSERT_NOK_WITH_MSG(HllSketchUtil::Union(sketch, "abc", pool_.get()), "invalid hll sketch");
+    std::string wrong_family = sketch;
+    wrong_family[2] = 3;
+    ASSERT_NOK_WITH_MSG(HllSketchUtil::Union(sketch, wrong_family, pool_.get()),
+                        "invalid hll sketch, serial version 1, family 3");
+    std::string truncated = Hll8Sketch(10, std::vector<uint8_t>(1 << 10, 1));
+    truncated.resize(100);
+    ASSERT_NOK_WITH_MSG(HllSketchUtil::Union(sketch, truncated, pool_.get()),
+                        "invalid hll sketch, size 100 is less than 1064");
+}
+
+}  // namespace paimon::test
@@ -16,6 +16,7 @@
 
 #include "paimon/utils/roaring_bitmap64.h"
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
 #include <utility>
@@ -184,6 +185,20 @@ bool RoaringBitmap64::ContainsAny(int64_t min, int64_t max) const {
     return false;
 }
 
+int64_t RoaringBitmap64::RangeCardinality(int64_t min, int64_t max) const {
+    min = std::max<int64_t>(min, 0);
+    if (max <= min) {
+        return 0;
+    }
+    const auto& bitmap = GetRoaringBitmap(roaring_bitmap_);
+    // rank(x) is the number of values less than or equal to x
+    uint64_t count = bitmap.rank(static_cast<uint64_t>(max - 1));
+    if (min > 0) {
+        count -= bitmap.rank(static_cast<uint64_t>(min - 1));
+    }
+    return static_cast<int64_t>(count);
+}
+
 bool RoaringBitmap64::CheckedAdd(int64_t x) {
     if (Contains(x)) {
         return false;
@@ -389,6 +389,20 @@ TEST(RoaringBitmap64Test, TestContainsAny) {
     ASSERT_FALSE(roaring.ContainsAny(10000000000500l, 10000000000520l));
 }
 
+TEST(RoaringBitmap64Test, TestRangeCardinality) {
+    RoaringBitmap64 roaring =
+        RoaringBitmap64::From({0l, 5l, 10000000000010l, 10000000000011l, 10000000000100l});
+    ASSERT_EQ(5, roaring.RangeCardinality(0, RoaringBitmap64::MAX_VALUE));
+    ASSERT_EQ(2, roaring.RangeCardinality(0, 10000000000010l));
+    ASSERT_EQ(1, roaring.RangeCardinality(1, 10000000000010l));
+    ASSERT_EQ(2, roaring.RangeCardinality(10000000000010l, 10000000000100l));
+    ASSERT_EQ(3, roaring.RangeCardinality(10000000000010l, 10000000000101l));
+    ASSERT_EQ(0, roaring.RangeCardinality(10000000000020l, 10000000000100l));
+    ASSERT_EQ(0, roaring.RangeCardinality(10, 10));
+    ASSERT_EQ(0, roaring.RangeCardinality(10, 5));
+    ASSERT_EQ(2, roaring.RangeCardinality(-10, 10));
+}
+
 TEST(RoaringBitmap64Test, TestFromRoaringBitmap32) {
     {
         RoaringBitmap32 roaring32 = RoaringBitmap32::From({10, 20, 21});
@@ -0,0 +1,139 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/utils/split_block_bloom_filter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+#include "fmt/format.h"
+#include "paimon/status.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define PAIMON_BLOOM_FILTER_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace paimon {
+namespace {
+constexpr int32_t WORDS_PER_BLOCK = 8;
+constexpr int32_t PREFETCH_DISTANCE = 8;
+// odd constants to map the key to the bit of each word, the same as parquet
+alignas(32) constexpr uint32_t SALT[WORDS_PER_BLOCK] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU,
+                                                        0xa2b7289dU, 0x705495c7U, 0x2df1424bU,
+                                                        0x9efc4947U, 0x5c6bfb31U};
+
+#ifdef PAIMON_BLOOM_FILTER_DISPATCH
+__attribute__((target("avx2"))) bool TestBlockAvx2(const char* block, uint32_t key) {
+    __m256i salt = _mm256_load_si256(reinterpret_cast<const __m256i*>(SALT));
+    __m256i shift = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32(key), salt), 27);
+    __m256i mask = _mm256_sllv_epi32(_mm256_set1_epi32(1), shift);
+    __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+    // all bits of mask are set in words
+    return _mm256_testc_si256(words, mask) != 0;
+}
+#endif
+}  // namespace
+
+SplitBlockBloomFilter::SplitBlockBloomFilter(int32_t num_bytes, MemoryPool* pool) {
+    num_bytes = std::clamp(num_bytes, BYTES_PER_BLOCK, MAX_NUM_BYTES);
+    num_blocks_ = (num_bytes + BYTES_PER_BLOCK - 1) / BYTES_PER_BLOCK;
+    bytes_ = std::make_shared<Bytes>(num_blocks_ * BYTES_PER_BLOCK, pool);
+    std::memset(bytes_->data(), 0, bytes_->size());
+}
+
+SplitBlockBloomFilter::SplitBlockBloomFilter(const std::shared_ptr<Bytes>& bytes,
+                                             int32_t num_blocks)
+    : num_blocks_(num_blocks), bytes_(bytes) {}
+
+Result<SplitBlockBloomFilter> SplitBlockBloomFilter::Create(const char* data, int32_t num_bytes,
+                                                            MemoryPool* pool) {
+    if (num_bytes <= 0 || num_bytes % BYTES_PER_BLOCK != 0 || num_bytes > MAX_NUM_BYTES) {
+        return Status::Invalid(
+            fmt::format("invalid split block bloom filter, num bytes {}", num_bytes));
+    }
+    auto bytes = std::make_shared<Bytes>(num_bytes, pool);
+    std::memcpy(bytes->data(), data, num_bytes);
+    return SplitBlockBloomFilter(bytes, num_bytes / BYTES_PER_BLOCK);
+}
+
+int32_t SplitBlockBloomFilter::OptimalNumBytes(int64_t items, double fpp) {
+    items = std::max<int64_t>(items, 1);
+    // the false positive rate of a single word with one bit set for each item
+    double num_bits = -8.0 * items / std::log(1 - std::pow(fpp, 1.0 / WORDS_PER_BLOCK));
+    if (!(num_bits < static_cast<double>(MAX_NUM_BYTES) * 8)) {
+        return MAX_NUM_BYTES;
+    }
+    int64_t num_bytes = static_cast<int64_t>(std::ceil(num_bits / 8));
+    num_bytes = (num_bytes + BYTES_PER_BLOCK - 1) / BYTES_PER_BLOCK * BYTES_PER_BLOCK;
+    return static_cast<int32_t>(std::clamp<int64_t>(num_bytes, BYTES_PER_BLOCK, MAX_NUM_BYTES));
+}
+
+void SplitBlockBloomFilter::AddHash(int64_t hash64) {
+    auto key = static_cast<uint32_t>(hash64);
+    char* block = const_cast<char*>(Block(hash64));
+    uint32_t words[WORDS_PER_BLOCK];
+    std::memcpy(words, block, sizeof(words));
+    for (int32_t i = 0; i < WORDS_PER_BLOCK; i++) {
+        words[i] |= 1U << ((key * SALT[i]) >> 27);
+    }
+    std::memcpy(block, words, sizeof(words));
+}
+
+bool SplitBlockBloomFilter::TestBlockScalar(const char* block, uint32_t key) {
+    uint32_t words[WORDS_PER_BLOCK];
+    std::memcpy(words, block, sizeof(words));
+    uint32_t missing = 0;
+    // branch free, so that it can be vectorized by the compiler
+    for (int32_t i = 0; i < WORDS_PER_BLOCK; i++) {
+        missing |= ~words[i] & (1U << ((key * SALT[i]) >> 27));
+    }
+    return missing == 0;
+}
+
+SplitBlockBloomFilter::TestBlockFunction SplitBlockBloomFilter::GetTestBlockFunction() {
+    static const TestBlockFunction test_block = []() -> TestBlockFunction {
+#ifdef PAIMON_BLOOM_FILTER_DISPATCH
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return TestBlockAvx2;
+        }
+#endif
+        return TestBlockScalar;
+    }();
+    return test_block;
+}
+
+bool SplitBlockBloomFilter::TestHash(int64_t hash64) const {
+    return GetTestBlockFunction()(Block(hash64), static_cast<uint32_t>(hash64));
+}
+
+void SplitBlockBloomFilter::TestHashes(const int64_t* hashes, int64_t count, bool* results) const {
+    TestBlockFunction test_block = GetTestBlockFunction();
+    for (int64_t i = 0; i < count; i++) {
+#if defined(__GNUC__)
+        // overlap the cache misses of the following blocks
+        if (i + PREFETCH_DISTANCE < count) {
+            __builtin_prefetch(Block(hashes[i + PREFETCH_DISTANCE]));
+        }
+#endif
+        results[i] = test_block(Block(hashes[i]), static_cast<uint32_t>(hashes[i]));
+    }
+}
+
+}  // namespace paimon
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "paimon/memory/bytes.h"
+#include "paimon/result.h"
+#include "paimon/visibility.h"
+
+namespace paimon {
+class MemoryPool;
+
+/// Split block bloom filter handle 64 bits hash.
+///
+/// Unlike `BloomFilter64` which probes bits over the whole bit set, all bits of a hash are set in
+/// a single 256-bit block: the upper 32 bits of the hash select the block and the lower 32 bits
+/// set one bit in each of the eight 32-bit words of the block. So a membership test touches only
+/// one cache line and the eight words are tested together with SIMD. The algorithm is the same as
+/// the split block bloom filter of Parquet.
+class PAIMON_EXPORT SplitBlockBloomFilter {
+ public:
+    static constexpr int32_t BYTES_PER_BLOCK = 32;
+    static constexpr int32_t MAX_NUM_BYTES = 128 * 1024 * 1024;
+
+    /// Create an empty filter with `num_bytes` rounded up to whole blocks.
+    SplitBlockBloomFilter(int32_t num_bytes, MemoryPool* pool);
+
+    /// Create a filter from serialized blocks, the blocks are copied.
+    static Result<SplitBlockBloomFilter> Create(const char* data, int32_t num_bytes,
+                                                MemoryPool* pool);
+
+    /// @return The number of bytes for `items` distinct hashes with false positive rate `fpp`.
+    static int32_t OptimalNumBytes(int64_t items, double fpp);
+
+    void AddHash(int64_t hash64);
+
+    bool TestHash(int64_t hash64) const;
+
+    /// Test `count` hashes, `results[i]` is set to whether `hashes[i]` may be in the filter.
+    void TestHashes(const int64_t* hashes, int64_t count, bool* results) const;
+
+    int32_t NumBytes() const {
+        return num_blocks_ * BYTES_PER_BLOCK;
+    }
+
+    const std::shared_ptr<Bytes>& GetBytes() const {
+        return bytes_;
+    }
+
+ private:
+    SplitBlockBloomFilter(const std::shared_ptr<Bytes>& bytes, int32_t num_blocks);
+
+    const char* Block(int64_t hash64) const {
+        uint64_t block_index =
+            ((static_cast<uint64_t>(hash64) >> 32) * static_cast<uint64_t>(num_blocks_)) >> 32;
+        return bytes_->data() + block_index * BYTES_PER_BLOCK;
+    }
+
+    /// Test whether all bits of the key are set in the block.
+    using TestBlockFunction = bool (*)(const char* block, uint32_t key);
+
+    static bool TestBlockScalar(const char* block, uint32_t key);
+
+    /// @return The AVX2 kernel if the cpu supports it at runtime, otherwise the scalar one.
+    static TestBlockFunction GetTestBlockFunction();
+
+ private:
+    int32_t num_blocks_;
+    std::shared_ptr<Bytes> bytes_;
+};
+}  // namespace paimon
@@ -0,0 +1,134 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/utils/split_block_bloom_filter.h"
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "paimon/memory/bytes.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+TEST(SplitBlockBloomFilterTest, TestSimple) {
+    int32_t items = 10000;
+    auto pool = GetDefaultPool();
+    SplitBlockBloomFilter bloom_filter(SplitBlockBloomFilter::OptimalNumBytes(items, 0.01),
+                                       pool.get());
+    std::mt19937_64 engine(std::random_device{}());  // NOLINT(whitespace/braces)
+    std::uniform_int_distribution<int64_t> distribution(std::numeric_limits<int64_t>::min(),
+                                                        std::numeric_limits<int64_t>::max());
+    std::set<int64_t> test_data;
+    for (int32_t i = 0; i < items; i++) {
+        int64_t random = distribution(engine);
+        test_data.insert(random);
+        bloom_filter.AddHash(random);
+    }
+    for (const auto& value : test_data) {
+        ASSERT_TRUE(bloom_filter.TestHash(value));
+    }
+
+    // test false positive
+    int32_t false_positives = 0;
+    int32_t num = 1000000;
+    std::vector<int64_t> hashes(num);
+    for (auto& hash : hashes) {
+        hash = distribution(engine);
+    }
+    std::unique_ptr<bool[]> results(new bool[num]);
+    bloom_filter.TestHashes(hashes.data(), num, results.get());
+    for (int32_t i = 0; i < num; i++) {
+        ASSERT_EQ(bloom_filter.TestHash(hashes[i]), results[i]);
+        if (results[i] && test_data.find(hashes[i]) == test_data.end()) {
+            false_positives++;
+        }
+    }
+    ASSERT_LT(static_cast<double>(false_positives) / num, 0.015);
+}
+
+TEST(SplitBlockBloomFilterTest, TestSerialize) {
+    auto pool = GetDefaultPool();
+    SplitBlockBloomFilter bloom_filter(/*num_bytes=*/100, pool.get());
+    ASSERT_EQ(128, bloom_filter.NumBytes());
+    std::vector<int64_t> hashes = {-10, -5, 0, 13, 100, 200, 500};
+    for (int64_t hash : hashes) {
+        bloom_filter.AddHash(hash);
+    }
+    const auto& bytes = bloom_filter.GetBytes();
+    ASSERT_OK_AND_ASSIGN(SplitBlockBloomFilter deserialized,
+                         SplitBlockBloomFilter::Create(bytes->data(), bytes->size(), pool.get()));
+    ASSERT_EQ(*bytes, *deserialized.GetBytes());
+    for (int64_t hash : hashes) {
+        ASSERT_TRUE(deserialized.TestHash(hash));
+    }
+    ASSERT_NOK_WITH_MSG(SplitBlockBloomFilter::Create(bytes->data(), 33, pool.get()),
+                        "invalid split block bloom filter, num bytes 33");
+}
+
+TEST(SplitBlockBloomFilterTest, TestOptimalNumBytes) {
+    ASSERT_EQ(SplitBlockBloomFilter::BYTES_PER_BLOCK,
+              SplitBlockBloomFilter::OptimalNumBytes(0, 0.01));
+    int32_t num_bytes = SplitBlockBloomFilter::OptimalNumBytes(1000000, 0.01);
+    ASSERT_EQ(0, num_bytes % SplitBlockBloomFilter::BYTES_PER_BLOCK);
+    // about 9.7 bits per item for fpp 0.01
+    ASSERT_GT(num_bytes, 1000000 * 9 / 8);
+    ASSERT_LT(num_bytes, 1000000 * 11 / 8);
+    ASSERT_EQ(SplitBlockBloomFilter::MAX_NUM_BYTES,
+              SplitBlockBloomFilter::OptimalNumBytes(std::numeric_limits<int64_t>::max(), 0.01));
+}
+
+TEST(SplitBlockBloomFilterTest, TestSimdKernelMatchesScalar) {
+    auto pool = GetDefaultPool();
+    auto test_block = SplitBlockBloomFilter::GetTestBlockFunction();
+    std::mt19937 engine(42);
+    for (int32_t round = 0; round < 1000; round++) {
+        uint32_t key = engine();
+        // the single block of the filter is exactly the mask of the key
+        SplitBlockBloomFilter bloom_filter(SplitBlockBloomFilter::BYTES_PER_BLOCK, pool.get());
+        bloom_filter.AddHash(key);
+        std::vector<uint32_t> mask(8);
+        std::memcpy(mask.data(), bloom_filter.GetBytes()->data(), sizeof(uint32_t) * 8);
+        const char* block = reinterpret_cast<const char*>(mask.data());
+        ASSERT_TRUE(SplitBlockBloomFilter::TestBlockScalar(block, key));
+        ASSERT_TRUE(test_block(block, key));
+        // missing any bit of the mask fails both kernels
+        for (auto& word : mask) {
+            ASSERT_EQ(1, __builtin_popcount(word));
+            uint32_t bit = word;
+            word = 0;
+            ASSERT_FALSE(SplitBlockBloomFilter::TestBlockScalar(block, key));
+            ASSERT_FALSE(test_block(block, key));
+            word = bit;
+        }
+        // random dense blocks
+        std::vector<uint32_t> words(8);
+        for (auto& word : words) {
+            word = engine() | engine() | engine();
+        }
+        block = reinterpret_cast<const char*>(words.data());
+        ASSERT_EQ(SplitBlockBloomFilter::TestBlockScalar(block, key), test_block(block, key))
+            << key;
+    }
+}
+
+}  // namespace paimon::test
@@ -0,0 +1,217 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/utils/theta_sketch_util.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "fmt/format.h"
+#include "paimon/status.h"
+
+namespace paimon {
+namespace {
+// Layout of the preamble, see PreambleUtil of DataSketches.
+constexpr size_t PREAMBLE_LONGS_BYTE = 0;
+constexpr size_t SER_VER_BYTE = 1;
+constexpr size_t FAMILY_BYTE = 2;
+constexpr size_t FLAGS_BYTE = 5;
+constexpr size_t SEED_HASH_SHORT = 6;
+constexpr size_t RETAINED_ENTRIES_INT = 8;
+constexpr size_t P_FLOAT = 12;
+constexpr size_t THETA_LONG = 16;
+
+constexpr uint8_t SER_VER = 3;
+constexpr uint8_t COMPACT_FAMILY_ID = 3;
+
+constexpr uint8_t READ_ONLY_FLAG_MASK = 2;
+constexpr uint8_t EMPTY_FLAG_MASK = 4;
+constexpr uint8_t COMPACT_FLAG_MASK = 8;
+constexpr uint8_t ORDERED_FLAG_MASK = 16;
+constexpr uint8_t SINGLE_ITEM_FLAG_MASK = 32;
+
+constexpr int64_t MAX_THETA = std::numeric_limits<int64_t>::max();
+
+/// A view of the hashes of a serialized compact sketch, the hashes are copied and sorted only if
+/// the sketch is not ordered.
+struct CompactSketchView {
+    bool empty = true;
+    int64_t theta = MAX_THETA;
+    int32_t count = 0;
+    const char* hashes = nullptr;
+    std::vector<int64_t> sorted_hashes;
+
+    int64_t HashAt(int32_t index) const {
+        if (!sorted_hashes.empty()) {
+            return sorted_hashes[index];
+        }
+        int64_t hash;
+        std::memcpy(&hash, hashes + index * sizeof(int64_t), sizeof(int64_t));
+        return hash;
+    }
+};
+
+template <typename T>
+T ReadValue(std::string_view sketch, size_t offset) {
+    T value;
+    std::memcpy(&value, sketch.data() + offset, sizeof(T));
+    return value;
+}
+
+template <typename T>
+void WriteValue(char* data, size_t offset, T value) {
+    std::memcpy(data + offset, &value, sizeof(T));
+}
+
+Result<CompactSketchView> ReadSketch(std::string_view sketch) {
+    if (sketch.size() < 8) {
+        return Status::Invalid(fmt::format("invalid theta sketch, size {}", sketch.size()));
+    }
+    auto ser_ver = static_cast<uint8_t>(sketch[SER_VER_BYTE]);
+    auto family = static_cast<uint8_t>(sketch[FAMILY_BYTE]);
+    if (ser_ver != SER_VER || family != COMPACT_FAMILY_ID) {
+        return Status::Invalid(fmt::format(
+            "only serial version 3 compact theta sketch is supported, serial version {}, "
+            "family {}",
+            ser_ver, family));
+    }
+    auto flags = static_cast<uint8_t>(sketch[FLAGS_BYTE]);
+    CompactSketchView view;
+    if (flags & EMPTY_FLAG_MASK) {
+        return view;
+    }
+    view.empty = false;
+    auto seed_hash = ReadValue<uint16_t>(sketch, SEED_HASH_SHORT);
+    if (seed_hash != ThetaSketchUtil::DEFAULT_SEED_HASH) {
+        return Status::Invalid(
+            fmt::format("incompatible seed hash {} of theta sketch, expected {}", seed_hash,
+                        ThetaSketchUtil::DEFAULT_SEED_HASH));
+    }
+    auto pre_longs = static_cast<uint8_t>(sketch[PREAMBLE_LONGS_BYTE]) & 0x3F;
+    size_t hashes_offset = pre_longs * sizeof(int64_t);
+    if (pre_longs == 1) {
+        view.count = 1;
+    } else if (pre_longs == 2 || pre_longs == 3) {
+        if (sketch.size() < hashes_offset) {
+            return Status::Invalid(fmt::format("invalid theta sketch, size {}", sketch.size()));
+        }
+        view.count = ReadValue<int32_t>(sketch, RETAINED_ENTRIES_INT);
+        if (pre_longs == 3) {
+            view.theta = ReadValue<int64_t>(sketch, THETA_LONG);
+        }
+    } else {
+        return Status::Invalid(fmt::format("invalid theta sketch, preamble longs {}", pre_longs));
+    }
+    if (view.count < 0 ||
+        sketch.size() < hashes_offset + static_cast<size_t>(view.count) * sizeof(int64_t)) {
+        return Status::Invalid(fmt::format("invalid theta sketch, size {}, retained entries {}",
+                                           sketch.size(), view.count));
+    }
+    view.hashes = sketch.data() + hashes_offset;
+    if (!(flags & ORDERED_FLAG_MASK) && view.count > 1) {
+        view.sorted_hashes.resize(view.count);
+        std::memcpy(view.sorted_hashes.data(), view.hashes, view.count * sizeof(int64_t));
+        std::sort(view.sorted_hashes.begin(), view.sorted_hashes.end());
+    }
+    return view;
+}
+
+PAIMON_UNIQUE_PTR<Bytes> WriteSketch(bool empty, int64_t theta, const std::vector<int64_t>& hashes,
+                                     MemoryPool* pool) {
+    auto count = static_cast<int32_t>(hashes.size());
+    if (empty || (count == 0 && theta == MAX_THETA)) {
+        // same as the empty compact sketch of DataSketches
+        auto bytes = Bytes::AllocateBytes(8, pool);
+        std::memset(bytes->data(), 0, bytes->size());
+        bytes->data()[PREAMBLE_LONGS_BYTE] = 1;
+        bytes->data()[SER_VER_BYTE] = static_cast<char>(SER_VER);
+        bytes->data()[FAMILY_BYTE] = static_cast<char>(COMPACT_FAMILY_ID);
+        bytes->data()[FLAGS_BYTE] = static_cast<char>(READ_ONLY_FLAG_MASK | EMPTY_FLAG_MASK |
+                                                      COMPACT_FLAG_MASK | ORDERED_FLAG_MASK);
+        return bytes;
+    }
+    uint8_t flags = READ_ONLY_FLAG_MASK | COMPACT_FLAG_MASK | ORDERED_FLAG_MASK;
+    int32_t pre_longs = 3;
+    if (theta == MAX_THETA) {
+        pre_longs = count > 1 ? 2 : 1;
+    }
+    if (pre_longs == 1) {
+        flags |= SINGLE_ITEM_FLAG_MASK;
+    }
+    size_t hashes_offset = pre_longs * sizeof(int64_t);
+    auto bytes = Bytes::AllocateBytes(hashes_offset + count * sizeof(int64_t), pool);
+    std::memset(bytes->data(), 0, hashes_offset);
+    bytes->data()[PREAMBLE_LONGS_BYTE] = static_cast<char>(pre_longs);
+    bytes->data()[SER_VER_BYTE] = static_cast<char>(SER_VER);
+    bytes->data()[FAMILY_BYTE] = static_cast<char>(COMPACT_FAMILY_ID);
+    bytes->data()[FLAGS_BYTE] = static_cast<char>(flags);
+    WriteValue<uint16_t>(bytes->data(), SEED_HASH_SHORT, ThetaSketchUtil::DEFAULT_SEED_HASH);
+    if (pre_longs > 1) {
+        WriteValue<int32_t>(bytes->data(), RETAINED_ENTRIES_INT, count);
+        WriteValue<float>(bytes->data(), P_FLOAT, 1.0f);
+    }
+    if (pre_longs > 2) {
+        WriteValue<int64_t>(bytes->data(), THETA_LONG, theta);
+    }
+    if (count > 0) {
+        std::memcpy(bytes->data() + hashes_offset, hashes.data(), count * sizeof(int64_t));
+    }
+    return bytes;
+}
+}  // namespace
+
+Result<PAIMON_UNIQUE_PTR<Bytes>> ThetaSketchUtil::Union(std::string_view sketch1,
+                                                        std::string_view sketch2,
+                                                        MemoryPool* pool) {
+    PAIMON_ASSIGN_OR_RAISE(CompactSketchView view1, ReadSketch(sketch1));
+    PAIMON_ASSIGN_OR_RAISE(CompactSketchView view2, ReadSketch(sketch2));
+    int64_t theta = std::min(view1.theta, view2.theta);
+    // merge the sorted hashes less than theta, until the nominal entries are exceeded
+    std::vector<int64_t> hashes;
+    hashes.reserve(std::min(view1.count + view2.count, DEFAULT_NOMINAL_ENTRIES + 1));
+    int32_t i = 0;
+    int32_t j = 0;
+    while (hashes.size() <= static_cast<size_t>(DEFAULT_NOMINAL_ENTRIES)) {
+        int64_t hash1 = i < view1.count ? view1.HashAt(i) : MAX_THETA;
+        int64_t hash2 = j < view2.count ? view2.HashAt(j) : MAX_THETA;
+        int64_t hash = std::min(hash1, hash2);
+        if (hash >= theta) {
+            break;
+        }
+        hashes.push_back(hash);
+        i += (hash1 == hash);
+        j += (hash2 == hash);
+    }
+    if (hashes.size() > static_cast<size_t>(DEFAULT_NOMINAL_ENTRIES)) {
+        // same as DataSketches, theta is lowered to the (k + 1)-th smallest hash
+        theta = hashes.back();
+        hashes.pop_back();
+    }
+    return WriteSketch(view1.empty && view2.empty, theta, hashes, pool);
+}
+
+Result<double> ThetaSketchUtil::GetEstimate(std::string_view sketch) {
+    PAIMON_ASSIGN_OR_RAISE(CompactSketchView view, ReadSketch(sketch));
+    if (view.theta == MAX_THETA) {
+        return static_cast<double>(view.count);
+    }
+    return view.count / (static_cast<double>(view.theta) / static_cast<double>(MAX_THETA));
+}
+
+}  // namespace paimon
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+#include "paimon/memory/bytes.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/result.h"
+#include "paimon/visibility.h"
+
+namespace paimon {
+
+/// Utils of the serialized compact theta sketches of Apache DataSketches, compatible with
+/// `ThetaSketch` of Java Paimon.
+///
+/// As the hashes of an ordered compact sketch are sorted, two sketches are unioned by merging the
+/// serialized hash arrays directly.
+class PAIMON_EXPORT ThetaSketchUtil {
+ public:
+    ThetaSketchUtil() = delete;
+    ~ThetaSketchUtil() = delete;
+
+    /// Unions two serialized compact sketches, the result is an ordered compact sketch which is
+    /// the same as the result of a DataSketches union with the default nominal entries.
+    static Result<PAIMON_UNIQUE_PTR<Bytes>> Union(std::string_view sketch1,
+                                                  std::string_view sketch2, MemoryPool* pool);
+
+    /// @return The estimated number of distinct values of a serialized compact sketch.
+    static Result<double> GetEstimate(std::string_view sketch);
+
+ public:
+    static constexpr int32_t DEFAULT_NOMINAL_ENTRIES = 4096;
+    /// The seed hash of the default update seed 9001.
+    static constexpr uint16_t DEFAULT_SEED_HASH = 0x93CC;
+};
+
+}  // namespace paimon
@@ -0,0 +1,205 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/common/utils/theta_sketch_util.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+class ThetaSketchUtilTest : public ::testing::Test {
+ public:
+    static constexpr int64_t MAX_THETA = std::numeric_limits<int64_t>::max();
+
+    template <typename T>
+    static void Append(T value, std::string* sketch) {
+        sketch->append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    /// Serializes a compact sketch in the same way as DataSketches.
+    static std::string CompactSketch(int64_t theta, std::vector<int64_t> hashes,
+                                     bool ordered = true) {
+        if (hashes.empty() && theta == MAX_THETA) {
+            return std::string("\x01\x03\x03\x00\x00\x1e\x00\x00", 8);
+        }
+        if (ordered) {
+            std::sort(hashes.begin(), hashes.end());
+        }
+        int32_t pre_longs = theta < MAX_THETA ? 3 : (hashes.size() > 1 ? 2 : 1);
+        uint8_t flags = 2 | 8 | (ordered ? 16 : 0) | (pre_longs == 1 ? 32 : 0);
+        std::string sketch;
+        Append<uint8_t>(pre_longs, &sketch);
+        Append<uint8_t>(3, &sketch);
+        Append<uint8_t>(3, &sketch);
+        Append<uint16_t>(0, &sketch);
+        Append<uint8_t>(flags, &sketch);
+        Append<uint16_t>(ThetaSketchUtil::DEFAULT_SEED_HASH, &sketch);
+        if (pre_longs > 1) {
+            Append<int32_t>(hashes.size(), &sketch);
+            Append<float>(1.0f, &sketch);
+        }
+        if (pre_longs > 2) {
+            Append<int64_t>(theta, &sketch);
+        }
+        for (int64_t hash : hashes) {
+            Append<int64_t>(hash, &sketch);
+        }
+        return sketch;
+    }
+
+    static std::string FromBytes(const std::vector<uint8_t>& bytes) {
+        return std::string(bytes.begin(), bytes.end());
+    }
+
+    static std::vector<int64_t> RandomHashes(int32_t count, std::mt19937_64* random) {
+        std::vector<int64_t> hashes(count);
+        for (auto& hash : hashes) {
+            hash = static_cast<int64_t>((*random)() >> 1);
+        }
+        return hashes;
+    }
+
+ protected:
+    std::shared_ptr<MemoryPool> pool_ = GetDefaultPool();
+};
+
+TEST_F(ThetaSketchUtilTest, TestUnionExact) {
+    std::string empty = CompactSketch(MAX_THETA, {});
+    ASSERT_OK_AND_ASSIGN(auto result, ThetaSketchUtil::Union(empty, empty, pool_.get()));
+    ASSERT_EQ(empty, std::string(result->data(), result->size()));
+
+    std::string single = CompactSketch(MAX_THETA, {100});
+    ASSERT_OK_AND_ASSIGN(result, ThetaSketchUtil::Union(empty, single, pool_.get()));
+    ASSERT_EQ(single, std::string(result->data(), result->size()));
+    ASSERT_OK_AND_ASSIGN(result, ThetaSketchUtil::Union(single, single, pool_.get()));
+    ASSERT_EQ(single, std::string(result->data(), result->size()));
+
+    std::string sketch1 = CompactSketch(MAX_THETA, {5, 1, 3});
+    std::string sketch2 = CompactSketch(MAX_THETA, {4, 3, 2}, /*ordered=*/false);
+    ASSERT_OK_AND_ASSIGN(result, ThetaSketchUtil::Union(sketch1, sketch2, pool_.get()));
+    ASSERT_EQ(CompactSketch(MAX_THETA, {1, 2, 3, 4, 5}),
+              std::string(result->data(), result->size()));
+    ASSERT_OK_AND_ASSIGN(double estimate,
+                         ThetaSketchUtil::GetEstimate(std::string_view(result->data(),
+                                                                       result->size())));
+    ASSERT_EQ(5.0, estimate);
+}
+
+TEST_F(ThetaSketchUtilTest, TestUnionEstimation) {
+    std::mt19937_64 random(42);
+    std::vector<int64_t> hashes1 = RandomHashes(5000, &random);
+    std::vector<int64_t> hashes2 = RandomHashes(5000, &random);
+    hashes2.insert(hashes2.end(), hashes1.begin(), hashes1.begin() + 1000);
+    // sketch1 is in estimation mode with theta of its 4097-th smallest hash
+    std::sort(hashes1.begin(), hashes1.end());
+    int64_t theta1 = hashes1[ThetaSketchUtil::DEFAULT_NOMINAL_ENTRIES];
+    hashes1.resize(ThetaSketchUtil::DEFAULT_NOMINAL_ENTRIES);
+    std::string sketch1 = CompactSketch(theta1, hashes1);
+    std::string sketch2 = CompactSketch(MAX_THETA, hashes2);
+
+    std::set<int64_t> all_hashes;
+    for (int64_t hash : hashes1) {
+        all_hashes.insert(hash);
+    }
+    for (int64_t hash : hashes2) {
+        if (hash < theta1) {
+            all_hashes.insert(hash);
+        }
+    }
+    std::vector<int64_t> expected(all_hashes.begin(), all_hashes.end());
+    int64_t expected_theta = expected[ThetaSketchUtil::DEFAULT_NOMINAL_ENTRIES];
+    expected.resize(ThetaSketchUtil::DEFAULT_NOMINAL_ENTRIES);
+
+    ASSERT_OK_AND_ASSIGN(auto result, ThetaSketchUtil::Union(sketch1, sketch2, pool_.get()));
+    ASSERT_EQ(CompactSketch(expected_theta, expected),
+              std::string(result->data(), result->size()));
+    ASSERT_OK_AND_ASSIGN(double estimate,
+                         ThetaSketchUtil::GetEstimate(std::string_view(result->data(),
+                                                                       result->size())));
+    // the exact number of distinct hashes is 10000
+    ASSERT_NEAR(10000.0, estimate, 10000.0 * 0.05);
+}
+
+TEST_F(ThetaSketchUtilTest, TestUnionDataSketchesSerialized) {
+    // ordered compact sketches of DataSketches with the default seed 9001, serialized from the
+    // update sketches of the longs 1 to 5, 4 to 10, 1 to 10 and 1
+    std::string sketch1 = FromBytes({
+        0x02, 0x03, 0x03, 0x00, 0x00, 0x1A, 0xCC, 0x93, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x3F, 0x15, 0xF9, 0x7D, 0xCB, 0xBD, 0x86, 0xA1, 0x05, 0x40, 0xDE, 0x2E, 0xE1, 0xC9, 0xDB,
+        0x3D, 0x08, 0xBD, 0x32, 0x73, 0x72, 0x46, 0x91, 0xCC, 0x14, 0xC3, 0x97, 0xFC, 0x12, 0x81,
+        0x70, 0x9D, 0x1E, 0xBA, 0x40, 0xB3, 0xC1, 0xDA, 0x06, 0x69, 0x5D});
+    std::string sketch2 = FromBytes({
+        0x02, 0x03, 0x03, 0x00, 0x00, 0x1A, 0xCC, 0x93, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x3F, 0x40, 0xDE, 0x2E, 0xE1, 0xC9, 0xDB, 0x3D, 0x08, 0x69, 0x8B, 0xB9, 0x91, 0xB8, 0x68,
+        0x57, 0x08, 0xFE, 0x16, 0x21, 0x13, 0xFB, 0x98, 0xBC, 0x10, 0xBD, 0x32, 0x73, 0x72, 0x46,
+        0x91, 0xCC, 0x14, 0x1A, 0xD1, 0x30, 0x0B, 0x99, 0x8C, 0x2F, 0x22, 0xE0, 0xF4, 0x8B, 0xEA,
+        0x99, 0x83, 0xC3, 0x7C, 0xD8, 0x2D, 0x23, 0x77, 0x4B, 0xB9, 0x35, 0x7E});
+    std::string expected = FromBytes({
+        0x02, 0x03, 0x03, 0x00, 0x00, 0x1A, 0xCC, 0x93, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+        0x3F, 0x15, 0xF9, 0x7D, 0xCB, 0xBD, 0x86, 0xA1, 0x05, 0x40, 0xDE, 0x2E, 0xE1, 0xC9, 0xDB,
+        0x3D, 0x08, 0x69, 0x8B, 0xB9, 0x91, 0xB8, 0x68, 0x57, 0x08, 0xFE, 0x16, 0x21, 0x13, 0xFB,
+        0x98, 0xBC, 0x10, 0xBD, 0x32, 0x73, 0x72, 0x46, 0x91, 0xCC, 0x14, 0xC3, 0x97, 0xFC, 0x12,
+        0x81, 0x70, 0x9D, 0x1E, 0x1A, 0xD1, 0x30, 0x0B, 0x99, 0x8C, 0x2F, 0x22, 0xBA, 0x40, 0xB3,
+        0xC1, 0xDA, 0x06, 0x69, 0x5D, 0xE0, 0xF4, 0x8B, 0xEA, 0x99, 0x83, 0xC3, 0x7C, 0xD8, 0x2D,
+        0x23, 0x77, 0x4B, 0xB9, 0x35, 0x7E});
+    std::string single = FromBytes({
+        0x01, 0x03, 0x03, 0x00, 0x00, 0x3A, 0xCC, 0x93, 0x15, 0xF9, 0x7D, 0xCB, 0xBD, 0x86, 0xA1,
+        0x05});
+    ASSERT_OK_AND_ASSIGN(auto result, ThetaSketchUtil::Union(sketch1, sketch2, pool_.get()));
+    ASSERT_EQ(expected, std::string(result->data(), result->size()));
+    ASSERT_OK_AND_ASSIGN(double estimate,
+                         ThetaSketchUtil::GetEstimate(std::string_view(result->data(),
+                                                                       result->size())));
+    ASSERT_EQ(10.0, estimate);
+    ASSERT_OK_AND_ASSIGN(estimate, ThetaSketchUtil::GetEstimate(sketch2));
+    ASSERT_EQ(7.0, estimate);
+
+    ASSERT_OK_AND_ASSIGN(result, ThetaSketchUtil::Union(single, sketch1, pool_.get()));
+    ASSERT_EQ(sketch1, std::string(result->data(), result->size()));
+    ASSERT_OK_AND_ASSIGN(result, ThetaSketchUtil::Union(single, single, pool_.get()));
+    ASSERT_EQ(single, std::string(result->data(), result->size()));
+    ASSERT_OK_AND_ASSIGN(estimate, ThetaSketchUtil::GetEstimate(single));
+    ASSERT_EQ(1.0, estimate);
+}
+
+TEST_F(ThetaSketchUtilTest, TestInvalidSketch) {
+    std::string sketch = CompactSketch(MAX_THETA, {1, 2});
+    ASSERT_NOK_WITH_MSG(ThetaSketchUtil::Union(sketch, "abc", pool_.get()),
+                        "invalid theta sketch, size 3");
+    std::string update_sketch = sketch;
+    update_sketch[2] = 2;
+    ASSERT_NOK_WITH_MSG(ThetaSketchUtil::Union(sketch, update_sketch, pool_.get()),
+                        "only serial version 3 compact theta sketch is supported");
+    std::string other_seed = sketch;
+    other_seed[6] = 0;
+    ASSERT_NOK_WITH_MSG(ThetaSketchUtil::Union(sketch, other_seed, pool_.get()),
+                        "incompatible seed hash");
+    std::string truncated = sketch.substr(0, sketch.size() - 1);
+    ASSERT_NOK_WITH_MSG(ThetaSketchUtil::Union(sketch, truncated, pool_.get()),
+                        "invalid theta sketch, size 31, retained entries 2");
+}
+
+}  // namespace paimon::test
@@ -24,7 +24,9 @@
 #include "arrow/c/bridge.h"
 #include "arrow/c/helpers.h"
 #include "arrow/type.h"
+#include "arrow/util/byte_size.h"
 #include "paimon/common/metrics/metrics_impl.h"
+#include "paimon/common/metrics/scoped_timer.h"
 #include "paimon/common/types/row_kind.h"
 #include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/common/utils/long_counter.h"
@@ -37,7 +39,9 @@
 #include "paimon/core/io/rolling_file_writer.h"
 #include "paimon/core/io/single_file_writer.h"
 #include "paimon/core/manifest/file_source.h"
+#include "paimon/core/operation/metrics/writer_metrics.h"
 #include "paimon/core/utils/commit_increment.h"
+#include "paimon/executor.h"
 #include "paimon/format/file_format.h"
 #include "paimon/format/file_format_factory.h"
 #include "paimon/format/writer_builder.h"
@@ -55,6 +59,8 @@ AppendOnlyWriter::AppendOnlyWriter(const CoreOptions& options, int64_t schema_id
                                    const std::optional<std::vector<std::string>>& write_cols,
                                    int64_t max_sequence_number,
                                    const std::shared_ptr<DataFilePathFactory>& path_factory,
+                                   const std::shared_ptr<Executor>& executor,
+                                   const std::shared_ptr<FlushMemoryBudget>& flush_memory_budget,
                                    const std::shared_ptr<MemoryPool>& memory_pool)
     : options_(options),
       schema_id_(schema_id),
@@ -63,7 +69,13 @@ AppendOnlyWriter::AppendOnlyWriter(const CoreOptions& options, int64_t schema_id
       seq_num_counter_(std::make_shared<LongCounter>(max_sequence_number + 1)),
       path_factory_(path_factory),
       memory_pool_(memory_pool),
-      metrics_(std::make_shared<MetricsImpl>()) {}
+      metrics_(std::make_shared<MetricsImpl>()) {
+    if (options_.WriteAsyncFlushEnabled() && executor) {
+        write_type_ = arrow::struct_(write_schema_->fields());
+        async_flusher_ = std::make_unique<AsyncFlusher>(
+            executor, options_.GetWriteAsyncFlushMaxInFlight(), flush_memory_budget);
+    }
+}
 
 AppendOnlyWriter::~AppendOnlyWriter() = default;
 
@@ -76,13 +88,59 @@ Status AppendOnlyWriter::Write(std::unique_ptr<RecordBatch>&& batch) {
                                    kind->Name());
         }
     }
+    if (async_flusher_) {
+        return BufferBatch(std::move(batch));
+    }
     if (writer_ == nullptr) {
         PAIMON_ASSIGN_OR_RAISE(writer_, CreateRollingRowWriter());
     }
     return writer_->Write(batch->GetData());
 }
 
+Status AppendOnlyWriter::BufferBatch(std::unique_ptr<RecordBatch>&& batch) {
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> array,
+                                      arrow::ImportArray(batch->GetData(), write_type_));
+    buffered_memory_in_bytes_ += arrow::util::TotalBufferSize(*array);
+    buffered_arrays_.push_back(std::move(array));
+    if (buffered_memory_in_bytes_ >= options_.GetWriteBufferSize()) {
+        return SubmitWriteBuffer();
+    }
+    return Status::OK();
+}
+
+Status AppendOnlyWriter::SubmitWriteBuffer() {
+    if (buffered_arrays_.empty()) {
+        return Status::OK();
+    }
+    std::vector<std::shared_ptr<arrow::Array>> arrays = std::move(buffered_arrays_);
+    int64_t memory_in_bytes = buffered_memory_in_bytes_;
+    buffered_arrays_.clear();
+    buffered_memory_in_bytes_ = 0;
+    // the flushes run one by one, so they can share the rolling writer; blocks if there are too
+    // many full buffers in flight
+    return async_flusher_->Submit(
+        [this, arrays = std::move(arrays)]() -> Status { return WriteArrays(arrays); },
+        memory_in_bytes);
+}
+
+Status AppendOnlyWriter::WriteArrays(const std::vector<std::shared_ptr<arrow::Array>>& arrays) {
+    if (writer_ == nullptr) {
+        PAIMON_ASSIGN_OR_RAISE(writer_, CreateRollingRowWriter());
+    }
+    for (const auto& array : arrays) {
+        ::ArrowArray c_array;
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(*array, &c_array));
+        ScopeGuard guard([&c_array]() { ArrowArrayRelease(&c_array); });
+        PAIMON_RETURN_NOT_OK(writer_->Write(&c_array));
+    }
+    return Status::OK();
+}
+
 Result<CommitIncrement> AppendOnlyWriter::PrepareCommit(bool wait_compaction) {
+    if (async_flusher_) {
+        PAIMON_RETURN_NOT_OK(SubmitWriteBuffer());
+        PAIMON_RETURN_NOT_OK(async_flusher_->WaitAll());
+    }
     PAIMON_RETURN_NOT_OK(Flush());
     return DrainIncrement();
 }
@@ -97,6 +155,7 @@ Result<CommitIncrement> AppendOnlyWriter::DrainIncrement() {
 
 Status AppendOnlyWriter::Flush() {
     if (writer_) {
+        ScopedTimer timer(metrics_.get(), WriterMetrics::FLUSH_DURATION);
         PAIMON_RETURN_NOT_OK(writer_->Close());
         PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<DataFileMeta>> flushed_files,
                                writer_->GetResult());
@@ -198,11 +257,18 @@ AppendOnlyWriter::RollingFileWriterResult AppendOnlyWriter::CreateRollingBlobWri
 }
 
 Status AppendOnlyWriter::Close() {
+    Status status;
+    if (async_flusher_) {
+        // in-flight flushes write to writer_, the files of a failed flush are aborted below
+        status = async_flusher_->WaitAll();
+        buffered_arrays_.clear();
+        buffered_memory_in_bytes_ = 0;
+    }
     if (writer_) {
         writer_->Abort();
         writer_.reset();
     }
-    return Status::OK();
+    return status;
 }
 
 }  // namespace paimon
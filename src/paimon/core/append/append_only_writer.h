@@ -27,6 +27,7 @@
 #include "paimon/core/core_options.h"
 #include "paimon/core/io/data_file_meta.h"
 #include "paimon/core/io/single_file_writer.h"
+#include "paimon/core/utils/async_flusher.h"
 #include "paimon/core/utils/batch_writer.h"
 #include "paimon/result.h"
 #include "paimon/status.h"
@@ -35,6 +36,8 @@ struct ArrowSchema;
 struct ArrowArray;
 
 namespace arrow {
+class Array;
+class DataType;
 class Schema;
 }  // namespace arrow
 
@@ -46,11 +49,16 @@ template <typename T, typename R>
 class RollingFileWriter;
 class LongCounter;
 class DataFilePathFactory;
+class Executor;
 class MemoryPool;
 class Metrics;
 class FormatStatsExtractor;
 class WriterBuilder;
 
+/// Writes the batches straight through a rolling file writer. With "write.async-flush.enabled"
+/// the batches are buffered up to write-buffer-size instead, and a full buffer is written to the
+/// files on the executor while new batches go to a fresh buffer. `flush_memory_budget` is shared
+/// by the writers of a table write and may be nullptr.
 class AppendOnlyWriter : public BatchWriter {
  public:
     AppendOnlyWriter(const CoreOptions& options, int64_t schema_id,
@@ -58,6 +66,8 @@ class AppendOnlyWriter : public BatchWriter {
                      const std::optional<std::vector<std::string>>& write_cols,
                      int64_t max_sequence_number,
                      const std::shared_ptr<DataFilePathFactory>& path_factory,
+                     const std::shared_ptr<Executor>& executor,
+                     const std::shared_ptr<FlushMemoryBudget>& flush_memory_budget,
                      const std::shared_ptr<MemoryPool>& memory_pool);
     ~AppendOnlyWriter() override;
 
@@ -84,6 +94,10 @@ class AppendOnlyWriter : public BatchWriter {
     Result<CommitIncrement> DrainIncrement();
     Status Flush();
 
+    Status BufferBatch(std::unique_ptr<RecordBatch>&& batch);
+    Status SubmitWriteBuffer();
+    Status WriteArrays(const std::vector<std::shared_ptr<arrow::Array>>& arrays);
+
     SingleFileWriterCreator GetDataFileWriterCreator(
         const std::shared_ptr<arrow::Schema>& schema,
         const std::optional<std::vector<std::string>>& write_cols) const;
@@ -106,6 +120,13 @@ class AppendOnlyWriter : public BatchWriter {
     std::vector<std::shared_ptr<DataFileMeta>> deleted_files_;
 
     std::unique_ptr<RollingFileWriter<::ArrowArray*, std::shared_ptr<DataFileMeta>>> writer_;
+
+    // only used when full write buffers are written on the executor
+    std::shared_ptr<arrow::DataType> write_type_;
+    std::vector<std::shared_ptr<arrow::Array>> buffered_arrays_;
+    int64_t buffered_memory_in_bytes_ = 0;
+    // declared last, so that in-flight flushes finish before the other members are destroyed
+    std::unique_ptr<AsyncFlusher> async_flusher_;
 };
 
 }  // namespace paimon
@@ -37,6 +37,7 @@
 #include "paimon/core/io/data_increment.h"
 #include "paimon/core/utils/commit_increment.h"
 #include "paimon/defs.h"
+#include "paimon/executor.h"
 #include "paimon/fs/file_system.h"
 #include "paimon/fs/local/local_file_system.h"
 #include "paimon/memory/memory_pool.h"
@@ -79,7 +80,8 @@ TEST_F(AppendOnlyWriterTest, TestEmptyCommits) {
     ASSERT_OK(path_factory->Init(dir->Str(), "mock_format", options.DataFilePrefix(), nullptr));
 
     AppendOnlyWriter writer(options, /*schema_id=*/0, schema, /*write_cols=*/std::nullopt,
-                            /*max_sequence_number=*/-1, path_factory, memory_pool_);
+                            /*max_sequence_number=*/-1, path_factory, /*executor=*/nullptr,
+                            /*flush_memory_budget=*/nullptr, memory_pool_);
     ASSERT_FALSE(writer.IsCompacting());
     for (int i = 0; i < 3; i++) {
         ASSERT_OK_AND_ASSIGN(CommitIncrement inc, writer.PrepareCommit(true));
@@ -108,7 +110,8 @@ TEST_F(AppendOnlyWriterTest, TestWriteAndPrepareCommit) {
     auto path_factory = std::make_shared<DataFilePathFactory>();
     ASSERT_OK(path_factory->Init(dir->Str(), "mock_format", options.DataFilePrefix(), nullptr));
     AppendOnlyWriter writer(options, /*schema_id=*/2, schema, /*write_cols=*/std::nullopt,
-                            /*max_sequence_number=*/-1, path_factory, memory_pool_);
+                            /*max_sequence_number=*/-1, path_factory, /*executor=*/nullptr,
+                            /*flush_memory_budget=*/nullptr, memory_pool_);
     ASSERT_FALSE(writer.IsCompacting());
     arrow::StringBuilder builder;
     for (size_t j = 0; j < 100; j++) {
@@ -150,7 +153,8 @@ TEST_F(AppendOnlyWriterTest, TestWriteAndClose) {
     auto path_factory = std::make_shared<DataFilePathFactory>();
     ASSERT_OK(path_factory->Init(dir->Str(), "orc", options.DataFilePrefix(), nullptr));
     AppendOnlyWriter writer(options, /*schema_id=*/1, schema, /*write_cols=*/std::nullopt,
-                            /*max_sequence_number=*/-1, path_factory, memory_pool_);
+                            /*max_sequence_number=*/-1, path_factory, /*executor=*/nullptr,
+                            /*flush_memory_budget=*/nullptr, memory_pool_);
     ASSERT_FALSE(writer.IsCompacting());
 
     auto struct_type = arrow::struct_(fields);
@@ -195,7 +199,8 @@ TEST_F(AppendOnlyWriterTest, TestInvalidRowKind) {
     auto path_factory = std::make_shared<DataFilePathFactory>();
     ASSERT_OK(path_factory->Init(dir->Str(), "orc", options.DataFilePrefix(), nullptr));
     AppendOnlyWriter writer(options, /*schema_id=*/1, schema, /*write_cols=*/std::nullopt,
-                            /*max_sequence_number=*/-1, path_factory, memory_pool_);
+                            /*max_sequence_number=*/-1, path_factory, /*executor=*/nullptr,
+                            /*flush_memory_budget=*/nullptr, memory_pool_);
     ASSERT_FALSE(writer.IsCompacting());
 
     auto struct_type = arrow::struct_(fields);
@@ -224,4 +229,76 @@ TEST_F(AppendOnlyWriterTest, TestInvalidRowKind) {
     ASSERT_TRUE(file_status_list.empty());
 }
 
+TEST_F(AppendOnlyWriterTest, TestAsyncFlush) {
+    std::map<std::string, std::string> raw_options;
+    raw_options[Options::FILE_FORMAT] = "orc";
+    raw_options[Options::FILE_SYSTEM] = "local";
+    raw_options[Options::MANIFEST_FORMAT] = "orc";
+    // each batch is flushed on the executor due to WRITE_BUFFER_SIZE
+    raw_options[Options::WRITE_BUFFER_SIZE] = "1";
+    raw_options[Options::WRITE_ASYNC_FLUSH_ENABLED] = "true";
+    raw_options[Options::WRITE_ASYNC_FLUSH_MAX_IN_FLIGHT] = "2";
+    ASSERT_OK_AND_ASSIGN(CoreOptions options, CoreOptions::FromMap(raw_options));
+
+    arrow::FieldVector fields = {arrow::field("f0", arrow::utf8())};
+    auto schema = arrow::schema(fields);
+
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+
+    auto path_factory = std::make_shared<DataFilePathFactory>();
+    ASSERT_OK(path_factory->Init(dir->Str(), "orc", options.DataFilePrefix(), nullptr));
+    std::shared_ptr<Executor> executor = CreateDefaultExecutor(/*thread_count=*/2);
+    AppendOnlyWriter writer(options, /*schema_id=*/1, schema, /*write_cols=*/std::nullopt,
+                            /*max_sequence_number=*/-1, path_factory, executor,
+                            /*flush_memory_budget=*/nullptr, memory_pool_);
+    ASSERT_TRUE(writer.async_flusher_);
+
+    auto struct_type = arrow::struct_(fields);
+    arrow::StructBuilder struct_builder(struct_type, arrow::default_memory_pool(),
+                                        {std::make_shared<arrow::StringBuilder>()});
+    auto string_builder = static_cast<arrow::StringBuilder*>(struct_builder.field_builder(0));
+    for (size_t j = 0; j < 100; j++) {
+        ASSERT_TRUE(struct_builder.Append().ok());
+        ASSERT_TRUE(string_builder->Append(std::to_string(j)).ok());
+    }
+    std::shared_ptr<arrow::Array> array;
+    ASSERT_TRUE(struct_builder.Finish(&array).ok());
+    ASSERT_TRUE(array);
+
+    auto write_batches = [&](int32_t batch_count) {
+        for (int32_t i = 0; i < batch_count; i++) {
+            ::ArrowArray arrow_array;
+            ASSERT_TRUE(arrow::ExportArray(*array, &arrow_array).ok());
+            RecordBatchBuilder batch_builder(&arrow_array);
+            ASSERT_OK_AND_ASSIGN(auto record_batch, batch_builder.Finish());
+            ASSERT_OK(writer.Write(std::move(record_batch)));
+            ASSERT_TRUE(ArrowArrayIsReleased(&arrow_array));
+        }
+    };
+    // the flushed batches of a commit go to the same file
+    write_batches(20);
+    ASSERT_OK_AND_ASSIGN(CommitIncrement inc1, writer.PrepareCommit(true));
+    ASSERT_EQ(1, inc1.GetNewFilesIncrement().NewFiles().size());
+    const auto& file1 = inc1.GetNewFilesIncrement().NewFiles()[0];
+    ASSERT_EQ(2000, file1->row_count);
+    ASSERT_EQ(0, file1->min_sequence_number);
+    ASSERT_EQ(1999, file1->max_sequence_number);
+
+    write_batches(5);
+    ASSERT_OK_AND_ASSIGN(CommitIncrement inc2, writer.PrepareCommit(true));
+    ASSERT_EQ(1, inc2.GetNewFilesIncrement().NewFiles().size());
+    const auto& file2 = inc2.GetNewFilesIncrement().NewFiles()[0];
+    ASSERT_EQ(500, file2->row_count);
+    ASSERT_EQ(2000, file2->min_sequence_number);
+    ASSERT_EQ(2499, file2->max_sequence_number);
+    ASSERT_OK(writer.Close());
+
+    for (const auto& file : {file1, file2}) {
+        ASSERT_OK_AND_ASSIGN(bool exist,
+                             options.GetFileSystem()->Exists(path_factory->ToPath(file)));
+        ASSERT_TRUE(exist);
+    }
+}
+
 }  // namespace paimon::test
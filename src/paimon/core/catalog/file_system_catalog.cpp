@@ -29,6 +29,7 @@
 #include "paimon/common/utils/string_utils.h"
 #include "paimon/core/schema/schema_impl.h"
 #include "paimon/core/schema/schema_manager.h"
+#include "paimon/core/utils/metadata_cache.h"
 #include "paimon/fs/file_system.h"
 #include "paimon/logging.h"
 #include "paimon/result.h"
@@ -122,6 +123,9 @@ Status FileSystemCatalog::CreateTable(const Identifier& identifier, ArrowSchema*
             "create table operation does not support object store file system for now");
     }
     SchemaManager schema_manager(fs_, NewDataTablePath(warehouse_, identifier));
+    // drops the metadata of a table previously at the same path from the process wide cache,
+    // the latest schema id is never trusted from the cache here
+    schema_manager.WithCache(MetadataCache::Global(), /*latest_ttl_ms=*/0);
     PAIMON_ASSIGN_OR_RAISE(
         std::unique_ptr<TableSchema> table_schema,
         schema_manager.CreateTable(schema, partition_keys, primary_keys, options));
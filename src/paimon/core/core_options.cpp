@@ -22,6 +22,8 @@
 #include <utility>
 
 #include "fmt/format.h"
+#include "paimon/common/fs/block_cache.h"
+#include "paimon/common/fs/caching_file_system.h"
 #include "paimon/common/fs/resolving_file_system.h"
 #include "paimon/common/options/memory_size.h"
 #include "paimon/common/options/time_duration.h"
@@ -253,6 +255,15 @@ struct CoreOptions::Impl {
     int64_t manifest_full_compaction_file_size = 16 * 1024 * 1024;
     int64_t write_buffer_size = 256 * 1024 * 1024;
     int64_t commit_timeout = std::numeric_limits<int64_t>::max();
+    int64_t metadata_cache_hint_ttl = 1000;
+    int64_t continuous_discovery_interval = 10 * 1000;
+    int64_t lookup_cache_max_disk_size = std::numeric_limits<int64_t>::max();
+    int64_t lookup_cache_max_memory_size = 256 * 1024 * 1024;
+    int64_t lookup_cache_block_size = 64 * 1024;
+    int64_t block_cache_block_size = 1024 * 1024;
+    int64_t block_cache_max_memory_size = 256 * 1024 * 1024;
+    int64_t block_cache_max_disk_size = 10LL * 1024 * 1024 * 1024;
+    double lookup_cache_bloom_filter_fpp = 0.05;
 
     std::shared_ptr<FileFormat> file_format;
     std::shared_ptr<FileSystem> file_system;
@@ -278,11 +289,14 @@ struct CoreOptions::Impl {
     std::map<std::string, std::string> raw_options;
 
     int32_t bucket = -1;
+    int32_t postpone_default_bucket_num = 1;
 
     int32_t manifest_merge_min_count = 30;
     int32_t read_batch_size = 1024;
     int32_t write_batch_size = 1024;
     int32_t commit_max_retries = 10;
+    int32_t write_async_flush_max_in_flight = 1;
+    int64_t write_async_flush_max_memory = 0;
 
     SortOrder sequence_field_sort_order = SortOrder::ASCENDING;
     MergeEngine merge_engine = MergeEngine::DEDUPLICATE;
@@ -293,6 +307,7 @@ struct CoreOptions::Impl {
     int32_t file_compression_zstd_level = 1;
 
     bool ignore_delete = false;
+    bool write_async_flush_enabled = false;
     bool deletion_vectors_enabled = false;
     bool force_lookup = false;
     bool partial_update_remove_record_on_delete = false;
@@ -303,6 +318,13 @@ struct CoreOptions::Impl {
     bool data_evolution_enabled = false;
     bool legacy_partition_name_enabled = true;
     bool global_index_enabled = true;
+    bool source_split_key_range_enabled = false;
+    bool lookup_cache_bloom_filter_enabled = true;
+    bool block_cache_enabled = false;
+    bool partition_statistics_index_enabled = false;
+    bool metadata_cache_enabled = false;
+    std::string lookup_cache_dir;
+    std::string block_cache_dir;
 };
 
 // Parse configurations from a map and return a populated CoreOptions object
@@ -317,6 +339,13 @@ Result<CoreOptions> CoreOptions::FromMap(
 
     // Parse basic configurations
     PAIMON_RETURN_NOT_OK(parser.Parse(Options::BUCKET, &impl->bucket));
+    PAIMON_RETURN_NOT_OK(parser.Parse(Options::POSTPONE_DEFAULT_BUCKET_NUM,
+                                      &impl->postpone_default_bucket_num));
+    if (impl->postpone_default_bucket_num < 1) {
+        return Status::Invalid(fmt::format("{} must be at least 1, but is {}",
+                                           Options::POSTPONE_DEFAULT_BUCKET_NUM,
+                                           impl->postpone_default_bucket_num));
+    }
     PAIMON_RETURN_NOT_OK(
         parser.Parse(Options::MANIFEST_MERGE_MIN_COUNT, &impl->manifest_merge_min_count));
     PAIMON_RETURN_NOT_OK(parser.Parse(Options::SCAN_SNAPSHOT_ID, &impl->scan_snapshot_id));
@@ -324,6 +353,17 @@ Result<CoreOptions> CoreOptions::FromMap(
     PAIMON_RETURN_NOT_OK(parser.Parse(Options::WRITE_BATCH_SIZE, &impl->write_batch_size));
     PAIMON_RETURN_NOT_OK(
         parser.ParseMemorySize(Options::WRITE_BUFFER_SIZE, &impl->write_buffer_size));
+    PAIMON_RETURN_NOT_OK(
+        parser.Parse<bool>(Options::WRITE_ASYNC_FLUSH_ENABLED, &impl->write_async_flush_enabled));
+    PAIMON_RETURN_NOT_OK(parser.Parse(Options::WRITE_ASYNC_FLUSH_MAX_IN_FLIGHT,
+                                      &impl->write_async_flush_max_in_flight));
+    if (impl->write_async_flush_max_in_flight < 1) {
+        return Status::Invalid(fmt::format("{} must be at least 1, but is {}",
+                                           Options::WRITE_ASYNC_FLUSH_MAX_IN_FLIGHT,
+                                           impl->write_async_flush_max_in_flight));
+    }
+    PAIMON_RETURN_NOT_OK(parser.ParseMemorySize(Options::WRITE_ASYNC_FLUSH_MAX_MEMORY,
+                                                &impl->write_async_flush_max_memory));
     PAIMON_RETURN_NOT_OK(parser.Parse(Options::COMMIT_MAX_RETRIES, &impl->commit_max_retries));
     PAIMON_RETURN_NOT_OK(parser.ParseString(Options::FILE_COMPRESSION, &impl->file_compression));
     PAIMON_RETURN_NOT_OK(
@@ -348,6 +388,8 @@ Result<CoreOptions> CoreOptions::FromMap(
                                                 &impl->source_split_open_file_cost));
     PAIMON_RETURN_NOT_OK(parser.ParseMemorySize(Options::MANIFEST_FULL_COMPACTION_FILE_SIZE,
                                                 &impl->manifest_full_compaction_file_size));
+    PAIMON_RETURN_NOT_OK(parser.Parse<bool>(Options::PARTITION_STATISTICS_INDEX_ENABLED,
+                                            &impl->partition_statistics_index_enabled));
 
     // Parse file format and file system configurations
     PAIMON_RETURN_NOT_OK(parser.ParseObject<FileFormatFactory>(
@@ -359,6 +401,23 @@ Result<CoreOptions> CoreOptions::FromMap(
         Options::MANIFEST_FORMAT, /*default_identifier=*/"orc", &impl->manifest_file_format));
     PAIMON_RETURN_NOT_OK(parser.ParseFileSystem(fs_scheme_to_identifier_map, specified_file_system,
                                                 &impl->file_system));
+    PAIMON_RETURN_NOT_OK(
+        parser.Parse<bool>(Options::BLOCK_CACHE_ENABLED, &impl->block_cache_enabled));
+    PAIMON_RETURN_NOT_OK(parser.ParseString(Options::BLOCK_CACHE_DIR, &impl->block_cache_dir));
+    PAIMON_RETURN_NOT_OK(
+        parser.ParseMemorySize(Options::BLOCK_CACHE_BLOCK_SIZE, &impl->block_cache_block_size));
+    PAIMON_RETURN_NOT_OK(parser.ParseMemorySize(Options::BLOCK_CACHE_MAX_MEMORY_SIZE,
+                                                &impl->block_cache_max_memory_size));
+    PAIMON_RETURN_NOT_OK(parser.ParseMemorySize(Options::BLOCK_CACHE_MAX_DISK_SIZE,
+                                                &impl->block_cache_max_disk_size));
+    if (impl->block_cache_enabled) {
+        PAIMON_ASSIGN_OR_RAISE(
+            std::shared_ptr<BlockCache> block_cache,
+            BlockCache::GetOrCreateShared(impl->block_cache_dir, impl->block_cache_block_size,
+                                          impl->block_cache_max_memory_size,
+                                          impl->block_cache_max_disk_size));
+        impl->file_system = std::make_shared<CachingFileSystem>(impl->file_system, block_cache);
+    }
 
     // Parse startup mode
     std::string startup_mode_str;
@@ -386,9 +445,28 @@ Result<CoreOptions> CoreOptions::FromMap(
     bool snapshot_clean_empty_directories = false;
     PAIMON_RETURN_NOT_OK(parser.Parse<bool>(Options::SNAPSHOT_CLEAN_EMPTY_DIRECTORIES,
                                             &snapshot_clean_empty_directories));
+    int32_t snapshot_expire_parallelism = 16;
+    PAIMON_RETURN_NOT_OK(
+        parser.Parse(Options::SNAPSHOT_EXPIRE_PARALLELISM, &snapshot_expire_parallelism));
+    if (snapshot_expire_parallelism < 1) {
+        return Status::Invalid(fmt::format("{} must be at least 1, but is {}",
+                                           Options::SNAPSHOT_EXPIRE_PARALLELISM,
+                                           snapshot_expire_parallelism));
+    }
     impl->expire_config =
         ExpireConfig(snapshot_num_retain_max, snapshot_num_retain_min, snapshot_time_retained,
-                     snapshot_expire_limit, snapshot_clean_empty_directories);
+                     snapshot_expire_limit, snapshot_clean_empty_directories,
+                     snapshot_expire_parallelism);
+
+    PAIMON_RETURN_NOT_OK(
+        parser.Parse<bool>(Options::METADATA_CACHE_ENABLED, &impl->metadata_cache_enabled));
+    std::string metadata_cache_hint_ttl_str;
+    PAIMON_RETURN_NOT_OK(
+        parser.ParseString(Options::METADATA_CACHE_HINT_TTL, &metadata_cache_hint_ttl_str));
+    if (!metadata_cache_hint_ttl_str.empty()) {
+        PAIMON_ASSIGN_OR_RAISE(impl->metadata_cache_hint_ttl,
+                               TimeDuration::Parse(metadata_cache_hint_ttl_str));
+    }
 
     std::string commit_timeout_str;
     PAIMON_RETURN_NOT_OK(parser.ParseString(Options::COMMIT_TIMEOUT, &commit_timeout_str));
@@ -396,6 +474,19 @@ Result<CoreOptions> CoreOptions::FromMap(
         PAIMON_ASSIGN_OR_RAISE(impl->commit_timeout, TimeDuration::Parse(commit_timeout_str));
     }
 
+    std::string discovery_interval_str;
+    PAIMON_RETURN_NOT_OK(
+        parser.ParseString(Options::CONTINUOUS_DISCOVERY_INTERVAL, &discovery_interval_str));
+    if (!discovery_interval_str.empty()) {
+        PAIMON_ASSIGN_OR_RAISE(impl->continuous_discovery_interval,
+                               TimeDuration::Parse(discovery_interval_str));
+        if (impl->continuous_discovery_interval <= 0) {
+            return Status::Invalid(fmt::format("{} must be positive, but is {}",
+                                               Options::CONTINUOUS_DISCOVERY_INTERVAL,
+                                               discovery_interval_str));
+        }
+    }
+
     // Parse sequence field
     PAIMON_RETURN_NOT_OK(parser.ParseList<std::string>(
         Options::SEQUENCE_FIELD, Options::FIELDS_SEPARATOR, &impl->sequence_field));
@@ -416,6 +507,23 @@ Result<CoreOptions> CoreOptions::FromMap(
     PAIMON_RETURN_NOT_OK(
         parser.Parse<bool>(Options::DELETION_VECTORS_ENABLED, &impl->deletion_vectors_enabled));
     PAIMON_RETURN_NOT_OK(parser.Parse<bool>(Options::FORCE_LOOKUP, &impl->force_lookup));
+    // Parse lookup cache
+    PAIMON_RETURN_NOT_OK(parser.ParseString(Options::LOOKUP_CACHE_DIR, &impl->lookup_cache_dir));
+    PAIMON_RETURN_NOT_OK(parser.ParseMemorySize(Options::LOOKUP_CACHE_MAX_DISK_SIZE,
+                                                &impl->lookup_cache_max_disk_size));
+    PAIMON_RETURN_NOT_OK(parser.ParseMemorySize(Options::LOOKUP_CACHE_MAX_MEMORY_SIZE,
+                                                &impl->lookup_cache_max_memory_size));
+    PAIMON_RETURN_NOT_OK(
+        parser.ParseMemorySize(Options::LOOKUP_CACHE_BLOCK_SIZE, &impl->lookup_cache_block_size));
+    PAIMON_RETURN_NOT_OK(parser.Parse<bool>(Options::LOOKUP_CACHE_BLOOM_FILTER_ENABLED,
+                                            &impl->lookup_cache_bloom_filter_enabled));
+    PAIMON_RETURN_NOT_OK(parser.Parse<double>(Options::LOOKUP_CACHE_BLOOM_FILTER_FPP,
+                                              &impl->lookup_cache_bloom_filter_fpp));
+    if (impl->lookup_cache_bloom_filter_fpp <= 0 || impl->lookup_cache_bloom_filter_fpp >= 1) {
+        return Status::Invalid(fmt::format("{} must be in (0, 1), but is {}",
+                                           Options::LOOKUP_CACHE_BLOOM_FILTER_FPP,
+                                           impl->lookup_cache_bloom_filter_fpp));
+    }
     // Parse changelog producer
     PAIMON_RETURN_NOT_OK(parser.ParseChangelogProducer(&impl->changelog_producer));
 
@@ -470,6 +578,9 @@ Result<CoreOptions> CoreOptions::FromMap(
     // Parse global-index.enabled
     PAIMON_RETURN_NOT_OK(
         parser.Parse<bool>(Options::GLOBAL_INDEX_ENABLED, &impl->global_index_enabled));
+    // Parse source.split.key-range.enabled
+    PAIMON_RETURN_NOT_OK(parser.Parse<bool>(Options::SOURCE_SPLIT_KEY_RANGE_ENABLED,
+                                            &impl->source_split_key_range_enabled));
     return options;
 }
 
@@ -491,6 +602,10 @@ int32_t CoreOptions::GetBucket() const {
     return impl_->bucket;
 }
 
+int32_t CoreOptions::GetPostponeDefaultBucketNum() const {
+    return impl_->postpone_default_bucket_num;
+}
+
 std::shared_ptr<FileFormat> CoreOptions::GetWriteFileFormat() const {
     return impl_->file_format;
 }
@@ -499,6 +614,26 @@ std::shared_ptr<FileSystem> CoreOptions::GetFileSystem() const {
     return impl_->file_system;
 }
 
+bool CoreOptions::BlockCacheEnabled() const {
+    return impl_->block_cache_enabled;
+}
+
+const std::string& CoreOptions::GetBlockCacheDir() const {
+    return impl_->block_cache_dir;
+}
+
+int64_t CoreOptions::GetBlockCacheBlockSize() const {
+    return impl_->block_cache_block_size;
+}
+
+int64_t CoreOptions::GetBlockCacheMaxMemorySize() const {
+    return impl_->block_cache_max_memory_size;
+}
+
+int64_t CoreOptions::GetBlockCacheMaxDiskSize() const {
+    return impl_->block_cache_max_disk_size;
+}
+
 const std::string& CoreOptions::GetFileCompression() const {
     return impl_->file_compression;
 }
@@ -533,9 +668,15 @@ int64_t CoreOptions::GetSourceSplitTargetSize() const {
 int64_t CoreOptions::GetSourceSplitOpenFileCost() const {
     return impl_->source_split_open_file_cost;
 }
+bool CoreOptions::SourceSplitKeyRangeEnabled() const {
+    return impl_->source_split_key_range_enabled;
+}
 std::optional<int64_t> CoreOptions::GetScanSnapshotId() const {
     return impl_->scan_snapshot_id;
 }
+int64_t CoreOptions::GetContinuousDiscoveryInterval() const {
+    return impl_->continuous_discovery_interval;
+}
 int64_t CoreOptions::GetManifestTargetFileSize() const {
     return impl_->manifest_target_file_size;
 }
@@ -548,6 +689,10 @@ int64_t CoreOptions::GetManifestFullCompactionThresholdSize() const {
     return impl_->manifest_full_compaction_file_size;
 }
 
+bool CoreOptions::PartitionStatisticsIndexEnabled() const {
+    return impl_->partition_statistics_index_enabled;
+}
+
 const std::string& CoreOptions::GetManifestCompression() const {
     return impl_->manifest_compression;
 }
@@ -574,6 +719,26 @@ int64_t CoreOptions::GetWriteBufferSize() const {
     return impl_->write_buffer_size;
 }
 
+bool CoreOptions::WriteAsyncFlushEnabled() const {
+    return impl_->write_async_flush_enabled;
+}
+
+int32_t CoreOptions::GetWriteAsyncFlushMaxInFlight() const {
+    return impl_->write_async_flush_max_in_flight;
+}
+
+int64_t CoreOptions::GetWriteAsyncFlushMaxMemory() const {
+    return impl_->write_async_flush_max_memory;
+}
+
+bool CoreOptions::MetadataCacheEnabled() const {
+    return impl_->metadata_cache_enabled;
+}
+
+int64_t CoreOptions::GetMetadataCacheHintTtl() const {
+    return impl_->metadata_cache_hint_ttl;
+}
+
 int64_t CoreOptions::GetCommitTimeout() const {
     return impl_->commit_timeout;
 }
@@ -654,6 +819,30 @@ bool CoreOptions::NeedLookup() const {
            impl_->force_lookup;
 }
 
+const std::string& CoreOptions::GetLookupCacheDir() const {
+    return impl_->lookup_cache_dir;
+}
+
+int64_t CoreOptions::GetLookupCacheMaxDiskSize() const {
+    return impl_->lookup_cache_max_disk_size;
+}
+
+int64_t CoreOptions::GetLookupCacheMaxMemorySize() const {
+    return impl_->lookup_cache_max_memory_size;
+}
+
+int64_t CoreOptions::GetLookupCacheBlockSize() const {
+    return impl_->lookup_cache_block_size;
+}
+
+bool CoreOptions::LookupCacheBloomFilterEnabled() const {
+    return impl_->lookup_cache_bloom_filter_enabled;
+}
+
+double CoreOptions::GetLookupCacheBloomFilterFpp() const {
+    return impl_->lookup_cache_bloom_filter_fpp;
+}
+
 std::map<std::string, std::string> CoreOptions::GetFieldsSequenceGroups() const {
     auto raw_options = impl_->raw_options;
     std::map<std::string, std::string> sequence_groups;
@@ -52,8 +52,14 @@ class PAIMON_EXPORT CoreOptions {
     ~CoreOptions();
 
     int32_t GetBucket() const;
+    int32_t GetPostponeDefaultBucketNum() const;
     std::shared_ptr<FileFormat> GetWriteFileFormat() const;
     std::shared_ptr<FileSystem> GetFileSystem() const;
+    bool BlockCacheEnabled() const;
+    const std::string& GetBlockCacheDir() const;
+    int64_t GetBlockCacheBlockSize() const;
+    int64_t GetBlockCacheMaxMemorySize() const;
+    int64_t GetBlockCacheMaxDiskSize() const;
     const std::string& GetFileCompression() const;
     int32_t GetFileCompressionZstdLevel() const;
     int64_t GetPageSize() const;
@@ -65,9 +71,12 @@ class PAIMON_EXPORT CoreOptions {
     const std::string& GetManifestCompression() const;
     int32_t GetManifestMergeMinCount() const;
     int64_t GetManifestFullCompactionThresholdSize() const;
+    bool PartitionStatisticsIndexEnabled() const;
     int64_t GetSourceSplitTargetSize() const;
     int64_t GetSourceSplitOpenFileCost() const;
+    bool SourceSplitKeyRangeEnabled() const;
     std::optional<int64_t> GetScanSnapshotId() const;
+    int64_t GetContinuousDiscoveryInterval() const;
 
     int64_t GetManifestTargetFileSize() const;
     StartupMode GetStartupMode() const;
@@ -75,9 +84,15 @@ class PAIMON_EXPORT CoreOptions {
     int32_t GetReadBatchSize() const;
     int32_t GetWriteBatchSize() const;
     int64_t GetWriteBufferSize() const;
+    bool WriteAsyncFlushEnabled() const;
+    int32_t GetWriteAsyncFlushMaxInFlight() const;
+    int64_t GetWriteAsyncFlushMaxMemory() const;
 
     const ExpireConfig& GetExpireConfig() const;
 
+    bool MetadataCacheEnabled() const;
+    int64_t GetMetadataCacheHintTtl() const;
+
     int64_t GetCommitTimeout() const;
     int32_t GetCommitMaxRetries() const;
 
@@ -93,6 +108,12 @@ class PAIMON_EXPORT CoreOptions {
     bool DeletionVectorsEnabled() const;
     ChangelogProducer GetChangelogProducer() const;
     bool NeedLookup() const;
+    const std::string& GetLookupCacheDir() const;
+    int64_t GetLookupCacheMaxDiskSize() const;
+    int64_t GetLookupCacheMaxMemorySize() const;
+    int64_t GetLookupCacheBlockSize() const;
+    bool LookupCacheBloomFilterEnabled() const;
+    double GetLookupCacheBloomFilterFpp() const;
     bool FileIndexReadEnabled() const;
 
     std::map<std::string, std::string> GetFieldsSequenceGroups() const;
@@ -20,6 +20,7 @@
 #include <utility>
 
 #include "gtest/gtest.h"
+#include "paimon/common/fs/caching_file_system.h"
 #include "paimon/common/fs/resolving_file_system.h"
 #include "paimon/core/options/expire_config.h"
 #include "paimon/defs.h"
@@ -36,6 +37,7 @@ TEST(CoreOptionsTest, TestDefaultValue) {
     ASSERT_EQ(core_options.GetWriteFileFormat()->Identifier(), "parquet");
     ASSERT_TRUE(core_options.GetFileSystem());
     ASSERT_EQ(-1, core_options.GetBucket());
+    ASSERT_EQ(1, core_options.GetPostponeDefaultBucketNum());
     ASSERT_EQ(64 * 1024L, core_options.GetPageSize());
     ASSERT_EQ(256 * 1024 * 1024L, core_options.GetTargetFileSize());
     ASSERT_EQ(256 * 1024 * 1024L, core_options.GetBlobTargetFileSize());
@@ -48,18 +50,26 @@ TEST(CoreOptionsTest, TestDefaultValue) {
     ASSERT_EQ(8 * 1024 * 1024L, core_options.GetManifestTargetFileSize());
     ASSERT_EQ(16 * 1024 * 1024L, core_options.GetManifestFullCompactionThresholdSize());
     ASSERT_EQ(30, core_options.GetManifestMergeMinCount());
+    ASSERT_FALSE(core_options.PartitionStatisticsIndexEnabled());
     ASSERT_EQ(128 * 1024 * 1024L, core_options.GetSourceSplitTargetSize());
     ASSERT_EQ(4 * 1024 * 1024L, core_options.GetSourceSplitOpenFileCost());
     ASSERT_EQ(1024, core_options.GetReadBatchSize());
     ASSERT_EQ(1024, core_options.GetWriteBatchSize());
     ASSERT_EQ(256 * 1024 * 1024, core_options.GetWriteBufferSize());
+    ASSERT_FALSE(core_options.WriteAsyncFlushEnabled());
+    ASSERT_EQ(1, core_options.GetWriteAsyncFlushMaxInFlight());
+    ASSERT_EQ(0, core_options.GetWriteAsyncFlushMaxMemory());
+    ASSERT_FALSE(core_options.MetadataCacheEnabled());
+    ASSERT_EQ(1000, core_options.GetMetadataCacheHintTtl());
     ASSERT_EQ(std::numeric_limits<int64_t>::max(), core_options.GetCommitTimeout());
+    ASSERT_EQ(10 * 1000, core_options.GetContinuousDiscoveryInterval());
     ASSERT_EQ(10, core_options.GetCommitMaxRetries());
     ExpireConfig expire_config = core_options.GetExpireConfig();
     ASSERT_EQ(10, expire_config.GetSnapshotRetainMin());
     ASSERT_EQ(std::numeric_limits<int32_t>::max(), expire_config.GetSnapshotRetainMax());
     ASSERT_EQ(10, expire_config.GetSnapshotMaxDeletes());
     ASSERT_FALSE(expire_config.CleanEmptyDirectories());
+    ASSERT_EQ(16, expire_config.GetExpireParallelism());
     ASSERT_EQ(1 * 3600 * 1000L, expire_config.GetSnapshotTimeRetainMs());
     ASSERT_EQ(std::vector<std::string>(), core_options.GetSequenceField());
     ASSERT_TRUE(core_options.SequenceFieldSortOrderIsAscending());
@@ -87,6 +97,18 @@ TEST(CoreOptionsTest, TestDefaultValue) {
     ASSERT_FALSE(core_options.DataEvolutionEnabled());
     ASSERT_TRUE(core_options.LegacyPartitionNameEnabled());
     ASSERT_TRUE(core_options.GlobalIndexEnabled());
+    ASSERT_FALSE(core_options.SourceSplitKeyRangeEnabled());
+    ASSERT_EQ("", core_options.GetLookupCacheDir());
+    ASSERT_EQ(std::numeric_limits<int64_t>::max(), core_options.GetLookupCacheMaxDiskSize());
+    ASSERT_EQ(256 * 1024 * 1024, core_options.GetLookupCacheMaxMemorySize());
+    ASSERT_EQ(64 * 1024, core_options.GetLookupCacheBlockSize());
+    ASSERT_TRUE(core_options.LookupCacheBloomFilterEnabled());
+    ASSERT_DOUBLE_EQ(0.05, core_options.GetLookupCacheBloomFilterFpp());
+    ASSERT_FALSE(core_options.BlockCacheEnabled());
+    ASSERT_EQ("", core_options.GetBlockCacheDir());
+    ASSERT_EQ(1024 * 1024, core_options.GetBlockCacheBlockSize());
+    ASSERT_EQ(256 * 1024 * 1024, core_options.GetBlockCacheMaxMemorySize());
+    ASSERT_EQ(10LL * 1024 * 1024 * 1024, core_options.GetBlockCacheMaxDiskSize());
 }
 
 TEST(CoreOptionsTest, TestFromMap) {
@@ -95,6 +117,7 @@ TEST(CoreOptionsTest, TestFromMap) {
         {Options::FILE_FORMAT, "ORC"},
         {Options::MANIFEST_FORMAT, "avRo"},
         {Options::BUCKET, "3"},
+        {Options::POSTPONE_DEFAULT_BUCKET_NUM, "4"},
         {Options::PAGE_SIZE, "128 kb"},
         {Options::TARGET_FILE_SIZE, "512MB"},
         {Options::BLOB_TARGET_FILE_SIZE, "1G"},
@@ -102,12 +125,19 @@ TEST(CoreOptionsTest, TestFromMap) {
         {Options::MANIFEST_TARGET_FILE_SIZE, "16MB"},
         {Options::MANIFEST_FULL_COMPACTION_FILE_SIZE, "32MB"},
         {Options::MANIFEST_MERGE_MIN_COUNT, "2"},
+        {Options::PARTITION_STATISTICS_INDEX_ENABLED, "true"},
         {Options::SOURCE_SPLIT_TARGET_SIZE, "24MB"},
         {Options::SOURCE_SPLIT_OPEN_FILE_COST, "32MB"},
         {Options::READ_BATCH_SIZE, "2048"},
         {Options::WRITE_BUFFER_SIZE, "16MB"},
+        {Options::WRITE_ASYNC_FLUSH_ENABLED, "true"},
+        {Options::WRITE_ASYNC_FLUSH_MAX_IN_FLIGHT, "3"},
+        {Options::WRITE_ASYNC_FLUSH_MAX_MEMORY, "64MB"},
         {Options::WRITE_BATCH_SIZE, "1234"},
+        {Options::METADATA_CACHE_ENABLED, "true"},
+        {Options::METADATA_CACHE_HINT_TTL, "5s"},
         {Options::COMMIT_TIMEOUT, "120s"},
+        {Options::CONTINUOUS_DISCOVERY_INTERVAL, "500ms"},
         {Options::COMMIT_MAX_RETRIES, "20"},
         {Options::SCAN_SNAPSHOT_ID, "5"},
         {Options::SNAPSHOT_NUM_RETAINED_MIN, "15"},
@@ -115,6 +145,7 @@ TEST(CoreOptionsTest, TestFromMap) {
         {Options::SNAPSHOT_EXPIRE_LIMIT, "20"},
         {Options::SNAPSHOT_TIME_RETAINED, "2h"},
         {Options::SNAPSHOT_CLEAN_EMPTY_DIRECTORIES, "true"},
+        {Options::SNAPSHOT_EXPIRE_PARALLELISM, "4"},
         {Options::SEQUENCE_FIELD, "f1,f2,f3"},
         {Options::SEQUENCE_FIELD_SORT_ORDER, "descending"},
         {Options::MERGE_ENGINE, "partial-update"},
@@ -144,6 +175,13 @@ TEST(CoreOptionsTest, TestFromMap) {
         {Options::DATA_EVOLUTION_ENABLED, "true"},
         {Options::PARTITION_GENERATE_LEGACY_NAME, "false"},
         {Options::GLOBAL_INDEX_ENABLED, "false"},
+        {Options::SOURCE_SPLIT_KEY_RANGE_ENABLED, "true"},
+        {Options::LOOKUP_CACHE_DIR, "/tmp/lookup"},
+        {Options::LOOKUP_CACHE_MAX_DISK_SIZE, "1 gb"},
+        {Options::LOOKUP_CACHE_MAX_MEMORY_SIZE, "32 mb"},
+        {Options::LOOKUP_CACHE_BLOCK_SIZE, "16 kb"},
+        {Options::LOOKUP_CACHE_BLOOM_FILTER_ENABLED, "false"},
+        {Options::LOOKUP_CACHE_BLOOM_FILTER_FPP, "0.01"},
     };
 
     ASSERT_OK_AND_ASSIGN(CoreOptions core_options, CoreOptions::FromMap(options));
@@ -157,6 +195,7 @@ TEST(CoreOptionsTest, TestFromMap) {
     ASSERT_EQ(manifest_format->Identifier(), "avro");
 
     ASSERT_EQ(3, core_options.GetBucket());
+    ASSERT_EQ(4, core_options.GetPostponeDefaultBucketNum());
     ASSERT_EQ(128 * 1024L, core_options.GetPageSize());
     ASSERT_EQ(512 * 1024 * 1024L, core_options.GetTargetFileSize());
     ASSERT_EQ(1024 * 1024 * 1024L, core_options.GetBlobTargetFileSize());
@@ -164,12 +203,19 @@ TEST(CoreOptionsTest, TestFromMap) {
     ASSERT_EQ(16 * 1024 * 1024L, core_options.GetManifestTargetFileSize());
     ASSERT_EQ(32 * 1024 * 1024L, core_options.GetManifestFullCompactionThresholdSize());
     ASSERT_EQ(2, core_options.GetManifestMergeMinCount());
+    ASSERT_TRUE(core_options.PartitionStatisticsIndexEnabled());
     ASSERT_EQ(24 * 1024 * 1024L, core_options.GetSourceSplitTargetSize());
     ASSERT_EQ(32 * 1024 * 1024L, core_options.GetSourceSplitOpenFileCost());
     ASSERT_EQ(2048, core_options.GetReadBatchSize());
     ASSERT_EQ(1234, core_options.GetWriteBatchSize());
     ASSERT_EQ(16 * 1024 * 1024, core_options.GetWriteBufferSize());
+    ASSERT_TRUE(core_options.WriteAsyncFlushEnabled());
+    ASSERT_EQ(3, core_options.GetWriteAsyncFlushMaxInFlight());
+    ASSERT_EQ(64 * 1024 * 1024, core_options.GetWriteAsyncFlushMaxMemory());
+    ASSERT_TRUE(core_options.MetadataCacheEnabled());
+    ASSERT_EQ(5 * 1000, core_options.GetMetadataCacheHintTtl());
     ASSERT_EQ(120 * 1000, core_options.GetCommitTimeout());
+    ASSERT_EQ(500, core_options.GetContinuousDiscoveryInterval());
     ASSERT_EQ(20, core_options.GetCommitMaxRetries());
     ASSERT_EQ(5, core_options.GetScanSnapshotId().value_or(-1));
     ExpireConfig expire_config = core_options.GetExpireConfig();
@@ -178,6 +224,7 @@ TEST(CoreOptionsTest, TestFromMap) {
     ASSERT_EQ(20, expire_config.GetSnapshotMaxDeletes());
     ASSERT_EQ(2 * 3600 * 1000L, expire_config.GetSnapshotTimeRetainMs());
     ASSERT_TRUE(expire_config.CleanEmptyDirectories());
+    ASSERT_EQ(4, expire_config.GetExpireParallelism());
     ASSERT_EQ(std::vector<std::string>({"f1", "f2", "f3"}), core_options.GetSequenceField());
     ASSERT_FALSE(core_options.SequenceFieldSortOrderIsAscending());
     ASSERT_EQ(MergeEngine::PARTIAL_UPDATE, core_options.GetMergeEngine());
@@ -212,6 +259,13 @@ TEST(CoreOptionsTest, TestFromMap) {
     ASSERT_TRUE(core_options.DataEvolutionEnabled());
     ASSERT_FALSE(core_options.LegacyPartitionNameEnabled());
     ASSERT_FALSE(core_options.GlobalIndexEnabled());
+    ASSERT_TRUE(core_options.SourceSplitKeyRangeEnabled());
+    ASSERT_EQ("/tmp/lookup", core_options.GetLookupCacheDir());
+    ASSERT_EQ(1024 * 1024 * 1024, core_options.GetLookupCacheMaxDiskSize());
+    ASSERT_EQ(32 * 1024 * 1024, core_options.GetLookupCacheMaxMemorySize());
+    ASSERT_EQ(16 * 1024, core_options.GetLookupCacheBlockSize());
+    ASSERT_FALSE(core_options.LookupCacheBloomFilterEnabled());
+    ASSERT_DOUBLE_EQ(0.01, core_options.GetLookupCacheBloomFilterFpp());
 }
 
 TEST(CoreOptionsTest, TestInvalidCase) {
@@ -227,6 +281,10 @@ TEST(CoreOptionsTest, TestInvalidCase) {
                         "invalid merge engine: invalid");
     ASSERT_NOK_WITH_MSG(CoreOptions::FromMap({{Options::CHANGELOG_PRODUCER, "invalid"}}),
                         "invalid changelog producer: invalid");
+    ASSERT_NOK_WITH_MSG(CoreOptions::FromMap({{Options::WRITE_ASYNC_FLUSH_MAX_IN_FLIGHT, "0"}}),
+                        "write.async-flush.max-in-flight must be at least 1, but is 0");
+    ASSERT_NOK_WITH_MSG(CoreOptions::FromMap({{Options::POSTPONE_DEFAULT_BUCKET_NUM, "0"}}),
+                        "postpone.default-bucket-num must be at least 1, but is 0");
 }
 
 TEST(CoreOptionsTest, TestCreateExternalPath) {
@@ -308,5 +366,31 @@ TEST(CoreOptionsTest, TestFileSystem) {
         ASSERT_TRUE(std::dynamic_pointer_cast<LocalFileSystem>(
             typed_fs->GetRealFileSystem("oss:///tmp/").value_or(nullptr)));
     }
+    {
+        auto mock_fs = std::make_shared<MockFileSystem>();
+        std::map<std::string, std::string> options = {
+            {Options::BLOCK_CACHE_ENABLED, "true"},
+            {Options::BLOCK_CACHE_BLOCK_SIZE, "64kb"},
+            {Options::BLOCK_CACHE_MAX_MEMORY_SIZE, "1mb"},
+            {Options::BLOCK_CACHE_MAX_DISK_SIZE, "16mb"},
+        };
+        ASSERT_OK_AND_ASSIGN(CoreOptions core_options,
+                             CoreOptions::FromMap(options, /*fs_scheme_to_identifier_map=*/{},
+                                                  /*specified_file_system=*/mock_fs));
+        ASSERT_TRUE(core_options.BlockCacheEnabled());
+        ASSERT_EQ(64 * 1024, core_options.GetBlockCacheBlockSize());
+        ASSERT_EQ(1024 * 1024, core_options.GetBlockCacheMaxMemorySize());
+        ASSERT_EQ(16 * 1024 * 1024, core_options.GetBlockCacheMaxDiskSize());
+        auto typed_fs = std::dynamic_pointer_cast<CachingFileSystem>(core_options.GetFileSystem());
+        ASSERT_TRUE(typed_fs);
+        ASSERT_TRUE(std::dynamic_pointer_cast<MockFileSystem>(typed_fs->fs_));
+        ASSERT_EQ(64 * 1024, typed_fs->GetCache()->BlockSize());
+
+        // the block cache is shared by the tables with the same dir and block size
+        ASSERT_OK_AND_ASSIGN(CoreOptions other_options, CoreOptions::FromMap(options));
+        auto other_fs = std::dynamic_pointer_cast<CachingFileSystem>(other_options.GetFileSystem());
+        ASSERT_TRUE(other_fs);
+        ASSERT_EQ(typed_fs->GetCache(), other_fs->GetCache());
+    }
 }
 }  // namespace paimon::test
@@ -20,9 +20,11 @@
 #include <memory>
 #include <utility>
 
+#include "arrow/array/array_base.h"
 #include "arrow/c/abi.h"
 #include "arrow/c/bridge.h"
 #include "arrow/c/helpers.h"
+#include "paimon/common/reader/arrow_batch_reader.h"
 #include "paimon/common/reader/reader_utils.h"
 #include "paimon/core/deletionvectors/deletion_vector.h"
 #include "paimon/memory/memory_pool.h"
@@ -35,7 +37,7 @@
 namespace paimon {
 class Metrics;
 
-class ApplyDeletionVectorBatchReader : public BatchReader {
+class ApplyDeletionVectorBatchReader : public ArrowBatchReader {
  public:
     ApplyDeletionVectorBatchReader(std::unique_ptr<FileBatchReader>&& reader,
                                    PAIMON_UNIQUE_PTR<DeletionVector>&& deletion_vector)
@@ -48,18 +50,17 @@ class ApplyDeletionVectorBatchReader : public BatchReader {
             "paimon inner reader ApplyDeletionVectorBatchReader should use NextBatchWithBitmap");
     }
 
-    Result<ReadBatchWithBitmap> NextBatchWithBitmap() override {
+    Result<ArrowBatchWithBitmap> NextArrowBatchWithBitmap() override {
         while (true) {
-            PAIMON_ASSIGN_OR_RAISE(ReadBatchWithBitmap batch_with_bitmap,
-                                   reader_->NextBatchWithBitmap());
-            if (BatchReader::IsEofBatch(batch_with_bitmap)) {
+            PAIMON_ASSIGN_OR_RAISE(ArrowBatchWithBitmap batch_with_bitmap,
+                                   NextArrowBatchOf(reader_.get()));
+            if (IsEofArrowBatch(batch_with_bitmap)) {
                 return batch_with_bitmap;
             }
-            auto& [batch, bitmap] = batch_with_bitmap;
-            PAIMON_ASSIGN_OR_RAISE(RoaringBitmap32 valid_bitmap, Filter(batch.first->length));
+            auto& [array, bitmap] = batch_with_bitmap;
+            PAIMON_ASSIGN_OR_RAISE(RoaringBitmap32 valid_bitmap, Filter(array->length()));
             bitmap &= valid_bitmap;
             if (bitmap.IsEmpty()) {
-                ReaderUtils::ReleaseReadBatch(std::move(batch));
                 continue;
             }
             return batch_with_bitmap;
@@ -66,7 +66,7 @@ GlobalIndexEvaluatorImpl::EvaluateVectorSearch(
         return Status::Invalid("Vector search cannot have multiple global indexes");
     }
     const auto& vector_search_reader = readers[0];
-    if (predicate_result && vector_search->pre_filter != nullptr) {
+    if (predicate_result && vector_search->HasPreFilter()) {
         return Status::Invalid("Predicate result and pre_filter in VectorSearch conflict");
     }
     auto final_vector_search = vector_search;
@@ -80,10 +80,9 @@ GlobalIndexEvaluatorImpl::EvaluateVectorSearch(
         PAIMON_ASSIGN_OR_RAISE(const RoaringBitmap64* bitmap,
                                bitmap_global_index_result->GetBitmap());
         assert(bitmap);
-        final_vector_search = vector_search->ReplacePreFilter(
-            [bitmap_global_index_result, bitmap](int64_t row_id) -> bool {
-                return bitmap->Contains(row_id);
-            });
+        // pass the bitmap natively, it shares the ownership of the predicate result
+        final_vector_search = vector_search->ReplacePreFilterBitmap(
+            std::shared_ptr<const RoaringBitmap64>(bitmap_global_index_result, bitmap));
     }
     PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<GlobalIndexResult> vector_search_result,
                            vector_search_reader->VisitVectorSearch(final_vector_search));
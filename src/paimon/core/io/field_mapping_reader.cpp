@@ -111,21 +111,26 @@ Result<std::shared_ptr<arrow::Array>> FieldMappingReader::CastNonPartitionArrayI
 }
 
 Result<BatchReader::ReadBatchWithBitmap> FieldMappingReader::NextBatchWithBitmap() {
-    PAIMON_ASSIGN_OR_RAISE(ReadBatchWithBitmap non_partition_result_with_bitmap,
-                           reader_->NextBatchWithBitmap());
+    if (!need_mapping_ && !need_casting_) {
+        return reader_->NextBatchWithBitmap();
+    }
+    PAIMON_ASSIGN_OR_RAISE(ArrowBatchWithBitmap batch_with_bitmap, NextArrowBatchWithBitmap());
+    return ExportArrowBatch(std::move(batch_with_bitmap));
+}
+
+Result<ArrowBatchReader::ArrowBatchWithBitmap> FieldMappingReader::NextArrowBatchWithBitmap() {
+    PAIMON_ASSIGN_OR_RAISE(ArrowBatchWithBitmap non_partition_result_with_bitmap,
+                           NextArrowBatchOf(reader_.get()));
     if (!need_mapping_ && !need_casting_) {
         return non_partition_result_with_bitmap;
     }
-    if (BatchReader::IsEofBatch(non_partition_result_with_bitmap)) {
+    if (IsEofArrowBatch(non_partition_result_with_bitmap)) {
         // read finish
         partition_array_.reset();
         non_exist_array_.reset();
         return non_partition_result_with_bitmap;
     }
-    auto& [non_partition_result, bitmap] = non_partition_result_with_bitmap;
-    auto& [c_array, c_schema] = non_partition_result;
-    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> non_partition_array,
-                                      arrow::ImportArray(c_array.get(), c_schema.get()));
+    auto& [non_partition_array, bitmap] = non_partition_result_with_bitmap;
 
     arrow::ArrayVector target_array(field_count_);
     std::vector<std::string> target_field_names(field_count_);
@@ -162,12 +167,7 @@ Result<BatchReader::ReadBatchWithBitmap> FieldMappingReader::NextBatchWithBitmap
     // construct target array
     PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> arrow_array,
                                       arrow::StructArray::Make(target_array, target_field_names));
-    std::unique_ptr<ArrowArray> target_c_arrow_array = std::make_unique<ArrowArray>();
-    std::unique_ptr<ArrowSchema> target_c_schema = std::make_unique<ArrowSchema>();
-    PAIMON_RETURN_NOT_OK_FROM_ARROW(
-        arrow::ExportArray(*arrow_array, target_c_arrow_array.get(), target_c_schema.get()));
-    auto target_batch = std::make_pair(std::move(target_c_arrow_array), std::move(target_c_schema));
-    return std::make_pair(std::move(target_batch), std::move(bitmap));
+    return std::make_pair(std::move(arrow_array), std::move(bitmap));
 }
 
 Result<std::shared_ptr<arrow::Array>> FieldMappingReader::GenerateSinglePartitionArray(
@@ -27,6 +27,7 @@
 #include "arrow/c/abi.h"
 #include "arrow/c/bridge.h"
 #include "paimon/common/data/binary_row.h"
+#include "paimon/common/reader/arrow_batch_reader.h"
 #include "paimon/common/utils/arrow/mem_utils.h"
 #include "paimon/core/partition/partition_info.h"
 #include "paimon/core/utils/field_mapping.h"
@@ -44,7 +45,7 @@ class MemoryPool;
 class Metrics;
 struct FieldMapping;
 
-class FieldMappingReader : public BatchReader {
+class FieldMappingReader : public ArrowBatchReader {
  public:
     FieldMappingReader(int32_t field_count, std::unique_ptr<BatchReader>&& reader,
                        const BinaryRow& partition, std::unique_ptr<FieldMapping>&& mapping,
@@ -57,6 +58,8 @@ class FieldMappingReader : public BatchReader {
 
     Result<ReadBatchWithBitmap> NextBatchWithBitmap() override;
 
+    Result<ArrowBatchWithBitmap> NextArrowBatchWithBitmap() override;
+
     std::shared_ptr<Metrics> GetReaderMetrics() const override {
         return reader_->GetReaderMetrics();
     }
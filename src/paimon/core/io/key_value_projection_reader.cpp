@@ -20,6 +20,8 @@
 #include <utility>
 
 #include "arrow/c/abi.h"
+#include "paimon/common/metrics/metrics_impl.h"
+#include "paimon/common/metrics/scoped_timer.h"
 #include "paimon/core/io/key_value_projection_consumer.h"
 #include "paimon/core/key_value.h"
 
@@ -48,12 +50,15 @@ KeyValueProjectionReader::KeyValueProjectionReader(
         projection_consumer)
     : batch_size_(batch_size),
       sort_merge_reader_(std::move(sort_merge_reader)),
-      key_value_consumer_(std::move(projection_consumer)) {}
+      key_value_consumer_(std::move(projection_consumer)),
+      metrics_(std::make_shared<MetricsImpl>()),
+      sort_merge_latency_(metrics_->GetOrCreateHistogram(SORT_MERGE_DURATION)) {}
 
 Result<BatchReader::ReadBatch> KeyValueProjectionReader::NextBatch() {
     int32_t cur_batch_size = 0;
     std::vector<KeyValue> key_value_vec;
     key_value_vec.reserve(batch_size_);
+    ScopedTimer timer(sort_merge_latency_.get());
     while (!read_finished_ && cur_batch_size < batch_size_) {
         if (iterator_ == nullptr) {
             PAIMON_ASSIGN_OR_RAISE(iterator_, sort_merge_reader_->NextBatch());
@@ -72,6 +77,7 @@ Result<BatchReader::ReadBatch> KeyValueProjectionReader::NextBatch() {
         key_value_vec.push_back(std::move(iterator_->Next()));
         cur_batch_size++;
     }
+    timer.Stop();
     if (cur_batch_size > 0) {
         return key_value_consumer_->NextBatch(key_value_vec);
     } else {
@@ -80,4 +86,11 @@ Result<BatchReader::ReadBatch> KeyValueProjectionReader::NextBatch() {
     }
 }
 
+std::shared_ptr<Metrics> KeyValueProjectionReader::GetReaderMetrics() const {
+    auto metrics = std::make_shared<MetricsImpl>();
+    metrics->Merge(sort_merge_reader_->GetReaderMetrics());
+    metrics->Merge(metrics_);
+    return metrics;
+}
+
 }  // namespace paimon
@@ -31,13 +31,19 @@ class Schema;
 }  // namespace arrow
 
 namespace paimon {
+class Histogram;
 class MemoryPool;
 class Metrics;
+class MetricsImpl;
 struct KeyValue;
 
 // Serial iterate KeyValue from SortMergeReader and convert KeyValue to arrow array
 class KeyValueProjectionReader : public BatchReader {
  public:
+    /// Histogram of the latencies in microseconds to sort merge the key values of a batch,
+    /// excluding the projection to arrow array.
+    static constexpr char SORT_MERGE_DURATION[] = "sortMergeBatchDuration";
+
     static Result<std::unique_ptr<KeyValueProjectionReader>> Create(
         std::unique_ptr<SortMergeReader>&& sort_merge_reader,
         const std::shared_ptr<arrow::Schema>& target_schema,
@@ -46,9 +52,7 @@ class KeyValueProjectionReader : public BatchReader {
 
     Result<ReadBatch> NextBatch() override;
 
-    std::shared_ptr<Metrics> GetReaderMetrics() const override {
-        return sort_merge_reader_->GetReaderMetrics();
-    }
+    std::shared_ptr<Metrics> GetReaderMetrics() const override;
 
     void Close() override {
         iterator_.reset();
@@ -68,5 +72,7 @@ class KeyValueProjectionReader : public BatchReader {
     std::unique_ptr<SortMergeReader> sort_merge_reader_;
     std::unique_ptr<SortMergeReader::Iterator> iterator_;
     std::unique_ptr<RowToArrowArrayConverter<KeyValue, BatchReader::ReadBatch>> key_value_consumer_;
+    std::shared_ptr<MetricsImpl> metrics_;
+    std::shared_ptr<Histogram> sort_merge_latency_;
 };
 }  // namespace paimon
@@ -44,6 +44,7 @@
 #include "paimon/core/mergetree/compact/sort_merge_reader_with_min_heap.h"
 #include "paimon/core/utils/fields_comparator.h"
 #include "paimon/memory/memory_pool.h"
+#include "paimon/metrics.h"
 #include "paimon/status.h"
 #include "paimon/testing/mock/mock_file_batch_reader.h"
 #include "paimon/testing/utils/read_result_collector.h"
@@ -136,6 +137,13 @@ class KeyValueProjectionReaderTest : public testing::Test,
                     << sorted_result->ToString() << std::endl
                     << sorted_expected->ToString();
             }
+            if (!multi_thread_row_to_batch) {
+                // each NextBatch() including the eof one records the sort merge latency
+                ASSERT_OK_AND_ASSIGN(HistogramStats stats,
+                                     projection_reader->GetReaderMetrics()->GetHistogram(
+                                         KeyValueProjectionReader::SORT_MERGE_DURATION));
+                ASSERT_GT(stats.count, 1);
+            }
             projection_reader->Close();
             // test reserve and accumulate
             if (!multi_thread_row_to_batch) {
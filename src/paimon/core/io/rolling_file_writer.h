@@ -22,9 +22,11 @@
 
 #include "arrow/c/bridge.h"
 #include "paimon/common/metrics/metrics_impl.h"
+#include "paimon/common/metrics/scoped_timer.h"
 #include "paimon/core/io/file_writer.h"
 #include "paimon/core/io/single_file_writer.h"
 #include "paimon/core/key_value.h"
+#include "paimon/core/operation/metrics/writer_metrics.h"
 #include "paimon/metrics.h"
 #include "paimon/record_batch.h"
 
@@ -155,10 +157,15 @@ Status RollingFileWriter<T, R>::CloseCurrentWriter() {
         return Status::OK();
     }
     std::shared_ptr<Metrics> current_metrics = current_writer_->GetMetrics();
+    ScopedTimer close_timer(metrics_.get(), WriterMetrics::FILE_CLOSE_DURATION);
     PAIMON_RETURN_NOT_OK(current_writer_->Close());
+    close_timer.Stop();
     PAIMON_ASSIGN_OR_RAISE(auto abort_executor, current_writer_->GetAbortExecutor());
     closed_writers_.push_back(abort_executor);
+    // the result of a data file writer holds the stats extracted from the written file
+    ScopedTimer stats_timer(metrics_.get(), WriterMetrics::FILE_STATS_EXTRACT_DURATION);
     PAIMON_ASSIGN_OR_RAISE(R result, current_writer_->GetResult());
+    stats_timer.Stop();
     results_.push_back(result);
     current_writer_.reset();
     if (metrics_) {
@@ -0,0 +1,221 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/manifest/partition_statistics_index.h"
+
+#include <unordered_map>
+#include <utility>
+
+#include "fmt/format.h"
+#include "paimon/common/io/memory_segment_output_stream.h"
+#include "paimon/common/memory/memory_segment_utils.h"
+#include "paimon/common/utils/path_util.h"
+#include "paimon/common/utils/serialization_utils.h"
+#include "paimon/core/manifest/manifest_entry.h"
+#include "paimon/core/manifest/manifest_file.h"
+#include "paimon/core/manifest/manifest_file_meta.h"
+#include "paimon/core/utils/file_store_path_factory.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/io/byte_array_input_stream.h"
+#include "paimon/io/data_input_stream.h"
+#include "paimon/memory/bytes.h"
+#include "paimon/memory/memory_pool.h"
+
+namespace paimon {
+namespace {
+Status ReadManifest(const ManifestFile* manifest_file, const std::string& file_name,
+                    std::unordered_map<BinaryRow, PartitionEntry>* statistics,
+                    std::vector<BinaryRow>* partitions) {
+    std::vector<ManifestEntry> entries;
+    PAIMON_RETURN_NOT_OK(manifest_file->Read(file_name, /*filter=*/nullptr, &entries));
+    if (statistics) {
+        PAIMON_RETURN_NOT_OK(PartitionEntry::Merge(entries, statistics));
+    }
+    std::unordered_map<BinaryRow, bool> seen;
+    for (const auto& entry : entries) {
+        if (seen.emplace(entry.Partition(), true).second) {
+            partitions->push_back(entry.Partition());
+        }
+    }
+    return Status::OK();
+}
+}  // namespace
+
+Result<PartitionStatisticsIndex> PartitionStatisticsIndex::Build(
+    const std::optional<PartitionStatisticsIndex>& previous,
+    const std::vector<ManifestFileMeta>& previous_manifests,
+    const std::vector<PartitionEntry>& delta_statistics,
+    const std::vector<ManifestFileMeta>& manifests, const ManifestFile* manifest_file) {
+    std::unordered_map<BinaryRow, PartitionEntry> statistics;
+    std::unordered_map<std::string, std::vector<BinaryRow>> known_manifests;
+    if (previous) {
+        for (const auto& partition : previous.value().partitions_) {
+            statistics.emplace(partition.Partition(), partition);
+        }
+        for (const auto& [file_name, ordinals] : previous.value().manifest_partitions_) {
+            auto& partitions = known_manifests[file_name];
+            for (int32_t ordinal : ordinals) {
+                partitions.push_back(previous.value().partitions_[ordinal].Partition());
+            }
+        }
+    } else {
+        // bootstrap from all the manifests of the previous snapshot
+        for (const auto& meta : previous_manifests) {
+            PAIMON_RETURN_NOT_OK(ReadManifest(manifest_file, meta.FileName(), &statistics,
+                                              &known_manifests[meta.FileName()]));
+        }
+    }
+    for (const auto& delta : delta_statistics) {
+        auto iter = statistics.find(delta.Partition());
+        if (iter == statistics.end()) {
+            statistics.emplace(delta.Partition(), delta);
+        } else {
+            iter->second = iter->second.Merge(delta);
+        }
+    }
+
+    std::vector<PartitionEntry> partitions;
+    std::unordered_map<BinaryRow, int32_t> partition_ordinals;
+    std::map<std::string, std::vector<int32_t>> manifest_partitions;
+    for (const auto& meta : manifests) {
+        std::vector<BinaryRow> manifest_rows;
+        auto known_iter = known_manifests.find(meta.FileName());
+        if (known_iter != known_manifests.end()) {
+            manifest_rows = known_iter->second;
+        } else {
+            PAIMON_RETURN_NOT_OK(ReadManifest(manifest_file, meta.FileName(),
+                                              /*statistics=*/nullptr, &manifest_rows));
+        }
+        auto& ordinals = manifest_partitions[meta.FileName()];
+        for (const auto& partition : manifest_rows) {
+            auto ordinal_iter = partition_ordinals.find(partition);
+            if (ordinal_iter == partition_ordinals.end()) {
+                auto statistics_iter = statistics.find(partition);
+                if (statistics_iter == statistics.end()) {
+                    return Status::Invalid(
+                        fmt::format("partition of manifest {} is missing in partition statistics",
+                                    meta.FileName()));
+                }
+                ordinal_iter =
+                    partition_ordinals.emplace(partition, static_cast<int32_t>(partitions.size()))
+                        .first;
+                partitions.push_back(statistics_iter->second);
+            }
+            ordinals.push_back(ordinal_iter->second);
+        }
+    }
+    return PartitionStatisticsIndex(std::move(partitions), std::move(manifest_partitions));
+}
+
+Result<std::string> PartitionStatisticsIndex::Serialize(
+    const std::shared_ptr<MemoryPool>& pool) const {
+    MemorySegmentOutputStream out(MemorySegmentOutputStream::DEFAULT_SEGMENT_SIZE, pool);
+    out.WriteValue<int8_t>(VERSION_1);
+    out.WriteValue<int32_t>(static_cast<int32_t>(partitions_.size()));
+    for (const auto& partition : partitions_) {
+        PAIMON_RETURN_NOT_OK(SerializationUtils::SerializeBinaryRow(partition.Partition(), &out));
+        out.WriteValue<int64_t>(partition.RecordCount());
+        out.WriteValue<int64_t>(partition.FileSizeInBytes());
+        out.WriteValue<int64_t>(partition.FileCount());
+        out.WriteValue<int64_t>(partition.LastFileCreationTime());
+    }
+    out.WriteValue<int32_t>(static_cast<int32_t>(manifest_partitions_.size()));
+    for (const auto& [file_name, ordinals] : manifest_partitions_) {
+        out.WriteString(file_name);
+        out.WriteValue<int32_t>(static_cast<int32_t>(ordinals.size()));
+        for (int32_t ordinal : ordinals) {
+            out.WriteValue<int32_t>(ordinal);
+        }
+    }
+    PAIMON_UNIQUE_PTR<Bytes> bytes =
+        MemorySegmentUtils::CopyToBytes(out.Segments(), 0, out.CurrentSize(), pool.get());
+    return std::string(bytes->data(), bytes->size());
+}
+
+Result<PartitionStatisticsIndex> PartitionStatisticsIndex::Deserialize(
+    const std::string& bytes, const std::shared_ptr<MemoryPool>& pool) {
+    auto input_stream = std::make_shared<ByteArrayInputStream>(bytes.data(), bytes.size());
+    DataInputStream in(input_stream);
+    PAIMON_ASSIGN_OR_RAISE(int8_t version, in.ReadValue<int8_t>());
+    if (version != VERSION_1) {
+        return Status::Invalid(
+            fmt::format("unknown partition statistics index version {}", version));
+    }
+    PAIMON_ASSIGN_OR_RAISE(int32_t num_partitions, in.ReadValue<int32_t>());
+    if (num_partitions < 0) {
+        return Status::Invalid(
+            fmt::format("invalid partition statistics index, num partitions {}", num_partitions));
+    }
+    std::vector<PartitionEntry> partitions;
+    partitions.reserve(num_partitions);
+    for (int32_t i = 0; i < num_partitions; i++) {
+        PAIMON_ASSIGN_OR_RAISE(BinaryRow partition,
+                               SerializationUtils::DeserializeBinaryRow(&in, pool.get()));
+        PAIMON_ASSIGN_OR_RAISE(int64_t record_count, in.ReadValue<int64_t>());
+        PAIMON_ASSIGN_OR_RAISE(int64_t file_size_in_bytes, in.ReadValue<int64_t>());
+        PAIMON_ASSIGN_OR_RAISE(int64_t file_count, in.ReadValue<int64_t>());
+        PAIMON_ASSIGN_OR_RAISE(int64_t last_file_creation_time, in.ReadValue<int64_t>());
+        partitions.emplace_back(partition, record_count, file_size_in_bytes, file_count,
+                                last_file_creation_time);
+    }
+    PAIMON_ASSIGN_OR_RAISE(int32_t num_manifests, in.ReadValue<int32_t>());
+    std::map<std::string, std::vector<int32_t>> manifest_partitions;
+    for (int32_t i = 0; i < num_manifests; i++) {
+        PAIMON_ASSIGN_OR_RAISE(std::string file_name, in.ReadString());
+        PAIMON_ASSIGN_OR_RAISE(int32_t num_ordinals, in.ReadValue<int32_t>());
+        auto& ordinals = manifest_partitions[file_name];
+        for (int32_t j = 0; j < num_ordinals; j++) {
+            PAIMON_ASSIGN_OR_RAISE(int32_t ordinal, in.ReadValue<int32_t>());
+            if (ordinal < 0 || ordinal >= num_partitions) {
+                return Status::Invalid(fmt::format(
+                    "invalid partition statistics index, partition ordinal {} of manifest {}",
+                    ordinal, file_name));
+            }
+            ordinals.push_back(ordinal);
+        }
+    }
+    return PartitionStatisticsIndex(std::move(partitions), std::move(manifest_partitions));
+}
+
+bool PartitionStatisticsIndex::operator==(const PartitionStatisticsIndex& other) const {
+    if (this == &other) {
+        return true;
+    }
+    return partitions_ == other.partitions_ && manifest_partitions_ == other.manifest_partitions_;
+}
+
+Result<std::string> PartitionStatisticsIndexFile::Write(
+    const PartitionStatisticsIndex& index) const {
+    PAIMON_ASSIGN_OR_RAISE(std::string bytes, index.Serialize(pool_));
+    std::string path = path_factory_->NewPartitionStatisticsFile();
+    PAIMON_RETURN_NOT_OK(fs_->WriteFile(path, bytes, /*overwrite=*/false));
+    return PathUtil::GetName(path);
+}
+
+Result<PartitionStatisticsIndex> PartitionStatisticsIndexFile::Read(
+    const std::string& file_name) const {
+    std::string bytes;
+    PAIMON_RETURN_NOT_OK(fs_->ReadFile(path_factory_->ToManifestFilePath(file_name), &bytes));
+    return PartitionStatisticsIndex::Deserialize(bytes, pool_);
+}
+
+void PartitionStatisticsIndexFile::DeleteQuietly(const std::string& file_name) const {
+    auto status = fs_->Delete(path_factory_->ToManifestFilePath(file_name));
+    // delete quietly will ignore any status error
+    (void)status;
+}
+
+}  // namespace paimon
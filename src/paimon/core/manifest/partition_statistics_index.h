@@ -0,0 +1,129 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "paimon/core/manifest/partition_entry.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace paimon {
+class FileStorePathFactory;
+class FileSystem;
+class ManifestFile;
+class ManifestFileMeta;
+class MemoryPool;
+
+/// Statistics of all partitions of a snapshot, together with the partitions referenced by each
+/// data manifest of the snapshot.
+///
+/// Listing partitions reads this single file instead of every manifest, and planning with a
+/// partition filter skips the manifests none of whose partitions pass the filter. Partitions
+/// whose files are all deleted are kept as long as a manifest still references them.
+///
+/// <pre>
+/// Partition statistics index format (big endian)
+/// +-------------------------------------------------+
+/// | version (1 byte)                                |
+/// +-------------------------------------------------+
+/// | num partitions (4 bytes int)                    |
+/// +-------------------------------------------------+
+/// | partition (binary row), record count, file size |
+/// | file count, last file creation time (8 bytes    |
+/// | long each), repeated for each partition         |
+/// +-------------------------------------------------+
+/// | num manifests (4 bytes int)                     |
+/// +-------------------------------------------------+
+/// | manifest file name (string), num partitions     |
+/// | (4 bytes int), partition ordinals (4 bytes int  |
+/// | each), repeated for each manifest               |
+/// +-------------------------------------------------+
+/// </pre>
+class PartitionStatisticsIndex {
+ public:
+    static constexpr int8_t VERSION_1 = 1;
+
+    PartitionStatisticsIndex(std::vector<PartitionEntry>&& partitions,
+                             std::map<std::string, std::vector<int32_t>>&& manifest_partitions)
+        : partitions_(std::move(partitions)),
+          manifest_partitions_(std::move(manifest_partitions)) {}
+
+    /// Builds the index of a new snapshot.
+    ///
+    /// @param previous The index of the previous snapshot, null if the previous snapshot has no
+    /// index or there is no previous snapshot.
+    /// @param previous_manifests The data manifests of the previous snapshot, read to bootstrap
+    /// the statistics when `previous` is null.
+    /// @param delta_statistics Statistics of the files committed by the new snapshot.
+    /// @param manifests The data manifests of the new snapshot, the ones not indexed by
+    /// `previous` are read to collect their partitions.
+    static Result<PartitionStatisticsIndex> Build(
+        const std::optional<PartitionStatisticsIndex>& previous,
+        const std::vector<ManifestFileMeta>& previous_manifests,
+        const std::vector<PartitionEntry>& delta_statistics,
+        const std::vector<ManifestFileMeta>& manifests, const ManifestFile* manifest_file);
+
+    Result<std::string> Serialize(const std::shared_ptr<MemoryPool>& pool) const;
+
+    static Result<PartitionStatisticsIndex> Deserialize(const std::string& bytes,
+                                                        const std::shared_ptr<MemoryPool>& pool);
+
+    const std::vector<PartitionEntry>& Partitions() const {
+        return partitions_;
+    }
+
+    /// @return Ordinals in `Partitions()` of the partitions referenced by each manifest.
+    const std::map<std::string, std::vector<int32_t>>& ManifestPartitions() const {
+        return manifest_partitions_;
+    }
+
+    bool operator==(const PartitionStatisticsIndex& other) const;
+
+ private:
+    std::vector<PartitionEntry> partitions_;
+    std::map<std::string, std::vector<int32_t>> manifest_partitions_;
+};
+
+/// Reads and writes `PartitionStatisticsIndex` files, which live in the manifest directory.
+class PartitionStatisticsIndexFile {
+ public:
+    PartitionStatisticsIndexFile(const std::shared_ptr<FileSystem>& fs,
+                                 const std::shared_ptr<FileStorePathFactory>& path_factory,
+                                 const std::shared_ptr<MemoryPool>& pool)
+        : fs_(fs), path_factory_(path_factory), pool_(pool) {}
+
+    /// @return The file name of the written index.
+    Result<std::string> Write(const PartitionStatisticsIndex& index) const;
+
+    Result<PartitionStatisticsIndex> Read(const std::string& file_name) const;
+
+    void DeleteQuietly(const std::string& file_name) const;
+
+ private:
+    std::shared_ptr<FileSystem> fs_;
+    std::shared_ptr<FileStorePathFactory> path_factory_;
+    std::shared_ptr<MemoryPool> pool_;
+};
+
+}  // namespace paimon
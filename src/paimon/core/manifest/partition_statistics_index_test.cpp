@@ -0,0 +1,152 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/manifest/partition_statistics_index.h"
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/api.h"
+#include "gtest/gtest.h"
+#include "paimon/core/manifest/manifest_file_meta.h"
+#include "paimon/core/stats/simple_stats.h"
+#include "paimon/core/utils/file_store_path_factory.h"
+#include "paimon/fs/local/local_file_system.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/testing/utils/binary_row_generator.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+class PartitionStatisticsIndexTest : public testing::Test {
+ public:
+    void SetUp() override {
+        pool_ = GetDefaultPool();
+    }
+
+    BinaryRow Partition(int32_t value) const {
+        return BinaryRowGenerator::GenerateRow({value}, pool_.get());
+    }
+
+    static ManifestFileMeta Manifest(const std::string& file_name) {
+        return ManifestFileMeta(file_name, /*file_size=*/100, /*num_added_files=*/1,
+                                /*num_deleted_files=*/0, SimpleStats::EmptyStats(),
+                                /*schema_id=*/0, /*min_bucket=*/0, /*max_bucket=*/0,
+                                /*min_level=*/0, /*max_level=*/0, /*min_row_id=*/std::nullopt,
+                                /*max_row_id=*/std::nullopt);
+    }
+
+    PartitionStatisticsIndex CreateIndex() const {
+        std::vector<PartitionEntry> partitions = {
+            PartitionEntry(Partition(1), /*record_count=*/10, /*file_size_in_bytes=*/100,
+                           /*file_count=*/2, /*last_file_creation_time=*/1000),
+            PartitionEntry(Partition(2), /*record_count=*/5, /*file_size_in_bytes=*/50,
+                           /*file_count=*/1, /*last_file_creation_time=*/2000)};
+        std::map<std::string, std::vector<int32_t>> manifest_partitions = {
+            {"manifest-a", {0}}, {"manifest-b", {0, 1}}};
+        return PartitionStatisticsIndex(std::move(partitions), std::move(manifest_partitions));
+    }
+
+ protected:
+    std::shared_ptr<MemoryPool> pool_;
+};
+
+TEST_F(PartitionStatisticsIndexTest, TestSerialize) {
+    PartitionStatisticsIndex index = CreateIndex();
+    ASSERT_OK_AND_ASSIGN(std::string bytes, index.Serialize(pool_));
+    ASSERT_OK_AND_ASSIGN(PartitionStatisticsIndex deserialized,
+                         PartitionStatisticsIndex::Deserialize(bytes, pool_));
+    ASSERT_EQ(index, deserialized);
+
+    PartitionStatisticsIndex empty({}, {});
+    ASSERT_OK_AND_ASSIGN(bytes, empty.Serialize(pool_));
+    ASSERT_EQ(9, bytes.size());
+    ASSERT_OK_AND_ASSIGN(deserialized, PartitionStatisticsIndex::Deserialize(bytes, pool_));
+    ASSERT_EQ(empty, deserialized);
+}
+
+TEST_F(PartitionStatisticsIndexTest, TestDeserializeInvalid) {
+    ASSERT_OK_AND_ASSIGN(std::string bytes, CreateIndex().Serialize(pool_));
+    std::string invalid_version = bytes;
+    invalid_version[0] = 2;
+    ASSERT_NOK_WITH_MSG(PartitionStatisticsIndex::Deserialize(invalid_version, pool_),
+                        "unknown partition statistics index version 2");
+    // the last int is the ordinal of partition 2 in manifest-b
+    std::string invalid_ordinal = bytes;
+    invalid_ordinal[invalid_ordinal.size() - 1] = 5;
+    ASSERT_NOK_WITH_MSG(PartitionStatisticsIndex::Deserialize(invalid_ordinal, pool_),
+                        "invalid partition statistics index, partition ordinal 5");
+    ASSERT_NOK(PartitionStatisticsIndex::Deserialize(bytes.substr(0, bytes.size() / 2), pool_));
+}
+
+TEST_F(PartitionStatisticsIndexTest, TestBuildFromPrevious) {
+    PartitionStatisticsIndex previous = CreateIndex();
+    // delete the only file of partition 2
+    std::vector<PartitionEntry> delta_statistics = {
+        PartitionEntry(Partition(2), /*record_count=*/-5, /*file_size_in_bytes=*/-50,
+                       /*file_count=*/-1, /*last_file_creation_time=*/1500)};
+    ASSERT_OK_AND_ASSIGN(
+        PartitionStatisticsIndex index,
+        PartitionStatisticsIndex::Build(previous, /*previous_manifests=*/{}, delta_statistics,
+                                        {Manifest("manifest-a"), Manifest("manifest-b")},
+                                        /*manifest_file=*/nullptr));
+    // partition 2 has no file, but is still referenced by manifest-b
+    std::vector<PartitionEntry> expected_partitions = {
+        PartitionEntry(Partition(1), 10, 100, 2, 1000),
+        PartitionEntry(Partition(2), 0, 0, 0, 2000)};
+    ASSERT_EQ(expected_partitions, index.Partitions());
+    std::map<std::string, std::vector<int32_t>> expected_manifests = {{"manifest-a", {0}},
+                                                                      {"manifest-b", {0, 1}}};
+    ASSERT_EQ(expected_manifests, index.ManifestPartitions());
+
+    // partition 2 is dropped once no manifest references it
+    ASSERT_OK_AND_ASSIGN(index, PartitionStatisticsIndex::Build(
+                                    previous, /*previous_manifests=*/{}, delta_statistics,
+                                    {Manifest("manifest-a")}, /*manifest_file=*/nullptr));
+    ASSERT_EQ(std::vector<PartitionEntry>({PartitionEntry(Partition(1), 10, 100, 2, 1000)}),
+              index.Partitions());
+    ASSERT_EQ((std::map<std::string, std::vector<int32_t>>{{"manifest-a", {0}}}),
+              index.ManifestPartitions());
+}
+
+TEST_F(PartitionStatisticsIndexTest, TestReadWriteFile) {
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    auto schema = arrow::schema({arrow::field("f0", arrow::int32())});
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<FileStorePathFactory> path_factory,
+                         FileStorePathFactory::Create(
+                             dir->Str(), schema, {"f0"}, "__DEFAULT_PARTITION__",
+                             /*identifier=*/"orc", /*data_file_prefix=*/"data-",
+                             /*legacy_partition_name_enabled=*/false, /*external_paths=*/{},
+                             /*index_file_in_data_file_dir=*/false, pool_));
+    auto fs = std::make_shared<LocalFileSystem>();
+    PartitionStatisticsIndexFile index_file(fs, path_factory, pool_);
+
+    PartitionStatisticsIndex index = CreateIndex();
+    ASSERT_OK_AND_ASSIGN(std::string file_name, index_file.Write(index));
+    ASSERT_EQ("partition-stats-" + path_factory->UUID() + "-0", file_name);
+    ASSERT_OK_AND_ASSIGN(PartitionStatisticsIndex read_index, index_file.Read(file_name));
+    ASSERT_EQ(index, read_index);
+
+    index_file.DeleteQuietly(file_name);
+    ASSERT_OK_AND_ASSIGN(bool exist, fs->Exists(path_factory->ToManifestFilePath(file_name)));
+    ASSERT_FALSE(exist);
+    ASSERT_NOK(index_file.Read(file_name));
+}
+
+}  // namespace paimon::test
@@ -20,6 +20,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <map>
+#include <utility>
 #include <variant>
 
 #include "arrow/api.h"
@@ -36,27 +38,47 @@ namespace paimon {
 Result<std::unique_ptr<AggregateMergeFunction>> AggregateMergeFunction::Create(
     const std::shared_ptr<arrow::Schema>& value_schema,
     const std::vector<std::string>& primary_keys, const CoreOptions& options) {
+    PAIMON_ASSIGN_OR_RAISE(std::vector<InternalRow::FieldGetterFunc> all_getters,
+                           InternalRowUtils::CreateFieldGetters(value_schema, /*use_view=*/true));
+    std::vector<int32_t> field_indexes;
+    std::vector<InternalRow::FieldGetterFunc> getters;
     std::vector<std::unique_ptr<FieldAggregator>> aggregators;
-    aggregators.reserve(value_schema->num_fields());
+    // fields which can be aggregated by typed aggregators, grouped by aggregate function and type
+    std::map<std::pair<std::string, arrow::Type::type>, std::vector<int32_t>> typed_fields;
     for (int32_t i = 0; i < value_schema->num_fields(); i++) {
         const auto& field_name = value_schema->field(i)->name();
         const auto& field_type = value_schema->field(i)->type();
         PAIMON_ASSIGN_OR_RAISE(std::string str_agg,
                                GetAggFuncName(field_name, primary_keys, options));
+        // still create the field aggregator to validate the aggregate function and type
         PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FieldAggregator> agg,
                                FieldAggregatorFactory::CreateFieldAggregator(field_name, field_type,
                                                                              str_agg, options));
+        PAIMON_ASSIGN_OR_RAISE(bool ignore_retract, options.FieldAggIgnoreRetract(field_name));
+        if (!ignore_retract && TypedFieldsAggregator::IsSupported(str_agg, field_type)) {
+            typed_fields[{str_agg, field_type->id()}].push_back(i);
+            continue;
+        }
+        field_indexes.push_back(i);
+        getters.push_back(all_getters[i]);
         aggregators.push_back(std::move(agg));
     }
-
-    PAIMON_ASSIGN_OR_RAISE(std::vector<InternalRow::FieldGetterFunc> getters,
-                           InternalRowUtils::CreateFieldGetters(value_schema, /*use_view=*/true));
-    return std::unique_ptr<AggregateMergeFunction>(
-        new AggregateMergeFunction(std::move(getters), std::move(aggregators)));
+    std::vector<std::unique_ptr<TypedFieldsAggregator>> typed_aggregators;
+    for (auto& [agg_and_type, indexes] : typed_fields) {
+        const auto& field_type = value_schema->field(indexes[0])->type();
+        typed_aggregators.push_back(
+            TypedFieldsAggregator::Create(agg_and_type.first, field_type, std::move(indexes)));
+    }
+    return std::unique_ptr<AggregateMergeFunction>(new AggregateMergeFunction(
+        value_schema->num_fields(), std::move(field_indexes), std::move(getters),
+        std::move(aggregators), std::move(typed_aggregators)));
 }
 
 Status AggregateMergeFunction::Add(KeyValue&& kv) {
     bool is_retract = kv.value_kind->IsRetract();
+    for (const auto& typed_agg : typed_aggregators_) {
+        PAIMON_RETURN_NOT_OK(typed_agg->Add(*(kv.value), is_retract));
+    }
     for (size_t i = 0; i < getters_.size(); i++) {
         auto accumulator = getters_[i](*row_);
         auto input_field = getters_[i](*(kv.value));
@@ -65,9 +87,10 @@ Status AggregateMergeFunction::Add(KeyValue&& kv) {
             PAIMON_ASSIGN_OR_RAISE(merged_field,
                                    aggregators_[i]->Retract(accumulator, input_field));
         } else {
-            merged_field = aggregators_[i]->Agg(accumulator, input_field);
+            PAIMON_ASSIGN_OR_RAISE(merged_field,
+                                   aggregators_[i]->CheckedAgg(accumulator, input_field));
         }
-        row_->SetField(i, merged_field);
+        row_->SetField(field_indexes_[i], merged_field);
     }
     row_->AddDataHolder(std::move(kv.value));
     latest_kv_ = std::move(kv);
@@ -76,6 +99,9 @@ Status AggregateMergeFunction::Add(KeyValue&& kv) {
 
 Result<std::optional<KeyValue>> AggregateMergeFunction::GetResult() {
     assert(latest_kv_);
+    for (const auto& typed_agg : typed_aggregators_) {
+        typed_agg->WriteTo(row_.get());
+    }
     latest_kv_.value().value = std::move(row_);
     latest_kv_.value().value_kind = RowKind::Insert();
     latest_kv_.value().level = KeyValue::UNKNOWN_LEVEL;
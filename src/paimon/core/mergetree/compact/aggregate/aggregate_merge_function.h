@@ -29,6 +29,7 @@
 #include "paimon/core/core_options.h"
 #include "paimon/core/key_value.h"
 #include "paimon/core/mergetree/compact/aggregate/field_aggregator.h"
+#include "paimon/core/mergetree/compact/aggregate/typed_fields_aggregator.h"
 #include "paimon/core/mergetree/compact/merge_function.h"
 #include "paimon/result.h"
 #include "paimon/status.h"
@@ -42,6 +43,10 @@ class CoreOptions;
 
 /// A `MergeFunction` where key is primary key (unique) and value is the partial record,
 /// pre-aggregate non-null fields on merge.
+///
+/// Fields of primitive types aggregated by sum, min or max are grouped by type and aggregate
+/// function, and aggregated by `TypedFieldsAggregator`s into typed buffers. Other fields fall back
+/// to `FieldAggregator`s on `VariantType`.
 class AggregateMergeFunction : public MergeFunction {
  public:
     // value_schema is the schema of parameter value in KeyValue object
@@ -51,10 +56,13 @@ class AggregateMergeFunction : public MergeFunction {
 
     void Reset() override {
         latest_kv_ = std::nullopt;
-        row_ = std::make_unique<GenericRow>(getters_.size());
+        row_ = std::make_unique<GenericRow>(arity_);
         for (const auto& agg : aggregators_) {
             agg->Reset();
         }
+        for (const auto& typed_agg : typed_aggregators_) {
+            typed_agg->Reset();
+        }
     }
 
     Status Add(KeyValue&& kv) override;
@@ -62,11 +70,17 @@ class AggregateMergeFunction : public MergeFunction {
     Result<std::optional<KeyValue>> GetResult() override;
 
  private:
-    AggregateMergeFunction(std::vector<InternalRow::FieldGetterFunc>&& getters,
-                           std::vector<std::unique_ptr<FieldAggregator>>&& aggregators)
-        : getters_(std::move(getters)),
+    AggregateMergeFunction(int32_t arity, std::vector<int32_t>&& field_indexes,
+                           std::vector<InternalRow::FieldGetterFunc>&& getters,
+                           std::vector<std::unique_ptr<FieldAggregator>>&& aggregators,
+                           std::vector<std::unique_ptr<TypedFieldsAggregator>>&& typed_aggregators)
+        : arity_(arity),
+          field_indexes_(std::move(field_indexes)),
+          getters_(std::move(getters)),
           aggregators_(std::move(aggregators)),
-          row_(std::make_unique<GenericRow>(getters_.size())) {
+          typed_aggregators_(std::move(typed_aggregators)),
+          row_(std::make_unique<GenericRow>(arity_)) {
+        assert(field_indexes_.size() == getters_.size());
         assert(getters_.size() == aggregators_.size());
     }
     static Result<std::string> GetAggFuncName(const std::string& field_name,
@@ -74,8 +88,13 @@ class AggregateMergeFunction : public MergeFunction {
                                               const CoreOptions& options);
 
  private:
+    int32_t arity_;
+    // indexes, getters and aggregators of the fields which are not aggregated by
+    // typed_aggregators_
+    std::vector<int32_t> field_indexes_;
     std::vector<InternalRow::FieldGetterFunc> getters_;
     std::vector<std::unique_ptr<FieldAggregator>> aggregators_;
+    std::vector<std::unique_ptr<TypedFieldsAggregator>> typed_aggregators_;
     std::optional<KeyValue> latest_kv_;
     std::unique_ptr<GenericRow> row_;
 };
@@ -35,6 +35,13 @@ class FieldAggregator {
 
     virtual VariantType Agg(const VariantType& accumulator, const VariantType& input_field) = 0;
 
+    /// Same as `Agg()`, but reports an invalid input field instead of ignoring it, e.g., a
+    /// corrupted serialized sketch.
+    virtual Result<VariantType> CheckedAgg(const VariantType& accumulator,
+                                           const VariantType& input_field) {
+        return Agg(accumulator, input_field);
+    }
+
     /// reset the aggregator to a clean start state.
     virtual void Reset() {}
 
@@ -26,13 +26,17 @@
 #include "paimon/core/mergetree/compact/aggregate/field_bool_or_agg.h"
 #include "paimon/core/mergetree/compact/aggregate/field_first_non_null_value_agg.h"
 #include "paimon/core/mergetree/compact/aggregate/field_first_value_agg.h"
+#include "paimon/core/mergetree/compact/aggregate/field_hll_sketch_agg.h"
 #include "paimon/core/mergetree/compact/aggregate/field_ignore_retract_agg.h"
 #include "paimon/core/mergetree/compact/aggregate/field_last_non_null_value_agg.h"
 #include "paimon/core/mergetree/compact/aggregate/field_last_value_agg.h"
 #include "paimon/core/mergetree/compact/aggregate/field_max_agg.h"
 #include "paimon/core/mergetree/compact/aggregate/field_min_agg.h"
 #include "paimon/core/mergetree/compact/aggregate/field_primary_key_agg.h"
+#include "paimon/core/mergetree/compact/aggregate/field_roaring_bitmap32_agg.h"
+#include "paimon/core/mergetree/compact/aggregate/field_roaring_bitmap64_agg.h"
 #include "paimon/core/mergetree/compact/aggregate/field_sum_agg.h"
+#include "paimon/core/mergetree/compact/aggregate/field_theta_sketch_agg.h"
 #include "paimon/result.h"
 #include "paimon/status.h"
 
@@ -71,6 +75,14 @@ class FieldAggregatorFactory {
             PAIMON_ASSIGN_OR_RAISE(field_aggregator, FieldBoolOrAgg::Create(field_type));
         } else if (str_agg == FieldBoolAndAgg::NAME) {
             PAIMON_ASSIGN_OR_RAISE(field_aggregator, FieldBoolAndAgg::Create(field_type));
+        } else if (str_agg == FieldHllSketchAgg::NAME) {
+            PAIMON_ASSIGN_OR_RAISE(field_aggregator, FieldHllSketchAgg::Create(field_type));
+        } else if (str_agg == FieldThetaSketchAgg::NAME) {
+            PAIMON_ASSIGN_OR_RAISE(field_aggregator, FieldThetaSketchAgg::Create(field_type));
+        } else if (str_agg == FieldRoaringBitmap32Agg::NAME) {
+            PAIMON_ASSIGN_OR_RAISE(field_aggregator, FieldRoaringBitmap32Agg::Create(field_type));
+        } else if (str_agg == FieldRoaringBitmap64Agg::NAME) {
+            PAIMON_ASSIGN_OR_RAISE(field_aggregator, FieldRoaringBitmap64Agg::Create(field_type));
         } else {
             return Status::Invalid(fmt::format(
                 "Use unsupported aggregation {} or spell aggregate function incorrectly!",
@@ -94,6 +94,41 @@ TEST(FieldAggregatorFactoryTest, TestSimple) {
                                                                            "first_value", options));
         ASSERT_TRUE(dynamic_cast<FieldFirstValueAgg*>(agg.get()));
     }
+    {
+        ASSERT_OK_AND_ASSIGN(CoreOptions options, CoreOptions::FromMap({}));
+        ASSERT_OK_AND_ASSIGN(std::unique_ptr<FieldAggregator> agg,
+                             FieldAggregatorFactory::CreateFieldAggregator("f0", arrow::binary(),
+                                                                           "hll_sketch", options));
+        ASSERT_TRUE(dynamic_cast<FieldHllSketchAgg*>(agg.get()));
+    }
+    {
+        ASSERT_OK_AND_ASSIGN(CoreOptions options, CoreOptions::FromMap({}));
+        ASSERT_OK_AND_ASSIGN(std::unique_ptr<FieldAggregator> agg,
+                             FieldAggregatorFactory::CreateFieldAggregator(
+                                 "f0", arrow::binary(), "theta_sketch", options));
+        ASSERT_TRUE(dynamic_cast<FieldThetaSketchAgg*>(agg.get()));
+    }
+    {
+        ASSERT_OK_AND_ASSIGN(CoreOptions options, CoreOptions::FromMap({}));
+        ASSERT_OK_AND_ASSIGN(std::unique_ptr<FieldAggregator> agg,
+                             FieldAggregatorFactory::CreateFieldAggregator("f0", arrow::binary(),
+                                                                           "rbm32", options));
+        ASSERT_TRUE(dynamic_cast<FieldRoaringBitmap32Agg*>(agg.get()));
+    }
+    {
+        ASSERT_OK_AND_ASSIGN(CoreOptions options, CoreOptions::FromMap({}));
+        ASSERT_OK_AND_ASSIGN(std::unique_ptr<FieldAggregator> agg,
+                             FieldAggregatorFactory::CreateFieldAggregator("f0", arrow::binary(),
+                                                                           "rbm64", options));
+        ASSERT_TRUE(dynamic_cast<FieldRoaringBitmap64Agg*>(agg.get()));
+    }
+    {
+        // sketch aggregate functions only support binary type
+        ASSERT_OK_AND_ASSIGN(CoreOptions options, CoreOptions::FromMap({}));
+        ASSERT_NOK_WITH_MSG(FieldAggregatorFactory::CreateFieldAggregator(
+                                "f0", arrow::utf8(), "hll_sketch", options),
+                            "supposed to be binary");
+    }
     {
         // test ignore_retract is true
         ASSERT_OK_AND_ASSIGN(CoreOptions options,
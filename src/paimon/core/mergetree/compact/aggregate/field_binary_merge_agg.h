@@ -0,0 +1,85 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "arrow/api.h"
+#include "fmt/format.h"
+#include "paimon/common/data/data_define.h"
+#include "paimon/core/mergetree/compact/aggregate/field_aggregator.h"
+#include "paimon/memory/bytes.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace paimon {
+/// abstract class of aggregating a binary field by merging the serialized values, e.g., sketches
+/// and bitmaps.
+class FieldBinaryMergeAgg : public FieldAggregator {
+ public:
+    VariantType Agg(const VariantType& accumulator, const VariantType& input_field) override {
+        Result<VariantType> merged = CheckedAgg(accumulator, input_field);
+        // an invalid input field can not be reported by Agg(), keep the accumulator
+        return merged.ok() ? std::move(merged).value() : accumulator;
+    }
+
+    Result<VariantType> CheckedAgg(const VariantType& accumulator,
+                                   const VariantType& input_field) override {
+        bool accumulator_null = DataDefine::IsVariantNull(accumulator);
+        bool input_null = DataDefine::IsVariantNull(input_field);
+        if (accumulator_null || input_null) {
+            return accumulator_null ? input_field : accumulator;
+        }
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<Bytes> merged,
+                               Merge(ToView(accumulator), ToView(input_field)));
+        return merged;
+    }
+
+ protected:
+    FieldBinaryMergeAgg(const std::string& name, const std::shared_ptr<arrow::DataType>& field_type)
+        : FieldAggregator(name, field_type), pool_(GetDefaultPool()) {}
+
+    static Status CheckFieldType(const std::shared_ptr<arrow::DataType>& field_type,
+                                 const std::string& name) {
+        if (field_type->id() != arrow::Type::type::BINARY) {
+            return Status::Invalid(
+                fmt::format("invalid field type {} for {}, supposed to be binary",
+                            field_type->ToString(), name));
+        }
+        return Status::OK();
+    }
+
+    /// Merges the serialized input field into the serialized accumulator.
+    virtual Result<std::shared_ptr<Bytes>> Merge(std::string_view accumulator,
+                                                 std::string_view input_field) = 0;
+
+ private:
+    static std::string_view ToView(const VariantType& value) {
+        if (const auto* bytes = DataDefine::GetVariantPtr<std::shared_ptr<Bytes>>(value)) {
+            return std::string_view((*bytes)->data(), (*bytes)->size());
+        }
+        return DataDefine::GetVariantValue<std::string_view>(value);
+    }
+
+ protected:
+    std::shared_ptr<MemoryPool> pool_;
+};
+}  // namespace paimon
@@ -0,0 +1,50 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "paimon/common/utils/hll_sketch_util.h"
+#include "paimon/core/mergetree/compact/aggregate/field_binary_merge_agg.h"
+
+namespace paimon {
+/// hll_sketch aggregate a field of a row, which unions the serialized HLL sketches of
+/// DataSketches.
+class FieldHllSketchAgg : public FieldBinaryMergeAgg {
+ public:
+    static Result<std::unique_ptr<FieldHllSketchAgg>> Create(
+        const std::shared_ptr<arrow::DataType>& field_type) {
+        PAIMON_RETURN_NOT_OK(CheckFieldType(field_type, NAME));
+        return std::unique_ptr<FieldHllSketchAgg>(new FieldHllSketchAgg(field_type));
+    }
+
+ public:
+    static constexpr char NAME[] = "hll_sketch";
+
+ protected:
+    Result<std::shared_ptr<Bytes>> Merge(std::string_view accumulator,
+                                         std::string_view input_field) override {
+        return HllSketchUtil::Union(accumulator, input_field, pool_.get());
+    }
+
+ private:
+    explicit FieldHllSketchAgg(const std::shared_ptr<arrow::DataType>& field_type)
+        : FieldBinaryMergeAgg(std::string(NAME), field_type) {}
+};
+}  // namespace paimon
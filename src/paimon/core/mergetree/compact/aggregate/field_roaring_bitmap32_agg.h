@@ -0,0 +1,68 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "paimon/core/mergetree/compact/aggregate/field_binary_merge_agg.h"
+#include "paimon/utils/roaring_bitmap32.h"
+
+namespace paimon {
+/// rbm32 aggregate a field of a row, which unions the serialized 32-bit roaring bitmaps.
+///
+/// The bitmap of the last result is kept, so that the accumulator is not deserialized again when
+/// it is the last result.
+class FieldRoaringBitmap32Agg : public FieldBinaryMergeAgg {
+ public:
+    static Result<std::unique_ptr<FieldRoaringBitmap32Agg>> Create(
+        const std::shared_ptr<arrow::DataType>& field_type) {
+        PAIMON_RETURN_NOT_OK(CheckFieldType(field_type, NAME));
+        return std::unique_ptr<FieldRoaringBitmap32Agg>(new FieldRoaringBitmap32Agg(field_type));
+    }
+
+    void Reset() override {
+        last_result_.reset();
+    }
+
+ public:
+    static constexpr char NAME[] = "rbm32";
+
+ protected:
+    Result<std::shared_ptr<Bytes>> Merge(std::string_view accumulator,
+                                         std::string_view input_field) override {
+        if (!last_result_ || accumulator.data() != last_result_->data()) {
+            last_result_.reset();
+            PAIMON_RETURN_NOT_OK(bitmap_.Deserialize(accumulator.data(), accumulator.size()));
+        }
+        RoaringBitmap32 input_bitmap;
+        PAIMON_RETURN_NOT_OK(input_bitmap.Deserialize(input_field.data(), input_field.size()));
+        bitmap_ |= input_bitmap;
+        last_result_ = bitmap_.Serialize(pool_.get());
+        return last_result_;
+    }
+
+ private:
+    explicit FieldRoaringBitmap32Agg(const std::shared_ptr<arrow::DataType>& field_type)
+        : FieldBinaryMergeAgg(std::string(NAME), field_type) {}
+
+ private:
+    RoaringBitmap32 bitmap_;
+    std::shared_ptr<Bytes> last_result_;
+};
+}  // namespace paimon
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "arrow/type_fwd.h"
+#include "gtest/gtest.h"
+#include "paimon/common/data/data_define.h"
+#include "paimon/core/mergetree/compact/aggregate/field_roaring_bitmap32_agg.h"
+#include "paimon/core/mergetree/compact/aggregate/field_roaring_bitmap64_agg.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+#include "paimon/testing/utils/testharness.h"
+#include "paimon/utils/roaring_bitmap32.h"
+#include "paimon/utils/roaring_bitmap64.h"
+
+namespace paimon::test {
+namespace {
+template <typename Bitmap>
+std::string Serialize(const Bitmap& bitmap) {
+    auto pool = GetDefaultPool();
+    auto bytes = bitmap.Serialize(pool.get());
+    return std::string(bytes->data(), bytes->size());
+}
+
+template <typename Bitmap>
+Bitmap Deserialize(const VariantType& value) {
+    auto bytes = DataDefine::GetVariantValue<std::shared_ptr<Bytes>>(value);
+    Bitmap bitmap;
+    EXPECT_OK(bitmap.Deserialize(bytes->data(), bytes->size()));
+    return bitmap;
+}
+}  // namespace
+
+TEST(FieldRoaringBitmapAggTest, TestRoaringBitmap32) {
+    ASSERT_OK_AND_ASSIGN(auto agg, FieldRoaringBitmap32Agg::Create(arrow::binary()));
+    std::string bitmap1 = Serialize(RoaringBitmap32::From({1, 3, 5}));
+    std::string bitmap2 = Serialize(RoaringBitmap32::From({2, 3, 100000}));
+    std::string bitmap3 = Serialize(RoaringBitmap32::From({7}));
+
+    auto agg_ret = agg->Agg(std::string_view(bitmap1), std::string_view(bitmap2));
+    ASSERT_EQ(Deserialize<RoaringBitmap32>(agg_ret),
+              RoaringBitmap32::From({1, 2, 3, 5, 100000}));
+    // the last result as accumulator
+    agg_ret = agg->Agg(agg_ret, std::string_view(bitmap3));
+    ASSERT_EQ(Deserialize<RoaringBitmap32>(agg_ret),
+              RoaringBitmap32::From({1, 2, 3, 5, 7, 100000}));
+    // an accumulator which is not the last result
+    agg_ret = agg->Agg(std::string_view(bitmap3), std::string_view(bitmap1));
+    ASSERT_EQ(Deserialize<RoaringBitmap32>(agg_ret), RoaringBitmap32::From({1, 3, 5, 7}));
+
+    agg->Reset();
+    agg_ret = agg->Agg(std::string_view(bitmap2), NullType());
+    ASSERT_EQ(DataDefine::GetVariantValue<std::string_view>(agg_ret), bitmap2);
+    agg_ret = agg->Agg(NullType(), NullType());
+    ASSERT_TRUE(DataDefine::IsVariantNull(agg_ret));
+
+    ASSERT_NOK(agg->CheckedAgg(std::string_view(bitmap1), std::string_view("invalid")));
+    ASSERT_NOK(FieldRoaringBitmap32Agg::Create(arrow::int32()));
+}
+
+TEST(FieldRoaringBitmapAggTest, TestRoaringBitmap64) {
+    ASSERT_OK_AND_ASSIGN(auto agg, FieldRoaringBitmap64Agg::Create(arrow::binary()));
+    int64_t large = (1ll << 40) + 1;
+    std::string bitmap1 = Serialize(RoaringBitmap64::From({1, large}));
+    std::string bitmap2 = Serialize(RoaringBitmap64::From({2, large + 1}));
+    std::string bitmap3 = Serialize(RoaringBitmap64::From({large}));
+
+    auto agg_ret = agg->Agg(std::string_view(bitmap1), std::string_view(bitmap2));
+    ASSERT_EQ(Deserialize<RoaringBitmap64>(agg_ret),
+              RoaringBitmap64::From({1, 2, large, large + 1}));
+    agg_ret = agg->Agg(agg_ret, std::string_view(bitmap3));
+    ASSERT_EQ(Deserialize<RoaringBitmap64>(agg_ret),
+              RoaringBitmap64::From({1, 2, large, large + 1}));
+
+    agg->Reset();
+    agg_ret = agg->Agg(std::string_view(bitmap3), std::string_view(bitmap2));
+    ASSERT_EQ(Deserialize<RoaringBitmap64>(agg_ret),
+              RoaringBitmap64::From({2, large, large + 1}));
+
+    ASSERT_NOK(agg->CheckedAgg(std::string_view(bitmap1), std::string_view("invalid")));
+    ASSERT_NOK(FieldRoaringBitmap64Agg::Create(arrow::utf8()));
+}
+
+}  // namespace paimon::test
@@ -0,0 +1,141 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "arrow/type_fwd.h"
+#include "gtest/gtest.h"
+#include "paimon/common/data/data_define.h"
+#include "paimon/common/utils/hll_sketch_util.h"
+#include "paimon/common/utils/theta_sketch_util.h"
+#include "paimon/core/mergetree/compact/aggregate/field_hll_sketch_agg.h"
+#include "paimon/core/mergetree/compact/aggregate/field_theta_sketch_agg.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+namespace {
+std::string ToString(const VariantType& value) {
+    auto bytes = DataDefine::GetVariantValue<std::shared_ptr<Bytes>>(value);
+    return std::string(bytes->data(), bytes->size());
+}
+
+// a compact theta sketch with a single hash
+std::string ThetaSketch(int64_t hash) {
+    std::string sketch("\x01\x03\x03\x00\x00\x3a\xcc\x93", 8);
+    sketch.append(reinterpret_cast<const char*>(&hash), sizeof(hash));
+    return sketch;
+}
+
+// a hll sketch in LIST mode with a single coupon
+std::string HllSketch(int32_t coupon) {
+    std::string sketch("\x02\x01\x07\x0c\x03\x08\x01\x00", 8);
+    sketch.append(reinterpret_cast<const char*>(&coupon), sizeof(coupon));
+    return sketch;
+}
+}  // namespace
+
+TEST(FieldThetaSketchAggTest, TestSimple) {
+    auto pool = GetDefaultPool();
+    ASSERT_OK_AND_ASSIGN(auto agg, FieldThetaSketchAgg::Create(arrow::binary()));
+    std::string sketch1 = ThetaSketch(1);
+    std::string sketch2 = ThetaSketch(2);
+    auto agg_ret = agg->Agg(std::string_view(sketch1), std::string_view(sketch2));
+    ASSERT_OK_AND_ASSIGN(auto expected, ThetaSketchUtil::Union(sketch1, sketch2, pool.get()));
+    ASSERT_EQ(ToString(agg_ret), std::string(expected->data(), expected->size()));
+    ASSERT_OK_AND_ASSIGN(double estimate, ThetaSketchUtil::GetEstimate(ToString(agg_ret)));
+    ASSERT_EQ(estimate, 2.0);
+
+    // the result can be the accumulator of the next aggregation
+    std::string sketch3 = ThetaSketch(3);
+    agg_ret = agg->Agg(agg_ret, std::string_view(sketch3));
+    ASSERT_OK_AND_ASSIGN(estimate, ThetaSketchUtil::GetEstimate(ToString(agg_ret)));
+    ASSERT_EQ(estimate, 3.0);
+
+    auto retract_ret = agg->Retract(agg_ret, std::string_view(sketch3));
+    ASSERT_FALSE(retract_ret.ok());
+}
+
+TEST(FieldThetaSketchAggTest, TestInvalidType) {
+    auto agg = FieldThetaSketchAgg::Create(arrow::utf8());
+    ASSERT_FALSE(agg.ok());
+}
+
+TEST(FieldThetaSketchAggTest, TestNull) {
+    ASSERT_OK_AND_ASSIGN(auto agg, FieldThetaSketchAgg::Create(arrow::binary()));
+    std::string sketch = ThetaSketch(1);
+    {
+        auto agg_ret = agg->Agg(std::string_view(sketch), NullType());
+        ASSERT_EQ(DataDefine::GetVariantValue<std::string_view>(agg_ret), sketch);
+    }
+    {
+        auto agg_ret = agg->Agg(NullType(), std::string_view(sketch));
+        ASSERT_EQ(DataDefine::GetVariantValue<std::string_view>(agg_ret), sketch);
+    }
+    {
+        auto agg_ret = agg->Agg(NullType(), NullType());
+        ASSERT_TRUE(DataDefine::IsVariantNull(agg_ret));
+    }
+}
+
+TEST(FieldThetaSketchAggTest, TestInvalidSketch) {
+    ASSERT_OK_AND_ASSIGN(auto agg, FieldThetaSketchAgg::Create(arrow::binary()));
+    std::string sketch = ThetaSketch(1);
+    std::string invalid_sketch = "invalid";
+    ASSERT_NOK_WITH_MSG(
+        agg->CheckedAgg(std::string_view(sketch), std::string_view(invalid_sketch)),
+        "invalid theta sketch");
+    // Agg() keeps the accumulator
+    auto agg_ret = agg->Agg(std::string_view(sketch), std::string_view(invalid_sketch));
+    ASSERT_EQ(DataDefine::GetVariantValue<std::string_view>(agg_ret), sketch);
+}
+
+TEST(FieldHllSketchAggTest, TestSimple) {
+    auto pool = GetDefaultPool();
+    ASSERT_OK_AND_ASSIGN(auto agg, FieldHllSketchAgg::Create(arrow::binary()));
+    std::string sketch1 = HllSketch((1 << 26) | 1);
+    std::string sketch2 = HllSketch((2 << 26) | 2);
+    ASSERT_OK_AND_ASSIGN(auto agg_ret,
+                         agg->CheckedAgg(std::string_view(sketch1), std::string_view(sketch2)));
+    ASSERT_OK_AND_ASSIGN(auto expected, HllSketchUtil::Union(sketch1, sketch2, pool.get()));
+    ASSERT_EQ(ToString(agg_ret), std::string(expected->data(), expected->size()));
+
+    ASSERT_OK_AND_ASSIGN(agg_ret, agg->CheckedAgg(agg_ret, std::string_view(sketch1)));
+    ASSERT_EQ(ToString(agg_ret), std::string(expected->data(), expected->size()));
+
+    ASSERT_NOK_WITH_MSG(agg->CheckedAgg(agg_ret, std::string_view("invalid")),
+                        "invalid hll sketch");
+}
+
+TEST(FieldHllSketchAggTest, TestNull) {
+    ASSERT_OK_AND_ASSIGN(auto agg, FieldHllSketchAgg::Create(arrow::binary()));
+    std::string sketch = HllSketch((1 << 26) | 1);
+    {
+        auto agg_ret = agg->Agg(std::string_view(sketch), NullType());
+        ASSERT_EQ(DataDefine::GetVariantValue<std::string_view>(agg_ret), sketch);
+    }
+    {
+        auto agg_ret = agg->Agg(NullType(), NullType());
+        ASSERT_TRUE(DataDefine::IsVariantNull(agg_ret));
+    }
+}
+
+}  // namespace paimon::test
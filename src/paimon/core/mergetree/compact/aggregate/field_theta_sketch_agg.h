@@ -0,0 +1,50 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "paimon/common/utils/theta_sketch_util.h"
+#include "paimon/core/mergetree/compact/aggregate/field_binary_merge_agg.h"
+
+namespace paimon {
+/// theta_sketch aggregate a field of a row, which unions the serialized compact theta sketches of
+/// DataSketches.
+class FieldThetaSketchAgg : public FieldBinaryMergeAgg {
+ public:
+    static Result<std::unique_ptr<FieldThetaSketchAgg>> Create(
+        const std::shared_ptr<arrow::DataType>& field_type) {
+        PAIMON_RETURN_NOT_OK(CheckFieldType(field_type, NAME));
+        return std::unique_ptr<FieldThetaSketchAgg>(new FieldThetaSketchAgg(field_type));
+    }
+
+ public:
+    static constexpr char NAME[] = "theta_sketch";
+
+ protected:
+    Result<std::shared_ptr<Bytes>> Merge(std::string_view accumulator,
+                                         std::string_view input_field) override {
+        return ThetaSketchUtil::Union(accumulator, input_field, pool_.get());
+    }
+
+ private:
+    explicit FieldThetaSketchAgg(const std::shared_ptr<arrow::DataType>& field_type)
+        : FieldBinaryMergeAgg(std::string(NAME), field_type) {}
+};
+}  // namespace paimon
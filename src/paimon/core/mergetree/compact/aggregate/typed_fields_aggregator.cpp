@@ -0,0 +1,83 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/mergetree/compact/aggregate/typed_fields_aggregator.h"
+
+#include "arrow/type.h"
+
+namespace paimon {
+
+namespace {
+template <typename Op>
+std::unique_ptr<TypedFieldsAggregator> CreateTypedFieldsAggregator(
+    arrow::Type::type type, std::vector<int32_t>&& field_indexes) {
+    switch (type) {
+        case arrow::Type::type::INT8:
+            return std::make_unique<TypedFieldsAggregatorImpl<char, Op>>(std::move(field_indexes));
+        case arrow::Type::type::INT16:
+            return std::make_unique<TypedFieldsAggregatorImpl<int16_t, Op>>(
+                std::move(field_indexes));
+        case arrow::Type::type::INT32:
+            return std::make_unique<TypedFieldsAggregatorImpl<int32_t, Op>>(
+                std::move(field_indexes));
+        case arrow::Type::type::INT64:
+            return std::make_unique<TypedFieldsAggregatorImpl<int64_t, Op>>(
+                std::move(field_indexes));
+        case arrow::Type::type::FLOAT:
+            return std::make_unique<TypedFieldsAggregatorImpl<float, Op>>(
+                std::move(field_indexes));
+        case arrow::Type::type::DOUBLE:
+            return std::make_unique<TypedFieldsAggregatorImpl<double, Op>>(
+                std::move(field_indexes));
+        default:
+            return nullptr;
+    }
+}
+}  // namespace
+
+bool TypedFieldsAggregator::IsSupported(const std::string& agg_name,
+                                        const std::shared_ptr<arrow::DataType>& field_type) {
+    if (agg_name != TypedSumOp::NAME && agg_name != TypedMinOp::NAME &&
+        agg_name != TypedMaxOp::NAME) {
+        return false;
+    }
+    switch (field_type->id()) {
+        case arrow::Type::type::INT8:
+        case arrow::Type::type::INT16:
+        case arrow::Type::type::INT32:
+        case arrow::Type::type::INT64:
+        case arrow::Type::type::FLOAT:
+        case arrow::Type::type::DOUBLE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+std::unique_ptr<TypedFieldsAggregator> TypedFieldsAggregator::Create(
+    const std::string& agg_name, const std::shared_ptr<arrow::DataType>& field_type,
+    std::vector<int32_t>&& field_indexes) {
+    if (agg_name == TypedSumOp::NAME) {
+        return CreateTypedFieldsAggregator<TypedSumOp>(field_type->id(), std::move(field_indexes));
+    } else if (agg_name == TypedMinOp::NAME) {
+        return CreateTypedFieldsAggregator<TypedMinOp>(field_type->id(), std::move(field_indexes));
+    } else if (agg_name == TypedMaxOp::NAME) {
+        return CreateTypedFieldsAggregator<TypedMaxOp>(field_type->id(), std::move(field_indexes));
+    }
+    return nullptr;
+}
+
+}  // namespace paimon
@@ -0,0 +1,231 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/type_fwd.h"
+#include "fmt/format.h"
+#include "paimon/common/data/data_define.h"
+#include "paimon/common/data/generic_row.h"
+#include "paimon/common/data/internal_row.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace paimon {
+
+/// Aggregates a group of fields which share the same primitive type and aggregate function. The
+/// fields of a run of equal keys are accumulated into typed buffers with a tight loop per row, the
+/// `VariantType` of each field is only created once when the result is written to a row.
+///
+/// It is a fast path of `FieldAggregator`, and has exactly the same semantics as the
+/// corresponding aggregator.
+class TypedFieldsAggregator {
+ public:
+    virtual ~TypedFieldsAggregator() = default;
+
+    static bool IsSupported(const std::string& agg_name,
+                            const std::shared_ptr<arrow::DataType>& field_type);
+
+    /// @return A typed aggregator of the fields, or nullptr if the aggregate function and the
+    /// type are not supported by the fast path.
+    static std::unique_ptr<TypedFieldsAggregator> Create(
+        const std::string& agg_name, const std::shared_ptr<arrow::DataType>& field_type,
+        std::vector<int32_t>&& field_indexes);
+
+    /// reset the aggregator to a clean start state.
+    virtual void Reset() = 0;
+
+    virtual Status Add(const InternalRow& row, bool is_retract) = 0;
+
+    /// Writes the accumulated values to the fields of `row`.
+    virtual void WriteTo(GenericRow* row) const = 0;
+
+    const std::vector<int32_t>& FieldIndexes() const {
+        return field_indexes_;
+    }
+
+ protected:
+    explicit TypedFieldsAggregator(std::vector<int32_t>&& field_indexes)
+        : field_indexes_(std::move(field_indexes)) {}
+
+ protected:
+    std::vector<int32_t> field_indexes_;
+};
+
+template <typename T>
+struct TypedFieldReader;
+
+template <>
+struct TypedFieldReader<char> {
+    static char Read(const InternalRow& row, int32_t pos) {
+        return row.GetByte(pos);
+    }
+};
+
+template <>
+struct TypedFieldReader<int16_t> {
+    static int16_t Read(const InternalRow& row, int32_t pos) {
+        return row.GetShort(pos);
+    }
+};
+
+template <>
+struct TypedFieldReader<int32_t> {
+    static int32_t Read(const InternalRow& row, int32_t pos) {
+        return row.GetInt(pos);
+    }
+};
+
+template <>
+struct TypedFieldReader<int64_t> {
+    static int64_t Read(const InternalRow& row, int32_t pos) {
+        return row.GetLong(pos);
+    }
+};
+
+template <>
+struct TypedFieldReader<float> {
+    static float Read(const InternalRow& row, int32_t pos) {
+        return row.GetFloat(pos);
+    }
+};
+
+template <>
+struct TypedFieldReader<double> {
+    static double Read(const InternalRow& row, int32_t pos) {
+        return row.GetDouble(pos);
+    }
+};
+
+/// Same as `FieldSumAgg`.
+struct TypedSumOp {
+    static constexpr char NAME[] = "sum";
+    static constexpr bool SUPPORT_RETRACT = true;
+
+    template <typename T>
+    static T Agg(T accumulator, T input) {
+        return static_cast<T>(accumulator + input);
+    }
+    template <typename T>
+    static T Negate(T input) {
+        return static_cast<T>(-input);
+    }
+};
+
+/// Same as `FieldMinAgg`.
+struct TypedMinOp {
+    static constexpr char NAME[] = "min";
+    static constexpr bool SUPPORT_RETRACT = false;
+
+    template <typename T>
+    static T Agg(T accumulator, T input) {
+        return accumulator < input ? accumulator : input;
+    }
+    template <typename T>
+    static T Negate(T input) {
+        return input;
+    }
+};
+
+/// Same as `FieldMaxAgg`.
+struct TypedMaxOp {
+    static constexpr char NAME[] = "max";
+    static constexpr bool SUPPORT_RETRACT = false;
+
+    template <typename T>
+    static T Agg(T accumulator, T input) {
+        return accumulator < input ? input : accumulator;
+    }
+    template <typename T>
+    static T Negate(T input) {
+        return input;
+    }
+};
+
+template <typename T, typename Op>
+class TypedFieldsAggregatorImpl : public TypedFieldsAggregator {
+ public:
+    explicit TypedFieldsAggregatorImpl(std::vector<int32_t>&& field_indexes)
+        : TypedFieldsAggregator(std::move(field_indexes)),
+          accumulators_(field_indexes_.size()),
+          is_null_(field_indexes_.size(), 1) {}
+
+    void Reset() override {
+        std::fill(accumulators_.begin(), accumulators_.end(), T());
+        std::fill(is_null_.begin(), is_null_.end(), 1);
+    }
+
+    Status Add(const InternalRow& row, bool is_retract) override {
+        if (is_retract) {
+            if constexpr (Op::SUPPORT_RETRACT) {
+                Accumulate<true>(row);
+            } else {
+                return Status::Invalid(fmt::format(
+                    "Aggregate function {} does not support retraction, if you allow this "
+                    "function to ignore retraction messages, you can configure "
+                    "fields.field_name.ignore-retract=true.",
+                    Op::NAME));
+            }
+        } else {
+            Accumulate<false>(row);
+        }
+        return Status::OK();
+    }
+
+    void WriteTo(GenericRow* row) const override {
+        for (size_t i = 0; i < field_indexes_.size(); i++) {
+            if (is_null_[i]) {
+                row->SetField(field_indexes_[i], NullType());
+            } else {
+                row->SetField(field_indexes_[i], accumulators_[i]);
+            }
+        }
+    }
+
+ private:
+    template <bool IS_RETRACT>
+    void Accumulate(const InternalRow& row) {
+        size_t field_count = field_indexes_.size();
+        T* accumulators = accumulators_.data();
+        uint8_t* is_null = is_null_.data();
+        for (size_t i = 0; i < field_count; i++) {
+            int32_t pos = field_indexes_[i];
+            if (row.IsNullAt(pos)) {
+                continue;
+            }
+            T input = TypedFieldReader<T>::Read(row, pos);
+            if constexpr (IS_RETRACT) {
+                input = Op::Negate(input);
+            }
+            accumulators[i] = is_null[i] ? input : Op::Agg(accumulators[i], input);
+            is_null[i] = 0;
+        }
+    }
+
+ private:
+    std::vector<T> accumulators_;
+    std::vector<uint8_t> is_null_;
+};
+
+}  // namespace paimon
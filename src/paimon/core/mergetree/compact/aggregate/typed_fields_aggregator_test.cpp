@@ -0,0 +1,135 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/mergetree/compact/aggregate/typed_fields_aggregator.h"
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "arrow/api.h"
+#include "gtest/gtest.h"
+#include "paimon/common/data/generic_row.h"
+#include "paimon/core/core_options.h"
+#include "paimon/core/mergetree/compact/aggregate/field_aggregator_factory.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+class TypedFieldsAggregatorTest : public ::testing::Test {
+ public:
+    template <typename T>
+    static VariantType RandomValue(std::mt19937* random) {
+        if ((*random)() % 5 == 0) {
+            return NullType();
+        }
+        return static_cast<T>(static_cast<int32_t>((*random)() % 200) - 100);
+    }
+
+    static VariantType RandomValue(const std::shared_ptr<arrow::DataType>& type,
+                                   std::mt19937* random) {
+        switch (type->id()) {
+            case arrow::Type::type::INT8:
+                return RandomValue<char>(random);
+            case arrow::Type::type::INT16:
+                return RandomValue<int16_t>(random);
+            case arrow::Type::type::INT32:
+                return RandomValue<int32_t>(random);
+            case arrow::Type::type::INT64:
+                return RandomValue<int64_t>(random);
+            case arrow::Type::type::FLOAT:
+                return RandomValue<float>(random);
+            default:
+                return RandomValue<double>(random);
+        }
+    }
+
+    // checks the typed aggregator produces the same result as the field aggregator
+    static void CheckSameAsFieldAggregator(const std::string& agg_name,
+                                           const std::shared_ptr<arrow::DataType>& type,
+                                           bool with_retract) {
+        SCOPED_TRACE(agg_name + " " + type->ToString());
+        int32_t field_count = 3;
+        ASSERT_OK_AND_ASSIGN(CoreOptions options, CoreOptions::FromMap({}));
+        std::vector<std::unique_ptr<FieldAggregator>> field_aggs;
+        for (int32_t i = 0; i < field_count; i++) {
+            ASSERT_OK_AND_ASSIGN(auto field_agg, FieldAggregatorFactory::CreateFieldAggregator(
+                                                     "f" + std::to_string(i), type, agg_name,
+                                                     options));
+            field_aggs.push_back(std::move(field_agg));
+        }
+        ASSERT_TRUE(TypedFieldsAggregator::IsSupported(agg_name, type));
+        std::unique_ptr<TypedFieldsAggregator> typed_agg =
+            TypedFieldsAggregator::Create(agg_name, type, {0, 1, 2});
+        ASSERT_TRUE(typed_agg);
+
+        std::mt19937 random(42);
+        for (int32_t round = 0; round < 10; round++) {
+            typed_agg->Reset();
+            std::vector<VariantType> expected(field_count, NullType());
+            int32_t row_count = random() % 20 + 1;
+            for (int32_t r = 0; r < row_count; r++) {
+                bool is_retract = with_retract && random() % 3 == 0;
+                GenericRow input(field_count);
+                for (int32_t i = 0; i < field_count; i++) {
+                    input.SetField(i, RandomValue(type, &random));
+                    const VariantType& field = input.GetField(i);
+                    if (is_retract) {
+                        ASSERT_OK_AND_ASSIGN(expected[i],
+                                             field_aggs[i]->Retract(expected[i], field));
+                    } else {
+                        expected[i] = field_aggs[i]->Agg(expected[i], field);
+                    }
+                }
+                ASSERT_OK(typed_agg->Add(input, is_retract));
+            }
+            GenericRow result(field_count);
+            typed_agg->WriteTo(&result);
+            for (int32_t i = 0; i < field_count; i++) {
+                ASSERT_EQ(expected[i], result.GetField(i)) << "round " << round << " field " << i;
+            }
+        }
+    }
+};
+
+TEST_F(TypedFieldsAggregatorTest, TestSameAsFieldAggregator) {
+    for (const auto& type : {arrow::int8(), arrow::int16(), arrow::int32(), arrow::int64(),
+                             arrow::float32(), arrow::float64()}) {
+        CheckSameAsFieldAggregator("sum", type, /*with_retract=*/true);
+        CheckSameAsFieldAggregator("min", type, /*with_retract=*/false);
+        CheckSameAsFieldAggregator("max", type, /*with_retract=*/false);
+    }
+}
+
+TEST_F(TypedFieldsAggregatorTest, TestNotSupported) {
+    ASSERT_FALSE(TypedFieldsAggregator::IsSupported("last_value", arrow::int32()));
+    ASSERT_FALSE(TypedFieldsAggregator::IsSupported("sum", arrow::decimal128(10, 2)));
+    ASSERT_FALSE(TypedFieldsAggregator::IsSupported("max", arrow::utf8()));
+    ASSERT_FALSE(TypedFieldsAggregator::Create("max", arrow::utf8(), {0}));
+}
+
+TEST_F(TypedFieldsAggregatorTest, TestRetractNotSupported) {
+    std::unique_ptr<TypedFieldsAggregator> typed_agg =
+        TypedFieldsAggregator::Create("max", arrow::int64(), {0});
+    GenericRow input(1);
+    input.SetField(0, static_cast<int64_t>(1));
+    ASSERT_OK(typed_agg->Add(input, /*is_retract=*/false));
+    ASSERT_NOK_WITH_MSG(typed_agg->Add(input, /*is_retract=*/true),
+                        "Aggregate function max does not support retraction");
+}
+
+}  // namespace paimon::test
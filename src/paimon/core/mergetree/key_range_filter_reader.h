@@ -0,0 +1,107 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "paimon/common/data/binary_row.h"
+#include "paimon/core/key_value.h"
+#include "paimon/core/mergetree/compact/sort_merge_reader.h"
+#include "paimon/core/utils/fields_comparator.h"
+#include "paimon/result.h"
+
+namespace paimon {
+class Metrics;
+
+/// A `RecordReader` which only outputs `KeyValue` whose key is in [lower_key, upper_key) from
+/// the wrapped reader. As the wrapped reader is sorted by key, reading stops at the first key
+/// not less than upper_key.
+class KeyRangeFilterReader : public SortMergeReader {
+ public:
+    KeyRangeFilterReader(std::unique_ptr<SortMergeReader>&& reader,
+                         const std::shared_ptr<FieldsComparator>& key_comparator,
+                         const std::optional<BinaryRow>& lower_key,
+                         const std::optional<BinaryRow>& upper_key)
+        : reader_(std::move(reader)),
+          key_comparator_(key_comparator),
+          lower_key_(lower_key),
+          upper_key_(upper_key) {}
+
+    class Iterator : public SortMergeReader::Iterator {
+     public:
+        Iterator(std::unique_ptr<SortMergeReader::Iterator>&& iterator,
+                 KeyRangeFilterReader* reader)
+            : iterator_(std::move(iterator)), reader_(reader) {}
+        Result<bool> HasNext() override {
+            while (true) {
+                PAIMON_ASSIGN_OR_RAISE(bool has_next, iterator_->HasNext());
+                if (!has_next) {
+                    return false;
+                }
+                result_ = std::move(iterator_->Next());
+                const InternalRow& key = *(result_.value().key);
+                if (reader_->upper_key_ &&
+                    reader_->key_comparator_->CompareTo(key, reader_->upper_key_.value()) >= 0) {
+                    reader_->end_of_range_ = true;
+                    return false;
+                }
+                if (!reader_->lower_key_ ||
+                    reader_->key_comparator_->CompareTo(key, reader_->lower_key_.value()) >= 0) {
+                    break;
+                }
+            }
+            return true;
+        }
+        KeyValue&& Next() override {
+            return std::move(result_).value();
+        }
+
+     private:
+        std::optional<KeyValue> result_;
+        std::unique_ptr<SortMergeReader::Iterator> iterator_;
+        KeyRangeFilterReader* reader_;
+    };
+
+    Result<std::unique_ptr<SortMergeReader::Iterator>> NextBatch() override {
+        if (end_of_range_) {
+            return std::unique_ptr<SortMergeReader::Iterator>();
+        }
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<SortMergeReader::Iterator> iter,
+                               reader_->NextBatch());
+        if (iter == nullptr) {
+            return iter;
+        }
+        return std::make_unique<Iterator>(std::move(iter), this);
+    }
+
+    std::shared_ptr<Metrics> GetReaderMetrics() const override {
+        return reader_->GetReaderMetrics();
+    }
+
+    void Close() override {
+        reader_->Close();
+    }
+
+ private:
+    std::unique_ptr<SortMergeReader> reader_;
+    std::shared_ptr<FieldsComparator> key_comparator_;
+    std::optional<BinaryRow> lower_key_;
+    std::optional<BinaryRow> upper_key_;
+    bool end_of_range_ = false;
+};
+}  // namespace paimon
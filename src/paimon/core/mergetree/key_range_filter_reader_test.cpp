@@ -0,0 +1,124 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/mergetree/key_range_filter_reader.h"
+
+#include <cstddef>
+#include <variant>
+#include <vector>
+
+#include "arrow/api.h"
+#include "gtest/gtest.h"
+#include "paimon/common/data/internal_row.h"
+#include "paimon/common/types/data_field.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/status.h"
+#include "paimon/testing/utils/binary_row_generator.h"
+#include "paimon/testing/utils/read_result_collector.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon {
+class Metrics;
+}  // namespace paimon
+
+namespace paimon::test {
+class KeyRangeFilterReaderTest : public testing::Test {
+ public:
+    class FakeSortMergeReader : public SortMergeReader {
+     public:
+        explicit FakeSortMergeReader(std::vector<KeyValue>&& data) : data_(std::move(data)) {}
+
+        class Iterator : public SortMergeReader::Iterator {
+         public:
+            explicit Iterator(FakeSortMergeReader* reader) : reader_(reader) {}
+            Result<bool> HasNext() override {
+                return reader_->iter_ < reader_->data_.size();
+            }
+            KeyValue&& Next() override {
+                return std::move(reader_->data_[reader_->iter_++]);
+            }
+
+         private:
+            FakeSortMergeReader* reader_;
+        };
+
+        Result<std::unique_ptr<SortMergeReader::Iterator>> NextBatch() override {
+            if (iter_ < data_.size()) {
+                return std::make_unique<Iterator>(this);
+            }
+            return std::unique_ptr<SortMergeReader::Iterator>();
+        }
+
+        std::shared_ptr<Metrics> GetReaderMetrics() const override {
+            return nullptr;
+        }
+
+        void Close() override {}
+
+     private:
+        std::vector<KeyValue> data_;
+        size_t iter_ = 0;
+    };
+
+    void SetUp() override {
+        pool_ = GetDefaultPool();
+        ASSERT_OK_AND_ASSIGN(
+            key_comparator_,
+            FieldsComparator::Create({DataField(0, arrow::field("f0", arrow::int32(), false))},
+                                     /*is_ascending_order=*/true, /*use_view=*/true));
+    }
+
+    std::vector<int32_t> Read(const std::optional<BinaryRow>& lower_key,
+                              const std::optional<BinaryRow>& upper_key) const {
+        std::vector<KeyValue> kvs;
+        for (int32_t key : {10, 20, 30, 40, 50}) {
+            kvs.emplace_back(RowKind::Insert(), /*sequence_number=*/key, /*level=*/0,
+                             /*key=*/BinaryRowGenerator::GenerateRowPtr({key}, pool_.get()),
+                             /*value=*/BinaryRowGenerator::GenerateRowPtr({key, key}, pool_.get()));
+        }
+        auto reader = std::make_unique<KeyRangeFilterReader>(
+            std::make_unique<FakeSortMergeReader>(std::move(kvs)), key_comparator_, lower_key,
+            upper_key);
+        auto results =
+            ReadResultCollector::CollectKeyValueResult<SortMergeReader, SortMergeReader::Iterator>(
+                reader.get());
+        EXPECT_TRUE(results.ok());
+        std::vector<int32_t> keys;
+        for (const auto& kv : results.value()) {
+            keys.push_back(kv.key->GetInt(0));
+        }
+        return keys;
+    }
+
+ private:
+    std::shared_ptr<MemoryPool> pool_;
+    std::shared_ptr<FieldsComparator> key_comparator_;
+};
+
+TEST_F(KeyRangeFilterReaderTest, TestSimple) {
+    auto pool = GetDefaultPool();
+    ASSERT_EQ(Read(std::nullopt, std::nullopt), std::vector<int32_t>({10, 20, 30, 40, 50}));
+    ASSERT_EQ(Read(BinaryRowGenerator::GenerateRow({20}, pool.get()), std::nullopt),
+              std::vector<int32_t>({20, 30, 40, 50}));
+    ASSERT_EQ(Read(std::nullopt, BinaryRowGenerator::GenerateRow({40}, pool.get())),
+              std::vector<int32_t>({10, 20, 30}));
+    ASSERT_EQ(Read(BinaryRowGenerator::GenerateRow({15}, pool.get()),
+                   BinaryRowGenerator::GenerateRow({45}, pool.get())),
+              std::vector<int32_t>({20, 30, 40}));
+    ASSERT_EQ(Read(BinaryRowGenerator::GenerateRow({60}, pool.get()), std::nullopt),
+              std::vector<int32_t>());
+}
+}  // namespace paimon::test
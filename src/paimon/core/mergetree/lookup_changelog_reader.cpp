@@ -0,0 +1,104 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/mergetree/lookup_changelog_reader.h"
+
+#include "paimon/common/types/row_kind.h"
+#include "paimon/common/utils/projected_row.h"
+
+namespace paimon {
+
+LookupChangelogReader::LookupChangelogReader(std::unique_ptr<SortMergeReader>&& reader,
+                                             LookupLevels* lookup_levels,
+                                             MergeFunction* merge_function,
+                                             const std::shared_ptr<FieldsComparator>&
+                                                 user_defined_seq_comparator,
+                                             bool first_row, int32_t value_arity)
+    : reader_(std::move(reader)),
+      lookup_levels_(lookup_levels),
+      merge_function_(merge_function),
+      user_defined_seq_comparator_(user_defined_seq_comparator),
+      first_row_(first_row) {
+    value_mapping_.reserve(value_arity);
+    for (int32_t i = 0; i < value_arity; i++) {
+        value_mapping_.push_back(i);
+    }
+}
+
+Result<bool> LookupChangelogReader::Iterator::HasNext() {
+    PAIMON_ASSIGN_OR_RAISE(bool has_next, iterator_->HasNext());
+    if (!has_next) {
+        return false;
+    }
+    result_ = std::move(iterator_->Next());
+    PAIMON_RETURN_NOT_OK(reader_->ProduceChangelog(&(result_.value())));
+    return true;
+}
+
+KeyValue LookupChangelogReader::MakeView(const RowKind* value_kind, const KeyValue& kv,
+                                         const std::shared_ptr<InternalRow>& value) const {
+    return KeyValue(value_kind, kv.sequence_number, kv.level, std::shared_ptr<InternalRow>(kv.key),
+                    std::make_unique<ProjectedRow>(value, value_mapping_));
+}
+
+Status LookupChangelogReader::ProduceChangelog(KeyValue* kv) {
+    PAIMON_ASSIGN_OR_RAISE(std::optional<KeyValue> before, lookup_levels_->Lookup(*kv->key));
+    // the value is shared by the written KeyValue and the changelog
+    std::shared_ptr<InternalRow> value = std::move(kv->value);
+    kv->value = std::make_unique<ProjectedRow>(value, value_mapping_);
+    if (first_row_) {
+        if (before == std::nullopt && kv->value_kind->IsAdd()) {
+            changelog_.push_back(MakeView(RowKind::Insert(), *kv, value));
+        }
+        return Status::OK();
+    }
+    std::shared_ptr<InternalRow> before_value;
+    merge_function_->Reset();
+    // the previous value is written earlier, so it is merged first unless its sequence fields are
+    // larger than the new value
+    bool before_is_newer = false;
+    if (before) {
+        before_value = std::move(before.value().value);
+        before_is_newer = user_defined_seq_comparator_ &&
+                          user_defined_seq_comparator_->CompareTo(*before_value, *value) > 0;
+        if (!before_is_newer) {
+            PAIMON_RETURN_NOT_OK(merge_function_->Add(
+                MakeView(before.value().value_kind, before.value(), before_value)));
+        }
+    }
+    PAIMON_RETURN_NOT_OK(merge_function_->Add(MakeView(kv->value_kind, *kv, value)));
+    if (before_is_newer) {
+        PAIMON_RETURN_NOT_OK(merge_function_->Add(
+            MakeView(before.value().value_kind, before.value(), before_value)));
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::optional<KeyValue> after, merge_function_->GetResult());
+    if (after == std::nullopt || after.value().value_kind->IsRetract()) {
+        if (before_value) {
+            changelog_.push_back(MakeView(RowKind::Delete(), *kv, before_value));
+        }
+        return Status::OK();
+    }
+    std::shared_ptr<InternalRow> after_value = std::move(after.value().value);
+    if (before_value) {
+        changelog_.push_back(MakeView(RowKind::UpdateBefore(), *kv, before_value));
+        changelog_.push_back(MakeView(RowKind::UpdateAfter(), *kv, after_value));
+    } else {
+        changelog_.push_back(MakeView(RowKind::Insert(), *kv, after_value));
+    }
+    return Status::OK();
+}
+
+}  // namespace paimon
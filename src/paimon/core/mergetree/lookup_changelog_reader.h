@@ -0,0 +1,109 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "paimon/core/key_value.h"
+#include "paimon/core/mergetree/compact/merge_function.h"
+#include "paimon/core/mergetree/compact/sort_merge_reader.h"
+#include "paimon/core/mergetree/lookup_levels.h"
+#include "paimon/core/utils/fields_comparator.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace paimon {
+class Metrics;
+
+/// A `RecordReader` which passes through the merged `KeyValue`s of the wrapped reader and
+/// produces their changelog by looking up the previous value of each key in `LookupLevels`:
+///
+/// <ul>
+/// <li>No previous value and the new value is added: +I new value.
+/// <li>Previous value exists and the new value is added: -U previous value, +U merged value.
+/// <li>Previous value exists and the new value is retracted: -D previous value.
+/// </ul>
+///
+/// For the first-row merge engine only keys without previous value produce +I.
+class LookupChangelogReader : public SortMergeReader {
+ public:
+    /// @param merge_function Merges the previous value with the new value to get the value after
+    /// the change, which should be the raw merge function of the table.
+    /// @param user_defined_seq_comparator Comparator of "sequence.field", the previous value is
+    /// merged after the new value if its sequence fields are larger. Nullptr if not specified.
+    LookupChangelogReader(std::unique_ptr<SortMergeReader>&& reader, LookupLevels* lookup_levels,
+                          MergeFunction* merge_function,
+                          const std::shared_ptr<FieldsComparator>& user_defined_seq_comparator,
+                          bool first_row, int32_t value_arity);
+
+    class Iterator : public SortMergeReader::Iterator {
+     public:
+        Iterator(std::unique_ptr<SortMergeReader::Iterator>&& iterator,
+                 LookupChangelogReader* reader)
+            : iterator_(std::move(iterator)), reader_(reader) {}
+        Result<bool> HasNext() override;
+        KeyValue&& Next() override {
+            return std::move(result_).value();
+        }
+
+     private:
+        std::optional<KeyValue> result_;
+        std::unique_ptr<SortMergeReader::Iterator> iterator_;
+        LookupChangelogReader* reader_;
+    };
+
+    Result<std::unique_ptr<SortMergeReader::Iterator>> NextBatch() override {
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<SortMergeReader::Iterator> iter,
+                               reader_->NextBatch());
+        if (iter == nullptr) {
+            return iter;
+        }
+        return std::make_unique<Iterator>(std::move(iter), this);
+    }
+
+    std::shared_ptr<Metrics> GetReaderMetrics() const override {
+        return reader_->GetReaderMetrics();
+    }
+
+    void Close() override {
+        reader_->Close();
+    }
+
+    /// @return The changelog produced so far, sorted by key.
+    std::vector<KeyValue> DrainChangelog() {
+        return std::move(changelog_);
+    }
+
+ private:
+    /// Produce changelog of `kv` and replace its value with a view sharing the same data.
+    Status ProduceChangelog(KeyValue* kv);
+    KeyValue MakeView(const RowKind* value_kind, const KeyValue& kv,
+                      const std::shared_ptr<InternalRow>& value) const;
+
+ private:
+    std::unique_ptr<SortMergeReader> reader_;
+    LookupLevels* lookup_levels_;
+    MergeFunction* merge_function_;
+    std::shared_ptr<FieldsComparator> user_defined_seq_comparator_;
+    bool first_row_;
+    std::vector<int32_t> value_mapping_;
+    std::vector<KeyValue> changelog_;
+};
+}  // namespace paimon
@@ -0,0 +1,178 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/mergetree/lookup_file.h"
+
+#include <cstdlib>
+
+#include "fmt/format.h"
+#include "paimon/common/fs/block_cache.h"
+#include "paimon/common/metrics/metrics_impl.h"
+#include "paimon/common/utils/path_util.h"
+#include "paimon/common/utils/uuid.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/fs/file_system_factory.h"
+#include "paimon/memory/memory_pool.h"
+
+namespace paimon {
+
+LookupFile::LookupFile(const std::shared_ptr<FileSystem>& fs, const std::string& local_path,
+                       const std::string& remote_file_name,
+                       std::unique_ptr<SortLookupStoreReader>&& reader)
+    : fs_(fs),
+      local_path_(local_path),
+      remote_file_name_(remote_file_name),
+      reader_(std::move(reader)) {}
+
+LookupFile::~LookupFile() {
+    reader_.reset();
+    // delete quietly will ignore any status error
+    auto status = fs_->Delete(local_path_, /*recursive=*/false);
+    (void)status;
+}
+
+Result<std::shared_ptr<LookupFileCache>> LookupFileCache::Create(const std::string& local_dir,
+                                                                 int64_t max_disk_size,
+                                                                 int64_t max_memory_size) {
+    std::string parent_dir = local_dir;
+    if (parent_dir.empty()) {
+        const char* tmp_dir = std::getenv("TMPDIR");
+        parent_dir = (tmp_dir != nullptr && tmp_dir[0] != '\0') ? tmp_dir : "/tmp";
+    }
+    std::string uuid;
+    if (!UUID::Generate(&uuid)) {
+        return Status::Invalid("generate uuid for lookup file cache failed");
+    }
+    std::string cache_dir = PathUtil::JoinPath(parent_dir, "paimon-lookup-" + uuid);
+    // lookup files are always kept on the local disk, whatever the file system of the table is
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FileSystem> fs,
+                           FileSystemFactory::Get("local", cache_dir, /*fs_options=*/{}));
+    auto status = fs->Mkdirs(cache_dir);
+    if (!status.ok()) {
+        return Status::IOError(
+            fmt::format("create lookup cache dir '{}' fail, {}", cache_dir, status.ToString()));
+    }
+    // the blocks of lookup files vary in size, so the block size of the cache is only nominal,
+    // and the lookup files are already local, so the blocks are only cached in memory
+    PAIMON_ASSIGN_OR_RAISE(
+        std::shared_ptr<BlockCache> block_cache,
+        BlockCache::Create(cache_dir, SortLookupStoreOptions().block_size, max_memory_size,
+                           /*max_disk_size=*/0, /*executor=*/nullptr, GetDefaultPool()));
+    return std::shared_ptr<LookupFileCache>(
+        new LookupFileCache(fs, cache_dir, max_disk_size, block_cache));
+}
+
+LookupFileCache::LookupFileCache(const std::shared_ptr<FileSystem>& fs,
+                                 const std::string& cache_dir, int64_t max_disk_size,
+                                 const std::shared_ptr<BlockCache>& block_cache)
+    : fs_(fs), cache_dir_(cache_dir), max_disk_size_(max_disk_size), block_cache_(block_cache) {}
+
+LookupFileCache::~LookupFileCache() {
+    files_.clear();
+    lru_list_.clear();
+    block_cache_.reset();
+    // delete quietly will ignore any status error
+    auto status = fs_->Delete(cache_dir_, /*recursive=*/true);
+    (void)status;
+}
+
+std::shared_ptr<LookupFile> LookupFileCache::Get(const std::string& remote_file_name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = files_.find(remote_file_name);
+    if (iter == files_.end()) {
+        miss_count_++;
+        return nullptr;
+    }
+    hit_count_++;
+    lru_list_.splice(lru_list_.begin(), lru_list_, iter->second);
+    return *(iter->second);
+}
+
+void LookupFileCache::Put(const std::shared_ptr<LookupFile>& lookup_file) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = files_.find(lookup_file->RemoteFileName());
+    if (iter != files_.end()) {
+        disk_size_ -= (*(iter->second))->FileSize();
+        lru_list_.erase(iter->second);
+        files_.erase(iter);
+    }
+    lru_list_.push_front(lookup_file);
+    files_[lookup_file->RemoteFileName()] = lru_list_.begin();
+    disk_size_ += lookup_file->FileSize();
+    EvictIfNeeded();
+}
+
+void LookupFileCache::Invalidate(const std::string& remote_file_name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = files_.find(remote_file_name);
+    if (iter == files_.end()) {
+        return;
+    }
+    disk_size_ -= (*(iter->second))->FileSize();
+    lru_list_.erase(iter->second);
+    files_.erase(iter);
+}
+
+void LookupFileCache::EvictIfNeeded() {
+    // always keep the most recently used file, which is about to be looked up
+    while (disk_size_ > max_disk_size_ && lru_list_.size() > 1) {
+        const std::shared_ptr<LookupFile>& eldest = lru_list_.back();
+        disk_size_ -= eldest->FileSize();
+        files_.erase(eldest->RemoteFileName());
+        lru_list_.pop_back();
+        eviction_count_++;
+    }
+}
+
+std::string LookupFileCache::NewLocalPath(const std::string& remote_file_name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return PathUtil::JoinPath(cache_dir_,
+                              fmt::format("{}-{}.lookup", remote_file_name, local_file_id_++));
+}
+
+size_t LookupFileCache::FileCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return files_.size();
+}
+
+int64_t LookupFileCache::DiskSize() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return disk_size_;
+}
+
+std::shared_ptr<Metrics> LookupFileCache::GetMetrics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto metrics = std::make_shared<MetricsImpl>();
+    metrics->SetCounter(LookupFileCacheMetrics::LOOKUP_FILE_CACHE_HIT_COUNT, hit_count_);
+    metrics->SetCounter(LookupFileCacheMetrics::LOOKUP_FILE_CACHE_MISS_COUNT, miss_count_);
+    metrics->SetCounter(LookupFileCacheMetrics::LOOKUP_FILE_CACHE_EVICTION_COUNT, eviction_count_);
+    metrics->SetCounter(LookupFileCacheMetrics::LOOKUP_FILE_CACHE_FILE_COUNT, files_.size());
+    metrics->SetCounter(LookupFileCacheMetrics::LOOKUP_FILE_CACHE_DISK_SIZE, disk_size_);
+    // renamed, not to be mixed up with the block cache of the table file system
+    std::shared_ptr<Metrics> block_cache_metrics = block_cache_->GetMetrics();
+    metrics->SetCounter(
+        LookupFileCacheMetrics::LOOKUP_BLOCK_CACHE_HIT_COUNT,
+        block_cache_metrics->GetCounter(BlockCacheMetrics::BLOCK_CACHE_MEMORY_HIT_COUNT)
+            .value_or(0));
+    metrics->SetCounter(
+        LookupFileCacheMetrics::LOOKUP_BLOCK_CACHE_MISS_COUNT,
+        block_cache_metrics->GetCounter(BlockCacheMetrics::BLOCK_CACHE_MISS_COUNT).value_or(0));
+    metrics->SetCounter(LookupFileCacheMetrics::LOOKUP_BLOCK_CACHE_MEMORY_SIZE,
+                        block_cache_->MemorySize());
+    return metrics;
+}
+
+}  // namespace paimon
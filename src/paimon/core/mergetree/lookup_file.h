@@ -0,0 +1,146 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include "paimon/common/lookup/sort_lookup_store.h"
+#include "paimon/result.h"
+
+namespace paimon {
+class BlockCache;
+class FileSystem;
+class MemoryPool;
+class Metrics;
+
+class LookupFileCacheMetrics {
+ public:
+    static constexpr char LOOKUP_FILE_CACHE_HIT_COUNT[] = "lookupFileCacheHitCount";
+    static constexpr char LOOKUP_FILE_CACHE_MISS_COUNT[] = "lookupFileCacheMissCount";
+    static constexpr char LOOKUP_FILE_CACHE_EVICTION_COUNT[] = "lookupFileCacheEvictionCount";
+    static constexpr char LOOKUP_FILE_CACHE_FILE_COUNT[] = "lookupFileCacheFileCount";
+    static constexpr char LOOKUP_FILE_CACHE_DISK_SIZE[] = "lookupFileCacheDiskSize";
+    static constexpr char LOOKUP_BLOCK_CACHE_HIT_COUNT[] = "lookupBlockCacheHitCount";
+    static constexpr char LOOKUP_BLOCK_CACHE_MISS_COUNT[] = "lookupBlockCacheMissCount";
+    static constexpr char LOOKUP_BLOCK_CACHE_MEMORY_SIZE[] = "lookupBlockCacheMemorySize";
+};
+
+/// A local file converted from a remote data file, which supports looking up a key without
+/// decoding the remote file. The local file is deleted when the `LookupFile` is destroyed.
+class LookupFile {
+ public:
+    LookupFile(const std::shared_ptr<FileSystem>& fs, const std::string& local_path,
+               const std::string& remote_file_name,
+               std::unique_ptr<SortLookupStoreReader>&& reader);
+    ~LookupFile();
+
+    Result<std::optional<std::string>> Get(std::string_view key) const {
+        return reader_->Lookup(key);
+    }
+
+    const std::string& LocalPath() const {
+        return local_path_;
+    }
+    const std::string& RemoteFileName() const {
+        return remote_file_name_;
+    }
+    int64_t FileSize() const {
+        return reader_->FileSize();
+    }
+
+ private:
+    std::shared_ptr<FileSystem> fs_;
+    std::string local_path_;
+    std::string remote_file_name_;
+    std::unique_ptr<SortLookupStoreReader> reader_;
+};
+
+/// Caches lookup files by the name of their remote data file. The least recently used files are
+/// evicted once the total size of the local files exceeds the max disk size. An evicted file is
+/// deleted as soon as it is no longer in use. The data blocks read by the lookups of all files
+/// share a memory cache bounded by the max memory size. The cache is thread safe and can be
+/// shared by the writers of a table.
+class LookupFileCache {
+ public:
+    /// @param local_dir Parent directory of the local files, a unique sub directory is created
+    /// for the cache and removed when the cache is destroyed. Use the system temporary directory
+    /// if empty.
+    static Result<std::shared_ptr<LookupFileCache>> Create(const std::string& local_dir,
+                                                           int64_t max_disk_size,
+                                                           int64_t max_memory_size);
+
+    ~LookupFileCache();
+
+    /// @return The lookup file of the remote data file, or nullptr if it is not cached.
+    std::shared_ptr<LookupFile> Get(const std::string& remote_file_name);
+
+    void Put(const std::shared_ptr<LookupFile>& lookup_file);
+
+    void Invalidate(const std::string& remote_file_name);
+
+    /// @return A new local path in the cache directory for the remote data file.
+    std::string NewLocalPath(const std::string& remote_file_name);
+
+    /// @return The file system of the local files.
+    const std::shared_ptr<FileSystem>& GetFileSystem() const {
+        return fs_;
+    }
+    /// @return The memory cache of the data blocks of the local files.
+    const std::shared_ptr<BlockCache>& GetBlockCache() const {
+        return block_cache_;
+    }
+
+    size_t FileCount() const;
+    int64_t DiskSize() const;
+
+    std::shared_ptr<Metrics> GetMetrics() const;
+
+ private:
+    using LruList = std::list<std::shared_ptr<LookupFile>>;
+
+    LookupFileCache(const std::shared_ptr<FileSystem>& fs, const std::string& cache_dir,
+                    int64_t max_disk_size, const std::shared_ptr<BlockCache>& block_cache);
+
+    void EvictIfNeeded();
+
+ private:
+    std::shared_ptr<FileSystem> fs_;
+    std::string cache_dir_;
+    int64_t max_disk_size_;
+    std::shared_ptr<BlockCache> block_cache_;
+
+    mutable std::mutex mutex_;
+    // the most recently used file is at the front
+    LruList lru_list_;
+    std::unordered_map<std::string, LruList::iterator> files_;
+    int64_t disk_size_ = 0;
+    uint64_t local_file_id_ = 0;
+    uint64_t hit_count_ = 0;
+    uint64_t miss_count_ = 0;
+    uint64_t eviction_count_ = 0;
+};
+
+}  // namespace paimon
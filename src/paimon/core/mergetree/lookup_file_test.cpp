@@ -0,0 +1,142 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/mergetree/lookup_file.h"
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/metrics.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+class LookupFileTest : public testing::Test {
+ public:
+    void SetUp() override {
+        dir_ = UniqueTestDirectory::Create();
+        ASSERT_TRUE(dir_);
+        pool_ = GetDefaultPool();
+    }
+
+    Result<std::shared_ptr<LookupFile>> CreateLookupFile(LookupFileCache* cache,
+                                                         const std::string& remote_file_name) {
+        std::string local_path = cache->NewLocalPath(remote_file_name);
+        const std::shared_ptr<FileSystem>& fs = cache->GetFileSystem();
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<SortLookupStoreWriter> writer,
+                               SortLookupStoreWriter::Create(fs, local_path,
+                                                             SortLookupStoreOptions(), 1,
+                                                             /*comparator=*/nullptr, pool_));
+        PAIMON_RETURN_NOT_OK(writer->Put("key", "value of " + remote_file_name));
+        PAIMON_RETURN_NOT_OK(writer->Finish());
+        PAIMON_ASSIGN_OR_RAISE(
+            std::unique_ptr<SortLookupStoreReader> reader,
+            SortLookupStoreReader::Open(fs, local_path, /*comparator=*/nullptr,
+                                        cache->GetBlockCache(), pool_));
+        return std::make_shared<LookupFile>(fs, local_path, remote_file_name, std::move(reader));
+    }
+
+ protected:
+    std::unique_ptr<UniqueTestDirectory> dir_;
+    std::shared_ptr<MemoryPool> pool_;
+};
+
+TEST_F(LookupFileTest, TestGetAndPut) {
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<LookupFileCache> cache,
+                         LookupFileCache::Create(dir_->Str(), /*max_disk_size=*/1024 * 1024,
+                                                 /*max_memory_size=*/1024 * 1024));
+    ASSERT_FALSE(cache->Get("data-1.orc"));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<LookupFile> file,
+                         CreateLookupFile(cache.get(), "data-1.orc"));
+    cache->Put(file);
+    ASSERT_EQ(1, cache->FileCount());
+    ASSERT_EQ(file->FileSize(), cache->DiskSize());
+
+    std::shared_ptr<LookupFile> cached = cache->Get("data-1.orc");
+    ASSERT_EQ(file, cached);
+    ASSERT_OK_AND_ASSIGN(std::optional<std::string> value, cached->Get("key"));
+    ASSERT_TRUE(value);
+    ASSERT_EQ("value of data-1.orc", value.value());
+
+    cache->Invalidate("data-1.orc");
+    ASSERT_FALSE(cache->Get("data-1.orc"));
+    ASSERT_EQ(0, cache->FileCount());
+    ASSERT_EQ(0, cache->DiskSize());
+    // the local file is deleted once it is no longer in use
+    std::string local_path = file->LocalPath();
+    ASSERT_TRUE(std::filesystem::exists(local_path));
+    file.reset();
+    cached.reset();
+    ASSERT_FALSE(std::filesystem::exists(local_path));
+
+    auto metrics = cache->GetMetrics();
+    ASSERT_OK_AND_ASSIGN(uint64_t hit_count,
+                         metrics->GetCounter(LookupFileCacheMetrics::LOOKUP_FILE_CACHE_HIT_COUNT));
+    ASSERT_EQ(1, hit_count);
+    ASSERT_OK_AND_ASSIGN(uint64_t miss_count,
+                         metrics->GetCounter(LookupFileCacheMetrics::LOOKUP_FILE_CACHE_MISS_COUNT));
+    ASSERT_EQ(2, miss_count);
+}
+
+TEST_F(LookupFileTest, TestEvictLeastRecentlyUsed) {
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<LookupFileCache> probe_cache,
+                         LookupFileCache::Create(dir_->Str(), /*max_disk_size=*/1024 * 1024,
+                                                 /*max_memory_size=*/1024 * 1024));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<LookupFile> probe,
+                         CreateLookupFile(probe_cache.get(), "data-0.orc"));
+    int64_t file_size = probe->FileSize();
+
+    // the cache can hold two files
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<LookupFileCache> cache,
+                         LookupFileCache::Create(dir_->Str(), file_size * 2,
+                                                 /*max_memory_size=*/1024 * 1024));
+    for (const auto& name : {"data-1.orc", "data-2.orc"}) {
+        ASSERT_OK_AND_ASSIGN(std::shared_ptr<LookupFile> file,
+                             CreateLookupFile(cache.get(), name));
+        cache->Put(file);
+    }
+    // touch data-1.orc, so that data-2.orc is the least recently used one
+    ASSERT_TRUE(cache->Get("data-1.orc"));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<LookupFile> file,
+                         CreateLookupFile(cache.get(), "data-3.orc"));
+    std::string local_path = file->LocalPath();
+    cache->Put(file);
+    file.reset();
+
+    ASSERT_EQ(2, cache->FileCount());
+    ASSERT_EQ(file_size * 2, cache->DiskSize());
+    ASSERT_TRUE(cache->Get("data-1.orc"));
+    ASSERT_FALSE(cache->Get("data-2.orc"));
+    ASSERT_TRUE(cache->Get("data-3.orc"));
+    ASSERT_TRUE(std::filesystem::exists(local_path));
+
+    auto metrics = cache->GetMetrics();
+    ASSERT_OK_AND_ASSIGN(
+        uint64_t eviction_count,
+        metrics->GetCounter(LookupFileCacheMetrics::LOOKUP_FILE_CACHE_EVICTION_COUNT));
+    ASSERT_EQ(1, eviction_count);
+
+    // cache dir is removed with the cache
+    std::string cache_dir = std::filesystem::path(local_path).parent_path().string();
+    cache.reset();
+    ASSERT_FALSE(std::filesystem::exists(cache_dir));
+}
+
+}  // namespace paimon::test
@@ -0,0 +1,488 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/mergetree/lookup_levels.h"
+
+#include <algorithm>
+#include <cstring>
+#include <set>
+#include <utility>
+
+#include "arrow/api.h"
+#include "arrow/c/bridge.h"
+#include "fmt/format.h"
+#include "paimon/common/data/binary_string.h"
+#include "paimon/common/data/generic_row.h"
+#include "paimon/common/table/special_fields.h"
+#include "paimon/common/types/data_field.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/common/utils/projected_row.h"
+#include "paimon/common/utils/scope_guard.h"
+#include "paimon/core/io/data_file_path_factory.h"
+#include "paimon/core/io/field_mapping_reader.h"
+#include "paimon/core/io/key_value_data_file_record_reader.h"
+#include "paimon/core/schema/schema_manager.h"
+#include "paimon/core/schema/table_schema.h"
+#include "paimon/core/utils/serialized_row_comparator.h"
+#include "paimon/format/file_format.h"
+#include "paimon/format/file_format_factory.h"
+#include "paimon/format/reader_builder.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/memory/bytes.h"
+#include "paimon/reader/file_batch_reader.h"
+
+namespace paimon {
+class MemoryPool;
+
+Result<std::unique_ptr<LookupLevels>> LookupLevels::Create(
+    const std::shared_ptr<TableSchema>& table_schema,
+    const std::shared_ptr<SchemaManager>& schema_manager, const CoreOptions& options,
+    const std::shared_ptr<DataFilePathFactory>& path_factory,
+    const std::shared_ptr<FieldsComparator>& key_comparator,
+    const std::shared_ptr<FieldsComparator>& user_defined_seq_comparator,
+    std::unique_ptr<MergeFunction>&& merge_function,
+    const std::vector<std::shared_ptr<DataFileMeta>>& files,
+    const std::shared_ptr<LookupFileCache>& lookup_file_cache,
+    const std::shared_ptr<MemoryPool>& pool) {
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::string> trimmed_primary_keys,
+                           table_schema->TrimmedPrimaryKeys());
+    PAIMON_ASSIGN_OR_RAISE(std::vector<DataField> key_fields,
+                           table_schema->GetFields(trimmed_primary_keys));
+    const std::vector<DataField>& value_fields = table_schema->Fields();
+    auto value_schema = DataField::ConvertDataFieldsToArrowSchema(value_fields);
+    // KeyValueDataFileRecordReader expects key fields right after the special fields
+    std::set<std::string> key_names(trimmed_primary_keys.begin(), trimmed_primary_keys.end());
+    std::vector<DataField> read_fields = {SpecialFields::SequenceNumber(),
+                                          SpecialFields::ValueKind()};
+    read_fields.insert(read_fields.end(), key_fields.begin(), key_fields.end());
+    for (const auto& field : value_fields) {
+        if (key_names.find(field.Name()) == key_names.end()) {
+            read_fields.push_back(field);
+        }
+    }
+    auto read_schema = DataField::ConvertDataFieldsToArrowSchema(read_fields);
+    // partition fields are also stored in the data files, so they are read from the files
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FieldMappingBuilder> field_mapping_builder,
+                           FieldMappingBuilder::Create(read_schema, /*partition_keys=*/{},
+                                                       /*predicate=*/nullptr));
+    std::vector<int32_t> key_mapping;
+    key_mapping.reserve(trimmed_primary_keys.size());
+    for (const auto& key_name : trimmed_primary_keys) {
+        int32_t index = value_schema->GetFieldIndex(key_name);
+        if (index < 0) {
+            return Status::Invalid(fmt::format("cannot find key field {} in table schema",
+                                               key_name));
+        }
+        key_mapping.push_back(index);
+    }
+
+    // the lookup key may be any kind of row and the min and max keys of files are BinaryRow, so
+    // the key getters and the key comparator do not use view
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FieldsComparator> binary_key_comparator,
+                           FieldsComparator::Create(key_fields, /*is_ascending_order=*/true,
+                                                    /*use_view=*/false));
+    // keys and values are serialized into BinaryRow in lookup files
+    std::shared_ptr<LookupFileCache> cache = lookup_file_cache;
+    std::vector<InternalRow::FieldGetterFunc> key_getters;
+    std::vector<BinaryRowWriter::FieldSetterFunc> key_setters;
+    std::vector<InternalRow::FieldGetterFunc> value_getters;
+    std::vector<BinaryRowWriter::FieldSetterFunc> value_setters;
+    for (size_t i = 0; cache != nullptr && i < key_fields.size(); i++) {
+        PAIMON_ASSIGN_OR_RAISE(
+            InternalRow::FieldGetterFunc getter,
+            InternalRow::CreateFieldGetter(i, key_fields[i].Type(), /*use_view=*/false));
+        key_getters.push_back(std::move(getter));
+        PAIMON_ASSIGN_OR_RAISE(BinaryRowWriter::FieldSetterFunc setter,
+                               BinaryRowWriter::CreateFieldSetter(i, key_fields[i].Type()));
+        key_setters.push_back(std::move(setter));
+    }
+    for (size_t i = 0; cache != nullptr && i < value_fields.size(); i++) {
+        Result<BinaryRowWriter::FieldSetterFunc> setter =
+            BinaryRowWriter::CreateFieldSetter(i, value_fields[i].Type());
+        if (!setter.ok()) {
+            // nested types cannot be written into BinaryRow, fall back to load files into memory
+            cache = nullptr;
+            break;
+        }
+        value_setters.push_back(std::move(setter).value());
+        PAIMON_ASSIGN_OR_RAISE(
+            InternalRow::FieldGetterFunc getter,
+            InternalRow::CreateFieldGetter(i, value_fields[i].Type(), /*use_view=*/true));
+        value_getters.push_back(std::move(getter));
+    }
+    SortLookupStoreOptions store_options;
+    store_options.block_size = options.GetLookupCacheBlockSize();
+    store_options.bloom_filter_enabled = options.LookupCacheBloomFilterEnabled();
+    store_options.bloom_filter_fpp = options.GetLookupCacheBloomFilterFpp();
+    // a lookup file may outlive the LookupLevels converting it, so the comparator of the
+    // serialized keys holds all its state, it compares the keys in place in the blocks
+    auto key_arity = static_cast<int32_t>(trimmed_primary_keys.size());
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<SerializedRowComparator> serialized_key_comparator,
+                           SerializedRowComparator::Create(key_fields));
+    SortLookupStoreKeyComparator store_key_comparator =
+        [serialized_key_comparator](std::string_view lhs, std::string_view rhs) {
+            return serialized_key_comparator->CompareTo(lhs, rhs);
+        };
+
+    auto lookup_levels = std::unique_ptr<LookupLevels>(new LookupLevels(
+        table_schema->Id(), schema_manager, options, path_factory, key_comparator,
+        binary_key_comparator, user_defined_seq_comparator, std::move(merge_function), key_arity,
+        value_schema, read_schema, std::move(field_mapping_builder), std::move(key_mapping), cache,
+        store_options, store_key_comparator,
+        std::move(key_getters), std::move(key_setters), std::move(value_getters),
+        std::move(value_setters), pool));
+    lookup_levels->AddFiles(files);
+    return lookup_levels;
+}
+
+LookupLevels::LookupLevels(int64_t schema_id, const std::shared_ptr<SchemaManager>& schema_manager,
+                           const CoreOptions& options,
+                           const std::shared_ptr<DataFilePathFactory>& path_factory,
+                           const std::shared_ptr<FieldsComparator>& key_comparator,
+                           const std::shared_ptr<FieldsComparator>& binary_key_comparator,
+                           const std::shared_ptr<FieldsComparator>& user_defined_seq_comparator,
+                           std::unique_ptr<MergeFunction>&& merge_function, int32_t key_arity,
+                           const std::shared_ptr<arrow::Schema>& value_schema,
+                           const std::shared_ptr<arrow::Schema>& read_schema,
+                           std::unique_ptr<FieldMappingBuilder>&& field_mapping_builder,
+                           std::vector<int32_t>&& key_mapping,
+                           const std::shared_ptr<LookupFileCache>& lookup_file_cache,
+                           const SortLookupStoreOptions& store_options,
+                           const SortLookupStoreKeyComparator& store_key_comparator,
+                           std::vector<InternalRow::FieldGetterFunc>&& key_getters,
+                           std::vector<BinaryRowWriter::FieldSetterFunc>&& key_setters,
+                           std::vector<InternalRow::FieldGetterFunc>&& value_getters,
+                           std::vector<BinaryRowWriter::FieldSetterFunc>&& value_setters,
+                           const std::shared_ptr<MemoryPool>& pool)
+    : schema_id_(schema_id),
+      schema_manager_(schema_manager),
+      options_(options),
+      path_factory_(path_factory),
+      key_comparator_(key_comparator),
+      binary_key_comparator_(binary_key_comparator),
+      user_defined_seq_comparator_(user_defined_seq_comparator),
+      merge_function_(std::move(merge_function)),
+      key_arity_(key_arity),
+      value_schema_(value_schema),
+      read_schema_(read_schema),
+      field_mapping_builder_(std::move(field_mapping_builder)),
+      key_mapping_(std::move(key_mapping)),
+      lookup_file_cache_(lookup_file_cache),
+      store_options_(store_options),
+      store_key_comparator_(store_key_comparator),
+      key_getters_(std::move(key_getters)),
+      key_setters_(std::move(key_setters)),
+      value_getters_(std::move(value_getters)),
+      value_setters_(std::move(value_setters)),
+      pool_(pool),
+      key_row_(key_arity),
+      value_row_(value_schema->num_fields()) {
+    value_mapping_.reserve(value_schema_->num_fields());
+    for (int32_t i = 0; i < value_schema_->num_fields(); i++) {
+        value_mapping_.push_back(i);
+    }
+    key_writer_ = std::make_unique<BinaryRowWriter>(&key_row_, /*initial_size=*/0, pool_.get());
+    value_writer_ =
+        std::make_unique<BinaryRowWriter>(&value_row_, /*initial_size=*/1024, pool_.get());
+}
+
+LookupLevels::~LookupLevels() {
+    if (lookup_file_cache_ != nullptr) {
+        for (const auto& file_name : lookup_file_names_) {
+            lookup_file_cache_->Invalidate(file_name);
+        }
+    }
+}
+
+void LookupLevels::AddFiles(const std::vector<std::shared_ptr<DataFileMeta>>& files) {
+    files_.insert(files_.end(), files.begin(), files.end());
+}
+
+Result<std::optional<KeyValue>> LookupLevels::Lookup(const InternalRow& key) {
+    std::vector<LookupEntry> candidates;
+    // the serialized key is copied, as converting a data file into a lookup file reuses the key
+    // row to serialize the keys of the file
+    std::string key_bytes;
+    if (lookup_file_cache_ != nullptr) {
+        key_bytes = std::string(SerializeKey(key));
+    }
+    for (const auto& file : files_) {
+        if (binary_key_comparator_->CompareTo(key, file->min_key) < 0 ||
+            binary_key_comparator_->CompareTo(key, file->max_key) > 0) {
+            continue;
+        }
+        if (lookup_file_cache_ != nullptr) {
+            PAIMON_RETURN_NOT_OK(LookupInLocalFile(file, key_bytes, &candidates));
+        } else {
+            PAIMON_RETURN_NOT_OK(LookupInMemory(file, key, &candidates));
+        }
+    }
+    if (candidates.empty()) {
+        return std::optional<KeyValue>();
+    }
+    // merge function expects the versions of a key in the same order as sort merge reader
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [this](const LookupEntry& lhs, const LookupEntry& rhs) {
+                         if (user_defined_seq_comparator_ != nullptr) {
+                             int32_t result =
+                                 user_defined_seq_comparator_->CompareTo(*lhs.value, *rhs.value);
+                             if (result != 0) {
+                                 return result < 0;
+                             }
+                         }
+                         return lhs.sequence_number < rhs.sequence_number;
+                     });
+    merge_function_->Reset();
+    for (const LookupEntry& candidate : candidates) {
+        PAIMON_RETURN_NOT_OK(merge_function_->Add(
+            KeyValue(candidate.value_kind, candidate.sequence_number, candidate.level,
+                     std::shared_ptr<InternalRow>(candidate.key),
+                     std::make_unique<ProjectedRow>(candidate.value, value_mapping_))));
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::optional<KeyValue> result, merge_function_->GetResult());
+    if (result == std::nullopt || result.value().value_kind->IsRetract()) {
+        return std::optional<KeyValue>();
+    }
+    return result;
+}
+
+Status LookupLevels::LookupInMemory(const std::shared_ptr<DataFileMeta>& file,
+                                    const InternalRow& key, std::vector<LookupEntry>* candidates) {
+    PAIMON_ASSIGN_OR_RAISE(const std::vector<LookupEntry>* entries, GetOrLoad(file));
+    auto iter = std::lower_bound(entries->begin(), entries->end(), key,
+                                 [this](const LookupEntry& entry, const InternalRow& target) {
+                                     return key_comparator_->CompareTo(*entry.key, target) < 0;
+                                 });
+    for (; iter != entries->end() && key_comparator_->CompareTo(*iter->key, key) == 0; ++iter) {
+        candidates->push_back(*iter);
+    }
+    return Status::OK();
+}
+
+Status LookupLevels::LookupInLocalFile(const std::shared_ptr<DataFileMeta>& file,
+                                       std::string_view key_bytes,
+                                       std::vector<LookupEntry>* candidates) {
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<LookupFile> lookup_file, GetOrCreateLookupFile(file));
+    PAIMON_ASSIGN_OR_RAISE(std::optional<std::string> value, lookup_file->Get(key_bytes));
+    if (value) {
+        PAIMON_ASSIGN_OR_RAISE(LookupEntry entry, DeserializeValue(value.value(), file->level));
+        candidates->push_back(std::move(entry));
+    }
+    return Status::OK();
+}
+
+Result<const std::vector<LookupLevels::LookupEntry>*> LookupLevels::GetOrLoad(
+    const std::shared_ptr<DataFileMeta>& file) {
+    auto iter = loaded_files_.find(file->file_name);
+    if (iter == loaded_files_.end()) {
+        PAIMON_ASSIGN_OR_RAISE(std::vector<LookupEntry> entries, LoadFile(file));
+        iter = loaded_files_.emplace(file->file_name, std::move(entries)).first;
+    }
+    return &(iter->second);
+}
+
+Result<std::shared_ptr<LookupFile>> LookupLevels::GetOrCreateLookupFile(
+    const std::shared_ptr<DataFileMeta>& file) {
+    std::shared_ptr<LookupFile> lookup_file = lookup_file_cache_->Get(file->file_name);
+    if (lookup_file != nullptr) {
+        return lookup_file;
+    }
+    const std::shared_ptr<FileSystem>& fs = lookup_file_cache_->GetFileSystem();
+    std::string local_path = lookup_file_cache_->NewLocalPath(file->file_name);
+    PAIMON_ASSIGN_OR_RAISE(
+        std::unique_ptr<SortLookupStoreWriter> writer,
+        SortLookupStoreWriter::Create(fs, local_path, store_options_, file->row_count,
+                                      store_key_comparator_, pool_));
+    ScopeGuard guard([&fs, &local_path]() {
+        // delete quietly will ignore any status error
+        auto status = fs->Delete(local_path, /*recursive=*/false);
+        (void)status;
+    });
+    // key values of a data file are sorted by key, so they are streamed into the lookup file and
+    // only the previous entry is held back, in case the next one has the same key
+    std::string pending_key;
+    std::string pending_value;
+    bool has_pending = false;
+    PAIMON_RETURN_NOT_OK(ReadFile(file, [&](LookupEntry&& entry) -> Status {
+        std::string_view key = SerializeKey(*entry.key);
+        if (has_pending && key != pending_key) {
+            PAIMON_RETURN_NOT_OK(writer->Put(pending_key, pending_value));
+        }
+        // a key is unique in a data file, keep the last version if not
+        pending_key.assign(key.data(), key.size());
+        pending_value = SerializeValue(entry);
+        has_pending = true;
+        return Status::OK();
+    }));
+    if (has_pending) {
+        PAIMON_RETURN_NOT_OK(writer->Put(pending_key, pending_value));
+    }
+    PAIMON_RETURN_NOT_OK(writer->Finish());
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<SortLookupStoreReader> reader,
+                           SortLookupStoreReader::Open(fs, local_path, store_key_comparator_,
+                                                       lookup_file_cache_->GetBlockCache(), pool_));
+    guard.Release();
+    lookup_file =
+        std::make_shared<LookupFile>(fs, local_path, file->file_name, std::move(reader));
+    lookup_file_cache_->Put(lookup_file);
+    lookup_file_names_.insert(file->file_name);
+    return lookup_file;
+}
+
+std::string_view LookupLevels::SerializeKey(const InternalRow& key) {
+    key_writer_->Reset();
+    for (size_t i = 0; i < key_setters_.size(); i++) {
+        key_setters_[i](key_getters_[i](key), key_writer_.get());
+    }
+    key_writer_->Complete();
+    const MemorySegment& segment = key_row_.GetSegments()[0];
+    return std::string_view(segment.GetArray()->data() + key_row_.GetOffset(),
+                            key_row_.GetSizeInBytes());
+}
+
+std::string LookupLevels::SerializeValue(const LookupEntry& entry) {
+    value_writer_->Reset();
+    for (size_t i = 0; i < value_setters_.size(); i++) {
+        value_setters_[i](value_getters_[i](*entry.value), value_writer_.get());
+    }
+    value_writer_->Complete();
+    const MemorySegment& segment = value_row_.GetSegments()[0];
+    std::string bytes;
+    bytes.reserve(sizeof(int64_t) + sizeof(int8_t) + value_row_.GetSizeInBytes());
+    bytes.append(reinterpret_cast<const char*>(&entry.sequence_number), sizeof(int64_t));
+    bytes.push_back(static_cast<char>(entry.value_kind->ToByteValue()));
+    bytes.append(segment.GetArray()->data() + value_row_.GetOffset(),
+                 value_row_.GetSizeInBytes());
+    return bytes;
+}
+
+Result<LookupLevels::LookupEntry> LookupLevels::DeserializeValue(std::string_view bytes,
+                                                                 int32_t level) const {
+    constexpr size_t header_size = sizeof(int64_t) + sizeof(int8_t);
+    if (bytes.size() < header_size) {
+        return Status::Invalid(
+            fmt::format("lookup value size {} is less than {}", bytes.size(), header_size));
+    }
+    int64_t sequence_number;
+    std::memcpy(&sequence_number, bytes.data(), sizeof(int64_t));
+    PAIMON_ASSIGN_OR_RAISE(const RowKind* value_kind,
+                           RowKind::FromByteValue(static_cast<int8_t>(bytes[sizeof(int64_t)])));
+    auto row_size = static_cast<int32_t>(bytes.size() - header_size);
+    std::shared_ptr<Bytes> row_bytes = Bytes::AllocateBytes(row_size, pool_.get());
+    std::memcpy(row_bytes->data(), bytes.data() + header_size, row_size);
+    int32_t arity = value_schema_->num_fields();
+    auto binary_row = std::make_unique<BinaryRow>(arity);
+    binary_row->PointTo(MemorySegment::Wrap(row_bytes), /*offset=*/0, row_size);
+    // merge functions read string and binary fields by view, which BinaryRow does not support,
+    // so expose the fields through a GenericRow which views the bytes of the BinaryRow
+    auto value = std::make_shared<GenericRow>(arity);
+    for (int32_t i = 0; i < arity; i++) {
+        if (binary_row->IsNullAt(i)) {
+            value->SetField(i, NullType());
+            continue;
+        }
+        arrow::Type::type type_id = value_schema_->field(i)->type()->id();
+        if (type_id == arrow::Type::STRING || type_id == arrow::Type::BINARY) {
+            BinaryString str = binary_row->GetString(i);
+            const MemorySegment& segment = str.GetSegments()[0];
+            value->SetField(i, std::string_view(segment.GetArray()->data() + str.GetOffset(),
+                                                str.GetSizeInBytes()));
+        } else {
+            value->SetField(i, value_getters_[i](*binary_row));
+        }
+    }
+    value->AddDataHolder(std::move(binary_row));
+    return LookupEntry{value_kind, sequence_number, level,
+                       std::make_shared<ProjectedRow>(value, key_mapping_), value};
+}
+
+Result<std::vector<LookupLevels::LookupEntry>> LookupLevels::LoadFile(
+    const std::shared_ptr<DataFileMeta>& file) const {
+    std::vector<LookupEntry> entries;
+    entries.reserve(file->row_count);
+    PAIMON_RETURN_NOT_OK(ReadFile(file, [&entries](LookupEntry&& entry) -> Status {
+        entries.push_back(std::move(entry));
+        return Status::OK();
+    }));
+    return entries;
+}
+
+Status LookupLevels::ReadFile(const std::shared_ptr<DataFileMeta>& file,
+                              const std::function<Status(LookupEntry&&)>& consumer) const {
+    PAIMON_ASSIGN_OR_RAISE(std::string format_identifier, file->FileFormat());
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FileFormat> file_format,
+                           FileFormatFactory::Get(format_identifier, options_.ToMap()));
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<ReaderBuilder> reader_builder,
+                           file_format->CreateReaderBuilder(options_.GetReadBatchSize()));
+    reader_builder->WithMemoryPool(pool_);
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<InputStream> input_stream,
+                           options_.GetFileSystem()->Open(path_factory_->ToPath(file)));
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FileBatchReader> file_reader,
+                           reader_builder->Build(input_stream));
+    std::shared_ptr<arrow::Schema> file_read_schema = read_schema_;
+    std::unique_ptr<FieldMapping> field_mapping;
+    if (file->schema_id != schema_id_) {
+        if (schema_manager_ == nullptr) {
+            return Status::Invalid(
+                fmt::format("cannot read lookup file {} with schema id {} without schema manager",
+                            file->file_name, file->schema_id));
+        }
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<TableSchema> data_schema,
+                               schema_manager_->ReadSchema(file->schema_id));
+        std::vector<DataField> file_fields = {SpecialFields::SequenceNumber(),
+                                              SpecialFields::ValueKind()};
+        file_fields.insert(file_fields.end(), data_schema->Fields().begin(),
+                           data_schema->Fields().end());
+        PAIMON_ASSIGN_OR_RAISE(field_mapping,
+                               field_mapping_builder_->CreateFieldMapping(file_fields));
+        file_read_schema = DataField::ConvertDataFieldsToArrowSchema(
+            field_mapping->non_partition_info.non_partition_data_schema);
+    }
+    ::ArrowSchema c_read_schema;
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportSchema(*file_read_schema, &c_read_schema));
+    PAIMON_RETURN_NOT_OK(
+        file_reader->SetReadSchema(&c_read_schema, /*predicate=*/nullptr,
+                                   /*selection_bitmap=*/std::nullopt));
+    std::unique_ptr<BatchReader> batch_reader = std::move(file_reader);
+    if (field_mapping) {
+        // fills the fields added after the file is written with null and casts the evolved types
+        batch_reader = std::make_unique<FieldMappingReader>(
+            field_mapping_builder_->GetReadFieldCount(), std::move(batch_reader),
+            BinaryRow::EmptyRow(), std::move(field_mapping), pool_);
+    }
+    KeyValueDataFileRecordReader reader(std::move(batch_reader), key_arity_, value_schema_,
+                                        file->level, pool_);
+    ScopeGuard guard([&reader]() { reader.Close(); });
+    while (true) {
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<KeyValueRecordReader::Iterator> iterator,
+                               reader.NextBatch());
+        if (iterator == nullptr) {
+            break;
+        }
+        while (iterator->HasNext()) {
+            PAIMON_ASSIGN_OR_RAISE(KeyValue kv, iterator->Next());
+            // the key of KeyValueDataFileRecordReader does not hold the data, so project the key
+            // from the value instead
+            std::shared_ptr<InternalRow> value = std::move(kv.value);
+            PAIMON_RETURN_NOT_OK(
+                consumer({kv.value_kind, kv.sequence_number, kv.level,
+                          std::make_shared<ProjectedRow>(value, key_mapping_), value}));
+        }
+    }
+    return Status::OK();
+}
+
+}  // namespace paimon
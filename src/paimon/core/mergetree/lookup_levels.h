@@ -0,0 +1,192 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "paimon/common/data/binary_row.h"
+#include "paimon/common/data/binary_row_writer.h"
+#include "paimon/common/data/internal_row.h"
+#include "paimon/common/lookup/sort_lookup_store.h"
+#include "paimon/common/types/row_kind.h"
+#include "paimon/core/core_options.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/key_value.h"
+#include "paimon/core/mergetree/compact/merge_function.h"
+#include "paimon/core/mergetree/lookup_file.h"
+#include "paimon/core/utils/field_mapping.h"
+#include "paimon/core/utils/fields_comparator.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace arrow {
+class Schema;
+}  // namespace arrow
+
+namespace paimon {
+class DataFilePathFactory;
+class MemoryPool;
+class SchemaManager;
+class TableSchema;
+
+/// Looks up the merged value of a key among the data files of a bucket. A data file is converted
+/// into a local `LookupFile` the first time a looked up key falls into the key range of the file,
+/// the local files are kept in a `LookupFileCache` shared by the writers of a table.
+///
+/// If no cache is given or the value contains types which cannot be serialized into a
+/// `BinaryRow`, the key values of a data file are loaded into memory instead, and are kept until
+/// the `LookupLevels` is destroyed.
+///
+/// Data files written by a previous schema of the table are read through a `FieldMapping` into
+/// the fields of the current schema, the same as merge read.
+class LookupLevels {
+ public:
+    /// @param merge_function Merges all versions of a key found in the data files, which should
+    /// be the same merge function as the one used for merge read.
+    /// @param schema_manager Reads the schemas of the data files written by a previous schema,
+    /// may be nullptr if all files are written by `table_schema`.
+    /// @param lookup_file_cache Cache of the local lookup files, may be nullptr.
+    static Result<std::unique_ptr<LookupLevels>> Create(
+        const std::shared_ptr<TableSchema>& table_schema,
+        const std::shared_ptr<SchemaManager>& schema_manager, const CoreOptions& options,
+        const std::shared_ptr<DataFilePathFactory>& path_factory,
+        const std::shared_ptr<FieldsComparator>& key_comparator,
+        const std::shared_ptr<FieldsComparator>& user_defined_seq_comparator,
+        std::unique_ptr<MergeFunction>&& merge_function,
+        const std::vector<std::shared_ptr<DataFileMeta>>& files,
+        const std::shared_ptr<LookupFileCache>& lookup_file_cache,
+        const std::shared_ptr<MemoryPool>& pool);
+
+    ~LookupLevels();
+
+    void AddFiles(const std::vector<std::shared_ptr<DataFileMeta>>& files);
+
+    /// @return The merged `KeyValue` of the key, or std::nullopt if the key does not exist or
+    /// the merged result is retracted.
+    Result<std::optional<KeyValue>> Lookup(const InternalRow& key);
+
+    size_t FileCount() const {
+        return files_.size();
+    }
+    /// @return The number of files loaded into memory or converted into local lookup files.
+    size_t LoadedFileCount() const {
+        return loaded_files_.size() + lookup_file_names_.size();
+    }
+    bool UseLookupFile() const {
+        return lookup_file_cache_ != nullptr;
+    }
+
+ private:
+    struct LookupEntry {
+        const RowKind* value_kind;
+        int64_t sequence_number;
+        int32_t level;
+        std::shared_ptr<InternalRow> key;
+        std::shared_ptr<InternalRow> value;
+    };
+
+    LookupLevels(int64_t schema_id, const std::shared_ptr<SchemaManager>& schema_manager,
+                 const CoreOptions& options,
+                 const std::shared_ptr<DataFilePathFactory>& path_factory,
+                 const std::shared_ptr<FieldsComparator>& key_comparator,
+                 const std::shared_ptr<FieldsComparator>& binary_key_comparator,
+                 const std::shared_ptr<FieldsComparator>& user_defined_seq_comparator,
+                 std::unique_ptr<MergeFunction>&& merge_function, int32_t key_arity,
+                 const std::shared_ptr<arrow::Schema>& value_schema,
+                 const std::shared_ptr<arrow::Schema>& read_schema,
+                 std::unique_ptr<FieldMappingBuilder>&& field_mapping_builder,
+                 std::vector<int32_t>&& key_mapping,
+                 const std::shared_ptr<LookupFileCache>& lookup_file_cache,
+                 const SortLookupStoreOptions& store_options,
+                 const SortLookupStoreKeyComparator& store_key_comparator,
+                 std::vector<InternalRow::FieldGetterFunc>&& key_getters,
+                 std::vector<BinaryRowWriter::FieldSetterFunc>&& key_setters,
+                 std::vector<InternalRow::FieldGetterFunc>&& value_getters,
+                 std::vector<BinaryRowWriter::FieldSetterFunc>&& value_setters,
+                 const std::shared_ptr<MemoryPool>& pool);
+
+    Status LookupInMemory(const std::shared_ptr<DataFileMeta>& file, const InternalRow& key,
+                          std::vector<LookupEntry>* candidates);
+    Status LookupInLocalFile(const std::shared_ptr<DataFileMeta>& file, std::string_view key_bytes,
+                             std::vector<LookupEntry>* candidates);
+
+    Result<const std::vector<LookupEntry>*> GetOrLoad(const std::shared_ptr<DataFileMeta>& file);
+    Result<std::shared_ptr<LookupFile>> GetOrCreateLookupFile(
+        const std::shared_ptr<DataFileMeta>& file);
+    Result<std::vector<LookupEntry>> LoadFile(const std::shared_ptr<DataFileMeta>& file) const;
+    /// Reads the key values of a data file in key order and passes them to the consumer one by
+    /// one.
+    Status ReadFile(const std::shared_ptr<DataFileMeta>& file,
+                    const std::function<Status(LookupEntry&&)>& consumer) const;
+
+    /// Serializes the key into the reused key row.
+    /// @return A view of the serialized key, valid until the next call.
+    std::string_view SerializeKey(const InternalRow& key);
+    /// Serializes the sequence number, value kind and value of an entry.
+    std::string SerializeValue(const LookupEntry& entry);
+    Result<LookupEntry> DeserializeValue(std::string_view bytes, int32_t level) const;
+
+ private:
+    int64_t schema_id_;
+    std::shared_ptr<SchemaManager> schema_manager_;
+    CoreOptions options_;
+    std::shared_ptr<DataFilePathFactory> path_factory_;
+    std::shared_ptr<FieldsComparator> key_comparator_;
+    // compares keys without view, as the min and max keys of files are BinaryRow
+    std::shared_ptr<FieldsComparator> binary_key_comparator_;
+    std::shared_ptr<FieldsComparator> user_defined_seq_comparator_;
+    std::unique_ptr<MergeFunction> merge_function_;
+    int32_t key_arity_;
+    // value_schema is the table schema, read_schema = special fields + key fields + non-key fields
+    std::shared_ptr<arrow::Schema> value_schema_;
+    std::shared_ptr<arrow::Schema> read_schema_;
+    // maps the fields of the files written by previous schemas into read_schema
+    std::unique_ptr<FieldMappingBuilder> field_mapping_builder_;
+    // mapping from key to value fields, and identity mapping of value fields
+    std::vector<int32_t> key_mapping_;
+    std::vector<int32_t> value_mapping_;
+    std::shared_ptr<LookupFileCache> lookup_file_cache_;
+    SortLookupStoreOptions store_options_;
+    // orders the serialized keys in lookup files in the same way as the keys in data files
+    SortLookupStoreKeyComparator store_key_comparator_;
+    std::vector<InternalRow::FieldGetterFunc> key_getters_;
+    std::vector<BinaryRowWriter::FieldSetterFunc> key_setters_;
+    std::vector<InternalRow::FieldGetterFunc> value_getters_;
+    std::vector<BinaryRowWriter::FieldSetterFunc> value_setters_;
+    std::shared_ptr<MemoryPool> pool_;
+    // reused to serialize keys and values into lookup files
+    BinaryRow key_row_;
+    std::unique_ptr<BinaryRowWriter> key_writer_;
+    BinaryRow value_row_;
+    std::unique_ptr<BinaryRowWriter> value_writer_;
+
+    std::vector<std::shared_ptr<DataFileMeta>> files_;
+    // file name -> key values of the file sorted by key, only used without lookup files
+    std::unordered_map<std::string, std::vector<LookupEntry>> loaded_files_;
+    // names of the files converted into lookup files, which are invalidated from the cache
+    // when the LookupLevels is destroyed
+    std::unordered_set<std::string> lookup_file_names_;
+};
+}  // namespace paimon
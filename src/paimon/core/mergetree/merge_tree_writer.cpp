@@ -31,6 +31,7 @@
 #include "arrow/util/checked_cast.h"
 #include "fmt/format.h"
 #include "paimon/common/metrics/metrics_impl.h"
+#include "paimon/common/metrics/scoped_timer.h"
 #include "paimon/common/table/special_fields.h"
 #include "paimon/common/types/data_field.h"
 #include "paimon/common/utils/arrow/status_utils.h"
@@ -47,8 +48,12 @@
 #include "paimon/core/io/single_file_writer.h"
 #include "paimon/core/manifest/file_source.h"
 #include "paimon/core/mergetree/compact/sort_merge_reader_with_loser_tree.h"
+#include "paimon/core/mergetree/lookup_changelog_reader.h"
+#include "paimon/core/operation/metrics/writer_metrics.h"
+#include "paimon/core/options/merge_engine.h"
 #include "paimon/core/utils/commit_increment.h"
 #include "paimon/data/decimal.h"
+#include "paimon/executor.h"
 #include "paimon/format/file_format.h"
 #include "paimon/format/writer_builder.h"
 #include "paimon/metrics.h"
@@ -67,7 +72,11 @@ MergeTreeWriter::MergeTreeWriter(
     const std::shared_ptr<FieldsComparator>& user_defined_seq_comparator,
     const std::shared_ptr<MergeFunctionWrapper<KeyValue>>& merge_function_wrapper,
     int64_t schema_id, const std::shared_ptr<arrow::Schema>& value_schema,
-    const CoreOptions& options, const std::shared_ptr<MemoryPool>& pool)
+    const CoreOptions& options, std::unique_ptr<LookupLevels>&& lookup_levels,
+    std::unique_ptr<MergeFunction>&& changelog_merge_function,
+    const std::shared_ptr<Executor>& executor,
+    const std::shared_ptr<FlushMemoryBudget>& flush_memory_budget,
+    const std::shared_ptr<MemoryPool>& pool)
     : last_sequence_number_(last_sequence_number + 1),
       current_memory_in_bytes_(0),
       pool_(pool),
@@ -79,6 +88,8 @@ MergeTreeWriter::MergeTreeWriter(
       merge_function_wrapper_(merge_function_wrapper),
       schema_id_(schema_id),
       value_type_(arrow::struct_(value_schema->fields())),
+      lookup_levels_(std::move(lookup_levels)),
+      changelog_merge_function_(std::move(changelog_merge_function)),
       metrics_(std::make_shared<MetricsImpl>()) {
     arrow::FieldVector target_fields;
     target_fields.push_back(
@@ -87,6 +98,10 @@ MergeTreeWriter::MergeTreeWriter(
     target_fields.insert(target_fields.end(), value_schema->fields().begin(),
                          value_schema->fields().end());
     write_schema_ = arrow::schema(target_fields);
+    if (options_.WriteAsyncFlushEnabled() && executor) {
+        async_flusher_ = std::make_unique<AsyncFlusher>(
+            executor, options_.GetWriteAsyncFlushMaxInFlight(), flush_memory_budget);
+    }
 }
 
 Status MergeTreeWriter::Write(std::unique_ptr<RecordBatch>&& moved_batch) {
@@ -115,6 +130,9 @@ Status MergeTreeWriter::Write(std::unique_ptr<RecordBatch>&& moved_batch) {
 Result<CommitIncrement> MergeTreeWriter::PrepareCommit(bool wait_compaction) {
     // TODO(xinyu.lxy): support wait_compaction
     PAIMON_RETURN_NOT_OK(Flush());
+    if (async_flusher_) {
+        PAIMON_RETURN_NOT_OK(async_flusher_->WaitAll());
+    }
     return DrainIncrement();
 }
 
@@ -122,24 +140,63 @@ Status MergeTreeWriter::Flush() {
     if (batch_vec_.empty()) {
         return Status::OK();
     }
+    int64_t memory_in_bytes = current_memory_in_bytes_;
+    WriteBuffer buffer = SwapWriteBuffer();
+    if (async_flusher_) {
+        // blocks if there are too many full buffers in flight
+        return async_flusher_->Submit(
+            [this, buffer = std::move(buffer)]() mutable -> Status {
+                return FlushWriteBuffer(std::move(buffer));
+            },
+            memory_in_bytes);
+    }
+    return FlushWriteBuffer(std::move(buffer));
+}
+
+MergeTreeWriter::WriteBuffer MergeTreeWriter::SwapWriteBuffer() {
+    WriteBuffer buffer;
+    buffer.sequence_number = last_sequence_number_;
+    for (const auto& batch : batch_vec_) {
+        last_sequence_number_ += batch->length();
+    }
+    buffer.batches = std::move(batch_vec_);
+    buffer.row_kinds = std::move(row_kinds_vec_);
+    batch_vec_.clear();
+    row_kinds_vec_.clear();
+    current_memory_in_bytes_ = 0;
+    return buffer;
+}
+
+Status MergeTreeWriter::FlushWriteBuffer(WriteBuffer&& buffer) {
+    ScopedTimer timer(metrics_.get(), WriterMetrics::FLUSH_DURATION);
     // 1. create key value iter for each record batch
     std::vector<std::unique_ptr<KeyValueRecordReader>> readers;
-    readers.reserve(batch_vec_.size());
-    for (size_t i = 0; i < batch_vec_.size(); ++i) {
-        int64_t sequence_number = last_sequence_number_;
-        last_sequence_number_ += batch_vec_[i]->length();
+    readers.reserve(buffer.batches.size());
+    int64_t sequence_number = buffer.sequence_number;
+    for (size_t i = 0; i < buffer.batches.size(); ++i) {
+        int64_t batch_length = buffer.batches[i]->length();
         auto in_memory_reader = std::make_unique<KeyValueInMemoryRecordReader>(
-            sequence_number, std::move(batch_vec_[i]), std::move(row_kinds_vec_[i]),
+            sequence_number, std::move(buffer.batches[i]), std::move(buffer.row_kinds[i]),
             trimmed_primary_keys_, options_.GetSequenceField(), key_comparator_,
             merge_function_wrapper_, pool_);
+        sequence_number += batch_length;
         readers.push_back(std::move(in_memory_reader));
     }
-    batch_vec_.clear();
-    row_kinds_vec_.clear();
-    current_memory_in_bytes_ = 0;
     // 2. prepare loser tree sort merge reader
-    auto sort_merge_reader = std::make_unique<SortMergeReaderWithLoserTree>(
-        std::move(readers), key_comparator_, user_defined_seq_comparator_, merge_function_wrapper_);
+    std::unique_ptr<SortMergeReader> sort_merge_reader =
+        std::make_unique<SortMergeReaderWithLoserTree>(std::move(readers), key_comparator_,
+                                                       user_defined_seq_comparator_,
+                                                       merge_function_wrapper_);
+    LookupChangelogReader* changelog_reader = nullptr;
+    if (lookup_levels_) {
+        auto lookup_changelog_reader = std::make_unique<LookupChangelogReader>(
+            std::move(sort_merge_reader), lookup_levels_.get(), changelog_merge_function_.get(),
+            user_defined_seq_comparator_,
+            /*first_row=*/options_.GetMergeEngine() == MergeEngine::FIRST_ROW,
+            value_type_->num_fields());
+        changelog_reader = lookup_changelog_reader.get();
+        sort_merge_reader = std::move(lookup_changelog_reader);
+    }
     // 3. project key value to arrow array
     auto create_consumer = [target_schema = write_schema_, pool = pool_]()
         -> Result<std::unique_ptr<RowToArrowArrayConverter<KeyValue, KeyValueBatch>>> {
@@ -151,7 +208,7 @@ Status MergeTreeWriter::Flush() {
             std::move(sort_merge_reader), create_consumer,
             std::min(options_.GetWriteBatchSize(), MAX_PROJECTION_BATCH_SIZE),
             /*projection_thread_num=*/1, pool_);
-    auto rolling_writer = CreateRollingRowWriter();
+    auto rolling_writer = CreateRollingRowWriter(/*is_changelog=*/false);
     while (true) {
         PAIMON_ASSIGN_OR_RAISE(KeyValueBatch key_value_batch,
                                async_key_value_producer_consumer->NextBatch());
@@ -165,20 +222,54 @@ Status MergeTreeWriter::Flush() {
                            rolling_writer->GetResult());
     new_files_.insert(new_files_.end(), flushed_files.begin(), flushed_files.end());
     metrics_->Merge(rolling_writer->GetMetrics());
+    if (changelog_reader) {
+        // the producer has visited all key values when the last batch is consumed
+        PAIMON_RETURN_NOT_OK(WriteChangelog(changelog_reader->DrainChangelog()));
+        lookup_levels_->AddFiles(flushed_files);
+    }
+    return Status::OK();
+}
+
+Status MergeTreeWriter::WriteChangelog(std::vector<KeyValue>&& changelog) {
+    if (changelog.empty()) {
+        return Status::OK();
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<KeyValueMetaProjectionConsumer> consumer,
+                           KeyValueMetaProjectionConsumer::Create(write_schema_, pool_));
+    auto rolling_writer = CreateRollingRowWriter(/*is_changelog=*/true);
+    size_t batch_size = std::min(options_.GetWriteBatchSize(), MAX_PROJECTION_BATCH_SIZE);
+    std::vector<KeyValue> key_values;
+    key_values.reserve(std::min(batch_size, changelog.size()));
+    for (size_t start = 0; start < changelog.size(); start += batch_size) {
+        size_t end = std::min(start + batch_size, changelog.size());
+        key_values.clear();
+        for (size_t i = start; i < end; ++i) {
+            key_values.push_back(std::move(changelog[i]));
+        }
+        PAIMON_ASSIGN_OR_RAISE(KeyValueBatch key_value_batch, consumer->NextBatch(key_values));
+        PAIMON_RETURN_NOT_OK(rolling_writer->Write(std::move(key_value_batch)));
+    }
+    PAIMON_RETURN_NOT_OK(rolling_writer->Close());
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<DataFileMeta>> changelog_files,
+                           rolling_writer->GetResult());
+    changelog_files_.insert(changelog_files_.end(), changelog_files.begin(),
+                            changelog_files.end());
     return Status::OK();
 }
 
 Result<CommitIncrement> MergeTreeWriter::DrainIncrement() {
-    DataIncrement data_increment(std::move(new_files_), std::move(deleted_files_), {});
+    DataIncrement data_increment(std::move(new_files_), std::move(deleted_files_),
+                                 std::move(changelog_files_));
     CompactIncrement compact_increment({}, {}, {});
     new_files_.clear();
     deleted_files_.clear();
+    changelog_files_.clear();
     return CommitIncrement(data_increment, compact_increment);
 }
 
 std::unique_ptr<RollingFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>
-MergeTreeWriter::CreateRollingRowWriter() const {
-    auto create_file_writer = [&]()
+MergeTreeWriter::CreateRollingRowWriter(bool is_changelog) const {
+    auto create_file_writer = [&, is_changelog]()
         -> Result<std::unique_ptr<SingleFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>> {
         ::ArrowSchema arrow_schema;
         ScopeGuard guard([&arrow_schema]() { ArrowSchemaRelease(&arrow_schema); });
@@ -199,8 +290,9 @@ MergeTreeWriter::CreateRollingRowWriter() const {
             options_.GetFileCompression(), converter, schema_id_, FileSource::Append(),
             trimmed_primary_keys_, stats_extractor, write_schema_, path_factory_->IsExternalPath(),
             pool_);
-        PAIMON_RETURN_NOT_OK(
-            writer->Init(options_.GetFileSystem(), path_factory_->NewPath(), writer_builder));
+        std::string file_path =
+            is_changelog ? path_factory_->NewChangelogPath() : path_factory_->NewPath();
+        PAIMON_RETURN_NOT_OK(writer->Init(options_.GetFileSystem(), file_path, writer_builder));
         return writer;
     };
     return std::make_unique<RollingFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>(
@@ -26,7 +26,10 @@
 #include "paimon/core/io/data_file_path_factory.h"
 #include "paimon/core/io/rolling_file_writer.h"
 #include "paimon/core/key_value.h"
+#include "paimon/core/mergetree/compact/merge_function.h"
 #include "paimon/core/mergetree/compact/merge_function_wrapper.h"
+#include "paimon/core/mergetree/lookup_levels.h"
+#include "paimon/core/utils/async_flusher.h"
 #include "paimon/core/utils/batch_writer.h"
 #include "paimon/core/utils/commit_increment.h"
 #include "paimon/core/utils/fields_comparator.h"
@@ -44,12 +47,17 @@ class StructArray;
 
 namespace paimon {
 class DataFilePathFactory;
+class Executor;
 class FieldsComparator;
 class MemoryPool;
 class Metrics;
 template <typename T>
 class MergeFunctionWrapper;
 
+/// Buffers the written batches in memory and flushes them as sorted files once the buffer
+/// reaches write-buffer-size. With "write.async-flush.enabled" the full buffer is flushed on the
+/// executor while new batches go to a fresh buffer, `PrepareCommit()` waits for the flushes.
+/// `flush_memory_budget` is shared by the writers of a table write and may be nullptr.
 class MergeTreeWriter : public BatchWriter {
  public:
     MergeTreeWriter(int64_t last_sequence_number,
@@ -59,7 +67,11 @@ class MergeTreeWriter : public BatchWriter {
                     const std::shared_ptr<FieldsComparator>& user_defined_seq_comparator,
                     const std::shared_ptr<MergeFunctionWrapper<KeyValue>>& merge_function_wrapper,
                     int64_t schema_id, const std::shared_ptr<arrow::Schema>& value_schema,
-                    const CoreOptions& options, const std::shared_ptr<MemoryPool>& pool);
+                    const CoreOptions& options, std::unique_ptr<LookupLevels>&& lookup_levels,
+                    std::unique_ptr<MergeFunction>&& changelog_merge_function,
+                    const std::shared_ptr<Executor>& executor,
+                    const std::shared_ptr<FlushMemoryBudget>& flush_memory_budget,
+                    const std::shared_ptr<MemoryPool>& pool);
 
     ~MergeTreeWriter() override {
         [[maybe_unused]] auto status = DoClose();
@@ -80,17 +92,33 @@ class MergeTreeWriter : public BatchWriter {
     }
 
  private:
+    // batches to flush, the sequence numbers are assigned when the buffer is swapped out
+    struct WriteBuffer {
+        int64_t sequence_number;
+        std::vector<std::shared_ptr<arrow::StructArray>> batches;
+        std::vector<std::vector<RecordBatch::RowKind>> row_kinds;
+    };
+
     Status DoClose() {
+        Status status;
+        if (async_flusher_) {
+            // in-flight flushes reference this writer
+            status = async_flusher_->WaitAll();
+        }
         batch_vec_.clear();
         row_kinds_vec_.clear();
-        return Status::OK();
+        return status;
     }
 
     Status Flush();
+    WriteBuffer SwapWriteBuffer();
+    Status FlushWriteBuffer(WriteBuffer&& buffer);
     Result<CommitIncrement> DrainIncrement();
 
+    Status WriteChangelog(std::vector<KeyValue>&& changelog);
+
     std::unique_ptr<RollingFileWriter<KeyValueBatch, std::shared_ptr<DataFileMeta>>>
-    CreateRollingRowWriter() const;
+    CreateRollingRowWriter(bool is_changelog) const;
     static Result<int64_t> EstimateMemoryUse(const std::shared_ptr<arrow::Array>& array);
 
     // in case write batch size is too large and overflow arrow array
@@ -114,8 +142,16 @@ class MergeTreeWriter : public BatchWriter {
     std::vector<std::shared_ptr<arrow::StructArray>> batch_vec_;
     std::vector<std::vector<RecordBatch::RowKind>> row_kinds_vec_;
 
+    // not null if changelog is produced by looking up the previous value of flushed keys
+    std::unique_ptr<LookupLevels> lookup_levels_;
+    std::unique_ptr<MergeFunction> changelog_merge_function_;
+
     std::shared_ptr<Metrics> metrics_;
     std::vector<std::shared_ptr<DataFileMeta>> new_files_;
     std::vector<std::shared_ptr<DataFileMeta>> deleted_files_;
+    std::vector<std::shared_ptr<DataFileMeta>> changelog_files_;
+
+    // not null if full write buffers are flushed on the executor
+    std::unique_ptr<AsyncFlusher> async_flusher_;
 };
 }  // namespace paimon
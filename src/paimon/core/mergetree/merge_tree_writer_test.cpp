@@ -29,6 +29,7 @@
 #include "arrow/c/abi.h"
 #include "arrow/c/bridge.h"
 #include "arrow/ipc/json_simple.h"
+#include "fmt/format.h"
 #include "gtest/gtest.h"
 #include "paimon/common/factories/io_hook.h"
 #include "paimon/common/fs/external_path_provider.h"
@@ -40,10 +41,16 @@
 #include "paimon/core/io/data_increment.h"
 #include "paimon/core/manifest/file_source.h"
 #include "paimon/core/mergetree/compact/deduplicate_merge_function.h"
+#include "paimon/core/mergetree/compact/lookup_merge_function.h"
 #include "paimon/core/mergetree/compact/reducer_merge_function_wrapper.h"
+#include "paimon/core/mergetree/lookup_file.h"
+#include "paimon/core/mergetree/lookup_levels.h"
+#include "paimon/core/schema/schema_manager.h"
+#include "paimon/core/schema/table_schema.h"
 #include "paimon/core/utils/commit_increment.h"
 #include "paimon/core/utils/fields_comparator.h"
 #include "paimon/defs.h"
+#include "paimon/executor.h"
 #include "paimon/format/file_format.h"
 #include "paimon/format/file_format_factory.h"
 #include "paimon/fs/file_system.h"
@@ -136,7 +143,9 @@ TEST_F(MergeTreeWriterTest, TestSimple) {
     auto merge_writer = std::make_shared<MergeTreeWriter>(
         /*last_sequence_number=*/-1, primary_keys_, path_factory, key_comparator_,
         /*user_defined_seq_comparator=*/nullptr, merge_function_wrapper_, /*schema_id=*/1,
-        value_schema_, options, pool_);
+        value_schema_, options, /*lookup_levels=*/nullptr,
+        /*changelog_merge_function=*/nullptr, /*executor=*/nullptr, /*flush_memory_budget=*/nullptr,
+        pool_);
 
     // write batch
     std::shared_ptr<arrow::Array> array1 =
@@ -205,7 +214,9 @@ TEST_F(MergeTreeWriterTest, TestWriteMultiBatch) {
     auto merge_writer = std::make_shared<MergeTreeWriter>(
         /*last_sequence_number=*/9, primary_keys_, path_factory, key_comparator_,
         /*user_defined_seq_comparator=*/nullptr, merge_function_wrapper_, /*schema_id=*/0,
-        value_schema_, options, pool_);
+        value_schema_, options, /*lookup_levels=*/nullptr,
+        /*changelog_merge_function=*/nullptr, /*executor=*/nullptr, /*flush_memory_budget=*/nullptr,
+        pool_);
     // batch1
     std::shared_ptr<arrow::Array> array1 =
         arrow::ipc::internal::json::ArrayFromJSON(value_type_, R"([
@@ -290,7 +301,8 @@ TEST_F(MergeTreeWriterTest, TestWriteWithDeleteRow) {
     auto merge_writer = std::make_shared<MergeTreeWriter>(
         /*last_sequence_number=*/9, primary_keys_, path_factory, key_comparator_,
         user_defined_seq_comparator, merge_function_wrapper_, /*schema_id=*/0, value_schema_,
-        options, pool_);
+        options, /*lookup_levels=*/nullptr, /*changelog_merge_function=*/nullptr,
+        /*executor=*/nullptr, /*flush_memory_budget=*/nullptr, pool_);
     // batch1
     std::shared_ptr<arrow::Array> array1 =
         arrow::ipc::internal::json::ArrayFromJSON(value_type_, R"([
@@ -363,7 +375,9 @@ TEST_F(MergeTreeWriterTest, TestMultiplePrepareCommit) {
     auto merge_writer = std::make_shared<MergeTreeWriter>(
         /*last_sequence_number=*/9, primary_keys_, path_factory, key_comparator_,
         /*user_defined_seq_comparator=*/nullptr, merge_function_wrapper_, /*schema_id=*/0,
-        value_schema_, options, pool_);
+        value_schema_, options, /*lookup_levels=*/nullptr,
+        /*changelog_merge_function=*/nullptr, /*executor=*/nullptr, /*flush_memory_budget=*/nullptr,
+        pool_);
     // batch1
     std::shared_ptr<arrow::Array> array1 =
         arrow::ipc::internal::json::ArrayFromJSON(value_type_, R"([
@@ -493,7 +507,9 @@ TEST_F(MergeTreeWriterTest, TestPrepareCommitForEmptyData) {
     auto merge_writer = std::make_shared<MergeTreeWriter>(
         /*last_sequence_number=*/-1, primary_keys_, path_factory, key_comparator_,
         /*user_defined_seq_comparator=*/nullptr, merge_function_wrapper_, /*schema_id=*/0,
-        value_schema_, options, pool_);
+        value_schema_, options, /*lookup_levels=*/nullptr,
+        /*changelog_merge_function=*/nullptr, /*executor=*/nullptr, /*flush_memory_budget=*/nullptr,
+        pool_);
 
     // prepare commit, without write
     ASSERT_OK_AND_ASSIGN(CommitIncrement commit_increment,
@@ -533,7 +549,9 @@ TEST_F(MergeTreeWriterTest, TestCloseBeforePrepareCommit) {
     auto merge_writer = std::make_shared<MergeTreeWriter>(
         /*last_sequence_number=*/-1, primary_keys_, path_factory, key_comparator_,
         /*user_defined_seq_comparator=*/nullptr, merge_function_wrapper_, /*schema_id=*/0,
-        value_schema_, options, pool_);
+        value_schema_, options, /*lookup_levels=*/nullptr,
+        /*changelog_merge_function=*/nullptr, /*executor=*/nullptr, /*flush_memory_budget=*/nullptr,
+        pool_);
 
     // write batch
     std::shared_ptr<arrow::Array> array1 =
@@ -562,7 +580,9 @@ TEST_F(MergeTreeWriterTest, TestAutoFlush) {
     auto merge_writer = std::make_shared<MergeTreeWriter>(
         /*last_sequence_number=*/9, primary_keys_, path_factory, key_comparator_,
         /*user_defined_seq_comparator=*/nullptr, merge_function_wrapper_, /*schema_id=*/0,
-        value_schema_, options, pool_);
+        value_schema_, options, /*lookup_levels=*/nullptr,
+        /*changelog_merge_function=*/nullptr, /*executor=*/nullptr, /*flush_memory_budget=*/nullptr,
+        pool_);
     // batch1
     std::shared_ptr<arrow::Array> array1 =
         arrow::ipc::internal::json::ArrayFromJSON(value_type_, R"([
@@ -678,7 +698,9 @@ TEST_F(MergeTreeWriterTest, TestIOException) {
         auto merge_writer = std::make_shared<MergeTreeWriter>(
             /*last_sequence_number=*/-1, primary_keys_, path_factory, key_comparator_,
             /*user_defined_seq_comparator=*/nullptr, merge_function_wrapper_, /*schema_id=*/0,
-            value_schema_, options, pool_);
+            value_schema_, options, /*lookup_levels=*/nullptr,
+            /*changelog_merge_function=*/nullptr, /*executor=*/nullptr,
+            /*flush_memory_budget=*/nullptr, pool_);
 
         // write batch
         std::shared_ptr<arrow::Array> array =
@@ -789,7 +811,9 @@ TEST_F(MergeTreeWriterTest, TestBulkData) {
     auto merge_writer = std::make_shared<MergeTreeWriter>(
         /*last_sequence_number=*/-1, primary_keys_, path_factory, key_comparator_,
         /*user_defined_seq_comparator=*/nullptr, merge_function_wrapper_, /*schema_id=*/0,
-        value_schema_, options, pool_);
+        value_schema_, options, /*lookup_levels=*/nullptr,
+        /*changelog_merge_function=*/nullptr, /*executor=*/nullptr, /*flush_memory_budget=*/nullptr,
+        pool_);
     // multi batch
     size_t batch_size = 500;
     for (size_t i = 0; i < batch_size; ++i) {
@@ -839,4 +863,442 @@ TEST_F(MergeTreeWriterTest, TestBulkData) {
     }
 }
 
+TEST_F(MergeTreeWriterTest, TestAsyncFlush) {
+    // each batch is a file due to WRITE_BUFFER_SIZE, flushed on the executor
+    ASSERT_OK_AND_ASSIGN(CoreOptions options,
+                         CoreOptions::FromMap({{Options::FILE_FORMAT, "orc"},
+                                               {Options::WRITE_BUFFER_SIZE, "1"},
+                                               {Options::WRITE_ASYNC_FLUSH_ENABLED, "true"},
+                                               {Options::WRITE_ASYNC_FLUSH_MAX_IN_FLIGHT, "2"}}));
+
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    auto path_factory = std::make_shared<DataFilePathFactory>();
+    ASSERT_OK(path_factory->Init(dir->Str(), "orc", options.DataFilePrefix(), nullptr));
+    std::string uuid = path_factory->uuid_;
+
+    std::shared_ptr<Executor> executor = CreateDefaultExecutor(/*thread_count=*/2);
+    auto merge_writer = std::make_shared<MergeTreeWriter>(
+        /*last_sequence_number=*/-1, primary_keys_, path_factory, key_comparator_,
+        /*user_defined_seq_comparator=*/nullptr, merge_function_wrapper_, /*schema_id=*/0,
+        value_schema_, options, /*lookup_levels=*/nullptr,
+        /*changelog_merge_function=*/nullptr, executor, /*flush_memory_budget=*/nullptr, pool_);
+    ASSERT_TRUE(merge_writer->async_flusher_);
+    std::shared_ptr<arrow::Array> array =
+        arrow::ipc::internal::json::ArrayFromJSON(value_type_, R"([
+      ["Lucy", 20, 1, 14.1],
+      ["Paul", 20, 1, null],
+      ["Alice", 10, 0, 13.1],
+      ["Paul", 20, 1, 15.1]
+    ])")
+            .ValueOrDie();
+    size_t batch_count = 50;
+    for (int32_t round = 0; round < 2; ++round) {
+        for (size_t i = 0; i < batch_count; ++i) {
+            WriteBatch(array, /*row_kinds=*/{}, merge_writer.get());
+        }
+        // prepare commit waits for all the in-flight flushes
+        ASSERT_OK_AND_ASSIGN(CommitIncrement commit_increment,
+                             merge_writer->PrepareCommit(/*wait_compaction=*/false));
+        const auto& new_files = commit_increment.GetNewFilesIncrement().NewFiles();
+        ASSERT_EQ(batch_count, new_files.size());
+        for (size_t i = 0; i < batch_count; ++i) {
+            // files are flushed in the order of writes
+            int64_t file_idx = round * batch_count + i;
+            ASSERT_EQ("data-" + uuid + "-" + std::to_string(file_idx) + ".orc",
+                      new_files[i]->file_name);
+            ASSERT_EQ(3, new_files[i]->row_count);
+            ASSERT_EQ(file_idx * 4, new_files[i]->min_sequence_number);
+            ASSERT_EQ(file_idx * 4 + 3, new_files[i]->max_sequence_number);
+        }
+        int64_t seq = round * batch_count * 4;
+        std::string expected_json = fmt::format(R"([
+          [{}, 0, "Alice", 10, 0, 13.1],
+          [{}, 0, "Lucy", 20, 1, 14.1],
+          [{}, 0, "Paul", 20, 1, 15.1]
+        ])",
+                                                seq + 2, seq, seq + 3);
+        std::shared_ptr<arrow::ChunkedArray> expected_array;
+        ASSERT_TRUE(arrow::ipc::internal::json::ChunkedArrayFromJSON(write_type_, {expected_json},
+                                                                     &expected_array)
+                        .ok());
+        CheckFileContent(path_factory->ToPath(new_files[0]), expected_array);
+    }
+    ASSERT_OK(merge_writer->Close());
+}
+
+TEST_F(MergeTreeWriterTest, TestLookupChangelog) {
+    std::map<std::string, std::string> raw_options = {{Options::FILE_FORMAT, "orc"},
+                                                      {Options::CHANGELOG_PRODUCER, "lookup"}};
+    ASSERT_OK_AND_ASSIGN(CoreOptions options, CoreOptions::FromMap(raw_options));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<TableSchema> table_schema,
+                         TableSchema::Create(/*schema_id=*/0, value_schema_,
+                                             /*partition_keys=*/{}, primary_keys_, raw_options));
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    auto path_factory = std::make_shared<DataFilePathFactory>();
+    ASSERT_OK(path_factory->Init(dir->Str(), "orc", options.DataFilePrefix(), nullptr));
+
+    for (bool use_lookup_file : {false, true}) {
+        SCOPED_TRACE("use_lookup_file: " + std::to_string(use_lookup_file));
+        std::shared_ptr<LookupFileCache> lookup_file_cache;
+        if (use_lookup_file) {
+            ASSERT_OK_AND_ASSIGN(lookup_file_cache,
+                                 LookupFileCache::Create(dir->Str(), /*max_disk_size=*/1024 * 1024,
+                                                         /*max_memory_size=*/1024 * 1024));
+        }
+        auto create_writer = [&](int64_t last_sequence_number,
+                                 const std::vector<std::shared_ptr<DataFileMeta>>& restore_files)
+            -> std::shared_ptr<MergeTreeWriter> {
+            auto lookup_levels = LookupLevels::Create(
+                table_schema, /*schema_manager=*/nullptr, options, path_factory, key_comparator_,
+                /*user_defined_seq_comparator=*/nullptr,
+                std::make_unique<LookupMergeFunction>(
+                    std::make_unique<DeduplicateMergeFunction>(/*ignore_delete=*/false)),
+                restore_files, lookup_file_cache, pool_);
+            EXPECT_OK(lookup_levels.status());
+            return std::make_shared<MergeTreeWriter>(
+                last_sequence_number, primary_keys_, path_factory, key_comparator_,
+                /*user_defined_seq_comparator=*/nullptr, merge_function_wrapper_, /*schema_id=*/0,
+                value_schema_, options, std::move(lookup_levels).value(),
+                std::make_unique<DeduplicateMergeFunction>(/*ignore_delete=*/false),
+                /*executor=*/nullptr, /*flush_memory_budget=*/nullptr, pool_);
+        };
+        auto check_changelog = [&](const CommitIncrement& commit_increment,
+                                   const std::string& expected_json) {
+            const auto& changelog_files = commit_increment.GetNewFilesIncrement().ChangelogFiles();
+            ASSERT_EQ(1, changelog_files.size());
+            ASSERT_EQ(0, changelog_files[0]->file_name.find("changelog-"));
+            std::shared_ptr<arrow::ChunkedArray> expected_array;
+            ASSERT_TRUE(arrow::ipc::internal::json::ChunkedArrayFromJSON(
+                            write_type_, {expected_json}, &expected_array)
+                            .ok());
+            CheckFileContent(path_factory->ToPath(changelog_files[0]), expected_array);
+        };
+
+        std::vector<std::shared_ptr<DataFileMeta>> data_files;
+        auto writer = create_writer(/*last_sequence_number=*/-1, /*restore_files=*/{});
+        // first commit, all keys are new
+        WriteBatch(arrow::ipc::internal::json::ArrayFromJSON(value_type_, R"([
+          ["Lucy", 20, 1, 14.1],
+          ["Alice", 10, 0, 13.1]
+        ])")
+                       .ValueOrDie(),
+                   /*row_kinds=*/{}, writer.get());
+        ASSERT_OK_AND_ASSIGN(CommitIncrement commit_increment1,
+                             writer->PrepareCommit(/*wait_compaction=*/false));
+        check_changelog(commit_increment1, R"([
+          [1, 0, "Alice", 10, 0, 13.1],
+          [0, 0, "Lucy", 20, 1, 14.1]
+        ])");
+        const auto& new_files1 = commit_increment1.GetNewFilesIncrement().NewFiles();
+        data_files.insert(data_files.end(), new_files1.begin(), new_files1.end());
+
+        // second commit, previous values are looked up from files flushed by the same writer
+        WriteBatch(arrow::ipc::internal::json::ArrayFromJSON(value_type_, R"([
+          ["Lucy", 21, 1, 14.1],
+          ["Paul", 30, 2, null],
+          ["Alice", 10, 0, 13.1]
+        ])")
+                       .ValueOrDie(),
+                   {RecordBatch::RowKind::INSERT, RecordBatch::RowKind::INSERT,
+                    RecordBatch::RowKind::DELETE},
+                   writer.get());
+        ASSERT_OK_AND_ASSIGN(CommitIncrement commit_increment2,
+                             writer->PrepareCommit(/*wait_compaction=*/false));
+        check_changelog(commit_increment2, R"([
+          [4, 3, "Alice", 10, 0, 13.1],
+          [2, 1, "Lucy", 20, 1, 14.1],
+          [2, 2, "Lucy", 21, 1, 14.1],
+          [3, 0, "Paul", 30, 2, null]
+        ])");
+        const auto& new_files2 = commit_increment2.GetNewFilesIncrement().NewFiles();
+        data_files.insert(data_files.end(), new_files2.begin(), new_files2.end());
+        ASSERT_OK(writer->Close());
+
+        // restored writer looks up previous values from restore files
+        auto restored_writer = create_writer(/*last_sequence_number=*/4, data_files);
+        WriteBatch(arrow::ipc::internal::json::ArrayFromJSON(value_type_, R"([
+          ["Alice", 11, 0, 1.0],
+          ["Lucy", 22, 1, 14.1]
+        ])")
+                       .ValueOrDie(),
+                   /*row_kinds=*/{}, restored_writer.get());
+        ASSERT_OK_AND_ASSIGN(CommitIncrement commit_increment3,
+                             restored_writer->PrepareCommit(/*wait_compaction=*/false));
+        check_changelog(commit_increment3, R"([
+          [5, 0, "Alice", 11, 0, 1.0],
+          [6, 1, "Lucy", 21, 1, 14.1],
+          [6, 2, "Lucy", 22, 1, 14.1]
+        ])");
+        ASSERT_OK(restored_writer->Close());
+        if (use_lookup_file) {
+            // the restored writer reuses the lookup file converted by the first writer
+            ASSERT_EQ(2, lookup_file_cache->FileCount());
+            ASSERT_OK_AND_ASSIGN(uint64_t hit_count,
+                                 lookup_file_cache->GetMetrics()->GetCounter(
+                                     LookupFileCacheMetrics::LOOKUP_FILE_CACHE_HIT_COUNT));
+            ASSERT_GT(hit_count, 0);
+        }
+        // lookup files are invalidated with the writers
+        writer.reset();
+        restored_writer.reset();
+        if (use_lookup_file) {
+            ASSERT_EQ(0, lookup_file_cache->FileCount());
+        }
+    }
+}
+
+TEST_F(MergeTreeWriterTest, TestLookupChangelogWithSequenceField) {
+    std::map<std::string, std::string> raw_options = {{Options::FILE_FORMAT, "orc"},
+                                                      {Options::CHANGELOG_PRODUCER, "lookup"},
+                                                      {Options::SEQUENCE_FIELD, "f1"}};
+    ASSERT_OK_AND_ASSIGN(CoreOptions options, CoreOptions::FromMap(raw_options));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<TableSchema> table_schema,
+                         TableSchema::Create(/*schema_id=*/0, value_schema_,
+                                             /*partition_keys=*/{}, primary_keys_, raw_options));
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    auto path_factory = std::make_shared<DataFilePathFactory>();
+    ASSERT_OK(path_factory->Init(dir->Str(), "orc", options.DataFilePrefix(), nullptr));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<FieldsComparator> user_defined_seq_comparator,
+                         FieldsComparator::Create({value_fields_[1]},
+                                                  /*is_ascending_order=*/true,
+                                                  /*use_view=*/false));
+    ASSERT_OK_AND_ASSIGN(
+        std::unique_ptr<LookupLevels> lookup_levels,
+        LookupLevels::Create(
+            table_schema, /*schema_manager=*/nullptr, options, path_factory, key_comparator_,
+            user_defined_seq_comparator,
+            std::make_unique<LookupMergeFunction>(
+                std::make_unique<DeduplicateMergeFunction>(/*ignore_delete=*/false)),
+            /*restore_files=*/{}, /*lookup_file_cache=*/nullptr, pool_));
+    auto writer = std::make_shared<MergeTreeWriter>(
+        /*last_sequence_number=*/-1, primary_keys_, path_factory, key_comparator_,
+        user_defined_seq_comparator, merge_function_wrapper_, /*schema_id=*/0, value_schema_,
+        options, std::move(lookup_levels),
+        std::make_unique<DeduplicateMergeFunction>(/*ignore_delete=*/false),
+        /*executor=*/nullptr, /*flush_memory_budget=*/nullptr, pool_);
+    auto check_changelog = [&](const CommitIncrement& commit_increment,
+                               const std::string& expected_json) {
+        const auto& changelog_files = commit_increment.GetNewFilesIncrement().ChangelogFiles();
+        ASSERT_EQ(1, changelog_files.size());
+        std::shared_ptr<arrow::ChunkedArray> expected_array;
+        ASSERT_TRUE(arrow::ipc::internal::json::ChunkedArrayFromJSON(write_type_, {expected_json},
+                                                                     &expected_array)
+                        .ok());
+        CheckFileContent(path_factory->ToPath(changelog_files[0]), expected_array);
+    };
+
+    WriteBatch(arrow::ipc::internal::json::ArrayFromJSON(value_type_, R"([
+      ["Lucy", 20, 1, 14.1],
+      ["Alice", 10, 0, 13.1]
+    ])")
+                   .ValueOrDie(),
+               /*row_kinds=*/{}, writer.get());
+    ASSERT_OK_AND_ASSIGN(CommitIncrement commit_increment1,
+                         writer->PrepareCommit(/*wait_compaction=*/false));
+    check_changelog(commit_increment1, R"([
+      [1, 0, "Alice", 10, 0, 13.1],
+      [0, 0, "Lucy", 20, 1, 14.1]
+    ])");
+
+    // the new value of Lucy has a smaller sequence field, so the previous value is still the
+    // merged value, while the new value of Alice has a larger one
+    WriteBatch(arrow::ipc::internal::json::ArrayFromJSON(value_type_, R"([
+      ["Lucy", 15, 1, 1.0],
+      ["Alice", 11, 0, 1.0]
+    ])")
+                   .ValueOrDie(),
+               /*row_kinds=*/{}, writer.get());
+    ASSERT_OK_AND_ASSIGN(CommitIncrement commit_increment2,
+                         writer->PrepareCommit(/*wait_compaction=*/false));
+    check_changelog(commit_increment2, R"([
+      [3, 1, "Alice", 10, 0, 13.1],
+      [3, 2, "Alice", 11, 0, 1.0],
+      [2, 1, "Lucy", 20, 1, 14.1],
+      [2, 2, "Lucy", 20, 1, 14.1]
+    ])");
+    ASSERT_OK(writer->Close());
+}
+
+TEST_F(MergeTreeWriterTest, TestLookupAcrossFilesWithColdCache) {
+    std::map<std::string, std::string> raw_options = {{Options::FILE_FORMAT, "orc"},
+                                                      {Options::CHANGELOG_PRODUCER, "lookup"}};
+    ASSERT_OK_AND_ASSIGN(CoreOptions options, CoreOptions::FromMap(raw_options));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<TableSchema> table_schema,
+                         TableSchema::Create(/*schema_id=*/0, value_schema_,
+                                             /*partition_keys=*/{}, primary_keys_, raw_options));
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    auto path_factory = std::make_shared<DataFilePathFactory>();
+    ASSERT_OK(path_factory->Init(dir->Str(), "orc", options.DataFilePrefix(), nullptr));
+
+    // two level 0 files with overlapping key ranges [Alice, Lucy] and [Bob, Paul]
+    auto writer = std::make_shared<MergeTreeWriter>(
+        /*last_sequence_number=*/-1, primary_keys_, path_factory, key_comparator_,
+        /*user_defined_seq_comparator=*/nullptr, merge_function_wrapper_, /*schema_id=*/0,
+        value_schema_, options, /*lookup_levels=*/nullptr,
+        /*changelog_merge_function=*/nullptr, /*executor=*/nullptr, /*flush_memory_budget=*/nullptr,
+        pool_);
+    std::vector<std::shared_ptr<DataFileMeta>> data_files;
+    for (const auto& json : {R"([["Lucy", 20, 1, 14.1], ["Alice", 10, 0, 13.1]])",
+                             R"([["Paul", 40, 2, null], ["Bob", 30, 1, 1.0]])"}) {
+        WriteBatch(arrow::ipc::internal::json::ArrayFromJSON(value_type_, json).ValueOrDie(),
+                   /*row_kinds=*/{}, writer.get());
+        ASSERT_OK_AND_ASSIGN(CommitIncrement commit_increment,
+                             writer->PrepareCommit(/*wait_compaction=*/false));
+        const auto& new_files = commit_increment.GetNewFilesIncrement().NewFiles();
+        data_files.insert(data_files.end(), new_files.begin(), new_files.end());
+    }
+    ASSERT_OK(writer->Close());
+    ASSERT_EQ(2, data_files.size());
+
+    std::vector<std::pair<std::string, std::optional<int32_t>>> expected_f1 = {
+        {"Alice", 10}, {"Bob", 30}, {"Carl", std::nullopt}, {"Lucy", 20}, {"Paul", 40}};
+    for (const auto& [key, expected] : expected_f1) {
+        SCOPED_TRACE("key: " + key);
+        // each key is looked up with a cold cache, so the files are converted during the lookup
+        ASSERT_OK_AND_ASSIGN(
+            std::shared_ptr<LookupFileCache> lookup_file_cache,
+            LookupFileCache::Create(dir->Str(), /*max_disk_size=*/1024 * 1024,
+                                    /*max_memory_size=*/1024 * 1024));
+        ASSERT_OK_AND_ASSIGN(
+            std::unique_ptr<LookupLevels> lookup_levels,
+            LookupLevels::Create(
+                table_schema, /*schema_manager=*/nullptr, options, path_factory, key_comparator_,
+                /*user_defined_seq_comparator=*/nullptr,
+                std::make_unique<LookupMergeFunction>(
+                    std::make_unique<DeduplicateMergeFunction>(/*ignore_delete=*/false)),
+                data_files, lookup_file_cache, pool_));
+        ASSERT_TRUE(lookup_levels->UseLookupFile());
+        BinaryRow key_row = BinaryRowGenerator::GenerateRow({key}, pool_.get());
+        ASSERT_OK_AND_ASSIGN(std::optional<KeyValue> result, lookup_levels->Lookup(key_row));
+        ASSERT_EQ(expected.has_value(), result.has_value());
+        if (expected) {
+            ASSERT_EQ(expected.value(), result.value().value->GetInt(1));
+        }
+        if (key != "Alice" && key != "Paul") {
+            // the key falls into the key ranges of both files
+            ASSERT_EQ(2, lookup_file_cache->FileCount());
+        }
+    }
+}
+
+
+TEST_F(MergeTreeWriterTest, TestLookupFilesOfPreviousSchema) {
+    std::map<std::string, std::string> raw_options = {{Options::FILE_FORMAT, "orc"},
+                                                      {Options::CHANGELOG_PRODUCER, "lookup"}};
+    ASSERT_OK_AND_ASSIGN(CoreOptions options, CoreOptions::FromMap(raw_options));
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    auto schema_manager = std::make_shared<SchemaManager>(file_system_, dir->Str());
+    ASSERT_OK(schema_manager->CreateTable(value_schema_, /*partition_keys=*/{}, primary_keys_,
+                                          raw_options));
+    // schema 1 widens f1 to BIGINT and adds f4
+    std::string new_schema_str = R"==({
+  "version" : 3,
+  "id" : 1,
+  "fields" : [ {
+    "id" : 0,
+    "name" : "f0",
+    "type" : "STRING"
+  }, {
+    "id" : 1,
+    "name" : "f1",
+    "type" : "BIGINT"
+  }, {
+    "id" : 2,
+    "name" : "f2",
+    "type" : "INT"
+  }, {
+    "id" : 3,
+    "name" : "f3",
+    "type" : "DOUBLE"
+  }, {
+    "id" : 4,
+    "name" : "f4",
+    "type" : "INT"
+  } ],
+  "highestFieldId" : 4,
+  "partitionKeys" : [ ],
+  "primaryKeys" : [ "f0" ],
+  "options" : {
+    "file.format" : "orc",
+    "changelog-producer" : "lookup"
+  },
+  "timeMillis" : 1732605243483
+})==";
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<TableSchema> table_schema,
+                         TableSchema::CreateFromJson(new_schema_str));
+    auto path_factory = std::make_shared<DataFilePathFactory>();
+    ASSERT_OK(path_factory->Init(dir->Str(), "orc", options.DataFilePrefix(), nullptr));
+
+    // the files are written by schema 0
+    auto writer = std::make_shared<MergeTreeWriter>(
+        /*last_sequence_number=*/-1, primary_keys_, path_factory, key_comparator_,
+        /*user_defined_seq_comparator=*/nullptr, merge_function_wrapper_, /*schema_id=*/0,
+        value_schema_, options, /*lookup_levels=*/nullptr,
+        /*changelog_merge_function=*/nullptr, /*executor=*/nullptr, /*flush_memory_budget=*/nullptr,
+        pool_);
+    std::vector<std::shared_ptr<DataFileMeta>> data_files;
+    for (const auto& json : {R"([["Lucy", 20, 1, 14.1], ["Alice", 10, 0, 13.1]])",
+                             R"([["Paul", 40, 2, null], ["Lucy", 30, 1, 1.0]])"}) {
+        WriteBatch(arrow::ipc::internal::json::ArrayFromJSON(value_type_, json).ValueOrDie(),
+                   /*row_kinds=*/{}, writer.get());
+        ASSERT_OK_AND_ASSIGN(CommitIncrement commit_increment,
+                             writer->PrepareCommit(/*wait_compaction=*/false));
+        const auto& new_files = commit_increment.GetNewFilesIncrement().NewFiles();
+        data_files.insert(data_files.end(), new_files.begin(), new_files.end());
+    }
+    ASSERT_OK(writer->Close());
+    ASSERT_EQ(2, data_files.size());
+
+    std::vector<std::pair<std::string, std::optional<int64_t>>> expected_f1 = {
+        {"Alice", 10}, {"Carl", std::nullopt}, {"Lucy", 30}, {"Paul", 40}};
+    for (bool use_lookup_file : {false, true}) {
+        SCOPED_TRACE("use lookup file: " + std::to_string(use_lookup_file));
+        std::shared_ptr<LookupFileCache> lookup_file_cache;
+        if (use_lookup_file) {
+            ASSERT_OK_AND_ASSIGN(lookup_file_cache,
+                                 LookupFileCache::Create(dir->Str(), /*max_disk_size=*/1024 * 1024,
+                                                         /*max_memory_size=*/1024 * 1024));
+        }
+        ASSERT_OK_AND_ASSIGN(
+            std::unique_ptr<LookupLevels> lookup_levels,
+            LookupLevels::Create(
+                table_schema, schema_manager, options, path_factory, key_comparator_,
+                /*user_defined_seq_comparator=*/nullptr,
+                std::make_unique<LookupMergeFunction>(
+                    std::make_unique<DeduplicateMergeFunction>(/*ignore_delete=*/false)),
+                data_files, lookup_file_cache, pool_));
+        ASSERT_EQ(use_lookup_file, lookup_levels->UseLookupFile());
+        for (const auto& [key, expected] : expected_f1) {
+            SCOPED_TRACE("key: " + key);
+            BinaryRow key_row = BinaryRowGenerator::GenerateRow({key}, pool_.get());
+            ASSERT_OK_AND_ASSIGN(std::optional<KeyValue> result, lookup_levels->Lookup(key_row));
+            ASSERT_EQ(expected.has_value(), result.has_value());
+            if (expected) {
+                const auto& value = result.value().value;
+                ASSERT_EQ(5, value->GetFieldCount());
+                ASSERT_EQ(key, value->GetString(0).ToString());
+                ASSERT_EQ(expected.value(), value->GetLong(1));
+                ASSERT_TRUE(value->IsNullAt(4));
+            }
+        }
+    }
+
+    // files of a previous schema cannot be read without the schema manager
+    ASSERT_OK_AND_ASSIGN(
+        std::unique_ptr<LookupLevels> lookup_levels,
+        LookupLevels::Create(
+            table_schema, /*schema_manager=*/nullptr, options, path_factory, key_comparator_,
+            /*user_defined_seq_comparator=*/nullptr,
+            std::make_unique<LookupMergeFunction>(
+                std::make_unique<DeduplicateMergeFunction>(/*ignore_delete=*/false)),
+            data_files, /*lookup_file_cache=*/nullptr, pool_));
+    BinaryRow key_row = BinaryRowGenerator::GenerateRow({std::string("Lucy")}, pool_.get());
+    ASSERT_NOK_WITH_MSG(lookup_levels->Lookup(key_row), "without schema manager");
+}
+
 }  // namespace paimon::test
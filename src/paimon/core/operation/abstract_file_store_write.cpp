@@ -23,6 +23,7 @@
 
 #include "fmt/format.h"
 #include "paimon/common/data/binary_row.h"
+#include "paimon/common/fs/caching_file_system.h"
 #include "paimon/common/metrics/metrics_impl.h"
 #include "paimon/core/manifest/manifest_entry.h"
 #include "paimon/core/operation/file_store_scan.h"
@@ -30,6 +31,7 @@
 #include "paimon/core/snapshot.h"
 #include "paimon/core/table/bucket_mode.h"
 #include "paimon/core/table/sink/commit_message_impl.h"
+#include "paimon/core/utils/async_flusher.h"
 #include "paimon/core/utils/batch_writer.h"
 #include "paimon/core/utils/commit_increment.h"
 #include "paimon/core/utils/file_store_path_factory.h"
@@ -72,7 +74,12 @@ AbstractFileStoreWrite::AbstractFileStoreWrite(
       is_streaming_mode_(is_streaming_mode),
       ignore_num_bucket_check_(ignore_num_bucket_check),
       metrics_(std::make_shared<MetricsImpl>()),
-      logger_(Logger::GetLogger("AbstractFileStoreWrite")) {}
+      logger_(Logger::GetLogger("AbstractFileStoreWrite")) {
+    if (options_.WriteAsyncFlushEnabled() && options_.GetWriteAsyncFlushMaxMemory() > 0) {
+        flush_memory_budget_ =
+            std::make_shared<FlushMemoryBudget>(options_.GetWriteAsyncFlushMaxMemory());
+    }
+}
 
 Status AbstractFileStoreWrite::Write(std::unique_ptr<RecordBatch>&& batch) {
     if (PAIMON_UNLIKELY(batch == nullptr)) {
@@ -98,7 +105,8 @@ Status AbstractFileStoreWrite::Write(std::unique_ptr<RecordBatch>&& batch) {
         }
     } else {
         assert(options_.GetBucket() > 0);
-        if (!(batch->GetBucket() >= 0 && batch->GetBucket() < options_.GetBucket())) {
+        // the upper bound is the bucket number of the partition, checked in GetWriter()
+        if (batch->GetBucket() < 0) {
             return Status::Invalid(
                 fmt::format("fixed bucketed mode must specify a bucket which in [0, {}) in "
                             "RecordBatch",
@@ -224,7 +232,15 @@ Status AbstractFileStoreWrite::Close() {
 }
 
 std::shared_ptr<Metrics> AbstractFileStoreWrite::GetMetrics() const {
-    return metrics_;
+    auto caching_fs = std::dynamic_pointer_cast<CachingFileSystem>(options_.GetFileSystem());
+    if (caching_fs == nullptr) {
+        return metrics_;
+    }
+    // the block cache is shared by the table, report it along with the writer metrics
+    auto metrics = std::make_shared<MetricsImpl>();
+    metrics->Merge(metrics_);
+    metrics->Merge(caching_fs->GetMetrics());
+    return metrics;
 }
 
 int32_t AbstractFileStoreWrite::GetDefaultBucketNum() const {
@@ -252,47 +268,57 @@ Result<int32_t> AbstractFileStoreWrite::ScanExistingFileMetas(
     PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FileStoreScan::RawPlan> plan,
                            scan->WithSnapshot(snapshot)->CreatePlan());
     std::vector<ManifestEntry> entries = plan->Files();
-    int32_t total_buckets = GetDefaultBucketNum();
+    std::optional<int32_t> total_buckets;
     for (auto& entry : entries) {
-        if (!ignore_num_bucket_check_ && entry.TotalBuckets() != options_.GetBucket()) {
+        if (!ignore_num_bucket_check_ && total_buckets != std::nullopt &&
+            entry.TotalBuckets() != total_buckets.value()) {
             return Status::Invalid(fmt::format(
-                "Try to write table with a new bucket num {}, but the previous "
-                "bucket num is {}. Please switch to batch mode, and perform INSERT OVERWRITE to "
-                "rescale current data layout first.",
-                options_.GetBucket(), entry.TotalBuckets()));
+                "files of bucket {} in partition {} have different bucket nums {} and {}", bucket,
+                partition.ToString(), total_buckets.value(), entry.TotalBuckets()));
         }
         total_buckets = entry.TotalBuckets();
         restore_files->push_back(std::move(entry.File()));
     }
-    return total_buckets;
+    if (total_buckets != std::nullopt) {
+        return total_buckets.value();
+    }
+    // a new bucket takes the bucket num of the other buckets of the partition, which differs from
+    // the options after the partition is rescaled
+    auto partition_scan_filter = std::make_shared<ScanFilter>(
+        /*predicate=*/nullptr, partition_filters, /*bucket_filter=*/std::nullopt,
+        /*vector_search=*/nullptr);
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FileStoreScan> partition_scan,
+                           CreateFileStoreScan(partition_scan_filter));
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FileStoreScan::RawPlan> partition_plan,
+                           partition_scan->WithSnapshot(snapshot)->CreatePlan());
+    std::vector<ManifestEntry> partition_entries = partition_plan->Files();
+    if (partition_entries.empty()) {
+        return GetDefaultBucketNum();
+    }
+    return partition_entries[0].TotalBuckets();
 }
 
 Result<std::shared_ptr<BatchWriter>> AbstractFileStoreWrite::GetWriter(const BinaryRow& partition,
                                                                        int32_t bucket) {
     auto iter = writers_.find(partition);
-    if (PAIMON_UNLIKELY(iter == writers_.end())) {
-        PAIMON_ASSIGN_OR_RAISE(auto result,
-                               CreateWriter(partition, bucket, ignore_previous_files_));
-        int32_t total_buckets = result.first;
-        std::shared_ptr<BatchWriter> writer = result.second;
-        writers_.emplace(partition,
-                         std::unordered_map<int32_t, WriterContainer<BatchWriter>>(
-                             {{bucket, WriterContainer<BatchWriter>(writer, total_buckets)}}));
-        return writer;
-    } else {
-        auto& buckets = iter->second;
-        auto iter = buckets.find(bucket);
-        if (PAIMON_LIKELY(iter != buckets.end())) {
-            return iter->second.writer;
-        } else {
-            PAIMON_ASSIGN_OR_RAISE(auto result,
-                                   CreateWriter(partition, bucket, ignore_previous_files_));
-            int32_t total_buckets = result.first;
-            std::shared_ptr<BatchWriter> writer = result.second;
-            buckets.emplace(bucket, WriterContainer<BatchWriter>(writer, total_buckets));
-            return writer;
+    if (PAIMON_LIKELY(iter != writers_.end())) {
+        auto bucket_iter = iter->second.find(bucket);
+        if (PAIMON_LIKELY(bucket_iter != iter->second.end())) {
+            return bucket_iter->second.writer;
         }
     }
+    PAIMON_ASSIGN_OR_RAISE(auto result, CreateWriter(partition, bucket, ignore_previous_files_));
+    int32_t total_buckets = result.first;
+    std::shared_ptr<BatchWriter> writer = result.second;
+    if (options_.GetBucket() > 0 && bucket >= total_buckets) {
+        PAIMON_RETURN_NOT_OK(writer->Close());
+        return Status::Invalid(
+            fmt::format("fixed bucketed mode must specify a bucket which in [0, {}) in "
+                        "RecordBatch",
+                        total_buckets));
+    }
+    writers_[partition].emplace(bucket, WriterContainer<BatchWriter>(writer, total_buckets));
+    return writer;
 }
 
 }  // namespace paimon
@@ -55,6 +55,7 @@ class TableSchema;
 class MetricsImpl;
 class BinaryRow;
 class Executor;
+class FlushMemoryBudget;
 class MemoryPool;
 class RecordBatch;
 
@@ -104,7 +105,8 @@ class AbstractFileStoreWrite : public FileStoreWrite {
     virtual Result<std::unique_ptr<FileStoreScan>> CreateFileStoreScan(
         const std::shared_ptr<ScanFilter>& filter) const = 0;
 
-    // return actual total bucket in the specific partition
+    // return actual total bucket in the specific partition, which is taken from the existing files
+    // of the partition, or the default bucket num for a new partition
     Result<int32_t> ScanExistingFileMetas(
         const Snapshot& snapshot, const BinaryRow& partition, int32_t bucket,
         std::vector<std::shared_ptr<DataFileMeta>>* restore_files) const;
@@ -122,6 +124,8 @@ class AbstractFileStoreWrite : public FileStoreWrite {
     std::shared_ptr<TableSchema> table_schema_;
     std::shared_ptr<arrow::Schema> partition_schema_;
     CoreOptions options_;
+    // shared by the writers, not null if "write.async-flush.max-memory" is set
+    std::shared_ptr<FlushMemoryBudget> flush_memory_budget_;
 
  private:
     Result<std::shared_ptr<BatchWriter>> GetWriter(const BinaryRow& partition, int32_t bucket);
@@ -108,7 +108,8 @@ Result<std::pair<int32_t, std::shared_ptr<BatchWriter>>> AppendOnlyFileStoreWrit
 
     auto writer = std::make_shared<AppendOnlyWriter>(options_, table_schema_->Id(), write_schema_,
                                                      write_cols_, max_sequence_number,
-                                                     data_file_path_factory, pool_);
+                                                     data_file_path_factory, executor_,
+                                                     flush_memory_budget_, pool_);
     return std::pair<int32_t, std::shared_ptr<BatchWriter>>(total_buckets, writer);
 }
 
@@ -0,0 +1,339 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/operation/bucket_redistributor.h"
+
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "arrow/api.h"
+#include "arrow/c/bridge.h"
+#include "arrow/c/helpers.h"
+#include "arrow/compute/api_vector.h"
+#include "fmt/format.h"
+#include "paimon/common/types/data_field.h"
+#include "paimon/common/utils/arrow/mem_utils.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/common/utils/scope_guard.h"
+#include "paimon/core/manifest/manifest_file.h"
+#include "paimon/core/manifest/manifest_list.h"
+#include "paimon/core/operation/key_value_file_store_scan.h"
+#include "paimon/core/schema/schema_manager.h"
+#include "paimon/core/schema/table_schema.h"
+#include "paimon/core/table/source/key_value_table_read.h"
+#include "paimon/core/utils/field_mapping.h"
+#include "paimon/core/utils/file_store_path_factory.h"
+#include "paimon/core/utils/snapshot_manager.h"
+#include "paimon/defs.h"
+#include "paimon/executor.h"
+#include "paimon/file_store_write.h"
+#include "paimon/format/file_format.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/read_context.h"
+#include "paimon/record_batch.h"
+#include "paimon/scan_context.h"
+#include "paimon/table/source/table_read.h"
+#include "paimon/utils/bucket_id_calculator.h"
+#include "paimon/write_context.h"
+
+namespace paimon {
+
+Result<std::unique_ptr<BucketRedistributeContext>> BucketRedistributeContext::Create(
+    std::unique_ptr<WriteContext> ctx) {
+    if (ctx == nullptr) {
+        return Status::Invalid("write context is null pointer");
+    }
+    if (ctx->GetMemoryPool() == nullptr) {
+        return Status::Invalid("memory pool is null pointer");
+    }
+    if (ctx->GetExecutor() == nullptr) {
+        return Status::Invalid("executor is null pointer");
+    }
+    PAIMON_ASSIGN_OR_RAISE(
+        CoreOptions tmp_options,
+        CoreOptions::FromMap(ctx->GetOptions(), ctx->GetFileSystemSchemeToIdentifierMap()));
+    std::string branch = ctx->GetBranch();
+    auto schema_manager =
+        std::make_shared<SchemaManager>(tmp_options.GetFileSystem(), ctx->GetRootPath(), branch);
+    PAIMON_ASSIGN_OR_RAISE(std::optional<std::shared_ptr<TableSchema>> table_schema,
+                           schema_manager->Latest());
+    if (table_schema == std::nullopt) {
+        return Status::Invalid(fmt::format("cannot found latest schema in branch {}", branch));
+    }
+    const auto& schema = table_schema.value();
+    auto opts = schema->Options();
+    for (const auto& [key, value] : ctx->GetOptions()) {
+        opts[key] = value;
+    }
+    PAIMON_ASSIGN_OR_RAISE(CoreOptions options,
+                           CoreOptions::FromMap(opts, ctx->GetFileSystemSchemeToIdentifierMap()));
+    auto arrow_schema = DataField::ConvertDataFieldsToArrowSchema(schema->Fields());
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Schema> partition_schema,
+                           FieldMapping::GetPartitionSchema(arrow_schema, schema->PartitionKeys()));
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::string> external_paths, options.CreateExternalPaths());
+    PAIMON_ASSIGN_OR_RAISE(
+        std::shared_ptr<FileStorePathFactory> path_factory,
+        FileStorePathFactory::Create(
+            ctx->GetRootPath(), arrow_schema, schema->PartitionKeys(),
+            options.GetPartitionDefaultName(), options.GetWriteFileFormat()->Identifier(),
+            options.DataFilePrefix(), options.LegacyPartitionNameEnabled(), external_paths,
+            options.IndexFileInDataFileDir(), ctx->GetMemoryPool()));
+    auto snapshot_manager =
+        std::make_shared<SnapshotManager>(options.GetFileSystem(), ctx->GetRootPath(), branch);
+    PAIMON_ASSIGN_OR_RAISE(
+        std::shared_ptr<ManifestList> manifest_list,
+        ManifestList::Create(options.GetFileSystem(), options.GetManifestFormat(),
+                             options.GetManifestCompression(), path_factory, ctx->GetMemoryPool()));
+    PAIMON_ASSIGN_OR_RAISE(
+        std::shared_ptr<ManifestFile> manifest_file,
+        ManifestFile::Create(options.GetFileSystem(), options.GetManifestFormat(),
+                             options.GetManifestCompression(), path_factory,
+                             options.GetManifestTargetFileSize(), ctx->GetMemoryPool(), options,
+                             partition_schema));
+    return std::unique_ptr<BucketRedistributeContext>(new BucketRedistributeContext(
+        ctx->GetRootPath(), ctx->GetCommitUser(), branch, ctx->GetOptions(),
+        ctx->GetFileSystemSchemeToIdentifierMap(), schema, arrow_schema, options, path_factory,
+        snapshot_manager, schema_manager, manifest_list, manifest_file, ctx->GetExecutor(),
+        ctx->GetMemoryPool()));
+}
+
+BucketRedistributeContext::BucketRedistributeContext(
+    const std::string& root_path, const std::string& commit_user, const std::string& branch,
+    const std::map<std::string, std::string>& context_options,
+    const std::map<std::string, std::string>& fs_scheme_to_identifier_map,
+    const std::shared_ptr<TableSchema>& table_schema,
+    const std::shared_ptr<arrow::Schema>& arrow_schema, const CoreOptions& options,
+    const std::shared_ptr<FileStorePathFactory>& path_factory,
+    const std::shared_ptr<SnapshotManager>& snapshot_manager,
+    const std::shared_ptr<SchemaManager>& schema_manager,
+    const std::shared_ptr<ManifestList>& manifest_list,
+    const std::shared_ptr<ManifestFile>& manifest_file, const std::shared_ptr<Executor>& executor,
+    const std::shared_ptr<MemoryPool>& pool)
+    : root_path_(root_path),
+      commit_user_(commit_user),
+      branch_(branch),
+      context_options_(context_options),
+      fs_scheme_to_identifier_map_(fs_scheme_to_identifier_map),
+      table_schema_(table_schema),
+      arrow_schema_(arrow_schema),
+      options_(options),
+      path_factory_(path_factory),
+      snapshot_manager_(snapshot_manager),
+      schema_manager_(schema_manager),
+      manifest_list_(manifest_list),
+      manifest_file_(manifest_file),
+      executor_(executor),
+      pool_(pool) {}
+
+Result<std::unique_ptr<KeyValueFileStoreScan>> BucketRedistributeContext::CreateScan(
+    const std::vector<std::map<std::string, std::string>>& partitions) const {
+    auto scan_filter = std::make_shared<ScanFilter>(/*predicate=*/nullptr, partitions,
+                                                    /*bucket_filter=*/std::nullopt,
+                                                    /*vector_search=*/nullptr);
+    return KeyValueFileStoreScan::Create(snapshot_manager_, schema_manager_, manifest_list_,
+                                         manifest_file_, table_schema_, arrow_schema_, scan_filter,
+                                         options_, executor_, pool_);
+}
+
+Result<std::unique_ptr<TableRead>> BucketRedistributeContext::CreateTableRead(
+    bool force_keep_delete) const {
+    ReadContextBuilder read_context_builder(root_path_);
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<ReadContext> read_context,
+                           read_context_builder.SetOptions(context_options_)
+                               .WithBranch(branch_)
+                               .WithMemoryPool(pool_)
+                               .WithExecutor(executor_)
+                               .WithFileSystemSchemeToIdentifierMap(fs_scheme_to_identifier_map_)
+                               .Finish());
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<TableRead> table_read,
+                           TableRead::Create(std::move(read_context)));
+    if (force_keep_delete) {
+        auto* key_value_table_read = dynamic_cast<KeyValueTableRead*>(table_read.get());
+        if (key_value_table_read == nullptr) {
+            return Status::Invalid("cannot keep delete rows in table read of the table, "
+                                   "supposed to be a key value table without fallback branch");
+        }
+        key_value_table_read->ForceKeepDelete();
+    }
+    return table_read;
+}
+
+Result<std::unique_ptr<FileStoreWrite>> BucketRedistributeContext::CreateFileStoreWrite(
+    int32_t bucket_num, bool ignore_previous_files) const {
+    std::map<std::string, std::string> write_options = context_options_;
+    write_options[Options::BUCKET] = std::to_string(bucket_num);
+    // flush the write buffers of the buckets on the executor
+    write_options[Options::WRITE_ASYNC_FLUSH_ENABLED] = "true";
+    WriteContextBuilder write_context_builder(root_path_, commit_user_);
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<WriteContext> write_context,
+                           write_context_builder.SetOptions(write_options)
+                               .WithStreamingMode(false)
+                               .WithIgnorePreviousFiles(ignore_previous_files)
+                               .WithBranch(branch_)
+                               .WithMemoryPool(pool_)
+                               .WithExecutor(executor_)
+                               .WithFileSystemSchemeToIdentifierMap(fs_scheme_to_identifier_map_)
+                               .Finish());
+    return FileStoreWrite::Create(std::move(write_context));
+}
+
+Result<std::unique_ptr<BucketRedistributor>> BucketRedistributor::Create(
+    const std::shared_ptr<TableSchema>& table_schema, int32_t bucket_num,
+    std::unique_ptr<FileStoreWrite>&& write, const std::shared_ptr<MemoryPool>& pool) {
+    if (write == nullptr) {
+        return Status::Invalid("file store write is null pointer");
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<BucketIdCalculator> bucket_id_calculator,
+                           BucketIdCalculator::Create(/*is_pk_table=*/true, bucket_num, pool));
+    return std::unique_ptr<BucketRedistributor>(new BucketRedistributor(
+        table_schema, bucket_num, std::move(bucket_id_calculator), std::move(write), pool));
+}
+
+BucketRedistributor::BucketRedistributor(const std::shared_ptr<TableSchema>& table_schema,
+                                         int32_t bucket_num,
+                                         std::unique_ptr<BucketIdCalculator>&& bucket_id_calculator,
+                                         std::unique_ptr<FileStoreWrite>&& write,
+                                         const std::shared_ptr<MemoryPool>& pool)
+    : table_schema_(table_schema),
+      bucket_num_(bucket_num),
+      bucket_id_calculator_(std::move(bucket_id_calculator)),
+      write_(std::move(write)),
+      pool_(pool) {}
+
+BucketRedistributor::~BucketRedistributor() = default;
+
+Status BucketRedistributor::Write(const std::map<std::string, std::string>& partition,
+                                  BatchReader::ReadBatch&& batch) {
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> array,
+                                      arrow::ImportArray(batch.first.get(), batch.second.get()));
+    auto struct_array = std::dynamic_pointer_cast<arrow::StructArray>(array);
+    if (!struct_array || struct_array->num_fields() < 1) {
+        return Status::Invalid(
+            "invalid batch to redistribute, supposed to be struct array with _VALUE_KIND field");
+    }
+    // the first field is _VALUE_KIND, the others are the table fields
+    arrow::ArrayVector value_arrays = struct_array->fields();
+    auto row_kind_array = std::dynamic_pointer_cast<arrow::Int8Array>(value_arrays[0]);
+    if (!row_kind_array) {
+        return Status::Invalid("invalid _VALUE_KIND field in batch to redistribute");
+    }
+    value_arrays.erase(value_arrays.begin());
+    arrow::FieldVector value_fields = struct_array->struct_type()->fields();
+    value_fields.erase(value_fields.begin());
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::StructArray> values,
+                                      arrow::StructArray::Make(value_arrays, value_fields));
+
+    arrow::ArrayVector bucket_key_arrays;
+    arrow::FieldVector bucket_key_fields;
+    for (const auto& bucket_key : table_schema_->BucketKeys()) {
+        int32_t index = values->struct_type()->GetFieldIndex(bucket_key);
+        if (index < 0) {
+            return Status::Invalid(
+                fmt::format("bucket key {} not found in batch to redistribute", bucket_key));
+        }
+        bucket_key_arrays.push_back(values->field(index));
+        bucket_key_fields.push_back(values->struct_type()->field(index));
+    }
+    PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
+        std::shared_ptr<arrow::StructArray> bucket_keys,
+        arrow::StructArray::Make(bucket_key_arrays, bucket_key_fields));
+    ::ArrowArray c_bucket_keys;
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(*bucket_keys, &c_bucket_keys));
+    ScopeGuard guard([&c_bucket_keys]() { ArrowArrayRelease(&c_bucket_keys); });
+    ::ArrowSchema c_bucket_schema;
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(
+        arrow::ExportSchema(*arrow::schema(bucket_key_fields), &c_bucket_schema));
+    // CalculateBucketIds() releases the exported bucket keys
+    guard.Release();
+    int64_t num_rows = values->length();
+    std::vector<int32_t> bucket_ids(num_rows);
+    PAIMON_RETURN_NOT_OK(bucket_id_calculator_->CalculateBucketIds(
+        &c_bucket_keys, &c_bucket_schema, bucket_ids.data()));
+
+    // counting sort of the row indices by bucket, which keeps the write order within a bucket
+    std::vector<int64_t> bucket_offsets(bucket_num_ + 1, 0);
+    for (int32_t bucket_id : bucket_ids) {
+        bucket_offsets[bucket_id + 1]++;
+    }
+    for (int32_t bucket = 0; bucket < bucket_num_; bucket++) {
+        bucket_offsets[bucket + 1] += bucket_offsets[bucket];
+    }
+    std::vector<int64_t> positions(bucket_offsets.begin(), bucket_offsets.end() - 1);
+    std::vector<int64_t> sorted_indices(num_rows);
+    for (int64_t row = 0; row < num_rows; row++) {
+        sorted_indices[positions[bucket_ids[row]]++] = row;
+    }
+    auto arrow_pool = GetArrowPool(pool_);
+    arrow::Int64Builder indices_builder(arrow_pool.get());
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(indices_builder.AppendValues(sorted_indices));
+    std::shared_ptr<arrow::Array> indices;
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(indices_builder.Finish(&indices));
+
+    arrow::compute::ExecContext exec_context(arrow_pool.get());
+    for (int32_t bucket = 0; bucket < bucket_num_; bucket++) {
+        int64_t begin = bucket_offsets[bucket];
+        int64_t length = bucket_offsets[bucket + 1] - begin;
+        if (length == 0) {
+            continue;
+        }
+        std::shared_ptr<arrow::Array> bucket_values = values;
+        if (length != num_rows) {
+            PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
+                arrow::Datum taken,
+                arrow::compute::Take(values, indices->Slice(begin, length),
+                                     arrow::compute::TakeOptions::Defaults(), &exec_context));
+            bucket_values = taken.make_array();
+        }
+        std::vector<RecordBatch::RowKind> row_kinds;
+        row_kinds.reserve(length);
+        for (int64_t i = begin; i < begin + length; i++) {
+            row_kinds.push_back(
+                static_cast<RecordBatch::RowKind>(row_kind_array->Value(sorted_indices[i])));
+        }
+        ::ArrowArray c_bucket_values;
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(*bucket_values, &c_bucket_values));
+        RecordBatchBuilder batch_builder(&c_bucket_values);
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<RecordBatch> record_batch,
+                               batch_builder.SetPartition(partition)
+                                   .SetBucket(bucket)
+                                   .SetRowKinds(row_kinds)
+                                   .Finish());
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        PAIMON_RETURN_NOT_OK(write_->Write(std::move(record_batch)));
+    }
+    return Status::OK();
+}
+
+Status BucketRedistributor::WriteAll(const std::map<std::string, std::string>& partition,
+                                     BatchReader* reader) {
+    while (true) {
+        PAIMON_ASSIGN_OR_RAISE(BatchReader::ReadBatch batch, reader->NextBatch());
+        if (BatchReader::IsEofBatch(batch)) {
+            return Status::OK();
+        }
+        PAIMON_RETURN_NOT_OK(Write(partition, std::move(batch)));
+    }
+}
+
+Result<std::vector<std::shared_ptr<CommitMessage>>> BucketRedistributor::Finish() {
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<CommitMessage>> commit_messages,
+                           write_->PrepareCommit());
+    PAIMON_RETURN_NOT_OK(write_->Close());
+    return commit_messages;
+}
+
+}  // namespace paimon
@@ -0,0 +1,174 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "paimon/commit_message.h"
+#include "paimon/core/core_options.h"
+#include "paimon/reader/batch_reader.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+
+namespace arrow {
+class Schema;
+}  // namespace arrow
+
+namespace paimon {
+
+class BucketIdCalculator;
+class Executor;
+class FileStorePathFactory;
+class FileStoreWrite;
+class KeyValueFileStoreScan;
+class ManifestFile;
+class ManifestList;
+class MemoryPool;
+class SchemaManager;
+class SnapshotManager;
+class TableRead;
+class TableSchema;
+class WriteContext;
+
+/// The table to redistribute into buckets, which scans, reads and writes the latest schema of the
+/// table in the write context. Shared by `BucketRescaler` and `PostponeBucketCompactor`.
+class BucketRedistributeContext {
+ public:
+    /// Loads the latest schema of the table, the options of `context` override the options of
+    /// the schema. Streaming mode, write id and write schema of the context are ignored.
+    static Result<std::unique_ptr<BucketRedistributeContext>> Create(
+        std::unique_ptr<WriteContext> context);
+
+    /// @param partitions The partitions to scan, all partitions if empty.
+    Result<std::unique_ptr<KeyValueFileStoreScan>> CreateScan(
+        const std::vector<std::map<std::string, std::string>>& partitions) const;
+    /// @param force_keep_delete Whether to keep the retract rows with their row kinds, which
+    /// only reads the splits without merging, see `KeyValueTableRead::ForceKeepDelete()`.
+    Result<std::unique_ptr<TableRead>> CreateTableRead(bool force_keep_delete) const;
+    /// Creates a batch write of the table with bucket `bucket_num`, which flushes the write
+    /// buffers of the buckets on the executor.
+    ///
+    /// @param ignore_previous_files Whether the new files overwrite all existing files, so the
+    /// existing files are not restored by the writers.
+    Result<std::unique_ptr<FileStoreWrite>> CreateFileStoreWrite(
+        int32_t bucket_num, bool ignore_previous_files) const;
+
+    const std::shared_ptr<TableSchema>& GetTableSchema() const {
+        return table_schema_;
+    }
+    const CoreOptions& GetOptions() const {
+        return options_;
+    }
+    const std::shared_ptr<FileStorePathFactory>& GetPathFactory() const {
+        return path_factory_;
+    }
+    const std::shared_ptr<SnapshotManager>& GetSnapshotManager() const {
+        return snapshot_manager_;
+    }
+    const std::shared_ptr<Executor>& GetExecutor() const {
+        return executor_;
+    }
+    const std::shared_ptr<MemoryPool>& GetMemoryPool() const {
+        return pool_;
+    }
+
+ private:
+    BucketRedistributeContext(const std::string& root_path, const std::string& commit_user,
+                              const std::string& branch,
+                              const std::map<std::string, std::string>& context_options,
+                              const std::map<std::string, std::string>& fs_scheme_to_identifier_map,
+                              const std::shared_ptr<TableSchema>& table_schema,
+                              const std::shared_ptr<arrow::Schema>& arrow_schema,
+                              const CoreOptions& options,
+                              const std::shared_ptr<FileStorePathFactory>& path_factory,
+                              const std::shared_ptr<SnapshotManager>& snapshot_manager,
+                              const std::shared_ptr<SchemaManager>& schema_manager,
+                              const std::shared_ptr<ManifestList>& manifest_list,
+                              const std::shared_ptr<ManifestFile>& manifest_file,
+                              const std::shared_ptr<Executor>& executor,
+                              const std::shared_ptr<MemoryPool>& pool);
+
+ private:
+    std::string root_path_;
+    std::string commit_user_;
+    std::string branch_;
+    std::map<std::string, std::string> context_options_;
+    std::map<std::string, std::string> fs_scheme_to_identifier_map_;
+    std::shared_ptr<TableSchema> table_schema_;
+    std::shared_ptr<arrow::Schema> arrow_schema_;
+    CoreOptions options_;
+    std::shared_ptr<FileStorePathFactory> path_factory_;
+    std::shared_ptr<SnapshotManager> snapshot_manager_;
+    std::shared_ptr<SchemaManager> schema_manager_;
+    std::shared_ptr<ManifestList> manifest_list_;
+    std::shared_ptr<ManifestFile> manifest_file_;
+    std::shared_ptr<Executor> executor_;
+    std::shared_ptr<MemoryPool> pool_;
+};
+
+/// Writes rows read from a primary key table into the buckets computed from their bucket keys,
+/// used to move data into another bucket layout.
+///
+/// The rows of each bucket keep their read order, so that later rows of the same key still
+/// overwrite earlier ones. They are sorted by key when the writers flush.
+///
+/// `Write()` and `WriteAll()` may be called by multiple threads at the same time, as long as all
+/// rows of a key are written by the same thread, e.g. each thread reads other old buckets.
+class BucketRedistributor {
+ public:
+    /// @param write A file store write of the table with bucket `bucket_num`.
+    static Result<std::unique_ptr<BucketRedistributor>> Create(
+        const std::shared_ptr<TableSchema>& table_schema, int32_t bucket_num,
+        std::unique_ptr<FileStoreWrite>&& write, const std::shared_ptr<MemoryPool>& pool);
+
+    ~BucketRedistributor();
+
+    /// Writes a batch read by `TableRead`, whose first field is `_VALUE_KIND` followed by all
+    /// fields of the table.
+    Status Write(const std::map<std::string, std::string>& partition,
+                 BatchReader::ReadBatch&& batch);
+
+    /// Writes all batches read by `reader` until eof.
+    Status WriteAll(const std::map<std::string, std::string>& partition, BatchReader* reader);
+
+    /// Flushes all buckets and closes the write.
+    ///
+    /// @return The commit messages of the written files.
+    Result<std::vector<std::shared_ptr<CommitMessage>>> Finish();
+
+ private:
+    BucketRedistributor(const std::shared_ptr<TableSchema>& table_schema, int32_t bucket_num,
+                        std::unique_ptr<BucketIdCalculator>&& bucket_id_calculator,
+                        std::unique_ptr<FileStoreWrite>&& write,
+                        const std::shared_ptr<MemoryPool>& pool);
+
+ private:
+    std::shared_ptr<TableSchema> table_schema_;
+    int32_t bucket_num_;
+    std::unique_ptr<BucketIdCalculator> bucket_id_calculator_;
+    std::unique_ptr<FileStoreWrite> write_;
+    std::shared_ptr<MemoryPool> pool_;
+    // guards `write_`, the rows are redistributed without holding it
+    std::mutex write_mutex_;
+};
+
+}  // namespace paimon
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/operation/bucket_redistributor.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/c/bridge.h"
+#include "arrow/ipc/json_simple.h"
+#include "gtest/gtest.h"
+#include "paimon/core/schema/table_schema.h"
+#include "paimon/defs.h"
+#include "paimon/file_store_write.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/metrics.h"
+#include "paimon/record_batch.h"
+#include "paimon/testing/utils/testharness.h"
+#include "paimon/utils/bucket_id_calculator.h"
+
+namespace paimon::test {
+
+namespace {
+struct WrittenBatch {
+    std::map<std::string, std::string> partition;
+    int32_t bucket;
+    std::vector<RecordBatch::RowKind> row_kinds;
+    std::shared_ptr<arrow::Array> data;
+};
+
+class FakeFileStoreWrite : public FileStoreWrite {
+ public:
+    FakeFileStoreWrite(const std::shared_ptr<arrow::DataType>& value_type,
+                       std::vector<WrittenBatch>* batches, bool* closed)
+        : value_type_(value_type), batches_(batches), closed_(closed) {}
+
+    Status Write(std::unique_ptr<RecordBatch>&& batch) override {
+        auto data = arrow::ImportArray(batch->GetData(), value_type_);
+        if (!data.ok()) {
+            return Status::Invalid(data.status().ToString());
+        }
+        batches_->push_back({batch->GetPartition(), batch->GetBucket(), batch->GetRowKind(),
+                             data.ValueUnsafe()});
+        return Status::OK();
+    }
+
+    Result<std::vector<std::shared_ptr<CommitMessage>>> PrepareCommit(
+        bool wait_compaction, int64_t commit_identifier) override {
+        return std::vector<std::shared_ptr<CommitMessage>>();
+    }
+
+    std::shared_ptr<Metrics> GetMetrics() const override {
+        return nullptr;
+    }
+
+    Status Close() override {
+        *closed_ = true;
+        return Status::OK();
+    }
+
+ private:
+    std::shared_ptr<arrow::DataType> value_type_;
+    std::vector<WrittenBatch>* batches_;
+    bool* closed_;
+};
+}  // namespace
+
+TEST(BucketRedistributorTest, TestWrite) {
+    auto pool = GetDefaultPool();
+    arrow::FieldVector fields = {arrow::field("f0", arrow::utf8()),
+                                 arrow::field("f1", arrow::int32()),
+                                 arrow::field("f2", arrow::int64())};
+    std::map<std::string, std::string> options = {{Options::BUCKET, "3"},
+                                                  {Options::BUCKET_KEY, "f1"}};
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<TableSchema> table_schema,
+                         TableSchema::Create(/*schema_id=*/0, arrow::schema(fields),
+                                             /*partition_keys=*/{"f0"},
+                                             /*primary_keys=*/{"f0", "f1"}, options));
+    int32_t bucket_num = 3;
+    std::vector<WrittenBatch> batches;
+    bool closed = false;
+    auto write = std::make_unique<FakeFileStoreWrite>(arrow::struct_(fields), &batches, &closed);
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<BucketRedistributor> redistributor,
+                         BucketRedistributor::Create(table_schema, bucket_num, std::move(write),
+                                                     pool));
+
+    arrow::FieldVector read_fields = fields;
+    read_fields.insert(read_fields.begin(), arrow::field("_VALUE_KIND", arrow::int8()));
+    auto read_type = arrow::struct_(read_fields);
+    auto array = arrow::ipc::internal::json::ArrayFromJSON(read_type, R"([
+        [0, "p", 0, 10], [0, "p", 1, 11], [2, "p", 2, 12], [0, "p", 3, 13], [0, "p", 4, 14],
+        [0, "p", 5, 15], [1, "p", 6, 16], [0, "p", 7, 17], [0, "p", 8, 18], [0, "p", 9, 19]
+    ])")
+                     .ValueOrDie();
+    auto read_batch =
+        std::make_pair(std::make_unique<::ArrowArray>(), std::make_unique<::ArrowSchema>());
+    ASSERT_TRUE(arrow::ExportArray(*array, read_batch.first.get(), read_batch.second.get()).ok());
+    std::map<std::string, std::string> partition = {{"f0", "p"}};
+    ASSERT_OK(redistributor->Write(partition, std::move(read_batch)));
+
+    // compute the expected buckets of f1 in [0, 10)
+    auto bucket_keys =
+        arrow::ipc::internal::json::ArrayFromJSON(
+            arrow::struct_({fields[1]}), "[[0], [1], [2], [3], [4], [5], [6], [7], [8], [9]]")
+            .ValueOrDie();
+    ::ArrowArray c_bucket_keys;
+    ASSERT_TRUE(arrow::ExportArray(*bucket_keys, &c_bucket_keys).ok());
+    ::ArrowSchema c_bucket_schema;
+    ASSERT_TRUE(arrow::ExportSchema(*arrow::schema({fields[1]}), &c_bucket_schema).ok());
+    std::vector<int32_t> expected_buckets(bucket_keys->length());
+    ASSERT_OK_AND_ASSIGN(auto bucket_id_calculator,
+                         BucketIdCalculator::Create(/*is_pk_table=*/true, bucket_num));
+    ASSERT_OK(bucket_id_calculator->CalculateBucketIds(&c_bucket_keys, &c_bucket_schema,
+                                                       expected_buckets.data()));
+
+    int64_t total_rows = 0;
+    int32_t last_bucket = -1;
+    for (const auto& batch : batches) {
+        ASSERT_EQ(partition, batch.partition);
+        // batches are written in bucket order, one batch for each non-empty bucket
+        ASSERT_GT(batch.bucket, last_bucket);
+        last_bucket = batch.bucket;
+        auto struct_array = std::static_pointer_cast<arrow::StructArray>(batch.data);
+        auto f1 = std::static_pointer_cast<arrow::Int32Array>(struct_array->field(1));
+        auto f2 = std::static_pointer_cast<arrow::Int64Array>(struct_array->field(2));
+        ASSERT_EQ(static_cast<int64_t>(batch.row_kinds.size()), struct_array->length());
+        for (int64_t i = 0; i < struct_array->length(); i++) {
+            int32_t key = f1->Value(i);
+            ASSERT_EQ(expected_buckets[key], batch.bucket);
+            ASSERT_EQ(key + 10, f2->Value(i));
+            if (i > 0) {
+                // read order is kept within a bucket
+                ASSERT_LT(f1->Value(i - 1), key);
+            }
+            RecordBatch::RowKind expected_kind = RecordBatch::RowKind::INSERT;
+            if (key == 2) {
+                expected_kind = RecordBatch::RowKind::UPDATE_AFTER;
+            } else if (key == 6) {
+                expected_kind = RecordBatch::RowKind::UPDATE_BEFORE;
+            }
+            ASSERT_EQ(expected_kind, batch.row_kinds[i]);
+        }
+        total_rows += struct_array->length();
+    }
+    ASSERT_EQ(10, total_rows);
+
+    ASSERT_OK_AND_ASSIGN(auto commit_messages, redistributor->Finish());
+    ASSERT_TRUE(commit_messages.empty());
+    ASSERT_TRUE(closed);
+}
+
+}  // namespace paimon::test
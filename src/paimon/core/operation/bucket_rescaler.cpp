@@ -0,0 +1,47 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/bucket_rescaler.h"
+
+#include <utility>
+
+#include "fmt/format.h"
+#include "paimon/core/core_options.h"
+#include "paimon/core/operation/bucket_redistributor.h"
+#include "paimon/core/operation/bucket_rescaler_impl.h"
+#include "paimon/core/schema/table_schema.h"
+#include "paimon/status.h"
+#include "paimon/write_context.h"
+
+namespace paimon {
+
+Result<std::unique_ptr<BucketRescaler>> BucketRescaler::Create(
+    std::unique_ptr<WriteContext> ctx) {
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<BucketRedistributeContext> context,
+                           BucketRedistributeContext::Create(std::move(ctx)));
+    const CoreOptions& options = context->GetOptions();
+    if (context->GetTableSchema()->PrimaryKeys().empty() || options.GetBucket() <= 0) {
+        return Status::Invalid(fmt::format(
+            "bucket rescaler only support primary key table with fixed bucket, but bucket is {}",
+            options.GetBucket()));
+    }
+    if (options.DeletionVectorsEnabled()) {
+        return Status::NotImplemented("bucket rescaler does not support deletion vectors");
+    }
+    return std::make_unique<BucketRescalerImpl>(std::move(context));
+}
+
+}  // namespace paimon
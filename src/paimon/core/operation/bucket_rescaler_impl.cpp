@@ -0,0 +1,172 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/operation/bucket_rescaler_impl.h"
+
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "fmt/format.h"
+#include "fmt/ranges.h"
+#include "paimon/common/data/binary_row.h"
+#include "paimon/common/executor/future.h"
+#include "paimon/common/utils/linked_hash_map.h"
+#include "paimon/core/io/compact_increment.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/io/data_increment.h"
+#include "paimon/core/manifest/file_kind.h"
+#include "paimon/core/manifest/manifest_entry.h"
+#include "paimon/core/operation/bucket_redistributor.h"
+#include "paimon/core/operation/file_store_scan.h"
+#include "paimon/core/operation/key_value_file_store_scan.h"
+#include "paimon/core/schema/table_schema.h"
+#include "paimon/core/snapshot.h"
+#include "paimon/core/table/sink/commit_message_impl.h"
+#include "paimon/core/table/source/data_split_impl.h"
+#include "paimon/core/utils/file_store_path_factory.h"
+#include "paimon/core/utils/snapshot_manager.h"
+#include "paimon/executor.h"
+#include "paimon/file_store_write.h"
+#include "paimon/reader/batch_reader.h"
+#include "paimon/status.h"
+#include "paimon/table/source/table_read.h"
+
+namespace paimon {
+
+BucketRescalerImpl::BucketRescalerImpl(std::unique_ptr<BucketRedistributeContext>&& context)
+    : context_(std::move(context)) {}
+
+BucketRescalerImpl::~BucketRescalerImpl() = default;
+
+Result<std::vector<std::shared_ptr<CommitMessage>>> BucketRescalerImpl::Rescale(
+    const std::map<std::string, std::string>& partition, int32_t bucket_num) {
+    if (bucket_num <= 0) {
+        return Status::Invalid(
+            fmt::format("bucket number to rescale must be greater than 0, but is {}", bucket_num));
+    }
+    const std::vector<std::string>& partition_keys = context_->GetTableSchema()->PartitionKeys();
+    bool is_full_partition = partition.size() == partition_keys.size();
+    for (const auto& partition_key : partition_keys) {
+        is_full_partition = is_full_partition && partition.count(partition_key) > 0;
+    }
+    if (!is_full_partition) {
+        return Status::Invalid(fmt::format(
+            "partition to rescale must specify all partition keys [{}]",
+            fmt::join(partition_keys, ", ")));
+    }
+    std::vector<std::shared_ptr<CommitMessage>> commit_messages;
+    PAIMON_ASSIGN_OR_RAISE(std::optional<Snapshot> snapshot,
+                           context_->GetSnapshotManager()->LatestSnapshot());
+    if (snapshot == std::nullopt) {
+        return commit_messages;
+    }
+    std::vector<std::map<std::string, std::string>> partition_filters;
+    if (!partition.empty()) {
+        partition_filters.push_back(partition);
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<KeyValueFileStoreScan> scan,
+                           context_->CreateScan(partition_filters));
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FileStoreScan::RawPlan> plan,
+                           scan->WithSnapshot(snapshot.value())->CreatePlan());
+    FileStoreScan::RawPlan::GroupFiles grouped_entries =
+        FileStoreScan::RawPlan::GroupByPartFiles(plan->Files(FileKind::Add()));
+    if (grouped_entries.empty()) {
+        return commit_messages;
+    }
+    if (grouped_entries.size() != 1) {
+        return Status::Invalid(
+            fmt::format("partition to rescale matches {} partitions", grouped_entries.size()));
+    }
+    const BinaryRow& partition_row = grouped_entries.begin()->first;
+    const auto& bucket_map = grouped_entries.begin()->second;
+    bool rescaled = true;
+    for (const auto& [bucket, entries] : bucket_map) {
+        if (bucket < 0) {
+            return Status::Invalid(fmt::format("cannot rescale bucket {}", bucket));
+        }
+        for (const auto& entry : entries) {
+            rescaled = rescaled && entry.TotalBuckets() == bucket_num;
+        }
+    }
+    if (rescaled) {
+        return commit_messages;
+    }
+
+    const std::shared_ptr<FileStorePathFactory>& path_factory = context_->GetPathFactory();
+    PAIMON_ASSIGN_OR_RAISE(auto part_values, path_factory->GeneratePartitionVector(partition_row));
+    std::map<std::string, std::string> partition_map(part_values.begin(), part_values.end());
+    // the rescaled files overwrite all existing files of the partition
+    PAIMON_ASSIGN_OR_RAISE(
+        std::unique_ptr<FileStoreWrite> write,
+        context_->CreateFileStoreWrite(bucket_num, /*ignore_previous_files=*/true));
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<BucketRedistributor> redistributor,
+                           BucketRedistributor::Create(context_->GetTableSchema(), bucket_num,
+                                                       std::move(write),
+                                                       context_->GetMemoryPool()));
+    std::vector<std::pair<int32_t, std::vector<std::shared_ptr<DataFileMeta>>>> bucket_files;
+    std::vector<int32_t> bucket_totals;
+    for (const auto& [bucket, entries] : bucket_map) {
+        std::vector<std::shared_ptr<DataFileMeta>> files;
+        files.reserve(entries.size());
+        for (const auto& entry : entries) {
+            files.push_back(entry.File());
+        }
+        bucket_files.emplace_back(bucket, std::move(files));
+        bucket_totals.push_back(entries[0].TotalBuckets());
+    }
+    // each key is in a single old bucket, so the old buckets are read in parallel. A thread of the
+    // executor is left to the flushes of the writers, which the reading threads may wait for
+    Executor* executor = context_->GetExecutor().get();
+    PAIMON_RETURN_NOT_OK(ParallelFor(
+        executor, bucket_files.size(), executor->GetParallelism(), [&](size_t i) -> Status {
+            int32_t bucket = bucket_files[i].first;
+            std::vector<std::shared_ptr<DataFileMeta>> files = bucket_files[i].second;
+            PAIMON_ASSIGN_OR_RAISE(std::string bucket_path,
+                                   path_factory->BucketPath(partition_row, bucket));
+            DataSplitImpl::Builder builder(partition_row, bucket, bucket_path, std::move(files));
+            // merge read, so that each key is read once with its latest value
+            PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<DataSplitImpl> split,
+                                   builder.WithTotalBuckets(bucket_totals[i])
+                                       .WithSnapshot(snapshot.value().Id())
+                                       .RawConvertible(false)
+                                       .Build());
+            // the merge functions of a table read keep the state of the current key, so each
+            // bucket is read by its own table read
+            PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<TableRead> table_read,
+                                   context_->CreateTableRead(/*force_keep_delete=*/false));
+            PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<BatchReader> reader,
+                                   table_read->CreateReader(split));
+            PAIMON_RETURN_NOT_OK(redistributor->WriteAll(partition_map, reader.get()));
+            reader->Close();
+            return Status::OK();
+        }));
+    // the rows of each new bucket are sorted when the writers flush
+    PAIMON_ASSIGN_OR_RAISE(commit_messages, redistributor->Finish());
+    // the read files are deleted by the same commit, so that the overwrite fails if the partition
+    // is changed after it is scanned, see FileStoreCommit::Overwrite()
+    for (size_t i = 0; i < bucket_files.size(); i++) {
+        std::vector<std::shared_ptr<DataFileMeta>> deleted_files = bucket_files[i].second;
+        DataIncrement data_increment(/*new_files=*/{}, std::move(deleted_files),
+                                     /*changelog_files=*/{});
+        commit_messages.push_back(std::make_shared<CommitMessageImpl>(
+            partition_row, bucket_files[i].first, bucket_totals[i], data_increment,
+            CompactIncrement({}, {}, {})));
+    }
+    return commit_messages;
+}
+
+}  // namespace paimon
@@ -0,0 +1,45 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "paimon/bucket_rescaler.h"
+#include "paimon/commit_message.h"
+#include "paimon/result.h"
+
+namespace paimon {
+
+class BucketRedistributeContext;
+
+class BucketRescalerImpl : public BucketRescaler {
+ public:
+    explicit BucketRescalerImpl(std::unique_ptr<BucketRedistributeContext>&& context);
+    ~BucketRescalerImpl() override;
+
+    Result<std::vector<std::shared_ptr<CommitMessage>>> Rescale(
+        const std::map<std::string, std::string>& partition, int32_t bucket_num) override;
+
+ private:
+    std::unique_ptr<BucketRedistributeContext> context_;
+};
+
+}  // namespace paimon
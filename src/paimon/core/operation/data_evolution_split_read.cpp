@@ -351,7 +351,7 @@ Result<std::unique_ptr<DataEvolutionFileReader>> DataEvolutionSplitRead::CreateU
     // TODO(xinyu.lxy): check nullable when reader_offsets[read_field_idx] = -1
     return DataEvolutionFileReader::Create(std::move(file_batch_readers), raw_read_schema_,
                                            options_.GetReadBatchSize(), reader_offsets,
-                                           field_offsets, pool_);
+                                           field_offsets, pool_, executor_);
 }
 
 Result<bool> DataEvolutionSplitRead::Match(const std::shared_ptr<Split>& split,
@@ -28,14 +28,16 @@
 #include "fmt/format.h"
 #include "paimon/common/data/binary_row.h"
 #include "paimon/common/executor/future.h"
+#include "paimon/common/metrics/metrics_impl.h"
+#include "paimon/common/metrics/scoped_timer.h"
 #include "paimon/common/utils/date_time_utils.h"
 #include "paimon/common/utils/path_util.h"
-#include "paimon/common/utils/scope_guard.h"
 #include "paimon/core/manifest/file_kind.h"
 #include "paimon/core/manifest/manifest_entry.h"
 #include "paimon/core/manifest/manifest_file.h"
 #include "paimon/core/manifest/manifest_file_meta.h"
 #include "paimon/core/manifest/manifest_list.h"
+#include "paimon/core/operation/metrics/commit_metrics.h"
 #include "paimon/core/snapshot.h"
 #include "paimon/core/utils/file_store_path_factory.h"
 #include "paimon/core/utils/snapshot_manager.h"
@@ -56,9 +58,17 @@ ExpireSnapshots::ExpireSnapshots(const std::shared_ptr<SnapshotManager>& snapsho
       fs_(fs),
       config_(config),
       executor_(executor),
+      metrics_(std::make_shared<MetricsImpl>()),
       logger_(Logger::GetLogger("ExpireSnapshots")) {}
 
 Result<int32_t> ExpireSnapshots::Expire() {
+    metrics_ = std::make_shared<MetricsImpl>();
+    for (const char* name :
+         {CommitMetrics::EXPIRED_SNAPSHOTS, CommitMetrics::EXPIRE_DELETED_DATA_FILES,
+          CommitMetrics::EXPIRE_DELETED_MANIFEST_FILES,
+          CommitMetrics::EXPIRE_DELETED_CHANGELOG_FILES}) {
+        metrics_->SetCounter(name, 0);
+    }
     int32_t retain_min = config_.GetSnapshotRetainMin();
     if (retain_min < 1) {
         return Status::Invalid(
@@ -101,28 +111,78 @@ Result<int32_t> ExpireSnapshots::Expire() {
     // TODO(jinli.zjw): support consumer manager
     int64_t older_than_ms =
         DateTimeUtils::GetCurrentUTCTimeUs() / 1000 - config_.GetSnapshotTimeRetainMs();
-    for (int64_t snapshot_id = min; snapshot_id < max; snapshot_id++) {
-        PAIMON_ASSIGN_OR_RAISE(bool exist, snapshot_manager_->SnapshotExists(snapshot_id));
-        if (exist) {
-            PAIMON_ASSIGN_OR_RAISE(Snapshot snapshot, snapshot_manager_->LoadSnapshot(snapshot_id));
-            if (older_than_ms <= snapshot.TimeMillis()) {
-                return ExpireUntil(earliest_snapshot_id.value(), snapshot_id);
+    // prefetch the snapshots a batch at a time, most of the time only the first batch is needed
+    // the loaded snapshots of [min, max) are reused when expiring
+    auto batch_size = static_cast<int64_t>(Parallelism());
+    std::vector<std::optional<Snapshot>> loaded_snapshots;
+    for (int64_t batch_begin = min; batch_begin < max; batch_begin += batch_size) {
+        int64_t batch_end = std::min(max, batch_begin + batch_size);
+        PAIMON_ASSIGN_OR_RAISE(std::vector<std::optional<Snapshot>> snapshots,
+                               LoadSnapshots(batch_begin, batch_end));
+        for (auto& snapshot : snapshots) {
+            loaded_snapshots.push_back(std::move(snapshot));
+        }
+        for (int64_t id = batch_begin; id < batch_end; id++) {
+            const std::optional<Snapshot>& snapshot = loaded_snapshots[id - min];
+            if (snapshot && older_than_ms <= snapshot->TimeMillis()) {
+                return ExpireUntil(earliest_snapshot_id.value(), id, min,
+                                   std::move(loaded_snapshots));
             }
         }
     }
-    return ExpireUntil(earliest_snapshot_id.value(), max);
+    return ExpireUntil(earliest_snapshot_id.value(), max, min, std::move(loaded_snapshots));
+}
+
+Result<std::vector<std::optional<Snapshot>>> ExpireSnapshots::LoadSnapshots(
+    int64_t begin_inclusive_id, int64_t end_exclusive_id) const {
+    ScopedTimer timer(metrics_.get(), CommitMetrics::EXPIRE_LOAD_SNAPSHOTS_DURATION);
+    std::vector<std::optional<Snapshot>> snapshots(
+        std::max<int64_t>(end_exclusive_id - begin_inclusive_id, 0));
+    PAIMON_RETURN_NOT_OK(ParallelFor(
+        executor_.get(), snapshots.size(), Parallelism(), [&](size_t i) -> Status {
+            int64_t snapshot_id = begin_inclusive_id + i;
+            PAIMON_ASSIGN_OR_RAISE(bool exist, snapshot_manager_->SnapshotExists(snapshot_id));
+            if (exist) {
+                PAIMON_ASSIGN_OR_RAISE(snapshots[i], snapshot_manager_->LoadSnapshot(snapshot_id));
+            }
+            return Status::OK();
+        }));
+    return snapshots;
 }
 
-Result<int32_t> ExpireSnapshots::ExpireUntil(int64_t earliest_snapshot_id,
-                                             int64_t end_exclusive_id) {
+size_t ExpireSnapshots::Parallelism() const {
+    return static_cast<size_t>(std::max(config_.GetExpireParallelism(), 1));
+}
+
+Result<int32_t> ExpireSnapshots::ExpireUntil(
+    int64_t earliest_snapshot_id, int64_t end_exclusive_id, int64_t loaded_begin_id,
+    std::vector<std::optional<Snapshot>>&& loaded_snapshots) {
     if (end_exclusive_id <= earliest_snapshot_id) {
         // TODO(jinli.zjw): write earliest hint
         return 0;
     }
+    // the data files deleted by a snapshot are recorded in the delta of the next one, so load
+    // the end snapshot too, only the snapshots which are not loaded yet are read
+    int64_t end_id = end_exclusive_id + 1;
+    auto loaded_end_id = loaded_begin_id + static_cast<int64_t>(loaded_snapshots.size());
+    PAIMON_ASSIGN_OR_RAISE(
+        std::vector<std::optional<Snapshot>> snapshots,
+        LoadSnapshots(earliest_snapshot_id, std::min(loaded_begin_id, end_id)));
+    for (int64_t id = loaded_begin_id; id < std::min(loaded_end_id, end_id); id++) {
+        snapshots.push_back(std::move(loaded_snapshots[id - loaded_begin_id]));
+    }
+    PAIMON_ASSIGN_OR_RAISE(
+        std::vector<std::optional<Snapshot>> rest_snapshots,
+        LoadSnapshots(earliest_snapshot_id + static_cast<int64_t>(snapshots.size()), end_id));
+    for (auto& snapshot : rest_snapshots) {
+        snapshots.push_back(std::move(snapshot));
+    }
+    auto snapshot_at = [&](int64_t id) -> const std::optional<Snapshot>& {
+        return snapshots[id - earliest_snapshot_id];
+    };
     int64_t begin_inclusive_id = earliest_snapshot_id;
     for (int64_t id = end_exclusive_id - 1; id >= earliest_snapshot_id; id--) {
-        PAIMON_ASSIGN_OR_RAISE(bool exist, snapshot_manager_->SnapshotExists(id));
-        if (!exist) {
+        if (!snapshot_at(id)) {
             begin_inclusive_id = id + 1;
             break;
         }
@@ -133,45 +193,66 @@ Result<int32_t> ExpireSnapshots::ExpireUntil(int64_t earliest_snapshot_id,
     // Since the data file deletion information for each snapshot is recorded in the delta part of
     // the next snapshot, it is necessary to check the next snapshot. Otherwise, its data files will
     // not be deleted in this round.
+    std::vector<std::string> delta_manifest_lists;
     for (int64_t id = begin_inclusive_id + 1; id <= end_exclusive_id; id++) {
-        PAIMON_ASSIGN_OR_RAISE(bool exist, snapshot_manager_->SnapshotExists(id));
-        if (!exist) {
+        if (!snapshot_at(id)) {
             begin_inclusive_id++;
             continue;
         }
-        PAIMON_ASSIGN_OR_RAISE(Snapshot snapshot, snapshot_manager_->LoadSnapshot(id));
-        PAIMON_RETURN_NOT_OK(CleanUnusedDataFiles(snapshot.DeltaManifestList()));
+        delta_manifest_lists.push_back(snapshot_at(id)->DeltaManifestList());
     }
-    // TODO(jinli.zjw): support delete changelog files
+    PAIMON_RETURN_NOT_OK(CleanUnusedDataFiles(delta_manifest_lists));
 
     // data files in bucket directories has been deleted
     // then delete changed bucket directories if they are empty
     PAIMON_RETURN_NOT_OK(CleanEmptyDirectories());
 
-    PAIMON_ASSIGN_OR_RAISE(bool exist, snapshot_manager_->SnapshotExists(end_exclusive_id));
-    if (!exist) {
+    const std::optional<Snapshot>& end_snapshot = snapshot_at(end_exclusive_id);
+    if (!end_snapshot) {
         return 0;
     }
-    std::vector<Snapshot> retained_snapshots;
-    PAIMON_ASSIGN_OR_RAISE(Snapshot snapshot, snapshot_manager_->LoadSnapshot(end_exclusive_id));
-    retained_snapshots.push_back(snapshot);
     std::set<std::string> skipping_sets;
-    PAIMON_RETURN_NOT_OK(GetManifestSkippingSet(retained_snapshots, &skipping_sets));
+    PAIMON_RETURN_NOT_OK(GetManifestSkippingSet({end_snapshot.value()}, &skipping_sets));
+    std::vector<int64_t> expired_ids;
+    std::vector<std::string> manifest_lists;
+    std::vector<std::string> changelog_manifest_lists;
+    std::vector<std::string> partition_statistics;
     for (int64_t id = begin_inclusive_id; id < end_exclusive_id; id++) {
-        PAIMON_LOG_DEBUG(logger_, "Ready to delete manifests in snapshot #%ld", id);
-        PAIMON_ASSIGN_OR_RAISE(bool exist, snapshot_manager_->SnapshotExists(id));
-        if (!exist) {
+        if (!snapshot_at(id)) {
             begin_inclusive_id++;
             continue;
         }
-        PAIMON_ASSIGN_OR_RAISE(Snapshot snapshot, snapshot_manager_->LoadSnapshot(id));
-        PAIMON_RETURN_NOT_OK(CleanUnusedManifests(snapshot.BaseManifestList(), skipping_sets));
-        PAIMON_RETURN_NOT_OK(CleanUnusedManifests(snapshot.DeltaManifestList(), skipping_sets));
+        expired_ids.push_back(id);
+        manifest_lists.push_back(snapshot_at(id)->BaseManifestList());
+        manifest_lists.push_back(snapshot_at(id)->DeltaManifestList());
+        if (snapshot_at(id)->ChangelogManifestList()) {
+            changelog_manifest_lists.push_back(snapshot_at(id)->ChangelogManifestList().value());
+        }
+        if (snapshot_at(id)->PartitionStatistics()) {
+            partition_statistics.push_back(snapshot_at(id)->PartitionStatistics().value());
+        }
+    }
+    PAIMON_RETURN_NOT_OK(CleanChangelogFiles(changelog_manifest_lists));
+    manifest_lists.insert(manifest_lists.end(), changelog_manifest_lists.begin(),
+                          changelog_manifest_lists.end());
+    PAIMON_RETURN_NOT_OK(CleanUnusedManifests(manifest_lists, skipping_sets));
+    for (const auto& file_name : partition_statistics) {
+        if (skipping_sets.count(file_name) == 0) {
+            auto status = fs_->Delete(path_factory_->ToManifestFilePath(file_name));
+            // delete quietly will ignore any status error
+            (void)status;
+        }
+    }
+    // delete snapshots from the earliest, so that the remaining ones are always continuous
+    for (int64_t id : expired_ids) {
+        PAIMON_LOG_DEBUG(logger_, "Ready to delete snapshot #%ld", id);
         auto status = fs_->Delete(snapshot_manager_->SnapshotPath(id));
         // delete quietly will ignore any status error
         (void)status;
+        snapshot_manager_->InvalidateSnapshot(id);
     }
     PAIMON_RETURN_NOT_OK(snapshot_manager_->CommitEarliestHint(end_exclusive_id));
+    metrics_->SetCounter(CommitMetrics::EXPIRED_SNAPSHOTS, end_exclusive_id - begin_inclusive_id);
     return end_exclusive_id - begin_inclusive_id;
 }
 
@@ -237,56 +318,172 @@ bool ExpireSnapshots::TryDeleteEmptyDirectory(const std::string& path) const {
     return false;
 }
 
-Status ExpireSnapshots::CleanUnusedManifests(const std::string& manifest_list_name,
+Status ExpireSnapshots::CleanUnusedManifests(const std::vector<std::string>& manifest_list_names,
                                              const std::set<std::string>& skipping_sets) {
-    std::vector<ManifestFileMeta> manifest_file_metas;
-    auto status = manifest_list_->Read(manifest_list_name, nullptr, &manifest_file_metas);
-    if (status.ok()) {
-        std::vector<std::string> to_delete_manifests;
-        // TODO(jinli.zjw): optimize for async
-        for (const auto& manifest_file_meta : manifest_file_metas) {
+    ScopedTimer timer(metrics_.get(), CommitMetrics::EXPIRE_MANIFESTS_DURATION);
+    std::vector<std::vector<ManifestFileMeta>> manifests_of_lists(manifest_list_names.size());
+    std::vector<uint8_t> read_succeeded(manifest_list_names.size(), 0);
+    PAIMON_RETURN_NOT_OK(
+        ParallelFor(executor_.get(), manifest_list_names.size(), Parallelism(), [&](size_t i) {
+            auto status = manifest_list_->Read(manifest_list_names[i], /*filter=*/nullptr,
+                                               &manifests_of_lists[i]);
+            read_succeeded[i] = status.ok();
+            return Status::OK();
+        }));
+    // consecutive snapshots share most of the manifests, delete each of them once
+    std::set<std::string> to_delete_manifests;
+    std::set<std::string> to_delete_manifest_lists;
+    for (size_t i = 0; i < manifest_list_names.size(); i++) {
+        if (!read_succeeded[i]) {
+            continue;
+        }
+        for (const auto& manifest_file_meta : manifests_of_lists[i]) {
             if (skipping_sets.count(manifest_file_meta.FileName()) == 0) {
-                manifest_file_->DeleteQuietly(manifest_file_meta.FileName());
+                to_delete_manifests.insert(manifest_file_meta.FileName());
             }
         }
-        if (skipping_sets.count(manifest_list_name) == 0) {
-            manifest_list_->DeleteQuietly(manifest_list_name);
+        if (skipping_sets.count(manifest_list_names[i]) == 0) {
+            to_delete_manifest_lists.insert(manifest_list_names[i]);
         }
     }
+    std::vector<std::string> manifests(to_delete_manifests.begin(), to_delete_manifests.end());
+    PAIMON_RETURN_NOT_OK(
+        ParallelFor(executor_.get(), manifests.size(), Parallelism(), [&](size_t i) {
+            manifest_file_->DeleteQuietly(manifests[i]);
+            return Status::OK();
+        }));
+    // delete the manifest lists after all of their manifests
+    std::vector<std::string> manifest_lists(to_delete_manifest_lists.begin(),
+                                            to_delete_manifest_lists.end());
+    PAIMON_RETURN_NOT_OK(
+        ParallelFor(executor_.get(), manifest_lists.size(), Parallelism(), [&](size_t i) {
+            manifest_list_->DeleteQuietly(manifest_lists[i]);
+            return Status::OK();
+        }));
+    metrics_->SetCounter(CommitMetrics::EXPIRE_DELETED_MANIFEST_FILES,
+                         manifests.size() + manifest_lists.size());
     return Status::OK();
 }
 
-Status ExpireSnapshots::CleanUnusedDataFiles(const std::string& manifest_list_name) {
-    std::vector<ManifestFileMeta> manifest_file_metas;
-    auto status = manifest_list_->Read(manifest_list_name, nullptr, &manifest_file_metas);
-    if (status.ok()) {
-        std::map<std::string, ManifestEntry> data_files_to_delete;
-        for (const auto& manifest_file_meta : manifest_file_metas) {
-            std::vector<ManifestEntry> manifest_entries;
-            auto status =
-                manifest_file_->Read(manifest_file_meta.FileName(), nullptr, &manifest_entries);
+Status ExpireSnapshots::CleanUnusedDataFiles(const std::vector<std::string>& manifest_list_names) {
+    ScopedTimer timer(metrics_.get(), CommitMetrics::EXPIRE_DATA_FILES_DURATION);
+    std::vector<std::vector<ManifestFileMeta>> manifests_of_lists(manifest_list_names.size());
+    std::vector<uint8_t> list_read_succeeded(manifest_list_names.size(), 0);
+    PAIMON_RETURN_NOT_OK(
+        ParallelFor(executor_.get(), manifest_list_names.size(), Parallelism(), [&](size_t i) {
+            auto status = manifest_list_->Read(manifest_list_names[i], /*filter=*/nullptr,
+                                               &manifests_of_lists[i]);
+            list_read_succeeded[i] = status.ok();
+            return Status::OK();
+        }));
+
+    // decode the manifests of all the manifest lists together
+    std::vector<std::pair<size_t, const ManifestFileMeta*>> manifests;
+    for (size_t i = 0; i < manifest_list_names.size(); i++) {
+        if (list_read_succeeded[i]) {
+            for (const auto& manifest_file_meta : manifests_of_lists[i]) {
+                manifests.emplace_back(i, &manifest_file_meta);
+            }
+        }
+    }
+    std::vector<std::vector<ManifestEntry>> entries_of_manifests(manifests.size());
+    std::vector<Status> read_statuses(manifests.size());
+    PAIMON_RETURN_NOT_OK(ParallelFor(executor_.get(), manifests.size(), Parallelism(),
+                                     [&](size_t i) {
+                                         read_statuses[i] = manifest_file_->Read(
+                                             manifests[i].second->FileName(),
+                                             /*filter=*/nullptr, &entries_of_manifests[i]);
+                                         return Status::OK();
+                                     }));
+
+    std::map<std::string, ManifestEntry> data_files_to_delete;
+    size_t manifest_index = 0;
+    for (size_t i = 0; i < manifest_list_names.size(); i++) {
+        // a file deleted in a manifest may be added back by a later one of the same list
+        std::map<std::string, ManifestEntry> data_files_to_delete_of_list;
+        bool cancelled = false;
+        for (; manifest_index < manifests.size() && manifests[manifest_index].first == i;
+             manifest_index++) {
+            if (cancelled) {
+                continue;
+            }
+            const Status& status = read_statuses[manifest_index];
             if (!status.ok()) {
                 // cancel deletion if any exception occurs
                 PAIMON_LOG_WARN(logger_, "Failed to read some manifest files. Cancel deletion. %s",
                                 status.ToString().c_str());
-                return Status::OK();
-            } else {
-                PAIMON_RETURN_NOT_OK(GetDataFilesToDelete(manifest_entries, &data_files_to_delete));
+                cancelled = true;
+                continue;
             }
+            PAIMON_RETURN_NOT_OK(GetDataFilesToDelete(entries_of_manifests[manifest_index],
+                                                      &data_files_to_delete_of_list));
+        }
+        if (!cancelled) {
+            data_files_to_delete.merge(data_files_to_delete_of_list);
         }
+    }
+    entries_of_manifests.clear();
 
-        std::vector<std::future<void>> futures;
-        ScopeGuard guard([&futures]() { Wait(futures); });
-        for (const auto& [data_file_to_delete, entry] : data_files_to_delete) {
-            auto delete_file_path = data_file_to_delete;
-            futures.push_back(Via(executor_.get(), [this, delete_file_path]() {
-                auto status = fs_->Delete(delete_file_path);
-                // delete quietly will ignore any status error
-                (void)status;
-            }));
-            deletion_buckets_[entry.Partition()].insert(entry.Bucket());
+    std::vector<std::string> data_file_paths;
+    data_file_paths.reserve(data_files_to_delete.size());
+    for (const auto& [data_file_path, entry] : data_files_to_delete) {
+        data_file_paths.push_back(data_file_path);
+        deletion_buckets_[entry.Partition()].insert(entry.Bucket());
+    }
+    PAIMON_RETURN_NOT_OK(
+        ParallelFor(executor_.get(), data_file_paths.size(), Parallelism(), [&](size_t i) {
+            auto status = fs_->Delete(data_file_paths[i]);
+            // delete quietly will ignore any status error
+            (void)status;
+            return Status::OK();
+        }));
+    metrics_->SetCounter(CommitMetrics::EXPIRE_DELETED_DATA_FILES, data_file_paths.size());
+    return Status::OK();
+}
+
+Status ExpireSnapshots::CleanChangelogFiles(
+    const std::vector<std::string>& changelog_manifest_list_names) {
+    std::vector<ManifestFileMeta> manifests;
+    for (const auto& manifest_list_name : changelog_manifest_list_names) {
+        auto status = manifest_list_->Read(manifest_list_name, /*filter=*/nullptr, &manifests);
+        if (!status.ok()) {
+            PAIMON_LOG_WARN(logger_, "Failed to read changelog manifest list %s. %s",
+                            manifest_list_name.c_str(), status.ToString().c_str());
         }
     }
+    std::vector<std::vector<ManifestEntry>> entries_of_manifests(manifests.size());
+    std::vector<Status> read_statuses(manifests.size());
+    PAIMON_RETURN_NOT_OK(ParallelFor(executor_.get(), manifests.size(), Parallelism(),
+                                     [&](size_t i) {
+                                         read_statuses[i] = manifest_file_->Read(
+                                             manifests[i].FileName(),
+                                             /*filter=*/nullptr, &entries_of_manifests[i]);
+                                         return Status::OK();
+                                     }));
+    // the changelog files are only referenced by the snapshot producing them, so all of them are
+    // deleted along with the snapshot
+    std::set<std::string> changelog_file_paths;
+    for (size_t i = 0; i < manifests.size(); i++) {
+        if (!read_statuses[i].ok()) {
+            PAIMON_LOG_WARN(logger_, "Failed to read changelog manifest %s. %s",
+                            manifests[i].FileName().c_str(), read_statuses[i].ToString().c_str());
+            continue;
+        }
+        for (const auto& entry : entries_of_manifests[i]) {
+            PAIMON_ASSIGN_OR_RAISE(std::string bucket_path,
+                                   path_factory_->BucketPath(entry.Partition(), entry.Bucket()));
+            changelog_file_paths.insert(PathUtil::JoinPath(bucket_path, entry.FileName()));
+        }
+    }
+    std::vector<std::string> paths(changelog_file_paths.begin(), changelog_file_paths.end());
+    PAIMON_RETURN_NOT_OK(
+        ParallelFor(executor_.get(), paths.size(), Parallelism(), [&](size_t i) {
+            auto status = fs_->Delete(paths[i]);
+            // delete quietly will ignore any status error
+            (void)status;
+            return Status::OK();
+        }));
+    metrics_->SetCounter(CommitMetrics::EXPIRE_DELETED_CHANGELOG_FILES, paths.size());
     return Status::OK();
 }
 
@@ -328,6 +525,9 @@ Status ExpireSnapshots::GetManifestSkippingSet(const std::vector<Snapshot>& reta
         if (snapshot.Statistics()) {
             skipping_manifest_set->insert(snapshot.Statistics().value());
         }
+        if (snapshot.PartitionStatistics()) {
+            skipping_manifest_set->insert(snapshot.PartitionStatistics().value());
+        }
     }
     return Status::OK();
 }
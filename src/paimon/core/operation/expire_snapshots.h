@@ -16,9 +16,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -26,13 +28,14 @@
 
 #include "paimon/common/data/binary_row.h"
 #include "paimon/core/options/expire_config.h"
+#include "paimon/core/snapshot.h"
 #include "paimon/logging.h"
+#include "paimon/metrics.h"
 #include "paimon/result.h"
 #include "paimon/status.h"
 
 namespace paimon {
 
-class Snapshot;
 class SnapshotManager;
 class FileStorePathFactory;
 class FileSystem;
@@ -53,11 +56,26 @@ class ExpireSnapshots {
 
     Result<int32_t> Expire();
 
+    /// @return The metrics of the last expiration, see `CommitMetrics` for the names.
+    std::shared_ptr<Metrics> GetMetrics() const {
+        return metrics_;
+    }
+
  private:
-    Result<int32_t> ExpireUntil(int64_t earliest_snapshot_id, int64_t end_exclusive_id);
+    /// @param loaded_snapshots The already loaded snapshots starting from `loaded_begin_id`,
+    /// which are reused instead of being loaded again.
+    Result<int32_t> ExpireUntil(int64_t earliest_snapshot_id, int64_t end_exclusive_id,
+                                int64_t loaded_begin_id,
+                                std::vector<std::optional<Snapshot>>&& loaded_snapshots);
 
-    Status CleanUnusedDataFiles(const std::string& manifest_list_name);
-    Status CleanUnusedManifests(const std::string& manifest_list_name,
+    /// Loads snapshots of `[begin_inclusive_id, end_exclusive_id)` concurrently, a snapshot which
+    /// does not exist is nullopt.
+    Result<std::vector<std::optional<Snapshot>>> LoadSnapshots(int64_t begin_inclusive_id,
+                                                               int64_t end_exclusive_id) const;
+    Status CleanUnusedDataFiles(const std::vector<std::string>& manifest_list_names);
+    /// Deletes the changelog files of the changelog manifest lists of the expired snapshots.
+    Status CleanChangelogFiles(const std::vector<std::string>& changelog_manifest_list_names);
+    Status CleanUnusedManifests(const std::vector<std::string>& manifest_list_names,
                                 const std::set<std::string>& skipping_sets);
     Status CleanEmptyDirectories();
     Status GetDataFilesToDelete(const std::vector<ManifestEntry>& data_file_entries,
@@ -65,6 +83,7 @@ class ExpireSnapshots {
     Status GetManifestSkippingSet(const std::vector<Snapshot>& retained_snapshots,
                                   std::set<std::string>* skipping_manifest_set) const;
     bool TryDeleteEmptyDirectory(const std::string& path) const;
+    size_t Parallelism() const;
 
     std::shared_ptr<SnapshotManager> snapshot_manager_;
     std::shared_ptr<FileStorePathFactory> path_factory_;
@@ -74,6 +93,7 @@ class ExpireSnapshots {
     ExpireConfig config_;
     std::shared_ptr<Executor> executor_;
     std::unordered_map<BinaryRow, std::set<std::int32_t>> deletion_buckets_;
+    std::shared_ptr<Metrics> metrics_;
 
     std::unique_ptr<Logger> logger_;
 };
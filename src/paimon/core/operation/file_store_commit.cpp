@@ -33,6 +33,7 @@
 #include "paimon/core/schema/table_schema.h"
 #include "paimon/core/utils/field_mapping.h"
 #include "paimon/core/utils/file_store_path_factory.h"
+#include "paimon/core/utils/metadata_cache.h"
 #include "paimon/core/utils/snapshot_manager.h"
 #include "paimon/format/file_format.h"
 #include "paimon/fs/file_system.h"
@@ -59,6 +60,9 @@ Result<std::unique_ptr<FileStoreCommit>> FileStoreCommit::Create(
     PAIMON_ASSIGN_OR_RAISE(auto tmp_options, CoreOptions::FromMap(ctx->GetOptions()));
     const std::string& root_path = ctx->GetRootPath();
     auto schema_manager = std::make_shared<SchemaManager>(tmp_options.GetFileSystem(), root_path);
+    if (tmp_options.MetadataCacheEnabled()) {
+        schema_manager->WithCache(MetadataCache::Global(), tmp_options.GetMetadataCacheHintTtl());
+    }
     PAIMON_ASSIGN_OR_RAISE(std::optional<std::shared_ptr<TableSchema>> table_schema,
                            schema_manager->Latest());
     if (table_schema == std::nullopt) {
@@ -98,6 +102,9 @@ Result<std::unique_ptr<FileStoreCommit>> FileStoreCommit::Create(
             options.IndexFileInDataFileDir(), ctx->GetMemoryPool()));
 
     auto snapshot_manager = std::make_shared<SnapshotManager>(options.GetFileSystem(), root_path);
+    if (options.MetadataCacheEnabled()) {
+        snapshot_manager->WithCache(MetadataCache::Global(), options.GetMetadataCacheHintTtl());
+    }
     PAIMON_ASSIGN_OR_RAISE(
         std::shared_ptr<ManifestList> manifest_list,
         ManifestList::Create(options.GetFileSystem(), options.GetManifestFormat(),
@@ -31,6 +31,7 @@
 #include "paimon/common/data/blob_utils.h"
 #include "paimon/common/executor/future.h"
 #include "paimon/common/metrics/metrics_impl.h"
+#include "paimon/common/metrics/scoped_timer.h"
 #include "paimon/common/utils/binary_row_partition_computer.h"
 #include "paimon/common/utils/date_time_utils.h"
 #include "paimon/common/utils/scope_guard.h"
@@ -51,6 +52,7 @@
 #include "paimon/core/manifest/manifest_entry.h"
 #include "paimon/core/manifest/manifest_file.h"
 #include "paimon/core/manifest/manifest_file_meta.h"
+#include "paimon/core/manifest/partition_statistics_index.h"
 #include "paimon/core/manifest/manifest_list.h"
 #include "paimon/core/manifest/partition_entry.h"
 #include "paimon/core/operation/append_only_file_store_scan.h"
@@ -102,6 +104,8 @@ FileStoreCommitImpl::FileStoreCommitImpl(
       manifest_file_(manifest_file),
       manifest_list_(manifest_list),
       index_manifest_file_(index_manifest_file),
+      partition_statistics_index_file_(
+          std::make_shared<PartitionStatisticsIndexFile>(fs_, path_factory_, memory_pool_)),
       expire_snapshots_(expire_snapshots),
       schema_manager_(schema_manager),
       metrics_(std::make_shared<MetricsImpl>()),
@@ -116,7 +120,11 @@ FileStoreCommitImpl::FileStoreCommitImpl(
 FileStoreCommitImpl::~FileStoreCommitImpl() = default;
 
 Result<int32_t> FileStoreCommitImpl::Expire() {
-    return expire_snapshots_->Expire();
+    ScopedTimer timer(metrics_.get(), CommitMetrics::EXPIRE_DURATION);
+    PAIMON_ASSIGN_OR_RAISE(int32_t expired, expire_snapshots_->Expire());
+    timer.Stop();
+    metrics_->Merge(expire_snapshots_->GetMetrics());
+    return expired;
 }
 
 Status FileStoreCommitImpl::DropPartition(
@@ -262,9 +270,10 @@ Status FileStoreCommitImpl::Overwrite(
     std::shared_ptr<ManifestCommittable> committable =
         CreateManifestCommittable(identifier, commit_messages, watermark);
     std::vector<ManifestEntry> append_table_files;
+    std::vector<ManifestEntry> append_changelog_files;
     std::vector<IndexManifestEntry> append_table_index_files;
     PAIMON_RETURN_NOT_OK(CollectChanges(committable->FileCommittables(), &append_table_files,
-                                        &append_table_index_files));
+                                        &append_changelog_files, &append_table_index_files));
     if (!append_table_index_files.empty()) {
         return Status::NotImplemented("Overwrite not support index for now");
     }
@@ -283,9 +292,11 @@ Result<int32_t> FileStoreCommitImpl::FilterAndOverwrite(
                            FilterCommitted(committables));
     if (!actual_committables.empty()) {
         std::vector<ManifestEntry> append_table_files;
+        std::vector<ManifestEntry> append_changelog_files;
         std::vector<IndexManifestEntry> append_table_index_files;
         PAIMON_RETURN_NOT_OK(CollectChanges(actual_committables[0]->FileCommittables(),
-                                            &append_table_files, &append_table_index_files));
+                                            &append_table_files, &append_changelog_files,
+                                            &append_table_index_files));
         if (!append_table_index_files.empty()) {
             return Status::NotImplemented("FilterAndOverwrite not support index for now");
         }
@@ -317,23 +328,48 @@ Status FileStoreCommitImpl::TryOverwrite(
     const std::vector<std::map<std::string, std::string>>& partitions,
     const std::vector<ManifestEntry>& changes, int64_t commit_identifier,
     std::optional<int64_t> watermark) {
+    // the deleted files of the changes are the files of the partitions which the changes are
+    // computed from, e.g. by BucketRescaler, so the overwrite must not drop files added since then
+    std::set<std::string> expected_files;
+    std::vector<ManifestEntry> added_changes;
+    for (const auto& change : changes) {
+        if (change.Kind() == FileKind::Delete()) {
+            expected_files.insert(change.File()->file_name);
+        } else {
+            added_changes.push_back(change);
+        }
+    }
     int32_t retry_count = 0;
     while (true) {
         PAIMON_ASSIGN_OR_RAISE(std::optional<Snapshot> latest_snapshot,
                                snapshot_manager_->LatestSnapshot());
         std::vector<ManifestEntry> changes_with_overwrite;
+        std::vector<ManifestEntry> entries;
         if (latest_snapshot) {
-            PAIMON_ASSIGN_OR_RAISE(std::vector<ManifestEntry> entries,
-                                   GetAllFiles(latest_snapshot.value(), partitions));
+            PAIMON_ASSIGN_OR_RAISE(entries, GetAllFiles(latest_snapshot.value(), partitions));
+        }
+        if (!expected_files.empty()) {
+            bool changed = entries.size() != expected_files.size();
             for (const auto& entry : entries) {
-                changes_with_overwrite.emplace_back(FileKind::Delete(), entry.Partition(),
-                                                    entry.Bucket(), entry.TotalBuckets(),
-                                                    entry.File());
+                changed = changed || expected_files.count(entry.File()->file_name) == 0;
             }
+            if (changed) {
+                return Status::Invalid(fmt::format(
+                    "Partitions to overwrite have been changed since the files to overwrite were "
+                    "read, expected {} files but found {} files in snapshot {}.",
+                    expected_files.size(), entries.size(),
+                    latest_snapshot ? latest_snapshot.value().Id() : -1));
+            }
+        }
+        for (const auto& entry : entries) {
+            changes_with_overwrite.emplace_back(FileKind::Delete(), entry.Partition(),
+                                                entry.Bucket(), entry.TotalBuckets(), entry.File());
         }
-        changes_with_overwrite.insert(changes_with_overwrite.end(), changes.begin(), changes.end());
+        changes_with_overwrite.insert(changes_with_overwrite.end(), added_changes.begin(),
+                                      added_changes.end());
         PAIMON_ASSIGN_OR_RAISE(bool commit_success,
-                               TryCommitOnce(changes_with_overwrite, /*index_entries=*/{},
+                               TryCommitOnce(changes_with_overwrite, /*changelog_files=*/{},
+                                             /*index_entries=*/{},
                                              commit_identifier, watermark,
                                              /*log_offsets=*/{}, /*properties=*/{},
                                              Snapshot::CommitKind::Overwrite(), latest_snapshot,
@@ -341,6 +377,8 @@ Status FileStoreCommitImpl::TryOverwrite(
         if (commit_success) {
             break;
         }
+        // the cached latest snapshot may be stale, read it again from the file system
+        snapshot_manager_->InvalidateCache();
         if (retry_count >= options_.GetCommitMaxRetries()) {
             return Status::Invalid(
                 fmt::format("Commit failed after {} attempts, there maybe exist commit conflicts "
@@ -354,15 +392,19 @@ Status FileStoreCommitImpl::TryOverwrite(
 
 Status FileStoreCommitImpl::Commit(const std::shared_ptr<ManifestCommittable>& committable,
                                    bool check_append_files) {
+    ScopedTimer timer(metrics_.get(), CommitMetrics::COMMIT_DURATION);
     std::vector<ManifestEntry> append_table_files;
+    std::vector<ManifestEntry> append_changelog_files;
     std::vector<IndexManifestEntry> append_table_index_files;
     PAIMON_RETURN_NOT_OK(CollectChanges(committable->FileCommittables(), &append_table_files,
-                                        &append_table_index_files));
+                                        &append_changelog_files, &append_table_index_files));
 
     int32_t attempt = 0;
-    if (!ignore_empty_commit_ || !append_table_files.empty() || !append_table_index_files.empty()) {
+    if (!ignore_empty_commit_ || !append_table_files.empty() || !append_changelog_files.empty() ||
+        !append_table_index_files.empty()) {
         PAIMON_ASSIGN_OR_RAISE(int32_t cnt,
-                               TryCommit(append_table_files, append_table_index_files,
+                               TryCommit(append_table_files, append_changelog_files,
+                                         append_table_index_files,
                                          committable->Identifier(), committable->Watermark(),
                                          committable->LogOffsets(), committable->Properties(),
                                          Snapshot::CommitKind::Append(), check_append_files));
@@ -381,6 +423,7 @@ Status FileStoreCommitImpl::Commit(
 }
 
 Result<int32_t> FileStoreCommitImpl::TryCommit(const std::vector<ManifestEntry>& delta_files,
+                                               const std::vector<ManifestEntry>& changelog_files,
                                                const std::vector<IndexManifestEntry>& index_entries,
                                                int64_t identifier, std::optional<int64_t> watermark,
                                                std::map<int32_t, int64_t> log_offsets,
@@ -394,11 +437,14 @@ Result<int32_t> FileStoreCommitImpl::TryCommit(const std::vector<ManifestEntry>&
                                snapshot_manager_->LatestSnapshot());
         PAIMON_ASSIGN_OR_RAISE(
             bool commit_success,
-            TryCommitOnce(delta_files, index_entries, identifier, watermark, log_offsets,
-                          properties, commit_kind, latest_snapshot, check_append_files));
+            TryCommitOnce(delta_files, changelog_files, index_entries, identifier, watermark,
+                          log_offsets, properties, commit_kind, latest_snapshot,
+                          check_append_files));
         if (commit_success) {
             break;
         }
+        // the cached latest snapshot may be stale, read it again from the file system
+        snapshot_manager_->InvalidateCache();
         int64_t current_millis = DateTimeUtils::GetCurrentUTCTimeUs() / 1000;
         if (current_millis - start_millis > options_.GetCommitTimeout() ||
             retry_count >= options_.GetCommitMaxRetries()) {
@@ -484,6 +530,7 @@ Status FileStoreCommitImpl::NoConflictsOrFail(const std::string& base_commit_use
 
 Result<bool> FileStoreCommitImpl::TryCommitOnce(
     const std::vector<ManifestEntry>& delta_entries,
+    const std::vector<ManifestEntry>& changelog_files,
     const std::vector<IndexManifestEntry>& index_entries, int64_t identifier,
     std::optional<int64_t> watermark, std::map<int32_t, int64_t> log_offsets,
     const std::map<std::string, std::string>& properties, Snapshot::CommitKind commit_kind,
@@ -506,6 +553,7 @@ Result<bool> FileStoreCommitImpl::TryCommitOnce(
     }
 
     if (need_conflict_check && latest_snapshot) {
+        ScopedTimer conflict_check_timer(metrics_.get(), CommitMetrics::CONFLICT_CHECK_DURATION);
         std::set<std::map<std::string, std::string>> changed_partitions;
         PAIMON_ASSIGN_OR_RAISE(changed_partitions, ChangedPartitions(delta_files, index_entries));
         PAIMON_ASSIGN_OR_RAISE(
@@ -519,11 +567,14 @@ Result<bool> FileStoreCommitImpl::TryCommitOnce(
     std::vector<ManifestFileMeta> merge_after_manifests;
     std::pair<std::string, int64_t> base_manifest_list;
     std::pair<std::string, int64_t> delta_manifest_list;
+    std::optional<std::pair<std::string, int64_t>> changelog_manifest_list;
+    std::vector<ManifestFileMeta> changelog_manifests;
     std::vector<PartitionEntry> delta_statistics;
     std::string new_snapshot_path;
 
     std::optional<std::string> old_index_manifest;
     std::optional<std::string> index_manifest_name;
+    std::optional<std::string> partition_statistics;
     ScopeGuard guard([&]() {
         int64_t commit_time = ((DateTimeUtils::GetCurrentUTCTimeUs() / 1000) - start_millis) / 1000;
         PAIMON_LOG_WARN(logger_,
@@ -534,12 +585,18 @@ Result<bool> FileStoreCommitImpl::TryCommitOnce(
                         commit_time);
 
         CleanUpTmpManifests(base_manifest_list.first, delta_manifest_list.first,
-                            merge_before_manifests, merge_after_manifests, old_index_manifest,
-                            index_manifest_name);
+                            changelog_manifest_list ? changelog_manifest_list.value().first : "",
+                            changelog_manifests, merge_before_manifests, merge_after_manifests,
+                            old_index_manifest, index_manifest_name);
+        if (partition_statistics) {
+            partition_statistics_index_file_->DeleteQuietly(partition_statistics.value());
+        }
     });
     int64_t next_row_id_start = first_row_id_start;
     int64_t previous_total_record_count = 0;
 
+    ScopedTimer manifest_merge_timer(metrics_.get(), CommitMetrics::MANIFEST_MERGE_DURATION);
+
     if (latest_snapshot) {
         old_index_manifest = latest_snapshot.value().IndexManifest();
         // TODO(yonghao.fyh): total record count should call scan when its std::nullopt
@@ -581,6 +638,7 @@ Result<bool> FileStoreCommitImpl::TryCommitOnce(
     merge_after_manifests.insert(merge_after_manifests.end(), merged_metas.begin(),
                                  merged_metas.end());
     PAIMON_ASSIGN_OR_RAISE(base_manifest_list, manifest_list_->Write(merge_after_manifests));
+    manifest_merge_timer.Stop();
 
     if (options_.RowTrackingEnabled()) {
         // assigned snapshot id to delta files
@@ -611,9 +669,23 @@ Result<bool> FileStoreCommitImpl::TryCommitOnce(
     PAIMON_ASSIGN_OR_RAISE(index_manifest_name, index_manifest_file_->WriteIndexFiles(
                                                     old_index_manifest, index_entries));
 
-    std::optional<std::pair<std::string, int64_t>> changelog_manifest_list;
-    std::optional<std::string> statistics;
+    if (options_.PartitionStatisticsIndexEnabled()) {
+        PAIMON_ASSIGN_OR_RAISE(
+            partition_statistics,
+            WritePartitionStatisticsIndex(latest_snapshot, merge_before_manifests,
+                                          delta_statistics, merge_after_manifests));
+    }
+
+    // write changelog files into manifest files
     int64_t changelog_record_count = 0;
+    if (!changelog_files.empty()) {
+        PAIMON_ASSIGN_OR_RAISE(changelog_manifests, manifest_file_->Write(changelog_files));
+        PAIMON_ASSIGN_OR_RAISE(changelog_manifest_list,
+                               manifest_list_->Write(changelog_manifests));
+        changelog_record_count = ManifestEntry::RecordCountAdd(changelog_files);
+    }
+
+    std::optional<std::string> statistics;
     int64_t schema_id = 0;
     PAIMON_ASSIGN_OR_RAISE(std::optional<std::shared_ptr<TableSchema>> table_schema,
                            schema_manager_->Latest());
@@ -633,9 +705,11 @@ Result<bool> FileStoreCommitImpl::TryCommitOnce(
         delta_record_count, changelog_record_count, watermark, statistics,
         properties.empty() ? std::nullopt
                            : std::optional<std::map<std::string, std::string>>(properties),
-        next_row_id_start);
+        next_row_id_start, partition_statistics);
 
+    ScopedTimer snapshot_commit_timer(metrics_.get(), CommitMetrics::SNAPSHOT_COMMIT_DURATION);
     Result<bool> commit_result = CommitSnapshotImpl(new_snapshot, delta_statistics);
+    snapshot_commit_timer.Stop();
     if (!commit_result.ok()) {
         // commit exception, not sure about the situation and should not clean up the files.
         PAIMON_LOG_WARN(logger_, "You need call FilterAndCommit to retry commit for exception. %s",
@@ -668,6 +742,32 @@ Result<bool> FileStoreCommitImpl::TryCommitOnce(
     }
 }
 
+Result<std::string> FileStoreCommitImpl::WritePartitionStatisticsIndex(
+    const std::optional<Snapshot>& latest_snapshot,
+    const std::vector<ManifestFileMeta>& previous_manifests,
+    const std::vector<PartitionEntry>& delta_statistics,
+    const std::vector<ManifestFileMeta>& manifests) const {
+    std::optional<PartitionStatisticsIndex> previous_index;
+    if (latest_snapshot && latest_snapshot.value().PartitionStatistics()) {
+        const std::string& previous_name = latest_snapshot.value().PartitionStatistics().value();
+        Result<PartitionStatisticsIndex> read_result =
+            partition_statistics_index_file_->Read(previous_name);
+        if (read_result.ok()) {
+            previous_index = std::move(read_result).value();
+        } else {
+            PAIMON_LOG_WARN(logger_,
+                            "Failed to read partition statistics index %s, rebuild it from "
+                            "manifests. %s",
+                            previous_name.c_str(), read_result.status().ToString().c_str());
+        }
+    }
+    PAIMON_ASSIGN_OR_RAISE(
+        PartitionStatisticsIndex index,
+        PartitionStatisticsIndex::Build(previous_index, previous_manifests, delta_statistics,
+                                        manifests, manifest_file_.get()));
+    return partition_statistics_index_file_->Write(index);
+}
+
 void FileStoreCommitImpl::AssignSnapshotId(int64_t snapshot_id,
                                            std::vector<ManifestEntry>* delta_files) const {
     for (auto& entry : *delta_files) {
@@ -738,6 +838,8 @@ Result<bool> FileStoreCommitImpl::CommitSnapshotImpl(
 
 void FileStoreCommitImpl::CleanUpTmpManifests(
     const std::string& base_manifest_list_name, const std::string& delta_manifest_list_name,
+    const std::string& changelog_manifest_list_name,
+    const std::vector<ManifestFileMeta>& changelog_manifests,
     const std::vector<ManifestFileMeta>& merge_before_manifests,
     const std::vector<ManifestFileMeta>& merge_after_manifests,
     const std::optional<std::string>& old_index_manifest,
@@ -750,6 +852,16 @@ void FileStoreCommitImpl::CleanUpTmpManifests(
         manifest_list_->DeleteQuietly(delta_manifest_list_name);
         PAIMON_LOG_DEBUG(logger_, "delta manifest list %s", delta_manifest_list_name.c_str());
     }
+    if (!changelog_manifest_list_name.empty()) {
+        manifest_list_->DeleteQuietly(changelog_manifest_list_name);
+        PAIMON_LOG_DEBUG(logger_, "changelog manifest list %s",
+                         changelog_manifest_list_name.c_str());
+    }
+    for (const auto& changelog_manifest : changelog_manifests) {
+        manifest_list_->DeleteQuietly(changelog_manifest.FileName());
+        PAIMON_LOG_DEBUG(logger_, "delete changelog manifest %s",
+                         changelog_manifest.FileName().c_str());
+    }
     // for faster searching
     std::set<std::string> merge_before_manifest_set;
     for (const auto& merge_before_manifest : merge_before_manifests) {
@@ -784,6 +896,7 @@ std::shared_ptr<ManifestCommittable> FileStoreCommitImpl::CreateManifestCommitta
 Status FileStoreCommitImpl::CollectChanges(
     const std::vector<std::shared_ptr<CommitMessage>>& commit_messages,
     std::vector<ManifestEntry>* append_table_files,
+    std::vector<ManifestEntry>* append_changelog_files,
     std::vector<IndexManifestEntry>* append_table_index_files) {
     for (const auto& message : commit_messages) {
         auto commit_message = std::dynamic_pointer_cast<CommitMessageImpl>(message);
@@ -797,6 +910,11 @@ Status FileStoreCommitImpl::CollectChanges(
                 append_table_files->push_back(
                     MakeEntry(FileKind::Delete(), commit_message, deleted_file));
             }
+            for (const std::shared_ptr<DataFileMeta>& changelog_file :
+                 new_files_increment.ChangelogFiles()) {
+                append_changelog_files->push_back(
+                    MakeEntry(FileKind::Add(), commit_message, changelog_file));
+            }
             for (const std::shared_ptr<IndexFileMeta>& deleted_index_file :
                  new_files_increment.DeletedIndexFiles()) {
                 append_table_index_files->emplace_back(
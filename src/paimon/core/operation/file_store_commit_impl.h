@@ -67,6 +67,7 @@ class Logger;
 class MemoryPool;
 class Metrics;
 class PartitionEntry;
+class PartitionStatisticsIndexFile;
 class SnapshotCommit;
 
 /// Commit operation which provides commit and overwrite.
@@ -145,15 +146,18 @@ class FileStoreCommitImpl : public FileStoreCommit {
 
     Status CollectChanges(const std::vector<std::shared_ptr<CommitMessage>>& commit_messages,
                           std::vector<ManifestEntry>* append_table_files,
+                          std::vector<ManifestEntry>* append_changelog_files,
                           std::vector<IndexManifestEntry>* append_table_index_files);
 
     Result<int32_t> TryCommit(const std::vector<ManifestEntry>& delta_files,
+                              const std::vector<ManifestEntry>& changelog_files,
                               const std::vector<IndexManifestEntry>& index_entries,
                               int64_t identifier, std::optional<int64_t> watermark,
                               std::map<int32_t, int64_t> log_offsets,
                               const std::map<std::string, std::string>& properties,
                               Snapshot::CommitKind commit_kind, bool check_append_files);
     Result<bool> TryCommitOnce(const std::vector<ManifestEntry>& delta_files,
+                               const std::vector<ManifestEntry>& changelog_files,
                                const std::vector<IndexManifestEntry>& index_entries,
                                int64_t commit_identifier, std::optional<int64_t> watermark,
                                std::map<int32_t, int64_t> log_offsets,
@@ -167,11 +171,23 @@ class FileStoreCommitImpl : public FileStoreCommit {
 
     void CleanUpTmpManifests(const std::string& previous_changes_list_name,
                              const std::string& new_changes_list_name,
+                             const std::string& changelog_list_name,
+                             const std::vector<ManifestFileMeta>& changelog_metas,
                              const std::vector<ManifestFileMeta>& old_metas,
                              const std::vector<ManifestFileMeta>& new_metas,
                              const std::optional<std::string>& old_index_manifest,
                              const std::optional<std::string>& new_index_manifest);
 
+    /// Writes the partition statistics index of the new snapshot, updated from the index of the
+    /// latest snapshot, or bootstrapped from its manifests if it has no index.
+    ///
+    /// @return The file name of the written index.
+    Result<std::string> WritePartitionStatisticsIndex(
+        const std::optional<Snapshot>& latest_snapshot,
+        const std::vector<ManifestFileMeta>& previous_manifests,
+        const std::vector<PartitionEntry>& delta_statistics,
+        const std::vector<ManifestFileMeta>& manifests) const;
+
     Result<std::vector<ManifestEntry>> ReadAllEntriesFromChangedPartitions(
         const Snapshot& latest_snapshot,
         const std::set<std::map<std::string, std::string>>& partitions) const;
@@ -212,6 +228,7 @@ class FileStoreCommitImpl : public FileStoreCommit {
     std::shared_ptr<ManifestFile> manifest_file_;
     std::shared_ptr<ManifestList> manifest_list_;
     std::shared_ptr<IndexManifestFile> index_manifest_file_;
+    std::shared_ptr<PartitionStatisticsIndexFile> partition_statistics_index_file_;
 
     std::shared_ptr<ExpireSnapshots> expire_snapshots_;
     std::shared_ptr<SchemaManager> schema_manager_;
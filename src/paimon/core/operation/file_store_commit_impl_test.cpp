@@ -22,6 +22,7 @@
 #include <filesystem>
 #include <iostream>
 #include <set>
+#include <unordered_map>
 #include <utility>
 
 #include "arrow/c/abi.h"
@@ -48,6 +49,8 @@
 #include "paimon/core/manifest/manifest_entry.h"
 #include "paimon/core/manifest/manifest_file_meta.h"
 #include "paimon/core/manifest/manifest_list.h"
+#include "paimon/core/manifest/partition_entry.h"
+#include "paimon/core/manifest/partition_statistics_index.h"
 #include "paimon/core/operation/metrics/commit_metrics.h"
 #include "paimon/core/partition/partition_statistics.h"
 #include "paimon/core/stats/simple_stats.h"
@@ -300,6 +303,11 @@ TEST_F(FileStoreCommitImplTest, TestCommit) {
     ASSERT_OK_AND_ASSIGN(uint64_t counter,
                          metrics->GetCounter(CommitMetrics::LAST_COMMIT_ATTEMPTS));
     ASSERT_EQ(1u, counter);
+    for (const auto& name : {CommitMetrics::COMMIT_DURATION, CommitMetrics::MANIFEST_MERGE_DURATION,
+                             CommitMetrics::SNAPSHOT_COMMIT_DURATION}) {
+        ASSERT_OK_AND_ASSIGN(HistogramStats stats, metrics->GetHistogram(name));
+        ASSERT_EQ(1u, stats.count) << name;
+    }
     ASSERT_OK_AND_ASSIGN(
         bool exist, file_system_->Exists(PathUtil::JoinPath(table_path_, "snapshot/snapshot-1")));
     ASSERT_TRUE(exist);
@@ -1191,6 +1199,17 @@ TEST_F(FileStoreCommitImplTest, TestDropPartitionAndExpireSnapshot) {
     ASSERT_EQ(1, manifests.size());
     ASSERT_EQ(0, manifests[0].NumAddedFiles());
     ASSERT_EQ(2, manifests[0].NumDeletedFiles());
+
+    ASSERT_OK_AND_ASSIGN(counter, metrics->GetCounter(CommitMetrics::EXPIRED_SNAPSHOTS));
+    ASSERT_EQ(1u, counter);
+    ASSERT_OK_AND_ASSIGN(counter, metrics->GetCounter(CommitMetrics::EXPIRE_DELETED_DATA_FILES));
+    ASSERT_EQ(2u, counter);
+    ASSERT_OK_AND_ASSIGN(counter,
+                         metrics->GetCounter(CommitMetrics::EXPIRE_DELETED_MANIFEST_FILES));
+    ASSERT_GT(counter, 0u);
+    ASSERT_OK_AND_ASSIGN(HistogramStats stats,
+                         metrics->GetHistogram(CommitMetrics::EXPIRE_DURATION));
+    ASSERT_EQ(1u, stats.count);
 }
 
 TEST_F(FileStoreCommitImplTest, TestDropMultiPartitionAndExpireSnapshot) {
@@ -1241,6 +1260,76 @@ TEST_F(FileStoreCommitImplTest, TestDropMultiPartitionAndExpireSnapshot) {
     ASSERT_EQ(3, manifests[0].NumDeletedFiles());
 }
 
+TEST_F(FileStoreCommitImplTest, TestPartitionStatisticsIndex) {
+    CommitContextBuilder context_builder(table_path_, "commit_user_1");
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<CommitContext> commit_context,
+                         context_builder.AddOption(Options::MANIFEST_FORMAT, "orc")
+                             .AddOption(Options::MANIFEST_TARGET_FILE_SIZE, "8mb")
+                             .AddOption(Options::FILE_SYSTEM, "local")
+                             .AddOption(Options::PARTITION_STATISTICS_INDEX_ENABLED, "true")
+                             .AddOption(Options::SNAPSHOT_NUM_RETAINED_MIN, "1")
+                             .AddOption(Options::SNAPSHOT_NUM_RETAINED_MAX, "1")
+                             .AddOption(Options::SNAPSHOT_EXPIRE_LIMIT, "30")
+                             .AddOption(Options::SNAPSHOT_TIME_RETAINED, "1ms")
+                             .Finish());
+    ASSERT_OK_AND_ASSIGN(auto commit, FileStoreCommit::Create(std::move(commit_context)));
+    auto commit_impl = dynamic_cast<FileStoreCommitImpl*>(commit.get());
+    ASSERT_TRUE(commit_impl);
+    PartitionStatisticsIndexFile index_file(file_system_, commit_impl->path_factory_,
+                                            GetDefaultPool());
+
+    // the index is supposed to hold the statistics merged from all the data manifests
+    auto check_index = [&](const Snapshot& snapshot) {
+        ASSERT_TRUE(snapshot.PartitionStatistics());
+        ASSERT_OK_AND_ASSIGN(PartitionStatisticsIndex index,
+                             index_file.Read(snapshot.PartitionStatistics().value()));
+        std::vector<ManifestFileMeta> manifests;
+        ASSERT_OK(commit_impl->manifest_list_->ReadDataManifests(snapshot, &manifests));
+        ASSERT_EQ(manifests.size(), index.ManifestPartitions().size());
+        std::unordered_map<BinaryRow, PartitionEntry> expected;
+        for (const auto& manifest : manifests) {
+            std::vector<ManifestEntry> entries;
+            ASSERT_OK(commit_impl->manifest_file_->Read(manifest.FileName(), nullptr, &entries));
+            ASSERT_OK(PartitionEntry::Merge(entries, &expected));
+            ASSERT_EQ(1, index.ManifestPartitions().count(manifest.FileName()));
+        }
+        ASSERT_EQ(expected.size(), index.Partitions().size());
+        for (const auto& partition : index.Partitions()) {
+            auto iter = expected.find(partition.Partition());
+            ASSERT_TRUE(iter != expected.end());
+            ASSERT_EQ(iter->second, partition);
+        }
+    };
+
+    for (const auto& [identifier, name] :
+         std::vector<std::pair<int64_t, std::string>>{{0, "01"}, {1, "02"}}) {
+        std::vector<std::shared_ptr<CommitMessage>> msgs =
+            GetCommitMessages(paimon::test::GetDataDir() +
+                                  "/orc/append_09.db/append_09/commit_messages/"
+                                  "commit_messages-" +
+                                  name,
+                              /*version=*/3);
+        ASSERT_OK(commit->Commit(msgs, identifier));
+        ASSERT_OK_AND_ASSIGN(std::optional<Snapshot> snapshot,
+                             commit_impl->snapshot_manager_->LatestSnapshot());
+        check_index(snapshot.value());
+    }
+    ASSERT_OK(commit->DropPartition({{{"f1", "10"}}}, /*commit_identifier=*/2));
+    ASSERT_OK_AND_ASSIGN(Snapshot snapshot1, commit_impl->snapshot_manager_->LoadSnapshot(1));
+    ASSERT_OK_AND_ASSIGN(Snapshot snapshot3, commit_impl->snapshot_manager_->LoadSnapshot(3));
+    check_index(snapshot3);
+
+    ASSERT_OK_AND_ASSIGN(int32_t expire_snapshot_cnt, commit->Expire());
+    ASSERT_EQ(2, expire_snapshot_cnt);
+    const auto& path_factory = commit_impl->path_factory_;
+    ASSERT_OK_AND_ASSIGN(bool exist, file_system_->Exists(path_factory->ToManifestFilePath(
+                                         snapshot1.PartitionStatistics().value())));
+    ASSERT_FALSE(exist);
+    ASSERT_OK_AND_ASSIGN(exist, file_system_->Exists(path_factory->ToManifestFilePath(
+                                    snapshot3.PartitionStatistics().value())));
+    ASSERT_TRUE(exist);
+}
+
 TEST_F(FileStoreCommitImplTest, TestCreateManifestCommittable) {
     CommitContextBuilder context_builder(table_path_, "commit_user_1");
     ASSERT_OK_AND_ASSIGN(std::unique_ptr<CommitContext> commit_context,
@@ -1279,9 +1368,12 @@ TEST_F(FileStoreCommitImplTest, TestCollectChanges) {
     auto commit_impl = std::dynamic_pointer_cast<FileStoreCommitImpl>(
         std::shared_ptr<FileStoreCommit>(std::move(commit)));
     std::vector<ManifestEntry> append_table_files;
+    std::vector<ManifestEntry> append_changelog_files;
     std::vector<IndexManifestEntry> append_table_index_files;
-    ASSERT_OK(commit_impl->CollectChanges(msgs, &append_table_files, &append_table_index_files));
+    ASSERT_OK(commit_impl->CollectChanges(msgs, &append_table_files, &append_changelog_files,
+                                          &append_table_index_files));
     ASSERT_EQ(append_table_files.size(), 3u);
+    ASSERT_EQ(append_changelog_files.size(), 0u);
     ASSERT_EQ(append_table_index_files.size(), 0u);
     ASSERT_EQ(append_table_files[0].Kind(), FileKind::Add());
     ASSERT_EQ(append_table_files[0].Bucket(), 0);
@@ -16,6 +16,7 @@
 
 #include "paimon/core/operation/file_store_scan.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <future>
 #include <list>
@@ -71,9 +72,40 @@ FileStoreScan::RawPlan::GroupFiles FileStoreScan::RawPlan::GroupByPartFiles(
 }
 
 Result<std::vector<PartitionEntry>> FileStoreScan::ReadPartitionEntries() const {
-    std::optional<Snapshot> snapshot;
+    PAIMON_ASSIGN_OR_RAISE(std::optional<Snapshot> snapshot, ReadSnapshot());
+    if (snapshot == std::nullopt) {
+        return std::vector<PartitionEntry>();
+    }
+    // the index holds statistics of whole partitions, so it only serves scans without filters
+    // on files
+    bool whole_partitions = scan_mode_ == ScanMode::ALL && !predicates_ && !row_ranges_ &&
+                            !only_read_real_buckets_ && bucket_filter_ == std::nullopt &&
+                            level_filter_ == nullptr;
+    std::optional<PartitionStatisticsIndex> index;
+    if (whole_partitions) {
+        index = ReadPartitionStatisticsIndex(snapshot.value());
+    }
+    if (index) {
+        std::vector<PartitionEntry> partition_entries;
+        for (const auto& partition_entry : index.value().Partitions()) {
+            if (partition_entry.FileCount() <= 0) {
+                continue;
+            }
+            if (partition_filter_) {
+                PAIMON_ASSIGN_OR_RAISE(
+                    bool res,
+                    partition_filter_->Test(partition_schema_, partition_entry.Partition()));
+                if (!res) {
+                    continue;
+                }
+            }
+            partition_entries.push_back(partition_entry);
+        }
+        return partition_entries;
+    }
+
     std::vector<ManifestFileMeta> manifest_file_metas;
-    PAIMON_RETURN_NOT_OK(ReadManifests(&snapshot, &manifest_file_metas));
+    PAIMON_RETURN_NOT_OK(FilterManifests(snapshot.value(), &manifest_file_metas));
     std::vector<ManifestEntry> manifest_entries;
     PAIMON_RETURN_NOT_OK(ReadFileEntries(manifest_file_metas, &manifest_entries));
     std::unordered_map<BinaryRow, PartitionEntry> partitions;
@@ -129,26 +161,78 @@ Status FileStoreScan::ReadManifests(std::optional<Snapshot>* snapshot_ptr,
                                     std::vector<ManifestFileMeta>* manifests_ptr) const {
     auto& snapshot = *snapshot_ptr;
     auto& manifests = *manifests_ptr;
-    if (specified_snapshot_ != std::nullopt) {
-        snapshot = specified_snapshot_;
-    } else {
-        PAIMON_ASSIGN_OR_RAISE(snapshot, snapshot_manager_->LatestSnapshot());
-    }
+    PAIMON_ASSIGN_OR_RAISE(snapshot, ReadSnapshot());
     if (snapshot == std::nullopt) {
         manifests = std::vector<ManifestFileMeta>();
         return Status::OK();
     }
+    return FilterManifests(snapshot.value(), manifests_ptr);
+}
+
+Result<std::optional<Snapshot>> FileStoreScan::ReadSnapshot() const {
+    if (specified_snapshot_ != std::nullopt) {
+        return specified_snapshot_;
+    }
+    return snapshot_manager_->LatestSnapshot();
+}
+
+Status FileStoreScan::FilterManifests(const Snapshot& snapshot,
+                                      std::vector<ManifestFileMeta>* manifests) const {
     std::vector<ManifestFileMeta> unfiltered_manifest_metas;
-    PAIMON_RETURN_NOT_OK(ReadManifestsWithSnapshot(snapshot.value(), &unfiltered_manifest_metas));
+    PAIMON_RETURN_NOT_OK(ReadManifestsWithSnapshot(snapshot, &unfiltered_manifest_metas));
+    std::unordered_set<std::string> pruned_manifests;
+    if (partition_filter_) {
+        std::optional<PartitionStatisticsIndex> index = ReadPartitionStatisticsIndex(snapshot);
+        if (index) {
+            PAIMON_ASSIGN_OR_RAISE(pruned_manifests, PrunedManifests(index.value()));
+        }
+    }
     for (const auto& meta : unfiltered_manifest_metas) {
+        if (pruned_manifests.find(meta.FileName()) != pruned_manifests.end()) {
+            continue;
+        }
         PAIMON_ASSIGN_OR_RAISE(bool filter_meta_result, FilterManifestFileMeta(meta));
         if (filter_meta_result) {
-            manifests.push_back(meta);
+            manifests->push_back(meta);
         }
     }
     return Status::OK();
 }
 
+std::optional<PartitionStatisticsIndex> FileStoreScan::ReadPartitionStatisticsIndex(
+    const Snapshot& snapshot) const {
+    if (!partition_statistics_index_file_ || snapshot.PartitionStatistics() == std::nullopt) {
+        return std::nullopt;
+    }
+    Result<PartitionStatisticsIndex> index =
+        partition_statistics_index_file_->Read(snapshot.PartitionStatistics().value());
+    if (!index.ok()) {
+        return std::nullopt;
+    }
+    return std::move(index).value();
+}
+
+Result<std::unordered_set<std::string>> FileStoreScan::PrunedManifests(
+    const PartitionStatisticsIndex& index) const {
+    const auto& partitions = index.Partitions();
+    // test each partition once, manifests usually share partitions
+    std::vector<bool> passed(partitions.size());
+    for (size_t i = 0; i < partitions.size(); i++) {
+        PAIMON_ASSIGN_OR_RAISE(
+            bool res, partition_filter_->Test(partition_schema_, partitions[i].Partition()));
+        passed[i] = res;
+    }
+    std::unordered_set<std::string> pruned_manifests;
+    for (const auto& [file_name, ordinals] : index.ManifestPartitions()) {
+        bool any_passed = std::any_of(ordinals.begin(), ordinals.end(),
+                                      [&passed](int32_t ordinal) { return passed[ordinal]; });
+        if (!any_passed) {
+            pruned_manifests.insert(file_name);
+        }
+    }
+    return pruned_manifests;
+}
+
 Status FileStoreScan::ReadManifestsWithSnapshot(const Snapshot& snapshot,
                                                 std::vector<ManifestFileMeta>* manifests) const {
     switch (scan_mode_) {
@@ -156,6 +240,8 @@ Status FileStoreScan::ReadManifestsWithSnapshot(const Snapshot& snapshot,
             return manifest_list_->ReadDataManifests(snapshot, manifests);
         case ScanMode::DELTA:
             return manifest_list_->ReadDeltaManifests(snapshot, manifests);
+        case ScanMode::CHANGELOG:
+            return manifest_list_->ReadChangelogManifests(snapshot, manifests);
         default:
             return Status::NotImplemented("Unknown scan mode ",
                                           std::to_string(static_cast<int32_t>(scan_mode_)));
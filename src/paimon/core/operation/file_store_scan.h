@@ -24,6 +24,7 @@
 #include <mutex>
 #include <optional>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -40,6 +41,7 @@
 #include "paimon/core/manifest/manifest_file_meta.h"
 #include "paimon/core/manifest/manifest_list.h"
 #include "paimon/core/manifest/partition_entry.h"
+#include "paimon/core/manifest/partition_statistics_index.h"
 #include "paimon/core/schema/schema_manager.h"
 #include "paimon/core/snapshot.h"
 #include "paimon/core/table/source/scan_mode.h"
@@ -115,6 +117,14 @@ class FileStoreScan {
         return this;
     }
 
+    /// Reads the partition statistics index of snapshots which have one, to list partitions
+    /// and to skip manifests without partitions passing the partition filter.
+    FileStoreScan* WithPartitionStatisticsIndexFile(
+        const std::shared_ptr<PartitionStatisticsIndexFile>& partition_statistics_index_file) {
+        partition_statistics_index_file_ = partition_statistics_index_file;
+        return this;
+    }
+
     virtual FileStoreScan* EnableValueFilter() {
         return this;
     }
@@ -212,6 +222,11 @@ class FileStoreScan {
     Status ReadManifests(std::optional<Snapshot>* snapshot_ptr,
                          std::vector<ManifestFileMeta>* manifests_ptr) const;
 
+    Result<std::optional<Snapshot>> ReadSnapshot() const;
+
+    Status FilterManifests(const Snapshot& snapshot,
+                           std::vector<ManifestFileMeta>* manifests) const;
+
     Status ReadManifestsWithSnapshot(const Snapshot& snapshot,
                                      std::vector<ManifestFileMeta>* manifests) const;
 
@@ -229,6 +244,15 @@ class FileStoreScan {
 
     Result<bool> FilterManifestFileMeta(const ManifestFileMeta& manifest) const;
 
+    /// @return The partition statistics index of the snapshot, null if the snapshot has no index
+    /// or the index fails to read, in which case the manifests are the source of truth.
+    std::optional<PartitionStatisticsIndex> ReadPartitionStatisticsIndex(
+        const Snapshot& snapshot) const;
+
+    /// @return Names of the indexed manifests none of whose partitions pass the partition filter.
+    Result<std::unordered_set<std::string>> PrunedManifests(
+        const PartitionStatisticsIndex& index) const;
+
     Status ReadManifestFileMeta(const ManifestFileMeta& manifest,
                                 std::vector<ManifestEntry>* entries) const;
 
@@ -255,5 +279,6 @@ class FileStoreScan {
     std::optional<int32_t> bucket_filter_;
     std::function<bool(int32_t)> level_filter_;
     std::optional<Snapshot> specified_snapshot_;
+    std::shared_ptr<PartitionStatisticsIndexFile> partition_statistics_index_file_;
 };
 }  // namespace paimon
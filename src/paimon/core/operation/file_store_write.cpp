@@ -36,6 +36,7 @@
 #include "paimon/core/utils/field_mapping.h"
 #include "paimon/core/utils/fields_comparator.h"
 #include "paimon/core/utils/file_store_path_factory.h"
+#include "paimon/core/utils/metadata_cache.h"
 #include "paimon/core/utils/primary_key_table_utils.h"
 #include "paimon/core/utils/snapshot_manager.h"
 #include "paimon/format/file_format.h"
@@ -68,6 +69,9 @@ Result<std::unique_ptr<FileStoreWrite>> FileStoreWrite::Create(std::unique_ptr<W
     std::string branch = ctx->GetBranch();
     auto schema_manager =
         std::make_shared<SchemaManager>(tmp_options.GetFileSystem(), ctx->GetRootPath(), branch);
+    if (tmp_options.MetadataCacheEnabled()) {
+        schema_manager->WithCache(MetadataCache::Global(), tmp_options.GetMetadataCacheHintTtl());
+    }
     PAIMON_ASSIGN_OR_RAISE(std::optional<std::shared_ptr<TableSchema>> table_schema,
                            schema_manager->Latest());
     if (table_schema == std::nullopt) {
@@ -94,6 +98,9 @@ Result<std::unique_ptr<FileStoreWrite>> FileStoreWrite::Create(std::unique_ptr<W
             options.IndexFileInDataFileDir(), ctx->GetMemoryPool()));
     auto snapshot_manager =
         std::make_shared<SnapshotManager>(options.GetFileSystem(), ctx->GetRootPath(), branch);
+    if (options.MetadataCacheEnabled()) {
+        snapshot_manager->WithCache(MetadataCache::Global(), options.GetMetadataCacheHintTtl());
+    }
     bool ignore_previous_files = ctx->IgnorePreviousFiles();
     if (schema->PrimaryKeys().empty()) {
         // append table
@@ -20,16 +20,25 @@
 #include <vector>
 
 #include "paimon/common/data/binary_row.h"
+#include "paimon/common/metrics/metrics_impl.h"
 #include "paimon/core/core_options.h"
 #include "paimon/core/io/data_file_meta.h"
 #include "paimon/core/manifest/manifest_file.h"
 #include "paimon/core/manifest/manifest_list.h"
+#include "paimon/core/mergetree/compact/lookup_merge_function.h"
+#include "paimon/core/mergetree/compact/merge_function.h"
+#include "paimon/core/mergetree/compact/reducer_merge_function_wrapper.h"
+#include "paimon/core/mergetree/lookup_file.h"
+#include "paimon/core/mergetree/lookup_levels.h"
 #include "paimon/core/mergetree/merge_tree_writer.h"
 #include "paimon/core/operation/file_store_scan.h"
 #include "paimon/core/operation/key_value_file_store_scan.h"
+#include "paimon/core/options/changelog_producer.h"
+#include "paimon/core/options/merge_engine.h"
 #include "paimon/core/schema/table_schema.h"
 #include "paimon/core/snapshot.h"
 #include "paimon/core/utils/file_store_path_factory.h"
+#include "paimon/core/utils/primary_key_table_utils.h"
 #include "paimon/core/utils/snapshot_manager.h"
 
 namespace arrow {
@@ -86,6 +95,16 @@ Result<std::unique_ptr<FileStoreScan>> KeyValueFileStoreWrite::CreateFileStoreSc
     return scan;
 }
 
+std::shared_ptr<Metrics> KeyValueFileStoreWrite::GetMetrics() const {
+    if (lookup_file_cache_ == nullptr) {
+        return AbstractFileStoreWrite::GetMetrics();
+    }
+    auto metrics = std::make_shared<MetricsImpl>();
+    metrics->Merge(AbstractFileStoreWrite::GetMetrics());
+    metrics->Merge(lookup_file_cache_->GetMetrics());
+    return metrics;
+}
+
 Result<std::pair<int32_t, std::shared_ptr<BatchWriter>>> KeyValueFileStoreWrite::CreateWriter(
     const BinaryRow& partition, int32_t bucket, bool ignore_previous_files) {
     PAIMON_LOG_DEBUG(logger_, "Creating key value writer for partition %s, bucket %d",
@@ -104,10 +123,51 @@ Result<std::pair<int32_t, std::shared_ptr<BatchWriter>>> KeyValueFileStoreWrite:
                            file_store_path_factory_->CreateDataFilePathFactory(partition, bucket));
     PAIMON_ASSIGN_OR_RAISE(std::vector<std::string> trimmed_primary_keys,
                            table_schema_->TrimmedPrimaryKeys());
+    std::unique_ptr<LookupLevels> lookup_levels;
+    std::unique_ptr<MergeFunction> changelog_merge_function;
+    if (options_.GetChangelogProducer() == ChangelogProducer::LOOKUP) {
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<MergeFunction> lookup_merge_function,
+                               PrimaryKeyTableUtils::CreateMergeFunction(
+                                   schema_, table_schema_->PrimaryKeys(), options_));
+        if (options_.GetMergeEngine() != MergeEngine::FIRST_ROW) {
+            lookup_merge_function =
+                std::make_unique<LookupMergeFunction>(std::move(lookup_merge_function));
+        }
+        if (lookup_file_cache_ == nullptr) {
+            PAIMON_ASSIGN_OR_RAISE(lookup_file_cache_,
+                                   LookupFileCache::Create(options_.GetLookupCacheDir(),
+                                                           options_.GetLookupCacheMaxDiskSize(),
+                                                           options_.GetLookupCacheMaxMemorySize()));
+        }
+        PAIMON_ASSIGN_OR_RAISE(
+            lookup_levels,
+            LookupLevels::Create(table_schema_, schema_manager_, options_, data_file_path_factory,
+                                 key_comparator_, user_defined_seq_comparator_,
+                                 std::move(lookup_merge_function), restore_files,
+                                 lookup_file_cache_, pool_));
+        PAIMON_ASSIGN_OR_RAISE(changelog_merge_function,
+                               PrimaryKeyTableUtils::CreateMergeFunction(
+                                   schema_, table_schema_->PrimaryKeys(), options_));
+    }
+    std::shared_ptr<MergeFunctionWrapper<KeyValue>> merge_function_wrapper =
+        merge_function_wrapper_;
+    if (options_.WriteAsyncFlushEnabled()) {
+        // flushes of different buckets run concurrently, so each writer needs its own merge
+        // function
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<MergeFunction> merge_function,
+                               PrimaryKeyTableUtils::CreateMergeFunction(
+                                   schema_, table_schema_->PrimaryKeys(), options_));
+        if (options_.NeedLookup() && options_.GetMergeEngine() != MergeEngine::FIRST_ROW) {
+            merge_function = std::make_unique<LookupMergeFunction>(std::move(merge_function));
+        }
+        merge_function_wrapper =
+            std::make_shared<ReducerMergeFunctionWrapper>(std::move(merge_function));
+    }
     auto writer = std::make_shared<MergeTreeWriter>(
         max_sequence_number, trimmed_primary_keys, data_file_path_factory, key_comparator_,
-        user_defined_seq_comparator_, merge_function_wrapper_, table_schema_->Id(), schema_,
-        options_, pool_);
+        user_defined_seq_comparator_, merge_function_wrapper, table_schema_->Id(), schema_,
+        options_, std::move(lookup_levels), std::move(changelog_merge_function), executor_,
+        flush_memory_budget_, pool_);
     return std::pair<int32_t, std::shared_ptr<BatchWriter>>(total_buckets, writer);
 }
 
@@ -40,7 +40,9 @@ class BinaryRow;
 class CoreOptions;
 class Executor;
 class FileStorePathFactory;
+class LookupFileCache;
 class MemoryPool;
+class Metrics;
 class SchemaManager;
 class SnapshotManager;
 class TableSchema;
@@ -64,6 +66,8 @@ class KeyValueFileStoreWrite : public AbstractFileStoreWrite {
         bool ignore_num_bucket_check, const std::shared_ptr<Executor>& executor,
         const std::shared_ptr<MemoryPool>& pool);
 
+    std::shared_ptr<Metrics> GetMetrics() const override;
+
  private:
     Result<std::pair<int32_t, std::shared_ptr<BatchWriter>>> CreateWriter(
         const BinaryRow& partition, int32_t bucket, bool ignore_previous_files) override;
@@ -75,6 +79,8 @@ class KeyValueFileStoreWrite : public AbstractFileStoreWrite {
     std::shared_ptr<FieldsComparator> key_comparator_;
     std::shared_ptr<FieldsComparator> user_defined_seq_comparator_;
     std::shared_ptr<MergeFunctionWrapper<KeyValue>> merge_function_wrapper_;
+    // shared by the writers of lookup changelog producer, created with the first writer
+    std::shared_ptr<LookupFileCache> lookup_file_cache_;
     std::unique_ptr<Logger> logger_;
 };
 
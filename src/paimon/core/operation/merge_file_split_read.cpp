@@ -27,12 +27,14 @@
 #include "arrow/c/abi.h"
 #include "arrow/c/bridge.h"
 #include "arrow/type.h"
+#include "paimon/common/predicate/literal_converter.h"
 #include "paimon/common/predicate/predicate_utils.h"
 #include "paimon/common/reader/complete_row_kind_batch_reader.h"
 #include "paimon/common/reader/concat_batch_reader.h"
 #include "paimon/common/table/special_fields.h"
 #include "paimon/common/types/data_field.h"
 #include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/common/utils/field_type_utils.h"
 #include "paimon/core/core_options.h"
 #include "paimon/core/deletionvectors/apply_deletion_vector_batch_reader.h"
 #include "paimon/core/deletionvectors/deletion_vector.h"
@@ -49,6 +51,7 @@
 #include "paimon/core/mergetree/compact/sort_merge_reader_with_loser_tree.h"
 #include "paimon/core/mergetree/compact/sort_merge_reader_with_min_heap.h"
 #include "paimon/core/mergetree/drop_delete_reader.h"
+#include "paimon/core/mergetree/key_range_filter_reader.h"
 #include "paimon/core/mergetree/sorted_run.h"
 #include "paimon/core/operation/internal_read_context.h"
 #include "paimon/core/options/merge_engine.h"
@@ -61,6 +64,7 @@
 #include "paimon/core/utils/file_store_path_factory.h"
 #include "paimon/core/utils/primary_key_table_utils.h"
 #include "paimon/memory/memory_pool.h"
+#include "paimon/predicate/predicate_builder.h"
 #include "paimon/reader/file_batch_reader.h"
 #include "paimon/table/source/data_split.h"
 #include "paimon/utils/roaring_bitmap32.h"
@@ -188,7 +192,8 @@ Result<std::unique_ptr<BatchReader>> MergeFileSplitRead::CreateMergeReader(
         PAIMON_ASSIGN_OR_RAISE(
             std::unique_ptr<BatchReader> projection_reader,
             CreateReaderForSection(section, data_split->BucketPath(), data_split->Partition(),
-                                   deletion_file_map, data_file_path_factory));
+                                   deletion_file_map, data_split->LowerKey(),
+                                   data_split->UpperKey(), data_file_path_factory));
         batch_readers.push_back(std::move(projection_reader));
     }
     auto concat_batch_reader = std::make_unique<ConcatBatchReader>(std::move(batch_readers), pool_);
@@ -356,6 +361,49 @@ Result<std::shared_ptr<Predicate>> MergeFileSplitRead::GenerateKeyPredicates(
     return PredicateUtils::ExcludePredicateWithFields(predicate, non_primary_keys);
 }
 
+Result<std::shared_ptr<Predicate>> MergeFileSplitRead::GenerateKeyRangePredicate(
+    const TableSchema& table_schema, const std::optional<BinaryRow>& lower_key,
+    const std::optional<BinaryRow>& upper_key) {
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::string> trimmed_key_fields,
+                           table_schema.TrimmedPrimaryKeys());
+    PAIMON_ASSIGN_OR_RAISE(DataField first_key_field, table_schema.GetField(trimmed_key_fields[0]));
+    std::vector<std::string> field_names = table_schema.FieldNames();
+    auto field_index = static_cast<int32_t>(
+        std::find(field_names.begin(), field_names.end(), first_key_field.Name()) -
+        field_names.begin());
+    PAIMON_ASSIGN_OR_RAISE(FieldType field_type,
+                           FieldTypeUtils::ConvertToFieldType(first_key_field.Type()->id()));
+    auto key_schema = DataField::ConvertDataFieldsToArrowSchema({first_key_field});
+    // keys are ordered by the first key field first, so the first key field of the keys in
+    // [lower_key, upper_key) is in [lower_key[0], upper_key[0]], and in [lower_key[0],
+    // upper_key[0]) if it is the only key field
+    std::vector<std::shared_ptr<Predicate>> predicates;
+    if (lower_key && !lower_key.value().IsNullAt(0)) {
+        PAIMON_ASSIGN_OR_RAISE(Literal lower, LiteralConverter::ConvertLiteralsFromRow(
+                                                  key_schema, lower_key.value(), 0, field_type));
+        predicates.push_back(PredicateBuilder::GreaterOrEqual(field_index, first_key_field.Name(),
+                                                              field_type, lower));
+    }
+    if (upper_key && !upper_key.value().IsNullAt(0)) {
+        PAIMON_ASSIGN_OR_RAISE(Literal upper, LiteralConverter::ConvertLiteralsFromRow(
+                                                  key_schema, upper_key.value(), 0, field_type));
+        if (trimmed_key_fields.size() == 1) {
+            predicates.push_back(PredicateBuilder::LessThan(field_index, first_key_field.Name(),
+                                                            field_type, upper));
+        } else {
+            predicates.push_back(PredicateBuilder::LessOrEqual(
+                field_index, first_key_field.Name(), field_type, upper));
+        }
+    }
+    if (predicates.empty()) {
+        return std::shared_ptr<Predicate>();
+    }
+    if (predicates.size() == 1) {
+        return predicates[0];
+    }
+    return PredicateBuilder::And(predicates);
+}
+
 std::vector<int32_t> MergeFileSplitRead::CreateProjection(
     const std::shared_ptr<arrow::Schema>& raw_read_schema,
     const std::shared_ptr<arrow::Schema>& value_schema) {
@@ -373,6 +421,7 @@ Result<std::unique_ptr<BatchReader>> MergeFileSplitRead::CreateReaderForSection(
     const std::vector<SortedRun>& section, const std::string& bucket_path,
     const BinaryRow& partition,
     const std::unordered_map<std::string, DeletionFile>& deletion_file_map,
+    const std::optional<BinaryRow>& lower_key, const std::optional<BinaryRow>& upper_key,
     const std::shared_ptr<DataFilePathFactory>& data_file_path_factory) const {
     // with overlap in one section
     std::vector<std::unique_ptr<KeyValueRecordReader>> record_readers;
@@ -383,6 +432,19 @@ Result<std::unique_ptr<BatchReader>> MergeFileSplitRead::CreateReaderForSection(
     } else {
         predicate = context_->GetPredicate();
     }
+    if (lower_key || upper_key) {
+        // all versions of a key have the same key fields, so filtering by the key range does not
+        // break the merge semantics either
+        PAIMON_ASSIGN_OR_RAISE(
+            std::shared_ptr<Predicate> key_range_predicate,
+            GenerateKeyRangePredicate(*context_->GetTableSchema(), lower_key, upper_key));
+        if (predicate && key_range_predicate) {
+            PAIMON_ASSIGN_OR_RAISE(predicate,
+                                   PredicateBuilder::And({predicate, key_range_predicate}));
+        } else if (key_range_predicate) {
+            predicate = key_range_predicate;
+        }
+    }
     for (const auto& run : section) {
         // no overlap in a run
         PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<KeyValueRecordReader> run_reader,
@@ -392,6 +454,12 @@ Result<std::unique_ptr<BatchReader>> MergeFileSplitRead::CreateReaderForSection(
     }
     PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<SortMergeReader> sort_merge_reader,
                            CreateSortMergeReader(std::move(record_readers)));
+    if (lower_key || upper_key) {
+        // all versions of a key are merged before filtering, so the key range does not break
+        // the merge semantics
+        sort_merge_reader = std::make_unique<KeyRangeFilterReader>(
+            std::move(sort_merge_reader), key_comparator_, lower_key, upper_key);
+    }
 
     auto drop_delete_reader = std::make_unique<DropDeleteReader>(std::move(sort_merge_reader));
     // KeyValueProjectionReader converts KeyValue objects to arrow array according to projection
@@ -452,6 +520,11 @@ Result<bool> MergeFileSplitRead::Match(const std::shared_ptr<Split>& split,
     if (split_impl == nullptr) {
         return Status::Invalid("unexpected error, split cast to impl failed");
     }
+    if (force_keep_delete && !split_impl->IsStreaming() &&
+        split_impl->Bucket() != BucketModeDefine::POSTPONE_BUCKET) {
+        // the merge reader drops the retract rows and does not output the row kinds
+        return false;
+    }
     return split_impl->BeforeFiles().empty();
 }
 
@@ -18,6 +18,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -70,7 +71,8 @@ class MergeFunctionWrapper;
 /// splits)->CompleteRowKindBatchReader->(PredicateBatchReader)
 /// ->ConcatBatchReader across no overlapped
 /// files->KeyValueProjectionReader/AsyncKeyValueProjectionReader
-/// ->DropDeleteReader->SortMergeReader->ConcatKeyValueRecordReader->KeyValueDataFileRecordReader
+/// ->DropDeleteReader->(KeyRangeFilterReader)->SortMergeReader->ConcatKeyValueRecordReader
+/// ->KeyValueDataFileRecordReader
 /// ->FieldMappingReader->(ApplyDeletionVectorBatchReader)->(DelegatingPrefetchReader)
 /// ->(PrefetchFileBatchReader)->FormatReader
 class MergeFileSplitRead : public AbstractSplitRead {
@@ -102,10 +104,14 @@ class MergeFileSplitRead : public AbstractSplitRead {
         const std::shared_ptr<DataSplitImpl>& data_split, bool only_filter_key,
         const std::shared_ptr<DataFilePathFactory>& data_file_path_factory) const;
 
+    /// `lower_key` and `upper_key` limit the output keys to [lower_key, upper_key) when the split
+    /// is generated by key range splitting, the key range is also pushed down into the format
+    /// readers.
     Result<std::unique_ptr<BatchReader>> CreateReaderForSection(
         const std::vector<SortedRun>& section, const std::string& bucket_path,
         const BinaryRow& partition,
         const std::unordered_map<std::string, DeletionFile>& deletion_file_map,
+        const std::optional<BinaryRow>& lower_key, const std::optional<BinaryRow>& upper_key,
         const std::shared_ptr<DataFilePathFactory>& data_file_path_factory) const;
 
     Result<std::unique_ptr<KeyValueRecordReader>> CreateReaderForRun(
@@ -150,6 +156,13 @@ class MergeFileSplitRead : public AbstractSplitRead {
     static Result<std::shared_ptr<Predicate>> GenerateKeyPredicates(
         const std::shared_ptr<Predicate>& predicate, const TableSchema& table_schema);
 
+    /// @return The predicate on the first key field of the keys in [lower_key, upper_key), which
+    /// is pushed down into the format readers to skip the data out of the key range, or nullptr
+    /// if the key range is unbounded.
+    static Result<std::shared_ptr<Predicate>> GenerateKeyRangePredicate(
+        const TableSchema& table_schema, const std::optional<BinaryRow>& lower_key,
+        const std::optional<BinaryRow>& upper_key);
+
     static std::vector<int32_t> CreateProjection(
         const std::shared_ptr<arrow::Schema>& raw_read_schema,
         const std::shared_ptr<arrow::Schema>& value_schema);
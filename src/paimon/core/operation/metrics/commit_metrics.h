@@ -22,6 +22,22 @@ namespace paimon {
 class CommitMetrics {
  public:
     static constexpr char LAST_COMMIT_ATTEMPTS[] = "lastCommitAttempts";
+
+    // histograms of latencies in microseconds
+    static constexpr char COMMIT_DURATION[] = "commitDuration";
+    static constexpr char CONFLICT_CHECK_DURATION[] = "commitConflictCheckDuration";
+    static constexpr char MANIFEST_MERGE_DURATION[] = "commitManifestMergeDuration";
+    static constexpr char SNAPSHOT_COMMIT_DURATION[] = "commitSnapshotDuration";
+
+    // snapshot expiration, counters are accumulated over all expirations
+    static constexpr char EXPIRED_SNAPSHOTS[] = "expiredSnapshots";
+    static constexpr char EXPIRE_DELETED_DATA_FILES[] = "expireDeletedDataFiles";
+    static constexpr char EXPIRE_DELETED_MANIFEST_FILES[] = "expireDeletedManifestFiles";
+    static constexpr char EXPIRE_DELETED_CHANGELOG_FILES[] = "expireDeletedChangelogFiles";
+    static constexpr char EXPIRE_DURATION[] = "expireDuration";
+    static constexpr char EXPIRE_LOAD_SNAPSHOTS_DURATION[] = "expireLoadSnapshotsDuration";
+    static constexpr char EXPIRE_DATA_FILES_DURATION[] = "expireDataFilesDuration";
+    static constexpr char EXPIRE_MANIFESTS_DURATION[] = "expireManifestsDuration";
 };
 
 }  // namespace paimon
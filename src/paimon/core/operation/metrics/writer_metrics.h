@@ -0,0 +1,29 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+namespace paimon {
+
+/// Metrics to measure a writer, all of them are histograms of latencies in microseconds.
+class WriterMetrics {
+ public:
+    static constexpr char FLUSH_DURATION[] = "writerFlushDuration";
+    static constexpr char FILE_CLOSE_DURATION[] = "writerFileCloseDuration";
+    static constexpr char FILE_STATS_EXTRACT_DURATION[] = "writerFileStatsExtractDuration";
+};
+
+}  // namespace paimon
@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <future>
 #include <map>
+#include <mutex>
 #include <optional>
 #include <queue>
 #include <utility>
@@ -65,7 +66,7 @@ OrphanFilesCleanerImpl::OrphanFilesCleanerImpl(
 
 bool OrphanFilesCleanerImpl::SupportToClean(const std::string& file_name) {
     static std::vector<std::pair<std::string, std::string>> supported_pattern = {
-        {"manifest-", ""}, {"manifest-list-", ""}, {".", ".tmp"}};
+        {"manifest-", ""}, {"manifest-list-", ""}, {"partition-stats-", ""}, {".", ".tmp"}};
     for (const auto& pattern : supported_pattern) {
         if (StringUtils::StartsWith(file_name, pattern.first) &&
             StringUtils::EndsWith(file_name, pattern.second)) {
@@ -74,7 +75,8 @@ bool OrphanFilesCleanerImpl::SupportToClean(const std::string& file_name) {
     }
     static std::vector<std::string> supported_formats = {".orc", ".parquet", ".avro", ".lance"};
     for (const auto& format : supported_formats) {
-        if (StringUtils::StartsWith(file_name, "data-") &&
+        if ((StringUtils::StartsWith(file_name, "data-") ||
+             StringUtils::StartsWith(file_name, "changelog-")) &&
             StringUtils::EndsWith(file_name, format)) {
             return true;
         }
@@ -90,18 +92,27 @@ Result<std::set<std::string>> OrphanFilesCleanerImpl::Clean() {
         return Status::NotImplemented(
             "OrphanFilesCleaner do not support cleaning table with branch");
     }
+    // decode manifests while listing the directories
+    auto used_files_future = Via(executor_.get(), [this] { return GetUsedFiles(); });
+    ScopeGuard used_files_guard([&used_files_future]() {
+        if (used_files_future.valid()) {
+            used_files_future.wait();
+        }
+    });
     PAIMON_ASSIGN_OR_RAISE(std::set<std::string> all_dirs, ListPaimonFileDirs());
     std::vector<std::future<std::vector<std::unique_ptr<FileStatus>>>> file_statuses_futures;
     for (const auto& dir : all_dirs) {
         file_statuses_futures.push_back(
             Via(executor_.get(), [this, dir] { return TryBestListingDirs(dir); }));
     }
-    PAIMON_ASSIGN_OR_RAISE(std::set<std::string> used_file_names, GetUsedFiles());
+    auto file_statuses_list = CollectAll(file_statuses_futures);
+    PAIMON_ASSIGN_OR_RAISE(std::unordered_set<std::string> used_file_names,
+                           used_files_future.get());
 
     std::set<std::string> need_to_deletes;
     std::vector<std::future<void>> futures;
     ScopeGuard guard([&futures]() { Wait(futures); });
-    for (const auto& file_statuses : CollectAll(file_statuses_futures)) {
+    for (const auto& file_statuses : file_statuses_list) {
         for (const auto& file_status : file_statuses) {
             if (file_status->IsDir()) {
                 continue;
@@ -219,43 +230,63 @@ std::vector<std::unique_ptr<BasicFileStatus>> OrphanFilesCleanerImpl::MinimalTry
     return file_statuses;
 }
 
-Result<std::set<std::string>> OrphanFilesCleanerImpl::GetUsedFiles() const {
-    std::set<std::string> used_files;
-    // TODO(jinli.zjw): consider changelog(add tests), stats
-    used_files.insert(SnapshotManager::EARLIEST);
-    used_files.insert(SnapshotManager::LATEST);
+Result<std::unordered_set<std::string>> OrphanFilesCleanerImpl::GetUsedFiles() const {
+    // TODO(jinli.zjw): consider stats
     PAIMON_ASSIGN_OR_RAISE(std::vector<Snapshot> snapshots, snapshot_manager_->GetAllSnapshots());
+    // consecutive snapshots share most of their manifests, so dedup the names before reading
+    std::set<std::string> manifest_list_names;
     for (const auto& snapshot : snapshots) {
-        used_files.insert(SnapshotManager::SNAPSHOT_PREFIX + std::to_string(snapshot.Id()));
-        used_files.insert(snapshot.BaseManifestList());
-        used_files.insert(snapshot.DeltaManifestList());
-        std::vector<ManifestFileMeta> manifests;
-        PAIMON_RETURN_NOT_OK(manifest_list_->ReadIfFileExist(snapshot.BaseManifestList(),
-                                                             /*filter=*/nullptr, &manifests));
-        PAIMON_RETURN_NOT_OK(manifest_list_->ReadIfFileExist(snapshot.DeltaManifestList(),
-                                                             /*filter=*/nullptr, &manifests));
-        const std::optional<std::string>& changelog_manifest_list =
-            snapshot.ChangelogManifestList();
-        if (changelog_manifest_list) {
-            used_files.insert(changelog_manifest_list.value());
-            return Status::NotImplemented("OrphanFilesCleaner do not support clean changelog");
+        manifest_list_names.insert(snapshot.BaseManifestList());
+        manifest_list_names.insert(snapshot.DeltaManifestList());
+        // the entries of changelog manifests are the changelog files
+        if (snapshot.ChangelogManifestList()) {
+            manifest_list_names.insert(snapshot.ChangelogManifestList().value());
         }
-        const std::optional<std::string>& index_manifest_name = snapshot.IndexManifest();
-        if (index_manifest_name) {
+        if (snapshot.IndexManifest()) {
             return Status::NotImplemented("OrphanFilesCleaner do not support clean index manifest");
             // TODO(jinli.zjw): support IndexManifestEntry and add tests
-            // used_files.insert(index_manifest_name.value());
         }
+    }
+    std::vector<std::string> manifest_lists(manifest_list_names.begin(),
+                                            manifest_list_names.end());
+    std::vector<std::vector<ManifestFileMeta>> manifests_of_lists(manifest_lists.size());
+    PAIMON_RETURN_NOT_OK(ParallelFor(executor_.get(), manifest_lists.size(), [&](size_t i) {
+        return manifest_list_->ReadIfFileExist(manifest_lists[i], /*filter=*/nullptr,
+                                               &manifests_of_lists[i]);
+    }));
+    std::set<std::string> manifest_names;
+    for (const auto& manifests : manifests_of_lists) {
         for (const auto& manifest : manifests) {
-            used_files.insert(manifest.FileName());
-            std::vector<ManifestEntry> manifest_entries;
-            PAIMON_RETURN_NOT_OK(manifest_file_->ReadIfFileExist(
-                manifest.FileName(), /*filter=*/nullptr, &manifest_entries));
-            for (const auto& manifest_entry : manifest_entries) {
-                used_files.insert(manifest_entry.FileName());
-            }
+            manifest_names.insert(manifest.FileName());
         }
     }
+    manifests_of_lists.clear();
+
+    std::unordered_set<std::string> used_files;
+    used_files.reserve(2 + snapshots.size() + manifest_lists.size() + manifest_names.size());
+    used_files.insert(SnapshotManager::EARLIEST);
+    used_files.insert(SnapshotManager::LATEST);
+    for (const auto& snapshot : snapshots) {
+        used_files.insert(SnapshotManager::SNAPSHOT_PREFIX + std::to_string(snapshot.Id()));
+        if (snapshot.PartitionStatistics()) {
+            used_files.insert(snapshot.PartitionStatistics().value());
+        }
+    }
+    used_files.insert(manifest_lists.begin(), manifest_lists.end());
+    used_files.insert(manifest_names.begin(), manifest_names.end());
+
+    std::vector<std::string> manifests(manifest_names.begin(), manifest_names.end());
+    std::mutex used_files_mutex;
+    PAIMON_RETURN_NOT_OK(ParallelFor(executor_.get(), manifests.size(), [&](size_t i) -> Status {
+        std::vector<ManifestEntry> manifest_entries;
+        PAIMON_RETURN_NOT_OK(manifest_file_->ReadIfFileExist(manifests[i], /*filter=*/nullptr,
+                                                             &manifest_entries));
+        std::lock_guard<std::mutex> lock(used_files_mutex);
+        for (const auto& manifest_entry : manifest_entries) {
+            used_files.insert(manifest_entry.FileName());
+        }
+        return Status::OK();
+    }));
     return used_files;
 }
 
@@ -22,6 +22,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "paimon/core/core_options.h"
@@ -68,7 +69,7 @@ class OrphanFilesCleanerImpl : public OrphanFilesCleaner {
     std::vector<std::unique_ptr<BasicFileStatus>> MinimalTryBestListingDirs(
         const std::string& path) const;
     std::set<std::string> ListFileDirs(const std::string& path, int32_t max_level) const;
-    Result<std::set<std::string>> GetUsedFiles() const;
+    Result<std::unordered_set<std::string>> GetUsedFiles() const;
     static bool SupportToClean(const std::string& file_name);
 
  private:
@@ -18,17 +18,80 @@
 
 #include <filesystem>
 #include <limits>
+#include <map>
+#include <mutex>
+#include <unordered_set>
 #include <utility>
 
 #include "gtest/gtest.h"
 #include "paimon/common/utils/path_util.h"
+#include "paimon/common/utils/scope_guard.h"
+#include "paimon/common/utils/string_utils.h"
+#include "paimon/core/manifest/manifest_entry.h"
+#include "paimon/core/manifest/manifest_file.h"
+#include "paimon/core/manifest/manifest_file_meta.h"
+#include "paimon/core/manifest/manifest_list.h"
 #include "paimon/core/operation/orphan_files_cleaner_impl.h"
+#include "paimon/core/utils/snapshot_manager.h"
 #include "paimon/defs.h"
+#include "paimon/factories/factory_creator.h"
+#include "paimon/fs/file_system_factory.h"
 #include "paimon/fs/local/local_file_system.h"
 #include "paimon/status.h"
 #include "paimon/testing/utils/testharness.h"
 
 namespace paimon::test {
+namespace {
+// counts the opened files by file name
+class OpenCounter {
+ public:
+    void Add(const std::string& path) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        counts_[PathUtil::GetName(path)]++;
+    }
+    std::map<std::string, int32_t> GetAndReset() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return std::move(counts_);
+    }
+
+ private:
+    std::mutex mutex_;
+    std::map<std::string, int32_t> counts_;
+};
+
+class CountingFileSystem : public LocalFileSystem {
+ public:
+    explicit CountingFileSystem(const std::shared_ptr<OpenCounter>& counter) : counter_(counter) {}
+
+    Result<std::unique_ptr<InputStream>> Open(const std::string& path) const override {
+        counter_->Add(path);
+        return LocalFileSystem::Open(path);
+    }
+
+ private:
+    std::shared_ptr<OpenCounter> counter_;
+};
+
+class CountingFileSystemFactory : public FileSystemFactory {
+ public:
+    static constexpr char IDENTIFIER[] = "counting_fs";
+
+    explicit CountingFileSystemFactory(const std::shared_ptr<OpenCounter>& counter)
+        : counter_(counter) {}
+
+    const char* Identifier() const override {
+        return IDENTIFIER;
+    }
+
+    Result<std::unique_ptr<FileSystem>> Create(
+        const std::string& path, const std::map<std::string, std::string>& options) const override {
+        return std::make_unique<CountingFileSystem>(counter_);
+    }
+
+ private:
+    std::shared_ptr<OpenCounter> counter_;
+};
+}  // namespace
 
 TEST(OrphanFilesCleanerTest, TestSupportToClean) {
     ASSERT_TRUE(
@@ -45,13 +108,15 @@ TEST(OrphanFilesCleanerTest, TestSupportToClean) {
         OrphanFilesCleanerImpl::SupportToClean("manifest-3ea5ee21-d399-4f1c-a749-2fc63dbf0852-0"));
     ASSERT_TRUE(OrphanFilesCleanerImpl::SupportToClean(
         "manifest-list-469f3a0f-f6f1-4027-91bf-d1e897e8ea23-1"));
+    ASSERT_TRUE(OrphanFilesCleanerImpl::SupportToClean(
+        "partition-stats-469f3a0f-f6f1-4027-91bf-d1e897e8ea23-0"));
     ASSERT_TRUE(OrphanFilesCleanerImpl::SupportToClean(
         ".snapshot-2.13c988c3-784d-493d-8884-016ddddb1fc2.tmp"));
     ASSERT_FALSE(OrphanFilesCleanerImpl::SupportToClean("tmp"));
     ASSERT_FALSE(OrphanFilesCleanerImpl::SupportToClean("snapshot-1"));
     ASSERT_FALSE(OrphanFilesCleanerImpl::SupportToClean("schema-0"));
     ASSERT_FALSE(OrphanFilesCleanerImpl::SupportToClean("bucket-0"));
-    ASSERT_FALSE(OrphanFilesCleanerImpl::SupportToClean(
+    ASSERT_TRUE(OrphanFilesCleanerImpl::SupportToClean(
         "changelog-ce64d06d-c4cd-456b-a1b3-ae570042620f-0.parquet"));
     ASSERT_FALSE(OrphanFilesCleanerImpl::SupportToClean(
         "data-5515726b-0f0f-4556-a942-e795e9f94c4a-0.orc.index"));
@@ -225,7 +290,7 @@ TEST(OrphanFilesCleanerTest, TestTableWithChangelog) {
   "schemaId" : 0,
   "baseManifestList" : "manifest-list-f2d59cb8-3ec6-4860-b34b-050b1a533416-0",
   "deltaManifestList" : "manifest-list-f2d59cb8-3ec6-4860-b34b-050b1a533416-1",
-  "changelogManifestList" : "manifest-list-f2d59cb8-3ec6-4860-b34b-050b1a533416-2",
+  "changelogManifestList" : "manifest-list-f2d59cb8-3ec6-4860-b34b-050b1a533416-3",
   "commitUser" : "febb1e71-79fc-4abc-9b9d-464ecbc198f7",
   "commitIdentifier" : 9223372036854775807,
   "commitKind" : "APPEND",
@@ -237,12 +302,21 @@ TEST(OrphanFilesCleanerTest, TestTableWithChangelog) {
 })";
     ASSERT_OK(file_system->WriteFile(PathUtil::JoinPath(table_path, "snapshot/snapshot-6"),
                                      snapshot_str, true));
+    // the files of the changelog manifest list are used, while a changelog file referenced by
+    // no snapshot is an orphan
+    std::string orphan_changelog =
+        "f1=10/bucket-0/changelog-ce64d06d-c4cd-456b-a1b3-ae570042620f-0.orc";
+    ASSERT_OK(file_system->WriteFile(PathUtil::JoinPath(table_path, orphan_changelog), " ", true));
 
     CleanContextBuilder clean_context_builder(table_path);
     ASSERT_OK_AND_ASSIGN(std::unique_ptr<CleanContext> clean_context,
-                         clean_context_builder.AddOption(Options::FILE_SYSTEM, "local").Finish());
+                         clean_context_builder.AddOption(Options::FILE_SYSTEM, "local")
+                             .WithOlderThanMs(std::numeric_limits<int64_t>::max())
+                             .Finish());
     ASSERT_OK_AND_ASSIGN(auto cleaner, OrphanFilesCleaner::Create(std::move(clean_context)));
-    ASSERT_NOK_WITH_MSG(cleaner->Clean(), "OrphanFilesCleaner do not support clean changelog");
+    ASSERT_OK_AND_ASSIGN(std::set<std::string> cleaned_paths, cleaner->Clean());
+    ASSERT_EQ(1, cleaned_paths.size());
+    ASSERT_EQ(PathUtil::GetName(orphan_changelog), PathUtil::GetName(*cleaned_paths.begin()));
 }
 
 TEST(OrphanFilesCleanerTest, TestTableWithIndexManifest) {
@@ -278,4 +352,83 @@ TEST(OrphanFilesCleanerTest, TestTableWithIndexManifest) {
     ASSERT_NOK_WITH_MSG(cleaner->Clean(), "OrphanFilesCleaner do not support clean index manifest");
 }
 
+TEST(OrphanFilesCleanerTest, TestManifestsSharedBySnapshots) {
+    auto counter = std::make_shared<OpenCounter>();
+    auto factory_creator = FactoryCreator::GetInstance();
+    factory_creator->Register(CountingFileSystemFactory::IDENTIFIER,
+                              new CountingFileSystemFactory(counter));
+    ScopeGuard guard(
+        [&]() { factory_creator->TEST_Unregister(CountingFileSystemFactory::IDENTIFIER); });
+
+    std::string test_data_path = paimon::test::GetDataDir() + "/orc/append_09.db/append_09/";
+    auto dir = UniqueTestDirectory::Create();
+    std::string table_path = dir->Str();
+    ASSERT_TRUE(TestUtil::CopyDirectory(test_data_path, table_path));
+    CleanContextBuilder clean_context_builder(table_path);
+    ASSERT_OK_AND_ASSIGN(
+        std::unique_ptr<CleanContext> clean_context,
+        clean_context_builder.AddOption(Options::FILE_SYSTEM, CountingFileSystemFactory::IDENTIFIER)
+            .WithOlderThanMs(std::numeric_limits<int64_t>::max())
+            .Finish());
+    ASSERT_OK_AND_ASSIGN(auto cleaner, OrphanFilesCleaner::Create(std::move(clean_context)));
+    auto* cleaner_impl = dynamic_cast<OrphanFilesCleanerImpl*>(cleaner.get());
+    ASSERT_TRUE(cleaner_impl);
+
+    // collect the used files snapshot by snapshot, which reads the shared manifests repeatedly
+    ASSERT_OK_AND_ASSIGN(std::vector<Snapshot> snapshots,
+                         cleaner_impl->snapshot_manager_->GetAllSnapshots());
+    ASSERT_EQ(5, snapshots.size());
+    std::unordered_set<std::string> expected = {SnapshotManager::EARLIEST,
+                                                SnapshotManager::LATEST};
+    int32_t manifest_reference_count = 0;
+    for (const auto& snapshot : snapshots) {
+        expected.insert(SnapshotManager::SNAPSHOT_PREFIX + std::to_string(snapshot.Id()));
+        std::vector<std::string> manifest_lists = {snapshot.BaseManifestList(),
+                                                   snapshot.DeltaManifestList()};
+        if (snapshot.ChangelogManifestList()) {
+            manifest_lists.push_back(snapshot.ChangelogManifestList().value());
+        }
+        for (const auto& manifest_list : manifest_lists) {
+            expected.insert(manifest_list);
+            std::vector<ManifestFileMeta> manifests;
+            ASSERT_OK(cleaner_impl->manifest_list_->ReadIfFileExist(
+                manifest_list, /*filter=*/nullptr, &manifests));
+            for (const auto& manifest : manifests) {
+                manifest_reference_count++;
+                expected.insert(manifest.FileName());
+                std::vector<ManifestEntry> entries;
+                ASSERT_OK(cleaner_impl->manifest_file_->ReadIfFileExist(
+                    manifest.FileName(), /*filter=*/nullptr, &entries));
+                for (const auto& entry : entries) {
+                    expected.insert(entry.FileName());
+                }
+            }
+        }
+    }
+    std::map<std::string, int32_t> serial_open_counts = counter->GetAndReset();
+
+    ASSERT_OK_AND_ASSIGN(std::unordered_set<std::string> used_files,
+                         cleaner_impl->GetUsedFiles());
+    ASSERT_EQ(expected, used_files);
+    ASSERT_TRUE(used_files.count("data-d41fd7d1-b3e4-4905-aad9-b20a780e90a2-0.orc"));
+
+    // every manifest list and manifest is decoded once, although shared by snapshots
+    std::map<std::string, int32_t> open_counts = counter->GetAndReset();
+    int32_t manifest_count = 0;
+    for (const auto& [file_name, count] : serial_open_counts) {
+        if (StringUtils::StartsWith(file_name, "manifest-")) {
+            ASSERT_EQ(1, open_counts[file_name]) << file_name;
+            if (!StringUtils::StartsWith(file_name, "manifest-list-")) {
+                manifest_count++;
+            }
+        }
+    }
+    ASSERT_LT(manifest_count, manifest_reference_count);
+    for (const auto& [file_name, count] : open_counts) {
+        if (StringUtils::StartsWith(file_name, "manifest-")) {
+            ASSERT_TRUE(serial_open_counts.count(file_name)) << file_name;
+        }
+    }
+}
+
 }  // namespace paimon::test
@@ -25,12 +25,13 @@ class ExpireConfig {
     ExpireConfig() = default;
     ExpireConfig(int32_t snapshot_retain_max, int32_t snapshot_retain_min,
                  int64_t snapshot_time_retain_ms, int32_t snapshot_max_deletes,
-                 bool snapshot_clean_empty_directories)
+                 bool snapshot_clean_empty_directories, int32_t snapshot_expire_parallelism = 1)
         : snapshot_retain_max_(snapshot_retain_max),
           snapshot_retain_min_(snapshot_retain_min),
           snapshot_time_retain_ms_(snapshot_time_retain_ms),
           snapshot_max_deletes_(snapshot_max_deletes),
-          snapshot_clean_empty_directories_(snapshot_clean_empty_directories) {}
+          snapshot_clean_empty_directories_(snapshot_clean_empty_directories),
+          snapshot_expire_parallelism_(snapshot_expire_parallelism) {}
 
     int32_t GetSnapshotRetainMin() const {
         return snapshot_retain_min_;
@@ -47,6 +48,9 @@ class ExpireConfig {
     bool CleanEmptyDirectories() const {
         return snapshot_clean_empty_directories_;
     }
+    int32_t GetExpireParallelism() const {
+        return snapshot_expire_parallelism_;
+    }
 
  private:
     int32_t snapshot_retain_max_;
@@ -54,6 +58,7 @@ class ExpireConfig {
     int64_t snapshot_time_retain_ms_;
     int32_t snapshot_max_deletes_;
     bool snapshot_clean_empty_directories_;
+    int32_t snapshot_expire_parallelism_ = 1;
 };
 
 }  // namespace paimon
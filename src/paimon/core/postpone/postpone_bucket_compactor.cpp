@@ -0,0 +1,47 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/postpone_bucket_compactor.h"
+
+#include <utility>
+
+#include "fmt/format.h"
+#include "paimon/core/core_options.h"
+#include "paimon/core/operation/bucket_redistributor.h"
+#include "paimon/core/postpone/postpone_bucket_compactor_impl.h"
+#include "paimon/core/schema/table_schema.h"
+#include "paimon/core/table/bucket_mode.h"
+#include "paimon/status.h"
+#include "paimon/write_context.h"
+
+namespace paimon {
+
+Result<std::unique_ptr<PostponeBucketCompactor>> PostponeBucketCompactor::Create(
+    std::unique_ptr<WriteContext> ctx) {
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<BucketRedistributeContext> context,
+                           BucketRedistributeContext::Create(std::move(ctx)));
+    const CoreOptions& options = context->GetOptions();
+    if (context->GetTableSchema()->PrimaryKeys().empty() ||
+        options.GetBucket() != BucketModeDefine::POSTPONE_BUCKET) {
+        return Status::Invalid(
+            fmt::format("postpone bucket compactor only support primary key table with bucket {}, "
+                        "but bucket is {}",
+                        BucketModeDefine::POSTPONE_BUCKET, options.GetBucket()));
+    }
+    return std::make_unique<PostponeBucketCompactorImpl>(std::move(context));
+}
+
+}  // namespace paimon
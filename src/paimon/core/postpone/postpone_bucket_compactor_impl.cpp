@@ -0,0 +1,150 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/postpone/postpone_bucket_compactor_impl.h"
+
+#include <optional>
+#include <utility>
+
+#include "paimon/common/utils/linked_hash_map.h"
+#include "paimon/core/io/compact_increment.h"
+#include "paimon/core/io/data_file_meta.h"
+#include "paimon/core/io/data_increment.h"
+#include "paimon/core/manifest/file_kind.h"
+#include "paimon/core/manifest/manifest_entry.h"
+#include "paimon/core/operation/bucket_redistributor.h"
+#include "paimon/core/operation/file_store_scan.h"
+#include "paimon/core/operation/key_value_file_store_scan.h"
+#include "paimon/core/schema/table_schema.h"
+#include "paimon/core/snapshot.h"
+#include "paimon/core/table/bucket_mode.h"
+#include "paimon/core/table/sink/commit_message_impl.h"
+#include "paimon/core/table/source/data_split_impl.h"
+#include "paimon/core/utils/file_store_path_factory.h"
+#include "paimon/core/utils/snapshot_manager.h"
+#include "paimon/file_store_write.h"
+#include "paimon/reader/batch_reader.h"
+#include "paimon/table/source/table_read.h"
+
+namespace paimon {
+
+PostponeBucketCompactorImpl::PostponeBucketCompactorImpl(
+    std::unique_ptr<BucketRedistributeContext>&& context)
+    : context_(std::move(context)) {}
+
+PostponeBucketCompactorImpl::~PostponeBucketCompactorImpl() = default;
+
+Result<std::vector<std::shared_ptr<CommitMessage>>> PostponeBucketCompactorImpl::Compact(
+    const std::vector<std::map<std::string, std::string>>& partitions) {
+    std::vector<std::shared_ptr<CommitMessage>> commit_messages;
+    PAIMON_ASSIGN_OR_RAISE(std::optional<Snapshot> snapshot,
+                           context_->GetSnapshotManager()->LatestSnapshot());
+    if (snapshot == std::nullopt) {
+        return commit_messages;
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<KeyValueFileStoreScan> scan,
+                           context_->CreateScan(partitions));
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<FileStoreScan::RawPlan> plan,
+                           scan->WithSnapshot(snapshot.value())->CreatePlan());
+    FileStoreScan::RawPlan::GroupFiles grouped_entries =
+        FileStoreScan::RawPlan::GroupByPartFiles(plan->Files(FileKind::Add()));
+
+    // partitions of the same bucket number are written by the same file store write
+    std::map<int32_t, std::vector<PostponedPartition>> partitions_by_bucket_num;
+    for (const auto& [partition, bucket_map] : grouped_entries) {
+        auto postpone_iter = bucket_map.find(BucketModeDefine::POSTPONE_BUCKET);
+        if (postpone_iter == bucket_map.end()) {
+            continue;
+        }
+        int32_t bucket_num = context_->GetOptions().GetPostponeDefaultBucketNum();
+        for (const auto& [bucket, entries] : bucket_map) {
+            if (bucket >= 0) {
+                bucket_num = entries[0].TotalBuckets();
+                break;
+            }
+        }
+        const std::vector<ManifestEntry>& postpone_entries = postpone_iter->second;
+        PostponedPartition postponed{partition, postpone_entries[0].TotalBuckets(), {}};
+        postponed.files.reserve(postpone_entries.size());
+        // entries are in commit order, which is the order the postponed data was written in
+        for (const auto& entry : postpone_entries) {
+            postponed.files.push_back(entry.File());
+        }
+        partitions_by_bucket_num[bucket_num].push_back(std::move(postponed));
+    }
+    if (partitions_by_bucket_num.empty()) {
+        return commit_messages;
+    }
+
+    // the retract rows of the postponed files delete or update the keys already in the buckets
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<TableRead> table_read,
+                           context_->CreateTableRead(/*force_keep_delete=*/true));
+    for (const auto& [bucket_num, postponed_partitions] : partitions_by_bucket_num) {
+        PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<CommitMessage>> messages,
+                               CompactPartitions(bucket_num, postponed_partitions,
+                                                 snapshot.value().Id(), table_read.get()));
+        commit_messages.insert(commit_messages.end(), messages.begin(), messages.end());
+    }
+    return commit_messages;
+}
+
+Result<std::vector<std::shared_ptr<CommitMessage>>> PostponeBucketCompactorImpl::CompactPartitions(
+    int32_t bucket_num, const std::vector<PostponedPartition>& partitions, int64_t snapshot_id,
+    TableRead* table_read) const {
+    PAIMON_ASSIGN_OR_RAISE(
+        std::unique_ptr<FileStoreWrite> write,
+        context_->CreateFileStoreWrite(bucket_num, /*ignore_previous_files=*/false));
+    PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<BucketRedistributor> redistributor,
+                           BucketRedistributor::Create(context_->GetTableSchema(), bucket_num,
+                                                       std::move(write),
+                                                       context_->GetMemoryPool()));
+    const std::shared_ptr<FileStorePathFactory>& path_factory = context_->GetPathFactory();
+    for (const auto& postponed : partitions) {
+        PAIMON_ASSIGN_OR_RAISE(auto part_values,
+                               path_factory->GeneratePartitionVector(postponed.partition));
+        std::map<std::string, std::string> partition_map(part_values.begin(), part_values.end());
+        PAIMON_ASSIGN_OR_RAISE(
+            std::string bucket_path,
+            path_factory->BucketPath(postponed.partition, BucketModeDefine::POSTPONE_BUCKET));
+        std::vector<std::shared_ptr<DataFileMeta>> files = postponed.files;
+        DataSplitImpl::Builder builder(postponed.partition, BucketModeDefine::POSTPONE_BUCKET,
+                                       bucket_path, std::move(files));
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<DataSplitImpl> split,
+                               builder.WithTotalBuckets(postponed.total_buckets)
+                                   .WithSnapshot(snapshot_id)
+                                   .RawConvertible(false)
+                                   .Build());
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<BatchReader> reader,
+                               table_read->CreateReader(split));
+        PAIMON_RETURN_NOT_OK(redistributor->WriteAll(partition_map, reader.get()));
+        reader->Close();
+    }
+    // the rows of each bucket are sorted and merged when the writers flush
+    PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<CommitMessage>> commit_messages,
+                           redistributor->Finish());
+    // remove the postponed files in the same commit as the files written from them
+    for (const auto& postponed : partitions) {
+        std::vector<std::shared_ptr<DataFileMeta>> deleted_files = postponed.files;
+        DataIncrement data_increment(/*new_files=*/{}, std::move(deleted_files),
+                                     /*changelog_files=*/{});
+        commit_messages.push_back(std::make_shared<CommitMessageImpl>(
+            postponed.partition, BucketModeDefine::POSTPONE_BUCKET, postponed.total_buckets,
+            data_increment, CompactIncrement({}, {}, {})));
+    }
+    return commit_messages;
+}
+
+}  // namespace paimon
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "paimon/commit_message.h"
+#include "paimon/common/data/binary_row.h"
+#include "paimon/postpone_bucket_compactor.h"
+#include "paimon/result.h"
+
+namespace paimon {
+
+class BucketRedistributeContext;
+class DataFileMeta;
+class TableRead;
+
+class PostponeBucketCompactorImpl : public PostponeBucketCompactor {
+ public:
+    explicit PostponeBucketCompactorImpl(std::unique_ptr<BucketRedistributeContext>&& context);
+    ~PostponeBucketCompactorImpl() override;
+
+    Result<std::vector<std::shared_ptr<CommitMessage>>> Compact(
+        const std::vector<std::map<std::string, std::string>>& partitions) override;
+
+ private:
+    struct PostponedPartition {
+        BinaryRow partition;
+        int32_t total_buckets;
+        std::vector<std::shared_ptr<DataFileMeta>> files;
+    };
+
+    /// Redistributes the postponed files of partitions with the same bucket number.
+    Result<std::vector<std::shared_ptr<CommitMessage>>> CompactPartitions(
+        int32_t bucket_num, const std::vector<PostponedPartition>& partitions, int64_t snapshot_id,
+        TableRead* table_read) const;
+
+ private:
+    std::unique_ptr<BucketRedistributeContext> context_;
+};
+
+}  // namespace paimon
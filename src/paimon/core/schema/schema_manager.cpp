@@ -23,6 +23,7 @@
 #include "paimon/core/schema/schema_validation.h"
 #include "paimon/core/utils/branch_manager.h"
 #include "paimon/core/utils/file_utils.h"
+#include "paimon/core/utils/metadata_cache.h"
 #include "paimon/fs/file_system.h"
 #include "paimon/status.h"
 
@@ -42,6 +43,17 @@ SchemaManager::SchemaManager(const std::shared_ptr<FileSystem>& file_system,
       table_root_(table_root),
       branch_(BranchManager::NormalizeBranch(branch)) {}
 
+void SchemaManager::WithCache(MetadataCache* cache, int64_t latest_ttl_ms) {
+    cache_ = cache;
+    latest_ttl_ms_ = latest_ttl_ms;
+}
+
+void SchemaManager::InvalidateTableCache() const {
+    if (cache_) {
+        cache_->InvalidatePrefix(PathUtil::JoinPath(table_root_, "/"));
+    }
+}
+
 std::string SchemaManager::BranchPath() const {
     return BranchManager::BranchPath(table_root_, branch_);
 }
@@ -51,31 +63,66 @@ std::string SchemaManager::ToSchemaPath(int64_t schema_id) const {
                               "/schema/" + std::string(SCHEMA_PREFIX) + std::to_string(schema_id));
 }
 Result<std::optional<std::shared_ptr<TableSchema>>> SchemaManager::Latest() const {
+    PAIMON_ASSIGN_OR_RAISE(std::optional<int64_t> max_schema_id, LatestId());
+    if (max_schema_id == std::nullopt) {
+        return std::optional<std::shared_ptr<TableSchema>>();
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<TableSchema> schema, ReadSchema(max_schema_id.value()));
+    return std::optional<std::shared_ptr<TableSchema>>(schema);
+}
+
+Result<std::optional<int64_t>> SchemaManager::LatestId() const {
+    std::string latest_key = LatestIdCacheKey();
+    if (cache_) {
+        std::optional<int64_t> cached = cache_->GetHint(latest_key, latest_ttl_ms_);
+        if (cached) {
+            return cached;
+        }
+    }
     std::vector<int64_t> versions;
     PAIMON_RETURN_NOT_OK(FileUtils::ListVersionedFiles(file_system_, SchemaDirectory(),
                                                        std::string(SCHEMA_PREFIX), &versions));
     if (versions.empty()) {
-        return std::optional<std::shared_ptr<TableSchema>>();
+        return std::optional<int64_t>();
     }
     int64_t max_schema_id = versions[0];
     for (const auto& version : versions) {
         max_schema_id = std::max(max_schema_id, version);
     }
-    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<TableSchema> schema, ReadSchema(max_schema_id));
-    return std::optional<std::shared_ptr<TableSchema>>(schema);
+    if (cache_) {
+        cache_->PutHint(latest_key, max_schema_id);
+    }
+    return std::optional<int64_t>(max_schema_id);
+}
+
+std::string SchemaManager::LatestIdCacheKey() const {
+    // there is no hint file for schemas, the listed latest id is cached under the same key format
+    // as the snapshot hints
+    return PathUtil::JoinPath(SchemaDirectory(), "LATEST");
 }
 
 Result<std::shared_ptr<TableSchema>> SchemaManager::ReadSchema(int64_t schema_id) const {
-    auto iter = schema_cache_.find(schema_id);
-    if (iter != schema_cache_.end()) {
-        return iter->second;
-    }
     auto path = ToSchemaPath(schema_id);
+    if (cache_) {
+        std::shared_ptr<TableSchema> cached = cache_->GetSchema(path);
+        if (cached) {
+            return cached;
+        }
+    } else {
+        auto iter = schema_cache_.find(schema_id);
+        if (iter != schema_cache_.end()) {
+            return iter->second;
+        }
+    }
     std::string content;
     PAIMON_RETURN_NOT_OK(file_system_->ReadFile(path, &content));
     PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<TableSchema> schema,
                            TableSchema::CreateFromJson(content));
-    schema_cache_[schema_id] = schema;
+    if (cache_) {
+        cache_->PutSchema(path, schema);
+    } else {
+        schema_cache_[schema_id] = schema;
+    }
     return schema;
 }
 
@@ -99,6 +146,8 @@ Result<std::unique_ptr<TableSchema>> SchemaManager::CreateTable(
     const std::shared_ptr<arrow::Schema>& schema, const std::vector<std::string>& partition_keys,
     const std::vector<std::string>& primary_keys,
     const std::map<std::string, std::string>& options) {
+    // a table dropped from the same path may still be cached
+    InvalidateTableCache();
     while (true) {
         PAIMON_ASSIGN_OR_RAISE(std::optional<std::shared_ptr<TableSchema>> latest_schema, Latest());
         if (latest_schema) {
@@ -112,6 +161,10 @@ Result<std::unique_ptr<TableSchema>> SchemaManager::CreateTable(
         PAIMON_ASSIGN_OR_RAISE(std::string content, table_schema->ToJsonString());
         auto status = file_system_->AtomicStore(schema_path, content);
         if (status.ok()) {
+            if (cache_) {
+                cache_->PutSchema(schema_path, std::make_shared<TableSchema>(*table_schema));
+                cache_->PutHint(LatestIdCacheKey(), table_schema->Id());
+            }
             return table_schema;
         }
     }
@@ -33,6 +33,7 @@ class Schema;
 
 namespace paimon {
 class FileSystem;
+class MetadataCache;
 
 /// Schema Manager to manage schema versions.
 class SchemaManager {
@@ -42,9 +43,19 @@ class SchemaManager {
     SchemaManager(const std::shared_ptr<FileSystem>& file_system, const std::string& table_root,
                   const std::string& branch);
 
+    /// Caches the parsed schemas and the latest schema id in `cache`, which is shared with the
+    /// other schema managers. The cached latest schema id is trusted for `latest_ttl_ms`, after
+    /// which the schema directory is listed again.
+    void WithCache(MetadataCache* cache, int64_t latest_ttl_ms);
+    /// Drops all cached metadata of the table, including the snapshots and schemas of all
+    /// branches.
+    void InvalidateTableCache() const;
+
     /// Read schema for schema id. Find schema in cache first.
     Result<std::shared_ptr<TableSchema>> ReadSchema(int64_t schema_id) const;
     Result<std::optional<std::shared_ptr<TableSchema>>> Latest() const;
+    /// Creates the first schema of the table. The cached metadata of a table previously at the
+    /// same path is dropped, and the new schema is written through to the cache.
     Result<std::unique_ptr<TableSchema>> CreateTable(
         const std::shared_ptr<arrow::Schema>& schema,
         const std::vector<std::string>& partition_keys,
@@ -58,6 +69,8 @@ class SchemaManager {
  private:
     std::string BranchPath() const;
     std::string ToSchemaPath(int64_t schema_id) const;
+    Result<std::optional<int64_t>> LatestId() const;
+    std::string LatestIdCacheKey() const;
 
  private:
     static constexpr char SCHEMA_PREFIX[] = "schema-";
@@ -67,6 +80,8 @@ class SchemaManager {
     std::string table_root_;
     const std::string branch_;
     mutable std::map<int64_t, std::shared_ptr<TableSchema>> schema_cache_;
+    MetadataCache* cache_ = nullptr;
+    int64_t latest_ttl_ms_ = 0;
 };
 
 }  // namespace paimon
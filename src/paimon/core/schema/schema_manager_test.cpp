@@ -21,6 +21,8 @@
 
 #include "arrow/type.h"
 #include "gtest/gtest.h"
+#include "paimon/common/utils/path_util.h"
+#include "paimon/core/utils/metadata_cache.h"
 #include "paimon/fs/local/local_file_system.h"
 #include "paimon/status.h"
 #include "paimon/testing/utils/testharness.h"
@@ -197,4 +199,67 @@ TEST(SchemaManagerTest, TestListAllIds) {
     ASSERT_OK_AND_ASSIGN(auto ids, manager.ListAllIds());
     ASSERT_EQ(std::set<int64_t>(ids.begin(), ids.end()), std::set<int64_t>({0, 1, 2, 3, 4}));
 }
+
+TEST(SchemaManagerTest, TestMetadataCache) {
+    std::string test_data_path =
+        paimon::test::GetDataDir() + "/orc/pk_table_with_alter_table.db/pk_table_with_alter_table/";
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    std::string table_root = dir->Str();
+    ASSERT_TRUE(TestUtil::CopyDirectory(test_data_path, table_root));
+    auto fs = std::make_shared<LocalFileSystem>();
+    MetadataCache cache(MetadataCache::DEFAULT_MAX_ENTRIES);
+    SchemaManager manager(fs, table_root);
+    manager.WithCache(&cache, /*latest_ttl_ms=*/60 * 1000);
+    ASSERT_OK_AND_ASSIGN(std::optional<std::shared_ptr<TableSchema>> latest, manager.Latest());
+    ASSERT_EQ(1, latest.value()->Id());
+
+    // parsed schemas are shared by the managers with the same cache
+    SchemaManager other_manager(fs, table_root);
+    other_manager.WithCache(&cache, /*latest_ttl_ms=*/0);
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<TableSchema> schema, other_manager.ReadSchema(1));
+    ASSERT_EQ(latest.value(), schema);
+
+    // the cached latest schema id is used within the ttl
+    ASSERT_OK(fs->Delete(manager.ToSchemaPath(1)));
+    ASSERT_OK_AND_ASSIGN(latest, manager.Latest());
+    ASSERT_EQ(1, latest.value()->Id());
+    ASSERT_OK_AND_ASSIGN(latest, other_manager.Latest());
+    ASSERT_EQ(0, latest.value()->Id());
+}
+
+TEST(SchemaManagerTest, TestRecreateTableWithMetadataCache) {
+    std::string test_data_path =
+        paimon::test::GetDataDir() + "/orc/pk_table_with_alter_table.db/pk_table_with_alter_table/";
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    std::string table_root = dir->Str();
+    ASSERT_TRUE(TestUtil::CopyDirectory(test_data_path, table_root));
+    auto fs = std::make_shared<LocalFileSystem>();
+    MetadataCache cache(MetadataCache::DEFAULT_MAX_ENTRIES);
+    SchemaManager manager(fs, table_root);
+    manager.WithCache(&cache, /*latest_ttl_ms=*/60 * 1000);
+    ASSERT_OK_AND_ASSIGN(std::optional<std::shared_ptr<TableSchema>> latest, manager.Latest());
+    ASSERT_EQ(1, latest.value()->Id());
+    std::string latest_snapshot_key = PathUtil::JoinPath(table_root, "snapshot/LATEST");
+    cache.PutHint(latest_snapshot_key, 5);
+
+    // drop the table and create another one at the same path
+    ASSERT_OK(fs->Delete(table_root, /*recursive=*/true));
+    ASSERT_OK(fs->Mkdirs(table_root));
+    auto schema = arrow::schema({arrow::field("f0", arrow::int32())});
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<TableSchema> created,
+                         manager.CreateTable(schema, {}, {}, {{"file.format", "orc"}}));
+    ASSERT_EQ(0, created->Id());
+    ASSERT_EQ(std::nullopt, cache.GetHint(latest_snapshot_key, /*ttl_ms=*/60 * 1000));
+
+    // the new schema is written through to the cache
+    SchemaManager other_manager(fs, table_root);
+    other_manager.WithCache(&cache, /*latest_ttl_ms=*/60 * 1000);
+    uint64_t miss_count = cache.MissCount();
+    ASSERT_OK_AND_ASSIGN(latest, other_manager.Latest());
+    ASSERT_EQ(0, latest.value()->Id());
+    ASSERT_EQ(std::vector<std::string>({"f0"}), latest.value()->FieldNames());
+    ASSERT_EQ(miss_count, cache.MissCount());
+}
 }  // namespace paimon::test
@@ -83,7 +83,8 @@ bool Snapshot::TEST_Equal(const Snapshot& other) const {
            delta_record_count_ == other.delta_record_count_ &&
            changelog_record_count_ == other.changelog_record_count_ &&
            watermark_ == other.watermark_ && statistics_ == other.statistics_ &&
-           properties_ == other.properties_ && next_row_id_ == other.next_row_id_;
+           properties_ == other.properties_ && next_row_id_ == other.next_row_id_ &&
+           partition_statistics_ == other.partition_statistics_;
 }
 
 bool Snapshot::operator==(const Snapshot& other) const {
@@ -104,7 +105,8 @@ bool Snapshot::operator==(const Snapshot& other) const {
            delta_record_count_ == other.delta_record_count_ &&
            changelog_record_count_ == other.changelog_record_count_ &&
            watermark_ == other.watermark_ && statistics_ == other.statistics_ &&
-           properties_ == other.properties_ && next_row_id_ == other.next_row_id_;
+           properties_ == other.properties_ && next_row_id_ == other.next_row_id_ &&
+           partition_statistics_ == other.partition_statistics_;
 }
 
 std::string Snapshot::CommitKind::ToString(const Snapshot::CommitKind& kind) {
@@ -152,7 +154,8 @@ Snapshot::Snapshot(const std::optional<int32_t>& version, int64_t id, int64_t sc
                    const std::optional<int64_t>& watermark,
                    const std::optional<std::string>& statistics,
                    const std::optional<std::map<std::string, std::string>>& properties,
-                   const std::optional<int64_t>& next_row_id)
+                   const std::optional<int64_t>& next_row_id,
+                   const std::optional<std::string>& partition_statistics)
     : version_(version),
       id_(id),
       schema_id_(schema_id),
@@ -174,7 +177,8 @@ Snapshot::Snapshot(const std::optional<int32_t>& version, int64_t id, int64_t sc
       watermark_(watermark),
       statistics_(statistics),
       properties_(properties),
-      next_row_id_(next_row_id) {}
+      next_row_id_(next_row_id),
+      partition_statistics_(partition_statistics) {}
 
 rapidjson::Value Snapshot::ToJson(rapidjson::Document::AllocatorType* allocator) const
     noexcept(false) {
@@ -268,6 +272,12 @@ rapidjson::Value Snapshot::ToJson(rapidjson::Document::AllocatorType* allocator)
                       RapidJsonUtil::SerializeValue(next_row_id_.value(), allocator).Move(),
                       *allocator);
     }
+    if (partition_statistics_ != std::nullopt) {
+        obj.AddMember(
+            rapidjson::StringRef(FIELD_PARTITION_STATISTICS),
+            RapidJsonUtil::SerializeValue(partition_statistics_.value(), allocator).Move(),
+            *allocator);
+    }
 
     return obj;
 }
@@ -314,6 +324,8 @@ void Snapshot::FromJson(const rapidjson::Value& obj) noexcept(false) {
             obj, FIELD_PROPERTIES);
     next_row_id_ =
         RapidJsonUtil::DeserializeKeyValue<std::optional<int64_t>>(obj, FIELD_NEXT_ROW_ID);
+    partition_statistics_ = RapidJsonUtil::DeserializeKeyValue<std::optional<std::string>>(
+        obj, FIELD_PARTITION_STATISTICS);
 }
 
 Result<Snapshot> Snapshot::FromPath(const std::shared_ptr<FileSystem>& fs,
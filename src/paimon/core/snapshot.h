@@ -85,6 +85,7 @@ class Snapshot : public Jsonizable<Snapshot> {
     static constexpr char FIELD_STATISTICS[] = "statistics";
     static constexpr char FIELD_PROPERTIES[] = "properties";
     static constexpr char FIELD_NEXT_ROW_ID[] = "nextRowId";
+    static constexpr char FIELD_PARTITION_STATISTICS[] = "partitionStatistics";
 
     JSONIZABLE_FRIEND_AND_DEFAULT_CTOR(Snapshot);
 
@@ -102,12 +103,14 @@ class Snapshot : public Jsonizable<Snapshot> {
              const std::optional<int64_t>& changelog_record_count,
              const std::optional<int64_t>& watermark, const std::optional<std::string>& statistics,
              const std::optional<std::map<std::string, std::string>>& properties,
-             const std::optional<int64_t>& next_row_id)
+             const std::optional<int64_t>& next_row_id,
+             const std::optional<std::string>& partition_statistics = std::nullopt)
         : Snapshot(CURRENT_VERSION, id, schema_id, base_manifest_list, base_manifest_list_size,
                    delta_manifest_list, delta_manifest_list_size, changelog_manifest_list,
                    changelog_manifest_list_size, index_manifest, commit_user, commit_identifier,
                    commit_kind, time_millis, log_offsets, total_record_count, delta_record_count,
-                   changelog_record_count, watermark, statistics, properties, next_row_id) {}
+                   changelog_record_count, watermark, statistics, properties, next_row_id,
+                   partition_statistics) {}
 
     Snapshot(const std::optional<int32_t>& version, int64_t id, int64_t schema_id,
              const std::string& base_manifest_list,
@@ -124,7 +127,8 @@ class Snapshot : public Jsonizable<Snapshot> {
              const std::optional<int64_t>& changelog_record_count,
              const std::optional<int64_t>& watermark, const std::optional<std::string>& statistics,
              const std::optional<std::map<std::string, std::string>>& properties,
-             const std::optional<int64_t>& next_row_id);
+             const std::optional<int64_t>& next_row_id,
+             const std::optional<std::string>& partition_statistics = std::nullopt);
 
     bool operator==(const Snapshot& other) const;
     bool TEST_Equal(const Snapshot& other) const;
@@ -224,6 +228,10 @@ class Snapshot : public Jsonizable<Snapshot> {
         return next_row_id_;
     }
 
+    const std::optional<std::string>& PartitionStatistics() const {
+        return partition_statistics_;
+    }
+
     rapidjson::Value ToJson(rapidjson::Document::AllocatorType* allocator) const
         noexcept(false) override;
 
@@ -302,6 +310,10 @@ class Snapshot : public Jsonizable<Snapshot> {
     std::optional<std::map<std::string, std::string>> properties_;
 
     std::optional<int64_t> next_row_id_;
+
+    // file name of the partition statistics index of this snapshot
+    // null if the index is not enabled, or for snapshots written by other writers
+    std::optional<std::string> partition_statistics_;
 };
 
 }  // namespace paimon
@@ -47,7 +47,8 @@ TEST_F(SnapshotTest, TestSimple) {
         /*commit_kind=*/Snapshot::CommitKind::Compact(), /*time_millis=*/1234, log_offset,
         /*total_record_count=*/35,
         /*delta_record_count=*/40, /*changelog_record_count=*/45, /*watermark=*/50,
-        /*statistics=*/"statistic_test", properties, /*next_row_id=*/0);
+        /*statistics=*/"statistic_test", properties, /*next_row_id=*/0,
+        /*partition_statistics=*/"partition-stats-0");
     ASSERT_EQ(5, snapshot.Version());
     ASSERT_EQ(10, snapshot.Id());
     ASSERT_EQ(15, snapshot.SchemaId());
@@ -70,6 +71,11 @@ TEST_F(SnapshotTest, TestSimple) {
     ASSERT_EQ("statistic_test", snapshot.Statistics().value());
     ASSERT_EQ(properties, snapshot.Properties().value());
     ASSERT_EQ(0, snapshot.NextRowId().value());
+    ASSERT_EQ("partition-stats-0", snapshot.PartitionStatistics().value());
+
+    ASSERT_OK_AND_ASSIGN(std::string json_str, snapshot.ToJsonString());
+    ASSERT_OK_AND_ASSIGN(Snapshot deserialized, Snapshot::FromJsonString(json_str));
+    ASSERT_EQ(snapshot, deserialized);
 }
 
 TEST_F(SnapshotTest, TestFromPath) {
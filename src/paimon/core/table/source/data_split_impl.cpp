@@ -92,7 +92,8 @@ bool DataSplitImpl::operator==(const DataSplitImpl& other) const {
            before_deletion_files_ == other.before_deletion_files_ &&
            ObjectUtils::Equal(data_files_, other.data_files_) &&
            data_deletion_files_ == other.data_deletion_files_ &&
-           is_streaming_ == other.is_streaming_ && raw_convertible_ == other.raw_convertible_;
+           is_streaming_ == other.is_streaming_ && raw_convertible_ == other.raw_convertible_ &&
+           lower_key_ == other.lower_key_ && upper_key_ == other.upper_key_;
 }
 
 bool DataSplitImpl::TEST_Equal(const DataSplitImpl& other) const {
@@ -106,7 +107,8 @@ bool DataSplitImpl::TEST_Equal(const DataSplitImpl& other) const {
            before_deletion_files_ == other.before_deletion_files_ &&
            ObjectUtils::TEST_Equal(data_files_, other.data_files_) &&
            data_deletion_files_ == other.data_deletion_files_ &&
-           is_streaming_ == other.is_streaming_ && raw_convertible_ == other.raw_convertible_;
+           is_streaming_ == other.is_streaming_ && raw_convertible_ == other.raw_convertible_ &&
+           lower_key_ == other.lower_key_ && upper_key_ == other.upper_key_;
 }
 
 int64_t DataSplitImpl::PartialMergedRowCount() const {
@@ -152,13 +154,14 @@ std::string DataSplitImpl::ToString() const {
         "snapshotId={}, partition={}, bucket={}, bucketPath={}, totalBuckets={}, "
         "beforeFiles={}, "
         "beforeDeletionFiles={}, dataFiles={}, dataDeletionFiles={}, isStreaming={}, "
-        "rawConvertible={}",
+        "rawConvertible={}, lowerKey={}, upperKey={}",
         snapshot_id_, partition_.ToString(), bucket_, bucket_path_,
         total_buckets_ == std::nullopt ? "null" : std::to_string(total_buckets_.value()),
         StringUtils::VectorToString(before_files_),
         StringUtils::VectorToString(before_deletion_files_),
         StringUtils::VectorToString(data_files_), StringUtils::VectorToString(data_deletion_files_),
-        is_streaming_, raw_convertible_);
+        is_streaming_, raw_convertible_, lower_key_ ? lower_key_->ToString() : "null",
+        upper_key_ ? upper_key_->ToString() : "null");
 }
 
 }  // namespace paimon
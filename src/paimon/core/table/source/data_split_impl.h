@@ -17,6 +17,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -39,6 +40,10 @@ class DataSplitImpl : public DataSplit {
  public:
     static constexpr int64_t MAGIC = -2394839472490812314L;
     static constexpr int32_t VERSION = 8;
+    /// Splits with key range are wrapped with this magic number, the inner data split is
+    /// serialized as is, so that splits without key range are still readable by Java Paimon.
+    static constexpr int64_t KEY_RANGE_MAGIC = -6357410387283492841L;
+    static constexpr int32_t KEY_RANGE_VERSION = 1;
 
     int64_t SnapshotId() const {
         return snapshot_id_;
@@ -84,6 +89,21 @@ class DataSplitImpl : public DataSplit {
         return raw_convertible_;
     }
 
+    /// Inclusive lower bound of the keys this split outputs, set when a merge section is split
+    /// by key range. Files of the split may contain keys outside of [lower key, upper key).
+    const std::optional<BinaryRow>& LowerKey() const {
+        return lower_key_;
+    }
+
+    /// Exclusive upper bound of the keys this split outputs.
+    const std::optional<BinaryRow>& UpperKey() const {
+        return upper_key_;
+    }
+
+    bool HasKeyRange() const {
+        return lower_key_ != std::nullopt || upper_key_ != std::nullopt;
+    }
+
     Result<std::optional<int64_t>> LatestFileCreationEpochMillis() const;
 
     int64_t RowCount() const;
@@ -152,8 +172,18 @@ class DataSplitImpl : public DataSplit {
             return *this;
         }
 
+        Builder& WithKeyRange(const std::optional<BinaryRow>& lower_key,
+                              const std::optional<BinaryRow>& upper_key) {
+            split_->lower_key_ = lower_key;
+            split_->upper_key_ = upper_key;
+            return *this;
+        }
+
         Result<std::shared_ptr<DataSplitImpl>> Build() const {
             PAIMON_RETURN_NOT_OK(Preconditions::CheckArgument(split_->bucket_ != -1));
+            PAIMON_RETURN_NOT_OK(
+                Preconditions::CheckState(!split_->HasKeyRange() || !split_->raw_convertible_,
+                                          "split with key range cannot be raw convertible"));
             return split_;
         }
 
@@ -188,5 +218,8 @@ class DataSplitImpl : public DataSplit {
 
     bool is_streaming_ = false;
     bool raw_convertible_ = false;
+
+    std::optional<BinaryRow> lower_key_;
+    std::optional<BinaryRow> upper_key_;
 };
 }  // namespace paimon
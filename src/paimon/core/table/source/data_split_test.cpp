@@ -1058,4 +1058,47 @@ TEST(DataSplitTest, TestPartialMergedRowCount) {
     ASSERT_EQ(0, expected_data_split->PartialMergedRowCount());
 }
 
+TEST(DataSplitTest, TestSerializeWithKeyRange) {
+    auto pool = GetDefaultPool();
+    auto file_meta = std::make_shared<DataFileMeta>(
+        "data-0.orc", /*file_size=*/100, /*row_count=*/2,
+        /*min_key=*/BinaryRowGenerator::GenerateRow({1}, pool.get()), /*max_key=*/
+        BinaryRowGenerator::GenerateRow({100}, pool.get()),
+        /*key_stats=*/SimpleStats::EmptyStats(), /*value_stats=*/SimpleStats::EmptyStats(),
+        /*min_sequence_number=*/0, /*max_sequence_number=*/1, /*schema_id=*/0,
+        /*level=*/0, /*extra_files=*/std::vector<std::optional<std::string>>(),
+        /*creation_time=*/Timestamp(1725562946338ll, 0),
+        /*delete_row_count=*/0, /*embedded_index=*/nullptr, FileSource::Append(),
+        /*value_stats_cols=*/std::nullopt, /*external_path=*/std::nullopt,
+        /*first_row_id=*/std::nullopt,
+        /*write_cols=*/std::nullopt);
+    DataSplitImpl::Builder builder(
+        /*partition=*/BinaryRowGenerator::GenerateRow({10}, pool.get()),
+        /*bucket=*/0, /*bucket_path=*/"fake_table/f1=10/bucket-0", {file_meta});
+    ASSERT_OK_AND_ASSIGN(
+        std::shared_ptr<DataSplitImpl> data_split,
+        builder.WithSnapshot(1)
+            .RawConvertible(false)
+            .WithKeyRange(BinaryRowGenerator::GenerateRow({20}, pool.get()), std::nullopt)
+            .Build());
+    ASSERT_TRUE(data_split->HasKeyRange());
+
+    ASSERT_OK_AND_ASSIGN(std::string serialize_bytes, Split::Serialize(data_split, pool));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Split> result_split,
+                         Split::Deserialize(serialize_bytes.data(), serialize_bytes.size(), pool));
+    auto result_data_split = std::dynamic_pointer_cast<DataSplitImpl>(result_split);
+    ASSERT_TRUE(result_data_split);
+    ASSERT_TRUE(result_data_split->TEST_Equal(*data_split));
+    ASSERT_EQ(result_data_split->LowerKey().value().GetInt(0), 20);
+    ASSERT_FALSE(result_data_split->UpperKey());
+
+    // key range split cannot be raw convertible
+    DataSplitImpl::Builder raw_builder(
+        /*partition=*/BinaryRowGenerator::GenerateRow({10}, pool.get()),
+        /*bucket=*/0, /*bucket_path=*/"fake_table/f1=10/bucket-0", {file_meta});
+    ASSERT_NOK(raw_builder.RawConvertible(true)
+                   .WithKeyRange(std::nullopt, BinaryRowGenerator::GenerateRow({20}, pool.get()))
+                   .Build());
+}
+
 }  // namespace paimon::test
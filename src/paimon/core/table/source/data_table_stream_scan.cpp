@@ -16,6 +16,7 @@
 
 #include "paimon/core/table/source/data_table_stream_scan.h"
 
+#include <chrono>
 #include <utility>
 
 #include "fmt/format.h"
@@ -23,11 +24,13 @@
 #include "paimon/core/options/changelog_producer.h"
 #include "paimon/core/table/bucket_mode.h"
 #include "paimon/core/table/source/plan_impl.h"
+#include "paimon/core/table/source/snapshot/changelog_follow_up_scanner.h"
 #include "paimon/core/table/source/snapshot/delta_follow_up_scanner.h"
 #include "paimon/core/table/source/snapshot/follow_up_scanner.h"
 #include "paimon/core/table/source/snapshot/snapshot_reader.h"
 #include "paimon/core/table/source/snapshot/starting_scanner.h"
 #include "paimon/core/utils/snapshot_manager.h"
+#include "paimon/core/utils/snapshot_watcher.h"
 
 namespace paimon {
 DataTableStreamScan::DataTableStreamScan(const CoreOptions& core_options,
@@ -39,6 +42,8 @@ DataTableStreamScan::DataTableStreamScan(const CoreOptions& core_options,
     }
 }
 
+DataTableStreamScan::~DataTableStreamScan() = default;
+
 Result<std::shared_ptr<Plan>> DataTableStreamScan::CreatePlan() {
     if (!starting_scanner_) {
         PAIMON_RETURN_NOT_OK(InitScanner());
@@ -50,15 +55,64 @@ Result<std::shared_ptr<Plan>> DataTableStreamScan::CreatePlan() {
     }
 }
 
+Result<std::vector<std::shared_ptr<Plan>>> DataTableStreamScan::WaitForNextPlan(
+    int64_t timeout_ms, int32_t max_plans) {
+    if (max_plans <= 0) {
+        return Status::Invalid(fmt::format("max plans must be positive, but is {}", max_plans));
+    }
+    if (!starting_scanner_) {
+        PAIMON_RETURN_NOT_OK(InitScanner());
+    }
+    if (!snapshot_watcher_) {
+        snapshot_watcher_ = std::make_unique<SnapshotWatcher>(
+            snapshot_reader_->GetSnapshotManager()->SnapshotDirectory(),
+            core_options_.GetContinuousDiscoveryInterval());
+    }
+    auto now = std::chrono::steady_clock::now();
+    // clamp the deadline, as adding a very large timeout to now overflows
+    auto deadline = std::chrono::steady_clock::time_point::max();
+    if (timeout_ms <
+        std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count()) {
+        deadline = now + std::chrono::milliseconds(timeout_ms);
+    }
+    std::vector<std::shared_ptr<Plan>> plans;
+    while (true) {
+        if (next_snapshot_id_ == std::nullopt) {
+            PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<Plan> first_plan, TryFirstPlan());
+            // an empty first plan without snapshot only means that reading starts from a later
+            // snapshot or the table is empty
+            if (first_plan->SnapshotId() != std::nullopt) {
+                plans.push_back(std::move(first_plan));
+            }
+        }
+        while (next_snapshot_id_ != std::nullopt && plans.size() < static_cast<size_t>(max_plans)) {
+            PAIMON_ASSIGN_OR_RAISE(std::optional<std::shared_ptr<Plan>> plan, TryNextPlan());
+            if (plan == std::nullopt) {
+                break;
+            }
+            plans.push_back(std::move(plan).value());
+        }
+        if (!plans.empty()) {
+            snapshot_watcher_->Reset();
+            return plans;
+        }
+        now = std::chrono::steady_clock::now();
+        if (now >= deadline) {
+            return plans;
+        }
+        snapshot_watcher_->Wait(
+            std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count());
+    }
+}
+
 Result<std::shared_ptr<Plan>> DataTableStreamScan::TryFirstPlan() {
     std::shared_ptr<StartingScanner::ScanResult> scan_result;
-    if (core_options_.GetChangelogProducer() == ChangelogProducer::LOOKUP) {
-        return Status::NotImplemented("do not support lookup changelog producer");
-    } else if (core_options_.GetChangelogProducer() == ChangelogProducer::FULL_COMPACTION) {
+    if (core_options_.GetChangelogProducer() == ChangelogProducer::FULL_COMPACTION) {
         return Status::NotImplemented("do not support full compaction changelog producer");
-    } else {
-        PAIMON_ASSIGN_OR_RAISE(scan_result, starting_scanner_->Scan(snapshot_reader_));
     }
+    // lookup changelog is produced when data files are flushed, so the first plan reads files
+    // of all levels and later snapshots are read from their changelog
+    PAIMON_ASSIGN_OR_RAISE(scan_result, starting_scanner_->Scan(snapshot_reader_));
     if (auto current_snapshot =
             std::dynamic_pointer_cast<StartingScanner::CurrentSnapshot>(scan_result)) {
         PAIMON_ASSIGN_OR_RAISE(int64_t current_snapshot_id, current_snapshot->SnapshotId());
@@ -72,31 +126,47 @@ Result<std::shared_ptr<Plan>> DataTableStreamScan::TryFirstPlan() {
 }
 
 Result<std::shared_ptr<Plan>> DataTableStreamScan::NextPlan() {
+    PAIMON_ASSIGN_OR_RAISE(std::optional<std::shared_ptr<Plan>> plan, TryNextPlan());
+    if (plan == std::nullopt) {
+        return PlanImpl::EmptyPlan();
+    }
+    return plan.value();
+}
+
+Result<std::optional<std::shared_ptr<Plan>>> DataTableStreamScan::TryNextPlan() {
     while (true) {
         PAIMON_ASSIGN_OR_RAISE(std::optional<Snapshot> snapshot,
                                GetNextSnapshot(next_snapshot_id_.value()));
         if (snapshot == std::nullopt) {
-            return PlanImpl::EmptyPlan();
+            return std::optional<std::shared_ptr<Plan>>();
         }
         if (follow_up_scanner_->NeedScanSnapshot(snapshot.value())) {
             PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<Plan> plan,
                                    follow_up_scanner_->Scan(snapshot.value(), snapshot_reader_));
             next_snapshot_id_.value()++;
-            return plan;
+            return std::optional<std::shared_ptr<Plan>>(plan);
         } else {
             next_snapshot_id_.value()++;
         }
     }
 }
 
-Result<std::optional<Snapshot>> DataTableStreamScan::GetNextSnapshot(
-    int64_t next_snapshot_id) const {
+Result<std::optional<Snapshot>> DataTableStreamScan::GetNextSnapshot(int64_t next_snapshot_id) {
     auto snapshot_manager = snapshot_reader_->GetSnapshotManager();
     PAIMON_ASSIGN_OR_RAISE(bool exists, snapshot_manager->SnapshotExists(next_snapshot_id));
     if (exists) {
         PAIMON_ASSIGN_OR_RAISE(Snapshot snapshot, snapshot_manager->LoadSnapshot(next_snapshot_id));
         return std::optional<Snapshot>(snapshot);
     }
+    // Reading hints may list the snapshot directory, which is expensive for object stores. The
+    // result of the check only changes if snapshots expire or the table is recreated, so it is
+    // cached while waiting for the same snapshot.
+    auto now = std::chrono::steady_clock::now();
+    if (checked_snapshot_id_ == next_snapshot_id &&
+        now - checked_time_ <
+            std::chrono::milliseconds(core_options_.GetContinuousDiscoveryInterval())) {
+        return std::optional<Snapshot>();
+    }
     PAIMON_ASSIGN_OR_RAISE(std::optional<int64_t> earliest, snapshot_manager->EarliestSnapshotId());
     PAIMON_ASSIGN_OR_RAISE(std::optional<int64_t> latest, snapshot_manager->LatestSnapshotId());
     // No snapshot now
@@ -108,6 +178,8 @@ Result<std::optional<Snapshot>> DataTableStreamScan::GetNextSnapshot(
                 "been recreated. The next snapshot id is {}, while the latest snapshot id is {}",
                 next_snapshot_id, latest.value()));
         }
+        checked_snapshot_id_ = next_snapshot_id;
+        checked_time_ = now;
         return std::optional<Snapshot>();
     }
     return Status::Invalid(
@@ -119,7 +191,11 @@ Result<std::optional<Snapshot>> DataTableStreamScan::GetNextSnapshot(
 
 Status DataTableStreamScan::InitScanner() {
     PAIMON_ASSIGN_OR_RAISE(starting_scanner_, CreateStartingScanner(/*is_streaming=*/true));
-    follow_up_scanner_ = std::make_shared<DeltaFollowUpScanner>();
+    if (core_options_.GetChangelogProducer() == ChangelogProducer::LOOKUP) {
+        follow_up_scanner_ = std::make_shared<ChangelogFollowUpScanner>();
+    } else {
+        follow_up_scanner_ = std::make_shared<DeltaFollowUpScanner>();
+    }
     return Status::OK();
 }
 
@@ -15,9 +15,11 @@
  */
 
 #pragma once
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include "paimon/core/snapshot.h"
 #include "paimon/core/table/source/abstract_table_scan.h"
@@ -31,6 +33,7 @@ namespace paimon {
 class CoreOptions;
 class FollowUpScanner;
 class SnapshotReader;
+class SnapshotWatcher;
 class StartingScanner;
 
 /// `StreamTableScan` implementation for streaming planning.
@@ -38,9 +41,13 @@ class DataTableStreamScan : public AbstractTableScan {
  public:
     DataTableStreamScan(const CoreOptions& core_options,
                         const std::shared_ptr<SnapshotReader>& snapshot_reader);
+    ~DataTableStreamScan() override;
 
     Result<std::shared_ptr<Plan>> CreatePlan() override;
 
+    Result<std::vector<std::shared_ptr<Plan>>> WaitForNextPlan(int64_t timeout_ms,
+                                                               int32_t max_plans) override;
+
  private:
     Status InitScanner();
 
@@ -48,11 +55,21 @@ class DataTableStreamScan : public AbstractTableScan {
 
     Result<std::shared_ptr<Plan>> NextPlan();
 
-    Result<std::optional<Snapshot>> GetNextSnapshot(int64_t next_snapshot_id) const;
+    /// @return The plan of the next snapshot to read, or `std::nullopt` if the next snapshot does
+    /// not exist yet.
+    Result<std::optional<std::shared_ptr<Plan>>> TryNextPlan();
+
+    Result<std::optional<Snapshot>> GetNextSnapshot(int64_t next_snapshot_id);
 
  private:
     std::shared_ptr<StartingScanner> starting_scanner_;
     std::shared_ptr<FollowUpScanner> follow_up_scanner_;
     std::optional<int64_t> next_snapshot_id_;
+    std::unique_ptr<SnapshotWatcher> snapshot_watcher_;
+    // The next snapshot id which has been checked against earliest and latest snapshot hints and
+    // the time of the check. While the next snapshot does not exist, hints are not read again
+    // until the discovery interval elapses.
+    std::optional<int64_t> checked_snapshot_id_;
+    std::chrono::steady_clock::time_point checked_time_;
 };
 }  // namespace paimon
@@ -42,6 +42,12 @@ class KeyValueTableRead : public TableRead {
 
     Result<std::unique_ptr<BatchReader>> CreateReader(const std::shared_ptr<Split>& split) override;
 
+    /// Keeps the retract rows (-D and -U) with their row kinds in the read batches. Only the
+    /// splits read without merging are accepted then, as merge read drops the retract rows.
+    void ForceKeepDelete() {
+        force_keep_delete_ = true;
+    }
+
  private:
     KeyValueTableRead(std::vector<std::unique_ptr<SplitRead>>&& split_reads,
                       const std::shared_ptr<MemoryPool>& memory_pool);
@@ -21,6 +21,7 @@
 #include <optional>
 #include <set>
 
+#include "paimon/common/data/binary_row.h"
 #include "paimon/common/utils/bin_packing.h"
 #include "paimon/core/mergetree/compact/interval_partition.h"
 #include "paimon/core/mergetree/sorted_run.h"
@@ -31,12 +32,14 @@ class FieldsComparator;
 
 MergeTreeSplitGenerator::MergeTreeSplitGenerator(
     int64_t target_split_size, int64_t open_file_cost, bool deletion_vectors_enabled,
-    const MergeEngine& merge_engine, const std::shared_ptr<FieldsComparator>& key_comparator)
+    const MergeEngine& merge_engine, const std::shared_ptr<FieldsComparator>& key_comparator,
+    bool key_range_split_enabled)
     : target_split_size_(target_split_size),
       open_file_cost_(open_file_cost),
       deletion_vectors_enabled_(deletion_vectors_enabled),
       merge_engine_(merge_engine),
-      key_comparator_(key_comparator) {}
+      key_comparator_(key_comparator),
+      key_range_split_enabled_(key_range_split_enabled) {}
 
 Result<std::vector<SplitGenerator::SplitGroup>> MergeTreeSplitGenerator::SplitForBatch(
     std::vector<std::shared_ptr<DataFileMeta>>&& input) const {
@@ -88,43 +91,154 @@ Result<std::vector<SplitGenerator::SplitGroup>> MergeTreeSplitGenerator::SplitFo
      * - split2: [5, 180] [5,190]
      * - split3: [200, 600] [210, 700]
      */
+    /*
+     * When key range splitting is enabled, a section whose size exceeds the targetSplitSize is
+     * not packed. Instead, it is cut into several key ranges by SplitSectionByKeyRange, and each
+     * key range becomes a split reading all files of the section intersecting it. Sections
+     * before and after it are still packed by OrderedPack.
+     */
     std::vector<std::vector<SortedRun>> sorted_runs_vec =
         IntervalPartition(std::move(input), key_comparator_).Partition();
+    std::vector<SplitGenerator::SplitGroup> split_groups;
     std::vector<std::vector<std::shared_ptr<DataFileMeta>>> sections;
     sections.reserve(sorted_runs_vec.size());
+    auto pack_sections = [&]() {
+        if (sections.empty()) {
+            return;
+        }
+        std::vector<std::vector<std::shared_ptr<DataFileMeta>>> metas_vec =
+            PackSplits(std::move(sections));
+        sections.clear();
+        for (auto& metas : metas_vec) {
+            if (metas.size() == 1 && WithoutDeleteRow(metas[0])) {
+                split_groups.push_back(
+                    SplitGenerator::SplitGroup::RawConvertibleGroup(std::move(metas)));
+            } else {
+                split_groups.push_back(
+                    SplitGenerator::SplitGroup::NonRawConvertibleGroup(std::move(metas)));
+            }
+        }
+    };
     for (auto& sorted_runs : sorted_runs_vec) {
         auto files = FlatRun(std::move(sorted_runs));
-        sections.push_back(std::move(files));
+        if (key_range_split_enabled_ && files.size() > 1 &&
+            TotalSize(files) > target_split_size_) {
+            pack_sections();
+            for (auto& group : SplitSectionByKeyRange(files)) {
+                split_groups.push_back(std::move(group));
+            }
+        } else {
+            sections.push_back(std::move(files));
+        }
+    }
+    pack_sections();
+    return split_groups;
+}
+
+std::vector<SplitGenerator::SplitGroup> MergeTreeSplitGenerator::SplitSectionByKeyRange(
+    const std::vector<std::shared_ptr<DataFileMeta>>& section) const {
+    auto less = [this](const BinaryRow& lhs, const BinaryRow& rhs) {
+        return key_comparator_->CompareTo(lhs, rhs) < 0;
+    };
+    auto equal = [this](const BinaryRow& lhs, const BinaryRow& rhs) {
+        return key_comparator_->CompareTo(lhs, rhs) == 0;
+    };
+    // 1. candidate split keys are the distinct min and max keys of the files
+    std::vector<BinaryRow> candidates;
+    candidates.reserve(section.size() * 2);
+    for (const auto& meta : section) {
+        candidates.push_back(meta->min_key);
+        candidates.push_back(meta->max_key);
+    }
+    std::sort(candidates.begin(), candidates.end(), less);
+    candidates.erase(std::unique(candidates.begin(), candidates.end(), equal), candidates.end());
+    if (candidates.size() < 2) {
+        std::vector<SplitGenerator::SplitGroup> result;
+        result.push_back(SplitGenerator::SplitGroup::NonRawConvertibleGroup(
+            std::vector<std::shared_ptr<DataFileMeta>>(section)));
+        return result;
     }
 
-    std::vector<std::vector<std::shared_ptr<DataFileMeta>>> metas_vec =
-        PackSplits(std::move(sections));
-    std::vector<SplitGenerator::SplitGroup> split_groups;
-    split_groups.reserve(metas_vec.size());
-    for (auto& metas : metas_vec) {
-        if (metas.size() == 1 && WithoutDeleteRow(metas[0])) {
-            split_groups.push_back(
-                SplitGenerator::SplitGroup::RawConvertibleGroup(std::move(metas)));
+    // 2. estimate the weight of each interval [candidates[i], candidates[i + 1]), assuming that
+    // the weight of a file is evenly distributed over the intervals its key range covers
+    size_t interval_count = candidates.size() - 1;
+    auto index_of = [&](const BinaryRow& key) -> size_t {
+        return std::lower_bound(candidates.begin(), candidates.end(), key, less) -
+               candidates.begin();
+    };
+    std::vector<double> density_delta(interval_count + 1, 0.0);
+    double total_weight = 0.0;
+    for (const auto& meta : section) {
+        size_t begin = std::min(index_of(meta->min_key), interval_count - 1);
+        size_t end = std::max(index_of(meta->max_key), begin + 1);
+        double weight = static_cast<double>(std::max(meta->file_size, open_file_cost_));
+        density_delta[begin] += weight / static_cast<double>(end - begin);
+        density_delta[end] -= weight / static_cast<double>(end - begin);
+        total_weight += weight;
+    }
+
+    // 3. choose split keys so that each key range holds about the same weight
+    int64_t split_num = (TotalSize(section) + target_split_size_ - 1) / target_split_size_;
+    double weight_per_split = total_weight / static_cast<double>(std::max<int64_t>(split_num, 1));
+    std::vector<BinaryRow> split_keys;
+    double density = 0.0;
+    double accumulated = 0.0;
+    for (size_t i = 0; i + 1 < interval_count; i++) {
+        density += density_delta[i];
+        accumulated += density;
+        if (accumulated >= weight_per_split &&
+            static_cast<int64_t>(split_keys.size()) + 1 < split_num) {
+            split_keys.push_back(candidates[i + 1]);
+            accumulated = 0.0;
+        }
+    }
+
+    // 4. each key range [lower, upper) reads all files intersecting it
+    std::vector<SplitGenerator::SplitGroup> result;
+    result.reserve(split_keys.size() + 1);
+    for (size_t i = 0; i <= split_keys.size(); i++) {
+        std::optional<BinaryRow> lower_key;
+        std::optional<BinaryRow> upper_key;
+        if (i > 0) {
+            lower_key = split_keys[i - 1];
+        }
+        if (i < split_keys.size()) {
+            upper_key = split_keys[i];
+        }
+        std::vector<std::shared_ptr<DataFileMeta>> files;
+        for (const auto& meta : section) {
+            if ((!lower_key || !less(meta->max_key, lower_key.value())) &&
+                (!upper_key || less(meta->min_key, upper_key.value()))) {
+                files.push_back(meta);
+            }
+        }
+        if (files.empty()) {
+            continue;
+        }
+        if (split_keys.empty()) {
+            result.push_back(SplitGenerator::SplitGroup::NonRawConvertibleGroup(std::move(files)));
         } else {
-            split_groups.push_back(
-                SplitGenerator::SplitGroup::NonRawConvertibleGroup(std::move(metas)));
+            result.push_back(
+                SplitGenerator::SplitGroup::KeyRangeGroup(std::move(files), lower_key, upper_key));
         }
     }
-    return split_groups;
+    return result;
+}
+
+int64_t MergeTreeSplitGenerator::TotalSize(
+    const std::vector<std::shared_ptr<DataFileMeta>>& section) {
+    int64_t ret = 0;
+    for (const auto& meta : section) {
+        ret += meta->file_size;
+    }
+    return ret;
 }
 
 std::vector<std::vector<std::shared_ptr<DataFileMeta>>> MergeTreeSplitGenerator::PackSplits(
     std::vector<std::vector<std::shared_ptr<DataFileMeta>>>&& sections) const {
-    auto total_size = [](const std::vector<std::shared_ptr<DataFileMeta>>& section) -> int64_t {
-        int64_t ret = 0;
-        for (const auto& meta : section) {
-            ret += meta->file_size;
-        }
-        return ret;
-    };
-    auto weight_func = [open_file_cost = open_file_cost_, total_size](
+    auto weight_func = [open_file_cost = open_file_cost_](
                            const std::vector<std::shared_ptr<DataFileMeta>>& metas) -> int64_t {
-        return std::max(total_size(metas), open_file_cost);
+        return std::max(TotalSize(metas), open_file_cost);
     };
     auto packed = BinPacking::PackForOrdered<std::vector<std::shared_ptr<DataFileMeta>>>(
         std::move(sections), weight_func, target_split_size_);
@@ -38,7 +38,8 @@ class MergeTreeSplitGenerator : public SplitGenerator {
  public:
     MergeTreeSplitGenerator(int64_t target_split_size, int64_t open_file_cost,
                             bool deletion_vectors_enabled, const MergeEngine& merge_engine,
-                            const std::shared_ptr<FieldsComparator>& key_comparator);
+                            const std::shared_ptr<FieldsComparator>& key_comparator,
+                            bool key_range_split_enabled = false);
 
     Result<std::vector<SplitGroup>> SplitForBatch(
         std::vector<std::shared_ptr<DataFileMeta>>&& input) const override;
@@ -53,6 +54,13 @@ class MergeTreeSplitGenerator : public SplitGenerator {
     std::vector<std::vector<std::shared_ptr<DataFileMeta>>> PackSplits(
         std::vector<std::vector<std::shared_ptr<DataFileMeta>>>&& sections) const;
 
+    /// Split one oversized section into several key ranges. Every key range reads all files of
+    /// the section that intersect it, so records of the same key are still merged together.
+    std::vector<SplitGroup> SplitSectionByKeyRange(
+        const std::vector<std::shared_ptr<DataFileMeta>>& section) const;
+
+    static int64_t TotalSize(const std::vector<std::shared_ptr<DataFileMeta>>& section);
+
     static std::vector<std::shared_ptr<DataFileMeta>> FlatFiles(
         std::vector<std::vector<std::shared_ptr<DataFileMeta>>>&& section);
 
@@ -66,5 +74,6 @@ class MergeTreeSplitGenerator : public SplitGenerator {
     bool deletion_vectors_enabled_;
     MergeEngine merge_engine_;
     std::shared_ptr<FieldsComparator> key_comparator_;
+    bool key_range_split_enabled_;
 };
 }  // namespace paimon
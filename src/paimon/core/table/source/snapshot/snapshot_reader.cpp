@@ -93,7 +93,8 @@ Result<std::vector<std::shared_ptr<Split>>> SnapshotReader::GenerateSplits(
                     .WithSnapshot(snapshot == std::nullopt ? Snapshot::FIRST_SNAPSHOT_ID - 1
                                                            : snapshot.value().Id())
                     .IsStreaming(is_streaming)
-                    .RawConvertible(split_group.raw_convertible);
+                    .RawConvertible(split_group.raw_convertible)
+                    .WithKeyRange(split_group.lower_key, split_group.upper_key);
                 if (deletion_file_enabled && !deletion_index_files_map.empty()) {
                     PAIMON_ASSIGN_OR_RAISE(
                         std::vector<std::optional<DeletionFile>> deletion_files,
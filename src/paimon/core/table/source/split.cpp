@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <optional>
 #include <utility>
 
 #include "fmt/format.h"
@@ -66,8 +67,27 @@ Status WriteDataSplit(const std::shared_ptr<DataSplitImpl>& data_split_impl,
     return Status::OK();
 }
 
+Status WriteOptionalKey(const std::optional<BinaryRow>& key, MemorySegmentOutputStream* out) {
+    if (key == std::nullopt) {
+        out->WriteValue<bool>(false);
+        return Status::OK();
+    }
+    out->WriteValue<bool>(true);
+    return SerializationUtils::SerializeBinaryRow(key.value(), out);
+}
+
+Result<std::optional<BinaryRow>> ReadOptionalKey(DataInputStream* in, MemoryPool* pool) {
+    PAIMON_ASSIGN_OR_RAISE(bool key_exist, in->ReadValue<bool>());
+    if (!key_exist) {
+        return std::optional<BinaryRow>();
+    }
+    PAIMON_ASSIGN_OR_RAISE(BinaryRow key, SerializationUtils::DeserializeBinaryRow(in, pool));
+    return std::optional<BinaryRow>(std::move(key));
+}
+
 Result<std::shared_ptr<DataSplitImpl>> ReadDataSplitWithoutMagicNumber(
-    int64_t magic, DataInputStream* in, const std::shared_ptr<MemoryPool>& pool) {
+    int64_t magic, DataInputStream* in, const std::shared_ptr<MemoryPool>& pool,
+    const std::optional<BinaryRow>& lower_key, const std::optional<BinaryRow>& upper_key) {
     int32_t version = 1;
     if (magic == DataSplitImpl::MAGIC) {
         PAIMON_ASSIGN_OR_RAISE(version, in->ReadValue<int32_t>());
@@ -119,7 +139,8 @@ Result<std::shared_ptr<DataSplitImpl>> ReadDataSplitWithoutMagicNumber(
         .WithSnapshot(snapshot_id)
         .WithBeforeFiles(std::move(before_files))
         .IsStreaming(is_streaming)
-        .RawConvertible(raw_convertible);
+        .RawConvertible(raw_convertible)
+        .WithKeyRange(lower_key, upper_key);
     if (!before_deletion_files.empty()) {
         builder.WithBeforeDeletionFiles(before_deletion_files);
     }
@@ -129,13 +150,33 @@ Result<std::shared_ptr<DataSplitImpl>> ReadDataSplitWithoutMagicNumber(
     return builder.Build();
 }
 
+Result<std::shared_ptr<DataSplitImpl>> ReadKeyRangeDataSplit(
+    DataInputStream* in, const std::shared_ptr<MemoryPool>& pool) {
+    PAIMON_ASSIGN_OR_RAISE(int32_t version, in->ReadValue<int32_t>());
+    if (version != DataSplitImpl::KEY_RANGE_VERSION) {
+        return Status::Invalid(fmt::format("Unsupported key range DataSplit version: {}", version));
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::optional<BinaryRow> lower_key, ReadOptionalKey(in, pool.get()));
+    PAIMON_ASSIGN_OR_RAISE(std::optional<BinaryRow> upper_key, ReadOptionalKey(in, pool.get()));
+    PAIMON_ASSIGN_OR_RAISE(int64_t data_split_magic, in->ReadValue<int64_t>());
+    return ReadDataSplitWithoutMagicNumber(data_split_magic, in, pool, lower_key, upper_key);
+}
+
 }  // namespace
 
 Result<std::string> Split::Serialize(const std::shared_ptr<Split>& split,
                                      const std::shared_ptr<MemoryPool>& pool) {
     MemorySegmentOutputStream out(MemorySegmentOutputStream::DEFAULT_SEGMENT_SIZE, pool);
     if (auto data_split_impl = std::dynamic_pointer_cast<DataSplitImpl>(split)) {
-        PAIMON_RETURN_NOT_OK(WriteDataSplit(data_split_impl, &out, pool));
+        if (data_split_impl->HasKeyRange()) {
+            out.WriteValue<int64_t>(DataSplitImpl::KEY_RANGE_MAGIC);
+            out.WriteValue<int32_t>(DataSplitImpl::KEY_RANGE_VERSION);
+            PAIMON_RETURN_NOT_OK(WriteOptionalKey(data_split_impl->LowerKey(), &out));
+            PAIMON_RETURN_NOT_OK(WriteOptionalKey(data_split_impl->UpperKey(), &out));
+            PAIMON_RETURN_NOT_OK(WriteDataSplit(data_split_impl, &out, pool));
+        } else {
+            PAIMON_RETURN_NOT_OK(WriteDataSplit(data_split_impl, &out, pool));
+        }
     } else if (auto indexed_split_impl = std::dynamic_pointer_cast<IndexedSplitImpl>(split)) {
         out.WriteValue<int64_t>(IndexedSplitImpl::MAGIC);
         out.WriteValue<int32_t>(IndexedSplitImpl::VERSION);
@@ -185,7 +226,9 @@ Result<std::shared_ptr<Split>> Split::Deserialize(const char* buffer, size_t len
         }
         PAIMON_ASSIGN_OR_RAISE(int64_t data_split_magic, in.ReadValue<int64_t>());
         PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<DataSplitImpl> data_split,
-                               ReadDataSplitWithoutMagicNumber(data_split_magic, &in, pool));
+                               ReadDataSplitWithoutMagicNumber(data_split_magic, &in, pool,
+                                                               /*lower_key=*/std::nullopt,
+                                                               /*upper_key=*/std::nullopt));
         PAIMON_ASSIGN_OR_RAISE(int32_t range_size, in.ReadValue<int32_t>());
         std::vector<Range> row_ranges;
         row_ranges.reserve(range_size);
@@ -217,9 +260,22 @@ Result<std::shared_ptr<Split>> Split::Deserialize(const char* buffer, size_t len
                 fmt::format("invalid IndexedSplit, remaining {} bytes after deserializing",
                             stream_length - pos));
         }
+    } else if (magic == DataSplitImpl::KEY_RANGE_MAGIC) {
+        PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<DataSplitImpl> data_split,
+                               ReadKeyRangeDataSplit(&in, pool));
+        PAIMON_ASSIGN_OR_RAISE(int64_t pos, in.GetPos());
+        PAIMON_ASSIGN_OR_RAISE(int64_t stream_length, in.Length());
+        if (pos != stream_length) {
+            return Status::Invalid(fmt::format(
+                "invalid key range data split byte stream, remaining {} bytes after deserializing",
+                stream_length - pos));
+        }
+        return data_split;
     } else if (magic == DataSplitImpl::MAGIC) {
         PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<DataSplitImpl> data_split,
-                               ReadDataSplitWithoutMagicNumber(magic, &in, pool));
+                               ReadDataSplitWithoutMagicNumber(magic, &in, pool,
+                                                               /*lower_key=*/std::nullopt,
+                                                               /*upper_key=*/std::nullopt));
         PAIMON_ASSIGN_OR_RAISE(int64_t pos, in.GetPos());
         PAIMON_ASSIGN_OR_RAISE(int64_t stream_length, in.Length());
         if (pos == stream_length) {
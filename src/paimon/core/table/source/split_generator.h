@@ -17,9 +17,11 @@
 #pragma once
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
+#include "paimon/common/data/binary_row.h"
 #include "paimon/core/io/data_file_meta.h"
 #include "paimon/result.h"
 
@@ -39,6 +41,17 @@ class SplitGenerator {
             return SplitGroup(std::move(files), false);
         }
 
+        /// A group that reads all `files` but only outputs keys in [lower_key, upper_key). A
+        /// missing bound means the key range is unbounded on that side.
+        static SplitGroup KeyRangeGroup(std::vector<std::shared_ptr<DataFileMeta>>&& files,
+                                        const std::optional<BinaryRow>& lower_key,
+                                        const std::optional<BinaryRow>& upper_key) {
+            SplitGroup group(std::move(files), false);
+            group.lower_key = lower_key;
+            group.upper_key = upper_key;
+            return group;
+        }
+
         bool operator==(const SplitGroup& other) const {
             if (this == &other) {
                 return true;
@@ -51,11 +64,16 @@ class SplitGenerator {
                     return false;
                 }
             }
-            return raw_convertible == other.raw_convertible;
+            return raw_convertible == other.raw_convertible && lower_key == other.lower_key &&
+                   upper_key == other.upper_key;
         }
 
         std::vector<std::shared_ptr<DataFileMeta>> files;
         bool raw_convertible;
+        // inclusive lower bound of output keys, only set by key range splitting
+        std::optional<BinaryRow> lower_key;
+        // exclusive upper bound of output keys, only set by key range splitting
+        std::optional<BinaryRow> upper_key;
 
      private:
         SplitGroup(std::vector<std::shared_ptr<DataFileMeta>>&& _files, bool _raw_convertible)
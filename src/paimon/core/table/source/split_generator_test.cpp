@@ -345,4 +345,52 @@ TEST_F(SplitGeneratorTest, TestMergeTreeSplitRawConvertible) {
     CheckResult(split_groups, expected, expected_raw_convertible);
 }
 
+TEST_F(SplitGeneratorTest, TestMergeTreeKeyRangeSplit) {
+    std::vector<std::shared_ptr<DataFileMeta>> files = {CreateDataFileMeta("1", 0, 100),
+                                                        CreateDataFileMeta("2", 0, 100),
+                                                        CreateDataFileMeta("3", 50, 150),
+                                                        CreateDataFileMeta("4", 200, 210)};
+    {
+        // key range splitting disabled, the oversized section stays in one split
+        auto tmp_files = files;
+        MergeTreeSplitGenerator split_generator(/*target_split_size=*/100, /*open_file_cost=*/2,
+                                                /*deletion_vectors_enabled=*/false,
+                                                MergeEngine::DEDUPLICATE, key_comparator_,
+                                                /*key_range_split_enabled=*/false);
+        ASSERT_OK_AND_ASSIGN(std::vector<SplitGenerator::SplitGroup> split_groups,
+                             split_generator.SplitForBatch(std::move(tmp_files)));
+        std::vector<std::vector<std::string>> expected = {{"1", "2", "3"}, {"4"}};
+        CheckResult(split_groups, expected);
+    }
+    {
+        auto tmp_files = files;
+        MergeTreeSplitGenerator split_generator(/*target_split_size=*/100, /*open_file_cost=*/2,
+                                                /*deletion_vectors_enabled=*/false,
+                                                MergeEngine::DEDUPLICATE, key_comparator_,
+                                                /*key_range_split_enabled=*/true);
+        ASSERT_OK_AND_ASSIGN(std::vector<SplitGenerator::SplitGroup> split_groups,
+                             split_generator.SplitForBatch(std::move(tmp_files)));
+        ASSERT_EQ(split_groups.size(), 4);
+        // [-inf, 50) only intersects file 1 and 2
+        ASSERT_EQ(split_groups[0].files.size(), 2);
+        ASSERT_FALSE(split_groups[0].raw_convertible);
+        ASSERT_FALSE(split_groups[0].lower_key);
+        ASSERT_EQ(split_groups[0].upper_key.value().GetInt(0), 50);
+        // [50, 100)
+        ASSERT_EQ(split_groups[1].files.size(), 3);
+        ASSERT_EQ(split_groups[1].lower_key.value().GetInt(0), 50);
+        ASSERT_EQ(split_groups[1].upper_key.value().GetInt(0), 100);
+        // [100, +inf)
+        ASSERT_EQ(split_groups[2].files.size(), 3);
+        ASSERT_EQ(split_groups[2].lower_key.value().GetInt(0), 100);
+        ASSERT_FALSE(split_groups[2].upper_key);
+        // small sections are still packed normally
+        ASSERT_EQ(split_groups[3].files.size(), 1);
+        ASSERT_EQ(split_groups[3].files[0]->file_name, "4");
+        ASSERT_TRUE(split_groups[3].raw_convertible);
+        ASSERT_FALSE(split_groups[3].lower_key);
+        ASSERT_FALSE(split_groups[3].upper_key);
+    }
+}
+
 }  // namespace paimon::test
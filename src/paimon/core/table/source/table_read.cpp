@@ -35,6 +35,7 @@
 #include "paimon/core/table/source/key_value_table_read.h"
 #include "paimon/core/utils/branch_manager.h"
 #include "paimon/core/utils/file_store_path_factory.h"
+#include "paimon/core/utils/metadata_cache.h"
 #include "paimon/defs.h"
 #include "paimon/format/file_format.h"
 #include "paimon/read_context.h"
@@ -59,6 +60,10 @@ Result<std::unique_ptr<InternalReadContext>> CreateInternalReadContext(
             CoreOptions tmp_core_options,
             CoreOptions::FromMap(tmp_options, context->GetFileSystemSchemeToIdentifierMap()));
         SchemaManager schema_manager(tmp_core_options.GetFileSystem(), context->GetPath(), branch);
+        if (tmp_core_options.MetadataCacheEnabled()) {
+            schema_manager.WithCache(MetadataCache::Global(),
+                                     tmp_core_options.GetMetadataCacheHintTtl());
+        }
         PAIMON_ASSIGN_OR_RAISE(std::optional<std::shared_ptr<TableSchema>> latest_schema,
                                schema_manager.Latest());
         if (!latest_schema) {
@@ -30,6 +30,7 @@
 #include "paimon/core/manifest/index_manifest_file.h"
 #include "paimon/core/manifest/manifest_file.h"
 #include "paimon/core/manifest/manifest_list.h"
+#include "paimon/core/manifest/partition_statistics_index.h"
 #include "paimon/core/operation/append_only_file_store_scan.h"
 #include "paimon/core/operation/data_evolution_file_store_scan.h"
 #include "paimon/core/operation/file_store_scan.h"
@@ -51,6 +52,7 @@
 #include "paimon/core/utils/fields_comparator.h"
 #include "paimon/core/utils/file_store_path_factory.h"
 #include "paimon/core/utils/index_file_path_factories.h"
+#include "paimon/core/utils/metadata_cache.h"
 #include "paimon/core/utils/snapshot_manager.h"
 #include "paimon/format/file_format.h"
 #include "paimon/result.h"
@@ -78,6 +80,12 @@ class TableScanImpl {
         auto snapshot_manager = std::make_shared<SnapshotManager>(fs, context->GetPath());
         // TODO(liancheng.lsz): support fallback branch in scan
         auto schema_manager = std::make_shared<SchemaManager>(fs, context->GetPath());
+        if (core_options.MetadataCacheEnabled()) {
+            snapshot_manager->WithCache(MetadataCache::Global(),
+                                        core_options.GetMetadataCacheHintTtl());
+            schema_manager->WithCache(MetadataCache::Global(),
+                                      core_options.GetMetadataCacheHintTtl());
+        }
         PAIMON_ASSIGN_OR_RAISE(
             std::shared_ptr<ManifestList> manifest_list,
             ManifestList::Create(fs, manifest_file_format, core_options.GetManifestCompression(),
@@ -90,19 +98,34 @@ class TableScanImpl {
             ManifestFile::Create(fs, manifest_file_format, core_options.GetManifestCompression(),
                                  path_factory, core_options.GetManifestTargetFileSize(),
                                  memory_pool, core_options, partition_schema));
+        std::unique_ptr<FileStoreScan> file_store_scan;
         if (table_schema->PrimaryKeys().empty()) {
             if (core_options.DataEvolutionEnabled()) {
-                return DataEvolutionFileStoreScan::Create(
-                    snapshot_manager, schema_manager, manifest_list, manifest_file, table_schema,
-                    arrow_schema, context->GetScanFilters(), core_options, executor, memory_pool);
+                PAIMON_ASSIGN_OR_RAISE(
+                    file_store_scan,
+                    DataEvolutionFileStoreScan::Create(
+                        snapshot_manager, schema_manager, manifest_list, manifest_file,
+                        table_schema, arrow_schema, context->GetScanFilters(), core_options,
+                        executor, memory_pool));
+            } else {
+                PAIMON_ASSIGN_OR_RAISE(
+                    file_store_scan,
+                    AppendOnlyFileStoreScan::Create(
+                        snapshot_manager, schema_manager, manifest_list, manifest_file,
+                        table_schema, arrow_schema, context->GetScanFilters(), core_options,
+                        executor, memory_pool));
             }
-            return AppendOnlyFileStoreScan::Create(
-                snapshot_manager, schema_manager, manifest_list, manifest_file, table_schema,
-                arrow_schema, context->GetScanFilters(), core_options, executor, memory_pool);
+        } else {
+            PAIMON_ASSIGN_OR_RAISE(
+                file_store_scan,
+                KeyValueFileStoreScan::Create(snapshot_manager, schema_manager, manifest_list,
+                                              manifest_file, table_schema, arrow_schema,
+                                              context->GetScanFilters(), core_options, executor,
+                                              memory_pool));
         }
-        return KeyValueFileStoreScan::Create(
-            snapshot_manager, schema_manager, manifest_list, manifest_file, table_schema,
-            arrow_schema, context->GetScanFilters(), core_options, executor, memory_pool);
+        file_store_scan->WithPartitionStatisticsIndexFile(
+            std::make_shared<PartitionStatisticsIndexFile>(fs, path_factory, memory_pool));
+        return file_store_scan;
     }
 
     static Result<std::unique_ptr<SplitGenerator>> CreateSplitGenerator(
@@ -132,7 +155,7 @@ class TableScanImpl {
             return std::make_unique<MergeTreeSplitGenerator>(
                 source_split_target_size, source_split_open_file_cost,
                 core_options.DeletionVectorsEnabled(), core_options.GetMergeEngine(),
-                key_comparator);
+                key_comparator, core_options.SourceSplitKeyRangeEnabled());
         }
     }
 
@@ -163,6 +186,9 @@ Result<std::unique_ptr<TableScan>> TableScan::Create(std::unique_ptr<ScanContext
     // load schema
     PAIMON_ASSIGN_OR_RAISE(CoreOptions tmp_options, CoreOptions::FromMap(context->GetOptions()));
     SchemaManager schema_manager(tmp_options.GetFileSystem(), context->GetPath());
+    if (tmp_options.MetadataCacheEnabled()) {
+        schema_manager.WithCache(MetadataCache::Global(), tmp_options.GetMetadataCacheHintTtl());
+    }
     PAIMON_ASSIGN_OR_RAISE(std::optional<std::shared_ptr<TableSchema>> latest_table_schema,
                            schema_manager.Latest());
     if (latest_table_schema == std::nullopt) {
@@ -238,4 +264,13 @@ Result<std::unique_ptr<TableScan>> TableScan::Create(std::unique_ptr<ScanContext
         context->GetExecutor());
 }
 
+Result<std::vector<std::shared_ptr<Plan>>> TableScan::WaitForNextPlan(int64_t timeout_ms,
+                                                                      int32_t max_plans) {
+    if (max_plans <= 0) {
+        return Status::Invalid(fmt::format("max plans must be positive, but is {}", max_plans));
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<Plan> plan, CreatePlan());
+    return std::vector<std::shared_ptr<Plan>>({plan});
+}
+
 }  // namespace paimon
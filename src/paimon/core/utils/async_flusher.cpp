@@ -0,0 +1,113 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/utils/async_flusher.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "paimon/executor.h"
+
+namespace paimon {
+
+void FlushMemoryBudget::Acquire(int64_t memory_in_bytes) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this, memory_in_bytes]() {
+        return used_memory_in_bytes_ == 0 ||
+               used_memory_in_bytes_ + memory_in_bytes <= max_memory_in_bytes_;
+    });
+    used_memory_in_bytes_ += memory_in_bytes;
+}
+
+void FlushMemoryBudget::Release(int64_t memory_in_bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    used_memory_in_bytes_ -= memory_in_bytes;
+    cv_.notify_all();
+}
+
+int64_t FlushMemoryBudget::GetUsedMemory() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return used_memory_in_bytes_;
+}
+
+AsyncFlusher::AsyncFlusher(const std::shared_ptr<Executor>& executor, int32_t max_in_flight,
+                           const std::shared_ptr<FlushMemoryBudget>& memory_budget)
+    : executor_(executor),
+      max_in_flight_(std::max(max_in_flight, 1)),
+      memory_budget_(memory_budget) {}
+
+AsyncFlusher::~AsyncFlusher() {
+    [[maybe_unused]] auto status = WaitAll();
+}
+
+Status AsyncFlusher::Submit(std::function<Status()>&& task, int64_t memory_in_bytes) {
+    if (memory_budget_) {
+        // the budget is acquired without holding the lock, as it waits for the tasks of other
+        // writers as well
+        memory_budget_->Acquire(memory_in_bytes);
+    } else {
+        memory_in_bytes = 0;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() { return in_flight_ < max_in_flight_ || !status_.ok(); });
+    if (!status_.ok()) {
+        if (memory_budget_) {
+            memory_budget_->Release(memory_in_bytes);
+        }
+        return status_;
+    }
+    pending_tasks_.emplace_back(std::move(task), memory_in_bytes);
+    in_flight_++;
+    if (!draining_) {
+        draining_ = true;
+        executor_->Add([this]() { Drain(); });
+    }
+    return Status::OK();
+}
+
+Status AsyncFlusher::WaitAll() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() { return in_flight_ == 0 && !draining_; });
+    return status_;
+}
+
+void AsyncFlusher::Drain() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!pending_tasks_.empty()) {
+        auto [task, memory_in_bytes] = std::move(pending_tasks_.front());
+        pending_tasks_.pop_front();
+        if (status_.ok()) {
+            lock.unlock();
+            Status status = task();
+            // release the flushed buffer before the writer is unblocked
+            task = nullptr;
+            lock.lock();
+            if (!status.ok() && status_.ok()) {
+                status_ = std::move(status);
+            }
+        }
+        if (memory_budget_) {
+            // dropped tasks release their memory as well
+            memory_budget_->Release(memory_in_bytes);
+        }
+        in_flight_--;
+        cv_.notify_all();
+    }
+    draining_ = false;
+    cv_.notify_all();
+}
+
+}  // namespace paimon
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "paimon/status.h"
+
+namespace paimon {
+class Executor;
+
+/// Bounds the memory of the full write buffers waiting to be flushed or being flushed by all the
+/// writers of a table write, which is not bounded by the per-writer `max_in_flight` when data is
+/// spread over many buckets.
+class FlushMemoryBudget {
+ public:
+    explicit FlushMemoryBudget(int64_t max_memory_in_bytes)
+        : max_memory_in_bytes_(max_memory_in_bytes) {}
+
+    /// Blocks until `memory_in_bytes` fits into the budget. A buffer larger than the whole budget
+    /// is admitted once nothing else is held, so that it does not wait forever.
+    void Acquire(int64_t memory_in_bytes);
+    void Release(int64_t memory_in_bytes);
+
+    int64_t GetUsedMemory() const;
+
+ private:
+    const int64_t max_memory_in_bytes_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    int64_t used_memory_in_bytes_ = 0;
+};
+
+/// Runs the flushes of a writer in the background.
+///
+/// Flush tasks run one by one in the order of submission on the executor, so they may share the
+/// state of the writer (e.g. the merge function, the lookup levels or the rolling file writer)
+/// while the writer thread keeps accepting data into a new buffer. At most `max_in_flight` tasks
+/// are waiting or running, `Submit()` blocks until the oldest one finishes when the limit is
+/// reached, which bounds the memory held by the full write buffers of the writer. If a memory
+/// budget is shared by the flushers of all the writers, `Submit()` also blocks until the buffer
+/// fits into the budget, the memory is released when the task finishes.
+///
+/// Once a task fails, the following tasks are dropped and the error is returned by `Submit()`
+/// and `WaitAll()`.
+class AsyncFlusher {
+ public:
+    /// @param memory_budget May be nullptr if the memory is only bounded by `max_in_flight`.
+    AsyncFlusher(const std::shared_ptr<Executor>& executor, int32_t max_in_flight,
+                 const std::shared_ptr<FlushMemoryBudget>& memory_budget);
+    /// Waits for the submitted tasks, as they usually reference the writer.
+    ~AsyncFlusher();
+
+    /// Submits a flush task of a buffer holding `memory_in_bytes`, blocks if there are already
+    /// `max_in_flight` tasks or the buffer does not fit into the memory budget.
+    Status Submit(std::function<Status()>&& task, int64_t memory_in_bytes);
+    /// Waits until all the submitted tasks finish.
+    Status WaitAll();
+
+ private:
+    void Drain();
+
+ private:
+    std::shared_ptr<Executor> executor_;
+    int32_t max_in_flight_;
+    std::shared_ptr<FlushMemoryBudget> memory_budget_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    // tasks with the memory they hold in the budget
+    std::deque<std::pair<std::function<Status()>, int64_t>> pending_tasks_;
+    // number of pending tasks plus the running one
+    int32_t in_flight_ = 0;
+    bool draining_ = false;
+    Status status_;
+};
+
+}  // namespace paimon
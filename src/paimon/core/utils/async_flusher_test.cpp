@@ -0,0 +1,165 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/utils/async_flusher.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "paimon/executor.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+TEST(AsyncFlusherTest, TestRunInOrder) {
+    std::shared_ptr<Executor> executor = CreateDefaultExecutor(4);
+    AsyncFlusher flusher(executor, /*max_in_flight=*/2, /*memory_budget=*/nullptr);
+    std::vector<int32_t> flushed;
+    std::atomic<int32_t> running = 0;
+    std::atomic<int32_t> max_running = 0;
+    for (int32_t i = 0; i < 20; i++) {
+        ASSERT_OK(flusher.Submit(
+            [&, i]() -> Status {
+                max_running = std::max(max_running.load(), ++running);
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                flushed.push_back(i);
+                running--;
+                return Status::OK();
+            },
+            /*memory_in_bytes=*/1));
+    }
+    ASSERT_OK(flusher.WaitAll());
+    ASSERT_EQ(20, flushed.size());
+    for (int32_t i = 0; i < 20; i++) {
+        ASSERT_EQ(i, flushed[i]);
+    }
+    ASSERT_EQ(1, max_running.load());
+}
+
+TEST(AsyncFlusherTest, TestBackPressure) {
+    std::shared_ptr<Executor> executor = CreateDefaultExecutor(1);
+    AsyncFlusher flusher(executor, /*max_in_flight=*/2, /*memory_budget=*/nullptr);
+    std::atomic<bool> release = false;
+    std::atomic<int32_t> finished = 0;
+    auto task = [&]() -> Status {
+        while (!release) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        finished++;
+        return Status::OK();
+    };
+    ASSERT_OK(flusher.Submit(task, /*memory_in_bytes=*/1));
+    ASSERT_OK(flusher.Submit(task, /*memory_in_bytes=*/1));
+    std::atomic<bool> submitted = false;
+    std::thread writer([&]() {
+        ASSERT_OK(flusher.Submit(task, /*memory_in_bytes=*/1));
+        submitted = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    // the third task waits for a slot
+    ASSERT_FALSE(submitted);
+    release = true;
+    writer.join();
+    ASSERT_TRUE(submitted);
+    ASSERT_OK(flusher.WaitAll());
+    ASSERT_EQ(3, finished.load());
+}
+
+TEST(AsyncFlusherTest, TestError) {
+    std::shared_ptr<Executor> executor = CreateDefaultExecutor(2);
+    AsyncFlusher flusher(executor, /*max_in_flight=*/3, /*memory_budget=*/nullptr);
+    std::atomic<int32_t> finished = 0;
+    ASSERT_OK(flusher.Submit([]() -> Status { return Status::IOError("flush failed"); },
+                             /*memory_in_bytes=*/1));
+    ASSERT_NOK_WITH_MSG(flusher.WaitAll(), "flush failed");
+    auto task = [&]() -> Status {
+        finished++;
+        return Status::OK();
+    };
+    ASSERT_NOK_WITH_MSG(flusher.Submit(task, /*memory_in_bytes=*/1), "flush failed");
+    ASSERT_NOK_WITH_MSG(flusher.WaitAll(), "flush failed");
+    ASSERT_EQ(0, finished.load());
+}
+
+TEST(AsyncFlusherTest, TestMemoryBudget) {
+    std::shared_ptr<Executor> executor = CreateDefaultExecutor(2);
+    auto budget = std::make_shared<FlushMemoryBudget>(/*max_memory_in_bytes=*/100);
+    // the flushers of two writers share the budget
+    AsyncFlusher flusher1(executor, /*max_in_flight=*/3, budget);
+    AsyncFlusher flusher2(executor, /*max_in_flight=*/3, budget);
+    std::atomic<bool> release = false;
+    std::atomic<int32_t> finished = 0;
+    auto task = [&]() -> Status {
+        while (!release) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        finished++;
+        return Status::OK();
+    };
+    ASSERT_OK(flusher1.Submit(task, /*memory_in_bytes=*/60));
+    ASSERT_OK(flusher2.Submit(task, /*memory_in_bytes=*/40));
+    ASSERT_EQ(100, budget->GetUsedMemory());
+    std::atomic<bool> submitted = false;
+    std::thread writer([&]() {
+        ASSERT_OK(flusher2.Submit(task, /*memory_in_bytes=*/10));
+        submitted = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    // the third buffer waits for the memory of the other writer's buffer, although its own
+    // flusher has free slots
+    ASSERT_FALSE(submitted);
+    release = true;
+    writer.join();
+    ASSERT_TRUE(submitted);
+    ASSERT_OK(flusher1.WaitAll());
+    ASSERT_OK(flusher2.WaitAll());
+    ASSERT_EQ(3, finished.load());
+    ASSERT_EQ(0, budget->GetUsedMemory());
+
+    // a buffer larger than the whole budget is admitted when nothing else is in flight
+    ASSERT_OK(flusher1.Submit([]() -> Status { return Status::OK(); }, /*memory_in_bytes=*/500));
+    ASSERT_OK(flusher1.WaitAll());
+    ASSERT_EQ(0, budget->GetUsedMemory());
+}
+
+TEST(AsyncFlusherTest, TestMemoryBudgetReleasedOnError) {
+    std::shared_ptr<Executor> executor = CreateDefaultExecutor(1);
+    auto budget = std::make_shared<FlushMemoryBudget>(/*max_memory_in_bytes=*/100);
+    AsyncFlusher flusher(executor, /*max_in_flight=*/3, budget);
+    std::atomic<bool> release = false;
+    ASSERT_OK(flusher.Submit(
+        [&]() -> Status {
+            while (!release) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            return Status::IOError("flush failed");
+        },
+        /*memory_in_bytes=*/50));
+    // dropped after the failure
+    ASSERT_OK(flusher.Submit([]() -> Status { return Status::OK(); }, /*memory_in_bytes=*/50));
+    release = true;
+    ASSERT_NOK_WITH_MSG(flusher.WaitAll(), "flush failed");
+    ASSERT_EQ(0, budget->GetUsedMemory());
+    ASSERT_NOK_WITH_MSG(
+        flusher.Submit([]() -> Status { return Status::OK(); }, /*memory_in_bytes=*/50),
+        "flush failed");
+    ASSERT_EQ(0, budget->GetUsedMemory());
+}
+
+}  // namespace paimon::test
@@ -109,6 +109,11 @@ class FileStorePathFactory : public std::enable_shared_from_this<FileStorePathFa
             ManifestPath(root_),
             "index-manifest-" + uuid_ + "-" + std::to_string(index_manifest_count_.fetch_add(1)));
     }
+    std::string NewPartitionStatisticsFile() const {
+        return PathUtil::JoinPath(ManifestPath(root_),
+                                  "partition-stats-" + uuid_ + "-" +
+                                      std::to_string(partition_statistics_count_.fetch_add(1)));
+    }
     std::string NewIndexFile() const {
         return PathUtil::JoinPath(IndexPath(root_),
                                   IndexPathFactory::INDEX_PREFIX + uuid_ + "-" +
@@ -154,6 +159,7 @@ class FileStorePathFactory : public std::enable_shared_from_this<FileStorePathFa
     mutable std::atomic<int32_t> manifest_file_count_ = 0;
     mutable std::atomic<int32_t> manifest_list_count_ = 0;
     mutable std::atomic<int32_t> index_manifest_count_ = 0;
+    mutable std::atomic<int32_t> partition_statistics_count_ = 0;
     std::shared_ptr<std::atomic<int32_t>> index_file_count_ =
         std::make_shared<std::atomic<int32_t>>(0);
     mutable std::atomic<int32_t> stats_file_count_ = 0;
@@ -173,6 +173,11 @@ TEST_F(FileStorePathFactoryTest, TestIndexManifestAndStatsPaths) {
         ASSERT_EQ(manifest_path,
                   dir->Str() + "/manifest/index-manifest-" + uuid + "-" + std::to_string(i));
     }
+    for (int32_t i = 0; i < 20; i++) {
+        std::string partition_statistics_path = path_factory->NewPartitionStatisticsFile();
+        ASSERT_EQ(partition_statistics_path,
+                  dir->Str() + "/manifest/partition-stats-" + uuid + "-" + std::to_string(i));
+    }
     for (int32_t i = 0; i < 20; i++) {
         std::string stats_file_path = path_factory->NewStatsFile();
         ASSERT_EQ(stats_file_path,
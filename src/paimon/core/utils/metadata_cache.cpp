@@ -0,0 +1,148 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/utils/metadata_cache.h"
+
+#include <utility>
+
+#include "paimon/core/schema/table_schema.h"
+#include "paimon/core/snapshot.h"
+
+namespace paimon {
+
+MetadataCache::MetadataCache(int64_t max_entries) : max_entries_(max_entries) {}
+
+MetadataCache* MetadataCache::Global() {
+    static MetadataCache cache(DEFAULT_MAX_ENTRIES);
+    return &cache;
+}
+
+std::shared_ptr<const Snapshot> MetadataCache::GetSnapshot(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry* entry = Find(path);
+    return entry == nullptr ? nullptr : entry->snapshot;
+}
+
+void MetadataCache::PutSnapshot(const std::string& path,
+                                const std::shared_ptr<const Snapshot>& snapshot) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Put(path, Entry{snapshot, nullptr, {}});
+}
+
+std::shared_ptr<TableSchema> MetadataCache::GetSchema(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry* entry = Find(path);
+    return entry == nullptr ? nullptr : entry->schema;
+}
+
+void MetadataCache::PutSchema(const std::string& path, const std::shared_ptr<TableSchema>& schema) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Put(path, Entry{nullptr, schema, {}});
+}
+
+std::optional<int64_t> MetadataCache::GetHint(const std::string& path, int64_t ttl_ms) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = hints_.find(path);
+    if (iter == hints_.end() ||
+        Clock::now() - iter->second.load_time >= std::chrono::milliseconds(ttl_ms)) {
+        miss_count_++;
+        return std::nullopt;
+    }
+    hit_count_++;
+    return iter->second.id;
+}
+
+void MetadataCache::PutHint(const std::string& path, int64_t id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    hints_[path] = Hint{id, Clock::now()};
+}
+
+void MetadataCache::Invalidate(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = entries_.find(path);
+    if (iter != entries_.end()) {
+        lru_list_.erase(iter->second.lru_iter);
+        entries_.erase(iter);
+    }
+    hints_.erase(path);
+}
+
+void MetadataCache::InvalidatePrefix(const std::string& prefix) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // the paths with the prefix are continuous in the sorted maps
+    auto iter = entries_.lower_bound(prefix);
+    while (iter != entries_.end() && iter->first.compare(0, prefix.size(), prefix) == 0) {
+        lru_list_.erase(iter->second.lru_iter);
+        iter = entries_.erase(iter);
+    }
+    auto hint_iter = hints_.lower_bound(prefix);
+    while (hint_iter != hints_.end() &&
+           hint_iter->first.compare(0, prefix.size(), prefix) == 0) {
+        hint_iter = hints_.erase(hint_iter);
+    }
+}
+
+void MetadataCache::Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    lru_list_.clear();
+    hints_.clear();
+    hit_count_ = 0;
+    miss_count_ = 0;
+}
+
+size_t MetadataCache::Size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+uint64_t MetadataCache::HitCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hit_count_;
+}
+
+uint64_t MetadataCache::MissCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return miss_count_;
+}
+
+MetadataCache::Entry* MetadataCache::Find(const std::string& path) {
+    auto iter = entries_.find(path);
+    if (iter == entries_.end()) {
+        miss_count_++;
+        return nullptr;
+    }
+    hit_count_++;
+    lru_list_.splice(lru_list_.begin(), lru_list_, iter->second.lru_iter);
+    return &iter->second;
+}
+
+void MetadataCache::Put(const std::string& path, Entry&& entry) {
+    auto iter = entries_.find(path);
+    if (iter != entries_.end()) {
+        lru_list_.erase(iter->second.lru_iter);
+        entries_.erase(iter);
+    }
+    lru_list_.push_front(path);
+    entry.lru_iter = lru_list_.begin();
+    entries_.emplace(path, std::move(entry));
+    while (static_cast<int64_t>(entries_.size()) > max_entries_ && !lru_list_.empty()) {
+        entries_.erase(lru_list_.back());
+        lru_list_.pop_back();
+    }
+}
+
+}  // namespace paimon
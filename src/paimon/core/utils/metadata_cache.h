@@ -0,0 +1,104 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+namespace paimon {
+class Snapshot;
+class TableSchema;
+
+/// A thread safe cache of table metadata shared by the snapshot and schema managers.
+///
+/// Snapshots and schemas are immutable once written, so they are cached as parsed objects keyed by
+/// their file path, and the least recently used ones are evicted once there are more than max
+/// entries. The latest and earliest ids are not immutable, they are cached by the path of their
+/// hint file and only trusted within a ttl given by the reader, after which the reader refreshes
+/// them from the hint files. Writers invalidate the cached ids once they find them stale.
+class MetadataCache {
+ public:
+    static constexpr int64_t DEFAULT_MAX_ENTRIES = 1000;
+
+    explicit MetadataCache(int64_t max_entries);
+
+    // No copying allowed
+    MetadataCache(const MetadataCache&) = delete;
+    void operator=(const MetadataCache&) = delete;
+
+    /// @return A process wide metadata cache.
+    static MetadataCache* Global();
+
+    /// @return The cached snapshot, or nullptr if it is not cached.
+    std::shared_ptr<const Snapshot> GetSnapshot(const std::string& path);
+    void PutSnapshot(const std::string& path, const std::shared_ptr<const Snapshot>& snapshot);
+
+    /// @return The cached schema, or nullptr if it is not cached.
+    std::shared_ptr<TableSchema> GetSchema(const std::string& path);
+    void PutSchema(const std::string& path, const std::shared_ptr<TableSchema>& schema);
+
+    /// @return The cached id of the hint, or nullopt if it is not cached or it is cached for more
+    /// than `ttl_ms`.
+    std::optional<int64_t> GetHint(const std::string& path, int64_t ttl_ms);
+    void PutHint(const std::string& path, int64_t id);
+
+    /// Removes the cached snapshot, schema or hint of the path.
+    void Invalidate(const std::string& path);
+    /// Removes all cached entries whose path starts with the prefix, e.g. a table or a branch.
+    void InvalidatePrefix(const std::string& prefix);
+    /// Removes all entries and resets the hit and miss counts.
+    void Clear();
+
+    /// @return The number of cached snapshots and schemas.
+    size_t Size() const;
+    uint64_t HitCount() const;
+    uint64_t MissCount() const;
+
+ private:
+    using Clock = std::chrono::steady_clock;
+    using LruList = std::list<std::string>;
+    struct Entry {
+        std::shared_ptr<const Snapshot> snapshot;
+        std::shared_ptr<TableSchema> schema;
+        LruList::iterator lru_iter;
+    };
+    struct Hint {
+        int64_t id;
+        Clock::time_point load_time;
+    };
+
+    /// @return The entry of the path marked as the most recently used, or nullptr if not found.
+    Entry* Find(const std::string& path);
+    void Put(const std::string& path, Entry&& entry);
+
+    int64_t max_entries_;
+    mutable std::mutex mutex_;
+    // the most recently used entry is at the front
+    LruList lru_list_;
+    std::map<std::string, Entry> entries_;
+    std::map<std::string, Hint> hints_;
+    uint64_t hit_count_ = 0;
+    uint64_t miss_count_ = 0;
+};
+
+}  // namespace paimon
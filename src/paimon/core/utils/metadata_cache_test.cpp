@@ -0,0 +1,121 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/utils/metadata_cache.h"
+
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "paimon/core/schema/schema_manager.h"
+#include "paimon/core/schema/table_schema.h"
+#include "paimon/core/snapshot.h"
+#include "paimon/fs/local/local_file_system.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+class MetadataCacheTest : public ::testing::Test {
+ public:
+    void SetUp() override {
+        table_path_ = paimon::test::GetDataDir() + "/orc/append_09.db/append_09";
+        fs_ = std::make_shared<LocalFileSystem>();
+    }
+
+    std::shared_ptr<const Snapshot> LoadSnapshot(int64_t snapshot_id) const {
+        auto snapshot = Snapshot::FromPath(
+            fs_, table_path_ + "/snapshot/snapshot-" + std::to_string(snapshot_id));
+        EXPECT_TRUE(snapshot.ok());
+        return std::make_shared<const Snapshot>(snapshot.value());
+    }
+
+ protected:
+    std::string table_path_;
+    std::shared_ptr<FileSystem> fs_;
+};
+
+TEST_F(MetadataCacheTest, TestSnapshotAndSchema) {
+    MetadataCache cache(/*max_entries=*/2);
+    ASSERT_FALSE(cache.GetSnapshot("/t/snapshot/snapshot-1"));
+    cache.PutSnapshot("/t/snapshot/snapshot-1", LoadSnapshot(1));
+    auto snapshot = cache.GetSnapshot("/t/snapshot/snapshot-1");
+    ASSERT_TRUE(snapshot);
+    ASSERT_EQ(1, snapshot->Id());
+    ASSERT_EQ(1, cache.HitCount());
+    ASSERT_EQ(1, cache.MissCount());
+
+    SchemaManager schema_manager(fs_, table_path_);
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<TableSchema> schema, schema_manager.ReadSchema(0));
+    cache.PutSchema("/t/schema/schema-0", schema);
+    ASSERT_EQ(schema, cache.GetSchema("/t/schema/schema-0"));
+    // a path is either a snapshot or a schema
+    ASSERT_FALSE(cache.GetSnapshot("/t/schema/schema-0"));
+
+    // schema-0 is the most recently used entry, snapshot-1 is evicted
+    cache.PutSnapshot("/t/snapshot/snapshot-2", LoadSnapshot(2));
+    ASSERT_EQ(2, cache.Size());
+    ASSERT_FALSE(cache.GetSnapshot("/t/snapshot/snapshot-1"));
+    ASSERT_TRUE(cache.GetSnapshot("/t/snapshot/snapshot-2"));
+    ASSERT_TRUE(cache.GetSchema("/t/schema/schema-0"));
+
+    cache.Invalidate("/t/snapshot/snapshot-2");
+    ASSERT_FALSE(cache.GetSnapshot("/t/snapshot/snapshot-2"));
+    ASSERT_EQ(1, cache.Size());
+
+    cache.Clear();
+    ASSERT_EQ(0, cache.Size());
+    ASSERT_EQ(0, cache.HitCount());
+    ASSERT_EQ(0, cache.MissCount());
+}
+
+TEST_F(MetadataCacheTest, TestHint) {
+    MetadataCache cache(MetadataCache::DEFAULT_MAX_ENTRIES);
+    ASSERT_EQ(std::nullopt, cache.GetHint("/t/snapshot/LATEST", /*ttl_ms=*/60 * 1000));
+    cache.PutHint("/t/snapshot/LATEST", 5);
+    ASSERT_EQ(5, cache.GetHint("/t/snapshot/LATEST", /*ttl_ms=*/60 * 1000));
+    // an expired hint is refreshed by the reader
+    ASSERT_EQ(std::nullopt, cache.GetHint("/t/snapshot/LATEST", /*ttl_ms=*/0));
+    cache.PutHint("/t/snapshot/LATEST", 6);
+    ASSERT_EQ(6, cache.GetHint("/t/snapshot/LATEST", /*ttl_ms=*/60 * 1000));
+    // hints are not counted as cached snapshots or schemas
+    ASSERT_EQ(0, cache.Size());
+
+    cache.Invalidate("/t/snapshot/LATEST");
+    ASSERT_EQ(std::nullopt, cache.GetHint("/t/snapshot/LATEST", /*ttl_ms=*/60 * 1000));
+}
+
+TEST_F(MetadataCacheTest, TestInvalidatePrefix) {
+    MetadataCache cache(MetadataCache::DEFAULT_MAX_ENTRIES);
+    cache.PutSnapshot("/t1/snapshot/snapshot-1", LoadSnapshot(1));
+    cache.PutSnapshot("/t1/snapshot/snapshot-2", LoadSnapshot(2));
+    cache.PutHint("/t1/snapshot/LATEST", 2);
+    cache.PutSnapshot("/t10/snapshot/snapshot-1", LoadSnapshot(1));
+    cache.PutHint("/t10/snapshot/LATEST", 1);
+
+    cache.InvalidatePrefix("/t1/");
+    ASSERT_EQ(1, cache.Size());
+    ASSERT_FALSE(cache.GetSnapshot("/t1/snapshot/snapshot-1"));
+    ASSERT_FALSE(cache.GetSnapshot("/t1/snapshot/snapshot-2"));
+    ASSERT_EQ(std::nullopt, cache.GetHint("/t1/snapshot/LATEST", /*ttl_ms=*/60 * 1000));
+    ASSERT_TRUE(cache.GetSnapshot("/t10/snapshot/snapshot-1"));
+    ASSERT_EQ(1, cache.GetHint("/t10/snapshot/LATEST", /*ttl_ms=*/60 * 1000));
+}
+
+TEST_F(MetadataCacheTest, TestGlobal) {
+    ASSERT_EQ(MetadataCache::Global(), MetadataCache::Global());
+}
+
+}  // namespace paimon::test
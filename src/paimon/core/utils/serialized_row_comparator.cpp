@@ -0,0 +1,197 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/utils/serialized_row_comparator.h"
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+#include "arrow/util/checked_cast.h"
+#include "fmt/format.h"
+#include "paimon/common/data/binary_row.h"
+#include "paimon/common/data/binary_section.h"
+#include "paimon/common/utils/date_time_utils.h"
+#include "paimon/data/decimal.h"
+#include "paimon/data/timestamp.h"
+#include "paimon/io/byte_order.h"
+#include "paimon/status.h"
+
+namespace paimon {
+namespace {
+template <typename T>
+T ReadValue(const char* data) {
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+template <typename T>
+int32_t CompareValues(const T& lhs, const T& rhs) {
+    return lhs == rhs ? 0 : (lhs < rhs ? -1 : 1);
+}
+
+bool IsNullAt(const char* row, int32_t pos) {
+    int32_t index = pos + BinaryRow::HEADER_SIZE_IN_BITS;
+    return (row[index >> 3] & (1 << (index & 7))) != 0;
+}
+
+/// @return The bytes of a string or binary field, which are in the fixed length part if they are
+/// not longer than 7 bytes, see `BinarySection::MAX_FIX_PART_DATA_SIZE`.
+std::string_view ReadBytes(const char* row, int32_t field_offset) {
+    auto offset_and_len = ReadValue<int64_t>(row + field_offset);
+    if ((offset_and_len & BinarySection::HIGHEST_FIRST_BIT) == 0) {
+        auto sub_offset = static_cast<int32_t>(offset_and_len >> 32);
+        auto len = static_cast<int32_t>(offset_and_len);
+        return std::string_view(row + sub_offset, len);
+    }
+    auto len = static_cast<int32_t>(
+        (offset_and_len & BinarySection::HIGHEST_SECOND_TO_EIGHTH_BIT) >> 56);
+    if (SystemByteOrder() == ByteOrder::PAIMON_LITTLE_ENDIAN) {
+        return std::string_view(row + field_offset, len);
+    }
+    // field_offset + 1 to skip header.
+    return std::string_view(row + field_offset + 1, len);
+}
+
+/// @return The unscaled value of a non-compact decimal, which is stored as big-endian two's
+/// complement bytes in the variable length part.
+Decimal::int128_t ReadUnscaledDecimal(const char* row, int32_t field_offset) {
+    auto offset_and_size = ReadValue<int64_t>(row + field_offset);
+    auto sub_offset = static_cast<int32_t>(offset_and_size >> 32);
+    auto size = static_cast<int32_t>(offset_and_size);
+    const auto* bytes = reinterpret_cast<const uint8_t*>(row + sub_offset);
+    Decimal::uint128_t value = (size > 0 && (bytes[0] & 0x80) != 0) ? ~Decimal::uint128_t(0) : 0;
+    for (int32_t i = 0; i < size; i++) {
+        value = (value << 8) | bytes[i];
+    }
+    return static_cast<Decimal::int128_t>(value);
+}
+
+template <typename T>
+std::function<int32_t(const char*, const char*, int32_t)> ComparePrimitive() {
+    return [](const char* lhs, const char* rhs, int32_t field_offset) -> int32_t {
+        return CompareValues(ReadValue<T>(lhs + field_offset), ReadValue<T>(rhs + field_offset));
+    };
+}
+}  // namespace
+
+Result<std::unique_ptr<SerializedRowComparator>> SerializedRowComparator::Create(
+    const std::vector<DataField>& input_data_field) {
+    std::vector<FieldComparatorFunc> comparators;
+    comparators.reserve(input_data_field.size());
+    for (size_t i = 0; i < input_data_field.size(); i++) {
+        PAIMON_ASSIGN_OR_RAISE(
+            FieldComparatorFunc cmp,
+            CompareField(static_cast<int32_t>(i), input_data_field[i].Type()));
+        comparators.push_back(std::move(cmp));
+    }
+    int32_t null_bits_size_in_bytes =
+        BinaryRow::CalculateBitSetWidthInBytes(static_cast<int32_t>(input_data_field.size()));
+    return std::unique_ptr<SerializedRowComparator>(
+        new SerializedRowComparator(null_bits_size_in_bytes, std::move(comparators)));
+}
+
+int32_t SerializedRowComparator::CompareTo(std::string_view lhs, std::string_view rhs) const {
+    const char* lhs_row = lhs.data();
+    const char* rhs_row = rhs.data();
+    for (size_t i = 0; i < comparators_.size(); i++) {
+        auto pos = static_cast<int32_t>(i);
+        bool lhs_null = IsNullAt(lhs_row, pos);
+        bool rhs_null = IsNullAt(rhs_row, pos);
+        // null is first, the same as FieldsComparator
+        if (lhs_null && rhs_null) {
+            continue;
+        } else if (lhs_null) {
+            return -1;
+        } else if (rhs_null) {
+            return 1;
+        }
+        int32_t comp = comparators_[i](lhs_row, rhs_row, null_bits_size_in_bytes_ + pos * 8);
+        if (comp != 0) {
+            return comp;
+        }
+    }
+    return 0;
+}
+
+Result<SerializedRowComparator::FieldComparatorFunc> SerializedRowComparator::CompareField(
+    int32_t field_idx, const std::shared_ptr<arrow::DataType>& input_type) {
+    switch (input_type->id()) {
+        case arrow::Type::type::BOOL:
+            return ComparePrimitive<bool>();
+        case arrow::Type::type::INT8:
+            return ComparePrimitive<int8_t>();
+        case arrow::Type::type::INT16:
+            return ComparePrimitive<int16_t>();
+        case arrow::Type::type::DATE32:
+        case arrow::Type::type::INT32:
+            return ComparePrimitive<int32_t>();
+        case arrow::Type::type::INT64:
+            return ComparePrimitive<int64_t>();
+        case arrow::Type::type::FLOAT:
+            return ComparePrimitive<float>();
+        case arrow::Type::type::DOUBLE:
+            return ComparePrimitive<double>();
+        case arrow::Type::type::STRING:
+        case arrow::Type::type::BINARY:
+            return FieldComparatorFunc(
+                [](const char* lhs, const char* rhs, int32_t field_offset) -> int32_t {
+                    int32_t cmp =
+                        ReadBytes(lhs, field_offset).compare(ReadBytes(rhs, field_offset));
+                    return cmp == 0 ? 0 : (cmp > 0 ? 1 : -1);
+                });
+        case arrow::Type::type::TIMESTAMP: {
+            auto timestamp_type =
+                arrow::internal::checked_pointer_cast<arrow::TimestampType>(input_type);
+            int32_t precision = DateTimeUtils::GetPrecisionFromType(timestamp_type);
+            if (Timestamp::IsCompact(precision)) {
+                return ComparePrimitive<int64_t>();
+            }
+            return FieldComparatorFunc(
+                [](const char* lhs, const char* rhs, int32_t field_offset) -> int32_t {
+                    auto lhs_offset_and_nanos = ReadValue<int64_t>(lhs + field_offset);
+                    auto rhs_offset_and_nanos = ReadValue<int64_t>(rhs + field_offset);
+                    int32_t cmp = CompareValues(
+                        ReadValue<int64_t>(lhs + (lhs_offset_and_nanos >> 32)),
+                        ReadValue<int64_t>(rhs + (rhs_offset_and_nanos >> 32)));
+                    if (cmp != 0) {
+                        return cmp;
+                    }
+                    return CompareValues(static_cast<int32_t>(lhs_offset_and_nanos),
+                                         static_cast<int32_t>(rhs_offset_and_nanos));
+                });
+        }
+        case arrow::Type::type::DECIMAL: {
+            auto* decimal_type =
+                arrow::internal::checked_cast<arrow::Decimal128Type*>(input_type.get());
+            if (Decimal::IsCompact(decimal_type->precision())) {
+                return ComparePrimitive<int64_t>();
+            }
+            // both decimals have the same scale, so their unscaled values are compared
+            return FieldComparatorFunc(
+                [](const char* lhs, const char* rhs, int32_t field_offset) -> int32_t {
+                    return CompareValues(ReadUnscaledDecimal(lhs, field_offset),
+                                         ReadUnscaledDecimal(rhs, field_offset));
+                });
+        }
+        default:
+            return Status::NotImplemented(fmt::format("Do not support comparing {} type in idx {}",
+                                                      input_type->ToString(), field_idx));
+    }
+}
+
+}  // namespace paimon
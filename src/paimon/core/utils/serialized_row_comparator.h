@@ -0,0 +1,58 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "arrow/api.h"
+#include "paimon/common/types/data_field.h"
+#include "paimon/result.h"
+
+namespace paimon {
+
+/// Compares rows serialized as the bytes of single segment `BinaryRow`s in the same order as an
+/// ascending `FieldsComparator` of all the fields, but reads the fields from the bytes in place
+/// instead of copying the bytes into a `BinaryRow` on each comparison.
+class SerializedRowComparator {
+ public:
+    static Result<std::unique_ptr<SerializedRowComparator>> Create(
+        const std::vector<DataField>& input_data_field);
+
+    int32_t CompareTo(std::string_view lhs, std::string_view rhs) const;
+
+ private:
+    /// Compares the fields of two rows, whose fixed length parts are at `field_offset`.
+    using FieldComparatorFunc =
+        std::function<int32_t(const char* lhs, const char* rhs, int32_t field_offset)>;
+
+    SerializedRowComparator(int32_t null_bits_size_in_bytes,
+                            std::vector<FieldComparatorFunc>&& comparators)
+        : null_bits_size_in_bytes_(null_bits_size_in_bytes), comparators_(std::move(comparators)) {}
+
+    static Result<FieldComparatorFunc> CompareField(
+        int32_t field_idx, const std::shared_ptr<arrow::DataType>& input_type);
+
+ private:
+    int32_t null_bits_size_in_bytes_;
+    std::vector<FieldComparatorFunc> comparators_;
+};
+}  // namespace paimon
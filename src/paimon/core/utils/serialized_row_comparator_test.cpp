@@ -0,0 +1,141 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/utils/serialized_row_comparator.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "arrow/api.h"
+#include "gtest/gtest.h"
+#include "paimon/common/data/binary_row.h"
+#include "paimon/common/data/data_define.h"
+#include "paimon/common/types/data_field.h"
+#include "paimon/common/utils/decimal_utils.h"
+#include "paimon/core/utils/fields_comparator.h"
+#include "paimon/data/decimal.h"
+#include "paimon/data/timestamp.h"
+#include "paimon/memory/bytes.h"
+#include "paimon/memory/memory_pool.h"
+#include "paimon/testing/utils/binary_row_generator.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+class SerializedRowComparatorTest : public ::testing::Test {
+ public:
+    static std::string_view Serialize(const BinaryRow& row) {
+        const MemorySegment& segment = row.GetSegments()[0];
+        return std::string_view(segment.GetArray()->data() + row.GetOffset(),
+                                row.GetSizeInBytes());
+    }
+
+    /// Checks that the serialized rows are compared the same as the rows by FieldsComparator.
+    void CheckSameOrder(const std::vector<BinaryRow>& rows,
+                        const std::vector<std::shared_ptr<arrow::DataType>>& input_types) const {
+        std::vector<DataField> data_fields;
+        for (const auto& type : input_types) {
+            data_fields.emplace_back(/*id=*/0, arrow::field("fake_name", type));
+        }
+        ASSERT_OK_AND_ASSIGN(auto expected_comparator,
+                             FieldsComparator::Create(data_fields, /*is_ascending_order=*/true,
+                                                      /*use_view=*/false));
+        ASSERT_OK_AND_ASSIGN(auto comparator, SerializedRowComparator::Create(data_fields));
+        int32_t non_zero_count = 0;
+        for (size_t i = 0; i < rows.size(); i++) {
+            for (size_t j = 0; j < rows.size(); j++) {
+                int32_t expected = expected_comparator->CompareTo(rows[i], rows[j]);
+                ASSERT_EQ(expected, comparator->CompareTo(Serialize(rows[i]), Serialize(rows[j])))
+                    << "i: " << i << ", j: " << j;
+                non_zero_count += (expected != 0);
+            }
+        }
+        ASSERT_GT(non_zero_count, 0);
+    }
+
+ protected:
+    std::shared_ptr<MemoryPool> pool_ = GetDefaultPool();
+};
+
+TEST_F(SerializedRowComparatorTest, TestPrimitiveTypes) {
+    std::vector<BinaryRow> rows;
+    for (bool b : {false, true}) {
+        for (int32_t i : {-100000, 0, 7, 100000}) {
+            rows.push_back(BinaryRowGenerator::GenerateRow(
+                {b, static_cast<int8_t>(i % 100), static_cast<int16_t>(-i % 1000), i,
+                 static_cast<int64_t>(i) * 1000000, static_cast<float>(i) / 3,
+                 static_cast<double>(-i) / 7},
+                pool_.get()));
+        }
+    }
+    rows.push_back(BinaryRowGenerator::GenerateRow(
+        {NullType(), static_cast<int8_t>(1), NullType(), 1, static_cast<int64_t>(1), NullType(),
+         1.0},
+        pool_.get()));
+    rows.push_back(BinaryRowGenerator::GenerateRow(
+        {true, NullType(), static_cast<int16_t>(1), NullType(), static_cast<int64_t>(1),
+         static_cast<float>(1), NullType()},
+        pool_.get()));
+    CheckSameOrder(rows, {arrow::boolean(), arrow::int8(), arrow::int16(), arrow::int32(),
+                          arrow::int64(), arrow::float32(), arrow::float64()});
+}
+
+TEST_F(SerializedRowComparatorTest, TestVariableLengthTypes) {
+    std::vector<BinaryRow> rows;
+    // strings not longer than 7 bytes are stored in the fixed length part
+    for (const std::string& str : {"", "a", "abc", "abcdefg", "abcdefgh", "abd", "快乐每一天",
+                                   "abcdefghijklmnopqrst"}) {
+        for (const std::string& bin : {"\x01", "\xff\x01", "\xff\x01\x02\x03\x04\x05\x06\x07"}) {
+            rows.push_back(BinaryRowGenerator::GenerateRow(
+                {str, std::make_shared<Bytes>(bin, pool_.get())}, pool_.get()));
+        }
+    }
+    rows.push_back(BinaryRowGenerator::GenerateRow({NullType(), NullType()}, pool_.get()));
+    CheckSameOrder(rows, {arrow::utf8(), arrow::binary()});
+}
+
+TEST_F(SerializedRowComparatorTest, TestTimestampAndDecimal) {
+    std::vector<BinaryRow> rows;
+    for (int64_t millis : {-1000l, 0l, 1725875365442l}) {
+        for (int32_t nanos : {0, 120000, 999999}) {
+            // non-compact decimals are stored as big-endian two's complement bytes
+            for (const char* str : {"-12345678998765432145678", "-256", "-1", "0", "255", "256",
+                                    "12345678998765432145678"}) {
+                ASSERT_OK_AND_ASSIGN(Decimal::int128_t unscaled, DecimalUtils::StrToInt128(str));
+                rows.push_back(BinaryRowGenerator::GenerateRow(
+                    {TimestampType(Timestamp(millis, 0), 3),
+                     TimestampType(Timestamp(millis, nanos), 9),
+                     Decimal(10, 2, unscaled % 1000000), Decimal(38, 10, unscaled),
+                     static_cast<int32_t>(millis / 86400000)},
+                    pool_.get()));
+            }
+        }
+    }
+    CheckSameOrder(rows, {arrow::timestamp(arrow::TimeUnit::MILLI),
+                          arrow::timestamp(arrow::TimeUnit::NANO), arrow::decimal128(10, 2),
+                          arrow::decimal128(38, 10), arrow::date32()});
+}
+
+TEST_F(SerializedRowComparatorTest, TestUnsupportedType) {
+    std::vector<DataField> data_fields = {
+        DataField(/*id=*/0, arrow::field("f0", arrow::list(arrow::int32())))};
+    ASSERT_NOK_WITH_MSG(SerializedRowComparator::Create(data_fields),
+                        "Do not support comparing");
+}
+
+}  // namespace paimon::test
@@ -27,6 +27,7 @@
 #include "paimon/core/snapshot.h"
 #include "paimon/core/utils/branch_manager.h"
 #include "paimon/core/utils/file_utils.h"
+#include "paimon/core/utils/metadata_cache.h"
 #include "paimon/fs/file_system.h"
 #include "paimon/result.h"
 
@@ -42,6 +43,24 @@ SnapshotManager::SnapshotManager(const std::shared_ptr<FileSystem>& fs,
 
 SnapshotManager::~SnapshotManager() = default;
 
+void SnapshotManager::WithCache(MetadataCache* cache, int64_t hint_ttl_ms) {
+    cache_ = cache;
+    hint_ttl_ms_ = hint_ttl_ms;
+}
+
+void SnapshotManager::InvalidateCache() {
+    if (cache_) {
+        cache_->Invalidate(PathUtil::JoinPath(SnapshotDirectory(), LATEST));
+        cache_->Invalidate(PathUtil::JoinPath(SnapshotDirectory(), EARLIEST));
+    }
+}
+
+void SnapshotManager::InvalidateSnapshot(int64_t snapshot_id) {
+    if (cache_) {
+        cache_->Invalidate(SnapshotPath(snapshot_id));
+    }
+}
+
 const std::string& SnapshotManager::Branch() const {
     return branch_;
 }
@@ -68,7 +87,17 @@ Result<std::optional<Snapshot>> SnapshotManager::LatestSnapshotOfUser(const std:
 }
 
 Result<Snapshot> SnapshotManager::LoadSnapshot(int64_t snapshot_id) const {
-    return Snapshot::FromPath(fs_, SnapshotPath(snapshot_id));
+    std::string path = SnapshotPath(snapshot_id);
+    if (!cache_) {
+        return Snapshot::FromPath(fs_, path);
+    }
+    std::shared_ptr<const Snapshot> cached = cache_->GetSnapshot(path);
+    if (cached) {
+        return *cached;
+    }
+    PAIMON_ASSIGN_OR_RAISE(Snapshot snapshot, Snapshot::FromPath(fs_, path));
+    cache_->PutSnapshot(path, std::make_shared<const Snapshot>(snapshot));
+    return snapshot;
 }
 
 Result<std::optional<Snapshot>> SnapshotManager::LatestSnapshot() const {
@@ -82,15 +111,38 @@ Result<std::optional<Snapshot>> SnapshotManager::LatestSnapshot() const {
 }
 
 Result<std::optional<int64_t>> SnapshotManager::LatestSnapshotId() const {
-    return FindLatest(
-        SnapshotDirectory(), std::string(SNAPSHOT_PREFIX),
-        [this](int64_t snapshot_id) -> std::string { return SnapshotPath(snapshot_id); });
+    return FindWithCache(LATEST, [this]() {
+        return FindLatest(
+            SnapshotDirectory(), std::string(SNAPSHOT_PREFIX),
+            [this](int64_t snapshot_id) -> std::string { return SnapshotPath(snapshot_id); });
+    });
 }
 
 Result<std::optional<int64_t>> SnapshotManager::EarliestSnapshotId() const {
-    return FindEarliest(
-        SnapshotDirectory(), std::string(SNAPSHOT_PREFIX),
-        [this](int64_t snapshot_id) -> std::string { return SnapshotPath(snapshot_id); });
+    return FindWithCache(EARLIEST, [this]() {
+        return FindEarliest(
+            SnapshotDirectory(), std::string(SNAPSHOT_PREFIX),
+            [this](int64_t snapshot_id) -> std::string { return SnapshotPath(snapshot_id); });
+    });
+}
+
+Result<std::optional<int64_t>> SnapshotManager::FindWithCache(
+    const std::string& hint_file_name,
+    const std::function<Result<std::optional<int64_t>>()>& find_func) const {
+    if (!cache_) {
+        return find_func();
+    }
+    std::string hint_path = PathUtil::JoinPath(SnapshotDirectory(), hint_file_name);
+    std::optional<int64_t> cached = cache_->GetHint(hint_path, hint_ttl_ms_);
+    if (cached) {
+        return cached;
+    }
+    PAIMON_ASSIGN_OR_RAISE(std::optional<int64_t> snapshot_id, find_func());
+    // do not cache an empty table, the first commit may come from another process
+    if (snapshot_id) {
+        cache_->PutHint(hint_path, snapshot_id.value());
+    }
+    return snapshot_id;
 }
 
 std::string SnapshotManager::BranchPath() const {
@@ -215,6 +267,9 @@ Status SnapshotManager::CommitHint(int64_t snapshot_id, const std::string& file_
     while (loop_time-- > 0) {
         s = fs_->WriteFile(path, snapshot_id_str, /*overwrite=*/true);
         if (s.ok()) {
+            if (cache_) {
+                cache_->PutHint(path, snapshot_id);
+            }
             return s;
         } else {
             std::random_device rd;
@@ -32,6 +32,7 @@ namespace paimon {
 
 class Snapshot;
 class FileSystem;
+class MetadataCache;
 
 /// Manager for `Snapshot`, providing utility methods related to paths and snapshot hints.
 class SnapshotManager {
@@ -45,6 +46,16 @@ class SnapshotManager {
                     const std::string& branch);
     ~SnapshotManager();
 
+    /// Caches the parsed snapshots and the latest and earliest snapshot ids in `cache`. The
+    /// cached ids are trusted for `hint_ttl_ms`, after which they are refreshed from the hint
+    /// files.
+    void WithCache(MetadataCache* cache, int64_t hint_ttl_ms);
+    /// Drops the cached latest and earliest snapshot ids of the branch, writers call it once they
+    /// find the cached ids stale, e.g. when committing a snapshot which already exists.
+    void InvalidateCache();
+    /// Drops the cached snapshot, called after the snapshot file is deleted.
+    void InvalidateSnapshot(int64_t snapshot_id);
+
     const std::string& Branch() const;
     Result<std::optional<Snapshot>> LatestSnapshot() const;
     std::string SnapshotDirectory() const;
@@ -75,12 +86,17 @@ class SnapshotManager {
         const std::function<int64_t(int64_t, int64_t)> reducer_func, const std::string& dir,
         const std::string& prefix) const;
     std::optional<int64_t> ReadHint(const std::string& file_name, const std::string& dir) const;
+    Result<std::optional<int64_t>> FindWithCache(
+        const std::string& hint_file_name,
+        const std::function<Result<std::optional<int64_t>>()>& find_func) const;
     Status CommitHint(int64_t snapshot_id, const std::string& file_name, const std::string& dir);
 
  private:
     std::shared_ptr<FileSystem> fs_;
     std::string root_path_;
     std::string branch_;
+    MetadataCache* cache_ = nullptr;
+    int64_t hint_ttl_ms_ = 0;
 };
 
 }  // namespace paimon
@@ -23,6 +23,7 @@
 #include "paimon/common/utils/path_util.h"
 #include "paimon/core/snapshot.h"
 #include "paimon/core/utils/branch_manager.h"
+#include "paimon/core/utils/metadata_cache.h"
 #include "paimon/fs/local/local_file_system.h"
 #include "paimon/testing/utils/testharness.h"
 
@@ -151,4 +152,52 @@ TEST(SnapshotManagerTest, TestCommitLatestHint) {
     ASSERT_TRUE(exists);
 }
 
+TEST(SnapshotManagerTest, TestMetadataCache) {
+    std::string test_data_path = paimon::test::GetDataDir() + "/orc/append_09.db/append_09/";
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    std::string table_path = dir->Str();
+    ASSERT_TRUE(TestUtil::CopyDirectory(test_data_path, table_path));
+    auto file_system = std::make_shared<LocalFileSystem>();
+    MetadataCache cache(MetadataCache::DEFAULT_MAX_ENTRIES);
+    SnapshotManager mgr(file_system, table_path);
+    mgr.WithCache(&cache, /*hint_ttl_ms=*/60 * 1000);
+    ASSERT_OK_AND_ASSIGN(std::optional<int64_t> latest_id, mgr.LatestSnapshotId());
+    ASSERT_EQ(5, latest_id.value());
+    ASSERT_OK_AND_ASSIGN(std::optional<int64_t> earliest_id, mgr.EarliestSnapshotId());
+    ASSERT_EQ(1, earliest_id.value());
+
+    // another process commits snapshot 6, the cached latest id is used within the ttl
+    SnapshotManager other_mgr(file_system, table_path);
+    std::string content;
+    ASSERT_OK(file_system->ReadFile(mgr.SnapshotPath(5), &content));
+    ASSERT_OK(file_system->WriteFile(mgr.SnapshotPath(6), content, /*overwrite=*/false));
+    ASSERT_OK(other_mgr.CommitLatestHint(6));
+    ASSERT_OK_AND_ASSIGN(latest_id, mgr.LatestSnapshotId());
+    ASSERT_EQ(5, latest_id.value());
+    // a manager with zero ttl sharing the cache refreshes the latest id from the hint file
+    SnapshotManager no_ttl_mgr(file_system, table_path);
+    no_ttl_mgr.WithCache(&cache, /*hint_ttl_ms=*/0);
+    ASSERT_OK_AND_ASSIGN(latest_id, no_ttl_mgr.LatestSnapshotId());
+    ASSERT_EQ(6, latest_id.value());
+    mgr.InvalidateCache();
+    ASSERT_OK(other_mgr.CommitLatestHint(5));
+    ASSERT_OK_AND_ASSIGN(latest_id, mgr.LatestSnapshotId());
+    ASSERT_EQ(6, latest_id.value());
+    // committed hints are written through
+    ASSERT_OK(mgr.CommitLatestHint(7));
+    ASSERT_OK_AND_ASSIGN(latest_id, mgr.LatestSnapshotId());
+    ASSERT_EQ(7, latest_id.value());
+
+    // snapshots are cached as parsed objects
+    ASSERT_OK_AND_ASSIGN(Snapshot snapshot, mgr.LoadSnapshot(1));
+    uint64_t hit_count = cache.HitCount();
+    ASSERT_OK(file_system->Delete(mgr.SnapshotPath(1)));
+    ASSERT_OK_AND_ASSIGN(Snapshot cached_snapshot, mgr.LoadSnapshot(1));
+    ASSERT_EQ(snapshot, cached_snapshot);
+    ASSERT_EQ(hit_count + 1, cache.HitCount());
+    mgr.InvalidateSnapshot(1);
+    ASSERT_NOK(mgr.LoadSnapshot(1));
+}
+
 }  // namespace paimon::test
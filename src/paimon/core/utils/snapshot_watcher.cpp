@@ -0,0 +1,144 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/utils/snapshot_watcher.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "paimon/common/utils/path_util.h"
+#include "paimon/result.h"
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace paimon {
+
+SnapshotWatcher::SnapshotWatcher(const std::string& snapshot_dir, int64_t max_poll_interval_ms)
+    : max_poll_interval_ms_(std::max(max_poll_interval_ms, MIN_POLL_INTERVAL_MS)) {
+#ifdef __linux__
+    // only paths of local file system can be watched, local file's scheme may be 'file' or empty
+    Result<Path> path = PathUtil::ToPath(snapshot_dir);
+    if (path.ok() && (path.value().scheme.empty() || path.value().scheme == "file")) {
+        local_dir_ = path.value().path;
+        watchable_ = true;
+    }
+#endif
+}
+
+SnapshotWatcher::~SnapshotWatcher() {
+    CloseWatch();
+}
+
+void SnapshotWatcher::Wait(int64_t timeout_ms) {
+    if (timeout_ms <= 0) {
+        return;
+    }
+    if (TryWatch()) {
+        // files created before the watch was established are not notified, let the caller check
+        // the snapshot directory once more
+        return;
+    }
+    if (IsWatching()) {
+        // still bound the wait by the poll interval, in case any notification is lost
+        WaitForNotification(std::min(timeout_ms, max_poll_interval_ms_));
+        return;
+    }
+    std::this_thread::sleep_for(
+        std::chrono::milliseconds(std::min(timeout_ms, current_poll_interval_ms_)));
+    current_poll_interval_ms_ = std::min(current_poll_interval_ms_ * 2, max_poll_interval_ms_);
+}
+
+void SnapshotWatcher::Reset() {
+    current_poll_interval_ms_ = MIN_POLL_INTERVAL_MS;
+}
+
+bool SnapshotWatcher::IsWatching() const {
+    return watch_fd_ >= 0;
+}
+
+bool SnapshotWatcher::TryWatch() {
+#ifdef __linux__
+    if (!watchable_ || IsWatching()) {
+        return false;
+    }
+    if (notify_fd_ < 0) {
+        notify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (notify_fd_ < 0) {
+            // inotify is not available, e.g., the limit of instances is reached
+            watchable_ = false;
+            return false;
+        }
+    }
+    // snapshot files are either renamed into the directory or written in place, depending on
+    // whether the file system supports atomic rename
+    watch_fd_ = inotify_add_watch(
+        notify_fd_, local_dir_.c_str(),
+        IN_CREATE | IN_MOVED_TO | IN_CLOSE_WRITE | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR);
+    // the directory may not exist yet, retry in the next wait
+    return watch_fd_ >= 0;
+#else
+    return false;
+#endif
+}
+
+void SnapshotWatcher::WaitForNotification(int64_t timeout_ms) {
+#ifdef __linux__
+    struct pollfd poll_fd;
+    poll_fd.fd = notify_fd_;
+    poll_fd.events = POLLIN;
+    poll_fd.revents = 0;
+    int32_t ret = poll(&poll_fd, 1, static_cast<int>(timeout_ms));
+    if (ret <= 0 || !(poll_fd.revents & POLLIN)) {
+        // timeout or interrupted, the caller checks the snapshot directory anyway
+        return;
+    }
+    // drain all pending events, a single wake-up is enough for the caller
+    alignas(struct inotify_event) char buffer[4096];
+    while (true) {
+        ssize_t len = read(notify_fd_, buffer, sizeof(buffer));
+        if (len <= 0) {
+            break;
+        }
+        for (char* ptr = buffer; ptr < buffer + len;) {
+            const auto* event = reinterpret_cast<const struct inotify_event*>(ptr);
+            if (event->mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED)) {
+                // the watched directory is gone, watch again in the next wait
+                inotify_rm_watch(notify_fd_, watch_fd_);
+                watch_fd_ = -1;
+            }
+            ptr += sizeof(struct inotify_event) + event->len;
+        }
+    }
+#endif
+}
+
+void SnapshotWatcher::CloseWatch() {
+#ifdef __linux__
+    if (notify_fd_ >= 0) {
+        // closing the inotify instance removes all its watches
+        close(notify_fd_);
+    }
+#endif
+    notify_fd_ = -1;
+    watch_fd_ = -1;
+}
+
+}  // namespace paimon
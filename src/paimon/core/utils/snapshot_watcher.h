@@ -0,0 +1,70 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace paimon {
+
+/// Waits for changes of a snapshot directory, used by streaming scan to discover new snapshots.
+///
+/// For a local directory on Linux, the directory is watched by inotify so that a waiter is woken
+/// up as soon as a file is created in it. Otherwise, or if the directory cannot be watched (e.g.
+/// it does not exist yet), waiting falls back to sleeping with an adaptive backoff interval,
+/// which starts from `MIN_POLL_INTERVAL_MS` and doubles up to `max_poll_interval_ms` until
+/// `Reset()` is called. A wake-up does not guarantee that a new snapshot exists, callers must
+/// check the snapshot directory again.
+class SnapshotWatcher {
+ public:
+    static constexpr int64_t MIN_POLL_INTERVAL_MS = 100;
+
+    SnapshotWatcher(const std::string& snapshot_dir, int64_t max_poll_interval_ms);
+    ~SnapshotWatcher();
+
+    SnapshotWatcher(const SnapshotWatcher&) = delete;
+    SnapshotWatcher& operator=(const SnapshotWatcher&) = delete;
+
+    /// Blocks until the snapshot directory may have changed or `timeout_ms` elapses.
+    void Wait(int64_t timeout_ms);
+
+    /// Resets the backoff interval, called when new snapshots have been found.
+    void Reset();
+
+    /// Whether the snapshot directory is currently watched by file system notification.
+    bool IsWatching() const;
+
+    int64_t CurrentPollInterval() const {
+        return current_poll_interval_ms_;
+    }
+
+ private:
+    /// Try to watch the snapshot directory, return true if the watch is newly established.
+    bool TryWatch();
+    void WaitForNotification(int64_t timeout_ms);
+    void CloseWatch();
+
+ private:
+    std::string local_dir_;
+    bool watchable_ = false;
+    int64_t max_poll_interval_ms_;
+    int64_t current_poll_interval_ms_ = MIN_POLL_INTERVAL_MS;
+    int32_t notify_fd_ = -1;
+    int32_t watch_fd_ = -1;
+};
+
+}  // namespace paimon
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "paimon/core/utils/snapshot_watcher.h"
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "paimon/common/utils/path_util.h"
+#include "paimon/fs/file_system.h"
+#include "paimon/testing/utils/testharness.h"
+
+namespace paimon::test {
+
+TEST(SnapshotWatcherTest, TestPollingBackoff) {
+    SnapshotWatcher watcher("oss://bucket/warehouse/db.db/tbl/snapshot",
+                            /*max_poll_interval_ms=*/300);
+    ASSERT_EQ(SnapshotWatcher::MIN_POLL_INTERVAL_MS, watcher.CurrentPollInterval());
+    watcher.Wait(/*timeout_ms=*/1000);
+    ASSERT_FALSE(watcher.IsWatching());
+    ASSERT_EQ(200, watcher.CurrentPollInterval());
+    watcher.Wait(/*timeout_ms=*/1000);
+    ASSERT_EQ(300, watcher.CurrentPollInterval());
+    watcher.Wait(/*timeout_ms=*/0);
+    ASSERT_EQ(300, watcher.CurrentPollInterval());
+    watcher.Reset();
+    ASSERT_EQ(SnapshotWatcher::MIN_POLL_INTERVAL_MS, watcher.CurrentPollInterval());
+}
+
+TEST(SnapshotWatcherTest, TestWaitTimeout) {
+    SnapshotWatcher watcher("oss://bucket/warehouse/db.db/tbl/snapshot",
+                            /*max_poll_interval_ms=*/10 * 1000);
+    auto start = std::chrono::steady_clock::now();
+    watcher.Wait(/*timeout_ms=*/20);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    ASSERT_LT(elapsed, std::chrono::milliseconds(SnapshotWatcher::MIN_POLL_INTERVAL_MS));
+}
+
+#ifdef __linux__
+TEST(SnapshotWatcherTest, TestWatchLocalDirectory) {
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    std::string snapshot_dir = PathUtil::JoinPath(dir->Str(), "snapshot");
+    SnapshotWatcher watcher(snapshot_dir, /*max_poll_interval_ms=*/60 * 1000);
+
+    // snapshot directory does not exist, fall back to polling
+    watcher.Wait(/*timeout_ms=*/10);
+    ASSERT_FALSE(watcher.IsWatching());
+
+    auto fs = dir->GetFileSystem();
+    ASSERT_OK(fs->Mkdirs(snapshot_dir));
+    // returns immediately once the watch is established
+    watcher.Wait(/*timeout_ms=*/60 * 1000);
+    ASSERT_TRUE(watcher.IsWatching());
+
+    std::thread writer([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        ASSERT_OK(fs->WriteFile(PathUtil::JoinPath(snapshot_dir, "snapshot-1"), "{}",
+                                /*overwrite=*/false));
+    });
+    auto start = std::chrono::steady_clock::now();
+    watcher.Wait(/*timeout_ms=*/60 * 1000);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    writer.join();
+    ASSERT_LT(elapsed, std::chrono::seconds(10));
+    ASSERT_TRUE(watcher.IsWatching());
+
+    // watch again after the directory is recreated
+    ASSERT_OK(fs->Delete(snapshot_dir));
+    watcher.Wait(/*timeout_ms=*/1000);
+    ASSERT_FALSE(watcher.IsWatching());
+    ASSERT_OK(fs->Mkdirs(snapshot_dir));
+    watcher.Wait(/*timeout_ms=*/1000);
+    ASSERT_TRUE(watcher.IsWatching());
+}
+#endif
+
+}  // namespace paimon::test
@@ -27,6 +27,7 @@
 #include "fmt/format.h"
 #include "orc/OrcFile.hh"
 #include "paimon/common/metrics/metrics_impl.h"
+#include "paimon/common/metrics/scoped_timer.h"
 #include "paimon/common/utils/arrow/mem_utils.h"
 #include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/common/utils/options_utils.h"
@@ -51,16 +52,24 @@ OrcFileBatchReader::OrcFileBatchReader(const std::string& file_name, int32_t bat
       arrow_pool_(std::move(arrow_pool)),
       orc_pool_(orc_pool),
       reader_metrics_(std::move(reader_metrics)),
-      reader_(std::move(reader)),
-      metrics_(std::make_shared<MetricsImpl>()) {}
+      reader_(std::move(reader)) {
+    auto metrics = std::make_shared<MetricsImpl>();
+    batch_latency_ = metrics->GetOrCreateHistogram(OrcMetrics::READ_BATCH_DURATION);
+    metrics_ = metrics;
+}
 
 Result<std::unique_ptr<OrcFileBatchReader>> OrcFileBatchReader::Create(
     std::unique_ptr<::orc::InputStream>&& input_stream, const std::shared_ptr<MemoryPool>& pool,
-    const std::map<std::string, std::string>& options, int32_t batch_size) {
+    const std::map<std::string, std::string>& options, int32_t batch_size,
+    const std::shared_ptr<std::string>& serialized_file_tail) {
     assert(input_stream);
     std::string file_name = input_stream->getName();
     try {
         ::orc::ReaderOptions reader_options;
+        if (serialized_file_tail) {
+            // skip reading the file tail from the input stream
+            reader_options.setSerializedFileTail(*serialized_file_tail);
+        }
         if (pool == nullptr) {
             return Status::Invalid("memory pool is nullptr");
         }
@@ -79,11 +88,15 @@ Result<std::unique_ptr<OrcFileBatchReader>> OrcFileBatchReader::Create(
                 orc_input_stream->SetMetrics(reader_metrics.get());
             }
         }
+        StopWatch open_watch;
         std::unique_ptr<::orc::Reader> reader =
             ::orc::createReader(std::move(input_stream), reader_options);
+        uint64_t open_latency_us = open_watch.ElapsedUs();
         auto orc_file_batch_reader = std::unique_ptr<OrcFileBatchReader>(
             new OrcFileBatchReader(file_name, batch_size, std::move(reader_metrics),
                                    std::move(reader), options, GetArrowPool(pool), orc_pool));
+        orc_file_batch_reader->metrics_->ObserveHistogram(OrcMetrics::READ_OPEN_DURATION,
+                                                          open_latency_us);
         PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<::ArrowSchema> file_schema,
                                orc_file_batch_reader->GetFileSchema());
         PAIMON_RETURN_NOT_OK(orc_file_batch_reader->SetReadSchema(
@@ -158,6 +171,7 @@ Result<BatchReader::ReadBatch> OrcFileBatchReader::NextBatch() {
     }
     std::unique_ptr<ArrowArray> c_array = std::make_unique<ArrowArray>();
     std::unique_ptr<ArrowSchema> c_schema = std::make_unique<ArrowSchema>();
+    ScopedTimer timer(batch_latency_.get());
     try {
         auto orc_batch = row_reader_->createRowBatch(batch_size_);
         bool eof = !row_reader_->next(*orc_batch);
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cassert>
 #include <map>
 #include <memory>
 #include <string>
@@ -35,12 +36,24 @@ namespace orc {
 class InputStream;
 }  // namespace orc
 
+namespace paimon {
+class Histogram;
+}  // namespace paimon
+
 namespace paimon::orc {
 class OrcFileBatchReader : public FileBatchReader {
  public:
+    /// @param serialized_file_tail Pre-read file tail (postscript, footer and metadata) of the
+    /// file, the tail is read from the input stream if it is nullptr.
     static Result<std::unique_ptr<OrcFileBatchReader>> Create(
         std::unique_ptr<::orc::InputStream>&& input_stream, const std::shared_ptr<MemoryPool>& pool,
-        const std::map<std::string, std::string>& options, int32_t batch_size);
+        const std::map<std::string, std::string>& options, int32_t batch_size,
+        const std::shared_ptr<std::string>& serialized_file_tail = nullptr);
+
+    std::string GetSerializedFileTail() const {
+        assert(reader_);
+        return reader_->getSerializedFileTail();
+    }
 
     // For timestamp type, precision info is missing from file
     Result<std::unique_ptr<::ArrowSchema>> GetFileSchema() const override;
@@ -97,6 +110,7 @@ class OrcFileBatchReader : public FileBatchReader {
     std::unique_ptr<::orc::RowReader> row_reader_;
     std::shared_ptr<arrow::DataType> target_type_;
     std::shared_ptr<Metrics> metrics_;
+    std::shared_ptr<Histogram> batch_latency_;
     bool has_error_ = false;
 };
 }  // namespace paimon::orc
@@ -27,6 +27,7 @@
 #include "arrow/ipc/api.h"
 #include "gtest/gtest.h"
 #include "paimon/common/types/data_field.h"
+#include "paimon/common/utils/footer_cache.h"
 #include "paimon/defs.h"
 #include "paimon/format/orc/orc_adapter.h"
 #include "paimon/format/orc/orc_format_defs.h"
@@ -35,6 +36,7 @@
 #include "paimon/format/orc/orc_memory_pool.h"
 #include "paimon/format/orc/orc_metrics.h"
 #include "paimon/format/orc/orc_output_stream_impl.h"
+#include "paimon/format/orc/orc_reader_builder.h"
 #include "paimon/fs/local/local_file_system.h"
 #include "paimon/predicate/predicate_builder.h"
 #include "paimon/testing/utils/read_result_collector.h"
@@ -368,6 +370,41 @@ TEST_P(OrcFileBatchReaderTest, TestNextBatchSimple) {
     }
 }
 
+TEST_F(OrcFileBatchReaderTest, TestFooterCache) {
+    std::string file_name = paimon::test::GetDataDir() +
+                            "/orc/append_09.db/append_09/f1=10/bucket-1/"
+                            "data-b9e7c41f-66e8-4dad-b25a-e6e1963becc4-0.orc";
+    auto* footer_cache = FooterCache<std::string>::Global();
+    footer_cache->Clear();
+    OrcReaderBuilder reader_builder({{ORC_READ_FOOTER_CACHE_ENABLED, "true"}}, batch_size_);
+    arrow::Schema read_schema(struct_array_->struct_type()->fields());
+    auto expected_array = std::make_shared<arrow::ChunkedArray>(struct_array_);
+    auto fs = std::make_shared<LocalFileSystem>();
+    for (int32_t i = 0; i < 2; i++) {
+        ASSERT_OK_AND_ASSIGN(std::shared_ptr<InputStream> input_stream, fs->Open(file_name));
+        ASSERT_OK_AND_ASSIGN(std::unique_ptr<FileBatchReader> reader,
+                             reader_builder.Build(input_stream));
+        ASSERT_TRUE(reader_builder.FooterCacheEnabled());
+        const char* counter_name =
+            i == 0 ? OrcMetrics::READ_FOOTER_CACHE_MISS : OrcMetrics::READ_FOOTER_CACHE_HIT;
+        ASSERT_OK_AND_ASSIGN(uint64_t counter,
+                             reader->GetReaderMetrics()->GetCounter(counter_name));
+        ASSERT_EQ(1, counter);
+        ArrowSchema c_schema;
+        ASSERT_TRUE(arrow::ExportSchema(read_schema, &c_schema).ok());
+        ASSERT_OK(reader->SetReadSchema(&c_schema, /*predicate=*/nullptr,
+                                        /*selection_bitmap=*/std::nullopt));
+        ASSERT_OK_AND_ASSIGN(auto result_array,
+                             paimon::test::ReadResultCollector::CollectResult(reader.get()));
+        ASSERT_TRUE(result_array->Equals(expected_array));
+    }
+    // the second reader reuses the file tail read by the first one
+    ASSERT_EQ(1, footer_cache->Size());
+    ASSERT_EQ(1, footer_cache->MissCount());
+    ASSERT_EQ(1, footer_cache->HitCount());
+    footer_cache->Clear();
+}
+
 TEST_P(OrcFileBatchReaderTest, TestNextBatchWithTargetSchema) {
     std::string file_name = paimon::test::GetDataDir() +
                             "/orc/append_09.db/append_09/f1=10/bucket-1/"
@@ -46,4 +46,8 @@ static inline const char ORC_NATURAL_READ_SIZE[] = "orc.read.natural-read-size";
 static constexpr uint64_t DEFAULT_NATURAL_READ_SIZE = 1024 * 1024;
 // default value of ORC_READ_ENABLE_METRICS is false
 static inline const char ORC_READ_ENABLE_METRICS[] = "orc.read.enable-metrics";
+// cache the serialized file tails of the files read in a process wide cache keyed by the file path
+// and length, so that the readers of the same file skip reading the tail again. default value of
+// ORC_READ_FOOTER_CACHE_ENABLED is false
+static inline const char ORC_READ_FOOTER_CACHE_ENABLED[] = "orc.read.footer-cache.enabled";
 }  // namespace paimon::orc
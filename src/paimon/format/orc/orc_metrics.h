@@ -28,6 +28,12 @@ class OrcMetrics {
     // read
     static inline const char READ_INCLUSIVE_LATENCY_US[] = "orc.read.inclusive.latency.us";
     static inline const char READ_IO_COUNT[] = "orc.read.io.count";
+    // whether the file tail of the reader is found in the footer cache
+    static inline const char READ_FOOTER_CACHE_HIT[] = "orc.read.footer-cache.hit";
+    static inline const char READ_FOOTER_CACHE_MISS[] = "orc.read.footer-cache.miss";
+    // histograms of latencies in microseconds
+    static inline const char READ_OPEN_DURATION[] = "orcReadOpenDuration";
+    static inline const char READ_BATCH_DURATION[] = "orcReadBatchDuration";
 };
 
 }  // namespace paimon::orc
@@ -21,10 +21,12 @@
 #include <string>
 #include <utility>
 
+#include "paimon/common/utils/footer_cache.h"
 #include "paimon/common/utils/options_utils.h"
 #include "paimon/format/orc/orc_file_batch_reader.h"
 #include "paimon/format/orc/orc_format_defs.h"
 #include "paimon/format/orc/orc_input_stream_impl.h"
+#include "paimon/format/orc/orc_metrics.h"
 #include "paimon/format/reader_builder.h"
 #include "paimon/fs/file_system.h"
 namespace paimon::orc {
@@ -49,13 +51,44 @@ class OrcReaderBuilder : public ReaderBuilder {
 
         PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<OrcInputStreamImpl> input_stream,
                                OrcInputStreamImpl::Create(path, natural_read_size));
-        return OrcFileBatchReader::Create(std::move(input_stream), pool_, options_, batch_size_);
+        PAIMON_ASSIGN_OR_RAISE(bool footer_cache_enabled, IsFooterCacheEnabled());
+        std::string uri;
+        if (footer_cache_enabled) {
+            PAIMON_ASSIGN_OR_RAISE(uri, path->GetUri());
+        }
+        if (uri.empty()) {
+            return OrcFileBatchReader::Create(std::move(input_stream), pool_, options_,
+                                              batch_size_);
+        }
+        PAIMON_ASSIGN_OR_RAISE(uint64_t file_length, path->Length());
+        auto* footer_cache = FooterCache<std::string>::Global();
+        std::shared_ptr<std::string> file_tail = footer_cache->Get(uri, file_length);
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<OrcFileBatchReader> reader,
+                               OrcFileBatchReader::Create(std::move(input_stream), pool_, options_,
+                                                          batch_size_, file_tail));
+        reader->GetReaderMetrics()->SetCounter(
+            file_tail ? OrcMetrics::READ_FOOTER_CACHE_HIT : OrcMetrics::READ_FOOTER_CACHE_MISS, 1);
+        if (!file_tail) {
+            file_tail = std::make_shared<std::string>(reader->GetSerializedFileTail());
+            footer_cache->Put(uri, file_length, file_tail, file_tail->size());
+        }
+        return reader;
+    }
+
+    bool FooterCacheEnabled() const override {
+        Result<bool> enabled = IsFooterCacheEnabled();
+        return enabled.ok() && enabled.value();
     }
 
     Result<std::unique_ptr<FileBatchReader>> Build(const std::string& path) const override {
         return Status::Invalid("do not support build reader with path in orc format");
     }
 
+ private:
+    Result<bool> IsFooterCacheEnabled() const {
+        return OptionsUtils::GetValueFromMap<bool>(options_, ORC_READ_FOOTER_CACHE_ENABLED, false);
+    }
+
  private:
     int32_t batch_size_ = -1;
     std::shared_ptr<MemoryPool> pool_;
@@ -36,6 +36,7 @@
 #include "arrow/util/thread_pool.h"
 #include "fmt/format.h"
 #include "paimon/common/metrics/metrics_impl.h"
+#include "paimon/common/metrics/scoped_timer.h"
 #include "paimon/common/utils/arrow/status_utils.h"
 #include "paimon/common/utils/options_utils.h"
 #include "paimon/format/parquet/parquet_field_id_converter.h"
@@ -64,21 +65,27 @@ ParquetFileBatchReader::ParquetFileBatchReader(
       arrow_pool_(arrow_pool),
       input_stream_(std::move(input_stream)),
       reader_(std::move(reader)),
-      read_ranges_(reader_->GetAllRowGroupRanges()),
-      metrics_(std::make_shared<MetricsImpl>()) {}
+      read_ranges_(reader_->GetAllRowGroupRanges()) {
+    auto metrics = std::make_shared<MetricsImpl>();
+    batch_latency_ = metrics->GetOrCreateHistogram(ParquetMetrics::READ_BATCH_DURATION);
+    metrics_ = metrics;
+}
 
 Result<std::unique_ptr<ParquetFileBatchReader>> ParquetFileBatchReader::Create(
     std::shared_ptr<arrow::io::RandomAccessFile>&& input_stream,
     const std::shared_ptr<arrow::MemoryPool>& pool,
-    const std::map<std::string, std::string>& options, int32_t batch_size) {
+    const std::map<std::string, std::string>& options, int32_t batch_size,
+    const std::shared_ptr<::parquet::FileMetaData>& metadata) {
     assert(input_stream);
     PAIMON_ASSIGN_OR_RAISE(::parquet::ReaderProperties reader_properties,
                            CreateReaderProperties(pool, options));
     PAIMON_ASSIGN_OR_RAISE(::parquet::ArrowReaderProperties arrow_reader_properties,
                            CreateArrowReaderProperties(pool, options, batch_size));
 
+    StopWatch open_watch;
     ::parquet::arrow::FileReaderBuilder file_reader_builder;
-    PAIMON_RETURN_NOT_OK_FROM_ARROW(file_reader_builder.Open(input_stream, reader_properties));
+    PAIMON_RETURN_NOT_OK_FROM_ARROW(
+        file_reader_builder.Open(input_stream, reader_properties, metadata));
 
     std::unique_ptr<::parquet::arrow::FileReader> file_reader;
     PAIMON_RETURN_NOT_OK_FROM_ARROW(file_reader_builder.memory_pool(pool.get())
@@ -87,8 +94,11 @@ Result<std::unique_ptr<ParquetFileBatchReader>> ParquetFileBatchReader::Create(
 
     PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FileReaderWrapper> reader,
                            FileReaderWrapper::Create(std::move(file_reader)));
+    uint64_t open_latency_us = open_watch.ElapsedUs();
     auto parquet_file_batch_reader = std::unique_ptr<ParquetFileBatchReader>(
         new ParquetFileBatchReader(std::move(input_stream), std::move(reader), options, pool));
+    parquet_file_batch_reader->metrics_->ObserveHistogram(ParquetMetrics::READ_OPEN_DURATION,
+                                                          open_latency_us);
     PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<::ArrowSchema> file_schema,
                            parquet_file_batch_reader->GetFileSchema());
     PAIMON_RETURN_NOT_OK(parquet_file_batch_reader->SetReadSchema(
@@ -222,6 +232,7 @@ Result<std::vector<int32_t>> ParquetFileBatchReader::FilterRowGroupsByBitmap(
 }
 
 Result<BatchReader::ReadBatch> ParquetFileBatchReader::NextBatch() {
+    ScopedTimer timer(batch_latency_.get());
     PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<arrow::RecordBatch> batch, reader_->Next());
     if (batch == nullptr) {
         return BatchReader::MakeEofBatch();
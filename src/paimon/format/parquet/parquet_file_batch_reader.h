@@ -40,6 +40,8 @@
 #include "paimon/result.h"
 #include "paimon/status.h"
 #include "parquet/arrow/reader.h"
+#include "parquet/file_reader.h"
+#include "parquet/metadata.h"
 #include "parquet/properties.h"
 
 namespace arrow {
@@ -50,6 +52,7 @@ class RandomAccessFile;
 }  // namespace io
 }  // namespace arrow
 namespace paimon {
+class Histogram;
 class Metrics;
 class Predicate;
 class RoaringBitmap32;
@@ -59,10 +62,18 @@ namespace paimon::parquet {
 
 class ParquetFileBatchReader : public PrefetchFileBatchReader {
  public:
+    /// @param metadata Pre-parsed metadata of the file, the footer is read and parsed from the
+    /// input stream if it is nullptr.
     static Result<std::unique_ptr<ParquetFileBatchReader>> Create(
         std::shared_ptr<arrow::io::RandomAccessFile>&& input_stream,
         const std::shared_ptr<arrow::MemoryPool>& pool,
-        const std::map<std::string, std::string>& options, int32_t batch_size);
+        const std::map<std::string, std::string>& options, int32_t batch_size,
+        const std::shared_ptr<::parquet::FileMetaData>& metadata = nullptr);
+
+    std::shared_ptr<::parquet::FileMetaData> GetFileMetaData() const {
+        assert(reader_);
+        return reader_->GetFileReader()->parquet_reader()->metadata();
+    }
 
     // For timestamp type, we return the schema stored in file, e.g., second in parquet file will
     // store as milli.
@@ -173,6 +184,7 @@ class ParquetFileBatchReader : public PrefetchFileBatchReader {
     std::vector<std::pair<uint64_t, uint64_t>> read_ranges_;
 
     std::shared_ptr<Metrics> metrics_;
+    std::shared_ptr<Histogram> batch_latency_;
 
     // last time set read schema
     std::vector<int32_t> read_row_groups_;
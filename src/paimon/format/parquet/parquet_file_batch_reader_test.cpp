@@ -34,14 +34,17 @@
 #include "paimon/common/types/data_field.h"
 #include "paimon/common/utils/arrow/mem_utils.h"
 #include "paimon/common/utils/date_time_utils.h"
+#include "paimon/common/utils/footer_cache.h"
 #include "paimon/common/utils/path_util.h"
 #include "paimon/defs.h"
 #include "paimon/format/parquet/parquet_format_defs.h"
 #include "paimon/format/parquet/parquet_format_writer.h"
 #include "paimon/format/parquet/parquet_input_stream_impl.h"
+#include "paimon/format/parquet/parquet_reader_builder.h"
 #include "paimon/fs/file_system.h"
 #include "paimon/fs/local/local_file_system.h"
 #include "paimon/memory/memory_pool.h"
+#include "paimon/metrics.h"
 #include "paimon/predicate/literal.h"
 #include "paimon/predicate/predicate_builder.h"
 #include "paimon/reader/batch_reader.h"
@@ -176,6 +179,41 @@ TEST_F(ParquetFileBatchReaderTest, TestSimple) {
                                      arrow::EqualOptions::Defaults().diff_sink(&std::cout)));
 }
 
+TEST_F(ParquetFileBatchReaderTest, TestFooterCache) {
+    std::string file_name = paimon::test::GetDataDir() +
+                            "/parquet/parquet_append_table.db/parquet_append_table/bucket-0/"
+                            "data-9ea62f34-1dca-49c1-bf7a-d37303d8fb76-0.parquet";
+    auto* footer_cache = FooterCache<::parquet::FileMetaData>::Global();
+    footer_cache->Clear();
+    ParquetReaderBuilder reader_builder({{PARQUET_READ_FOOTER_CACHE_ENABLED, "true"}},
+                                        batch_size_);
+    std::shared_ptr<arrow::ChunkedArray> expected_array =
+        std::make_shared<arrow::ChunkedArray>(struct_array_);
+    for (int32_t i = 0; i < 2; i++) {
+        ASSERT_OK_AND_ASSIGN(std::shared_ptr<InputStream> input_stream, fs_->Open(file_name));
+        ASSERT_OK_AND_ASSIGN(std::unique_ptr<FileBatchReader> reader,
+                             reader_builder.Build(input_stream));
+        ASSERT_TRUE(reader_builder.FooterCacheEnabled());
+        const char* counter_name =
+            i == 0 ? ParquetMetrics::READ_FOOTER_CACHE_MISS : ParquetMetrics::READ_FOOTER_CACHE_HIT;
+        ASSERT_OK_AND_ASSIGN(uint64_t counter,
+                             reader->GetReaderMetrics()->GetCounter(counter_name));
+        ASSERT_EQ(1, counter);
+        std::unique_ptr<ArrowSchema> c_schema = std::make_unique<ArrowSchema>();
+        ASSERT_TRUE(arrow::ExportSchema(*schema_, c_schema.get()).ok());
+        ASSERT_OK(reader->SetReadSchema(c_schema.get(), /*predicate=*/nullptr,
+                                        /*selection_bitmap=*/std::nullopt));
+        ASSERT_OK_AND_ASSIGN(std::shared_ptr<arrow::ChunkedArray> result_array,
+                             paimon::test::ReadResultCollector::CollectResult(reader.get()));
+        ASSERT_TRUE(result_array->Equals(*expected_array));
+    }
+    // the second reader reuses the footer parsed by the first one
+    ASSERT_EQ(1, footer_cache->Size());
+    ASSERT_EQ(1, footer_cache->MissCount());
+    ASSERT_EQ(1, footer_cache->HitCount());
+    footer_cache->Clear();
+}
+
 TEST_F(ParquetFileBatchReaderTest, TestSetReadSchema) {
     std::string file_name = paimon::test::GetDataDir() +
                             "parquet/parquet_append_table.db/parquet_append_table/bucket-0/"
@@ -249,6 +287,9 @@ TEST_F(ParquetFileBatchReaderTest, TestNextBatchSimple) {
         // test metrics
         auto read_metrics = parquet_batch_reader->GetReaderMetrics();
         ASSERT_TRUE(read_metrics);
+        ASSERT_OK_AND_ASSIGN(HistogramStats open_duration,
+                             read_metrics->GetHistogram(ParquetMetrics::READ_OPEN_DURATION));
+        ASSERT_EQ(1, open_duration.count);
         // TODO(jinli.zjw): test metrics
         // ASSERT_TRUE(read_metrics->GetCounter(ParquetMetrics::READ_BYTES) > 0);
         // ASSERT_TRUE(read_metrics->GetCounter(ParquetMetrics::READ_RAW_BYTES) > 0);
@@ -34,6 +34,9 @@ static inline const char PARQUET_COMPRESSION_CODEC_ZSTD_LEVEL[] =
     "parquet.compression.codec.zstd.level";
 static inline const char PARQUET_COMPRESSION_CODEC_ZLIB_LEVEL[] = "zlib.compress.level";
 static inline const char PARQUET_COMPRESSION_CODEC_BROTLI_LEVEL[] = "compression.brotli.quality";
+// encode and compress the column chunks of a row group in parallel on the arrow cpu thread pool,
+// the pages are still written to the file in column order. default value is false
+static inline const char PARQUET_WRITE_USE_THREADS[] = "parquet.write.use-threads";
 
 // read
 static inline const char PARQUET_READ_EXECUTOR_THREAD_COUNT[] =
@@ -45,6 +48,11 @@ static inline const char PARQUET_READ_CACHE_OPTION_PREFETCH_LIMIT[] =
 static inline const char PARQUET_READ_CACHE_OPTION_RANGE_SIZE_LIMIT[] =
     "parquet.read.cache-option.range-size-limit";
 
+// cache the parsed footers of the files read in a process wide cache keyed by the file path and
+// length, so that the readers of the same file skip reading and decoding the footer again. default
+// value is false
+static inline const char PARQUET_READ_FOOTER_CACHE_ENABLED[] = "parquet.read.footer-cache.enabled";
+
 // stack-overflow may happen while the number of predicate node is too large, limit the number of
 // predicate nodes. Predicate will not be pushdown when exceed limit.
 static inline const char PARQUET_READ_PREDICATE_NODE_COUNT_LIMIT[] =
@@ -57,6 +65,12 @@ static constexpr uint32_t DEFAULT_PARQUET_READ_PREDICATE_NODE_COUNT_LIMIT = 512;
 class ParquetMetrics {
  public:
     static inline const char WRITE_RECORD_COUNT[] = "parquet.write.record.count";
+    // whether the footer of the reader is found in the footer cache
+    static inline const char READ_FOOTER_CACHE_HIT[] = "parquet.read.footer-cache.hit";
+    static inline const char READ_FOOTER_CACHE_MISS[] = "parquet.read.footer-cache.miss";
+    // histograms of latencies in microseconds
+    static inline const char READ_OPEN_DURATION[] = "parquetReadOpenDuration";
+    static inline const char READ_BATCH_DURATION[] = "parquetReadBatchDuration";
 };
 
 }  // namespace paimon::parquet
@@ -44,9 +44,12 @@ Result<std::unique_ptr<ParquetFormatWriter>> ParquetFormatWriter::Create(
     const std::shared_ptr<OutputStream>& output_stream,
     const std::shared_ptr<arrow::Schema>& schema,
     const std::shared_ptr<::parquet::WriterProperties>& writer_properties,
-    const std::shared_ptr<arrow::MemoryPool>& pool) {
+    const std::shared_ptr<arrow::MemoryPool>& pool, bool use_threads) {
     auto out = std::make_shared<ParquetOutputStreamImpl>(output_stream);
     ::parquet::ArrowWriterProperties::Builder arrow_properties_builder;
+    // with threads, the columns of a record batch are encoded in parallel into the buffered row
+    // group, which is serialized in order when it is closed
+    arrow_properties_builder.set_use_threads(use_threads);
     auto arrow_writer_properties =
         arrow_properties_builder.enable_deprecated_int96_timestamps()->build();
     PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(
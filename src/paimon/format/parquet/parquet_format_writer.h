@@ -54,7 +54,7 @@ class ParquetFormatWriter : public FormatWriter {
         const std::shared_ptr<OutputStream>& output_stream,
         const std::shared_ptr<arrow::Schema>& schema,
         const std::shared_ptr<::parquet::WriterProperties>& writer_properties,
-        const std::shared_ptr<arrow::MemoryPool>& pool);
+        const std::shared_ptr<arrow::MemoryPool>& pool, bool use_threads = false);
 
     Status AddBatch(ArrowArray* batch) override;
 
@@ -259,6 +259,32 @@ TEST_F(ParquetFormatWriterTest, TestWriteMultipleTimes) {
     ASSERT_EQ(37, counter);
 }
 
+TEST_F(ParquetFormatWriterTest, TestWriteWithThreads) {
+    auto schema_pair = PrepareArrowSchema();
+    const auto& arrow_schema = schema_pair.first;
+    const auto& struct_type = schema_pair.second;
+
+    std::string file_path = PathUtil::JoinPath(dir_->Str(), "write_with_threads");
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<OutputStream> out,
+                         fs_->Create(file_path, /*overwrite=*/false));
+    ::parquet::WriterProperties::Builder builder;
+    builder.write_batch_size(10);
+    builder.compression(arrow::Compression::ZSTD);
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<ParquetFormatWriter> format_writer,
+                         ParquetFormatWriter::Create(out, arrow_schema, builder.build(),
+                                                     arrow_pool_, /*use_threads=*/true));
+    // columns are encoded in parallel for each batch, pages are still appended in order
+    int32_t row_count = 0;
+    for (int32_t batch_size : {6, 100, 1, 1000}) {
+        AddRecordBatchOnce(format_writer, struct_type, batch_size, row_count);
+        row_count += batch_size;
+    }
+    ASSERT_OK(format_writer->Finish());
+    ASSERT_OK(out->Flush());
+    ASSERT_OK(out->Close());
+    CheckResult(file_path, row_count);
+}
+
 TEST_F(ParquetFormatWriterTest, TestGetEstimateLength) {
     auto schema_pair = PrepareArrowSchema();
     const auto& arrow_schema = schema_pair.first;
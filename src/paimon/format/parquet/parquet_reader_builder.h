@@ -22,7 +22,10 @@
 #include <utility>
 
 #include "paimon/common/utils/arrow/mem_utils.h"
+#include "paimon/common/utils/footer_cache.h"
+#include "paimon/common/utils/options_utils.h"
 #include "paimon/format/parquet/parquet_file_batch_reader.h"
+#include "paimon/format/parquet/parquet_format_defs.h"
 #include "paimon/format/parquet/parquet_input_stream_impl.h"
 #include "paimon/format/reader_builder.h"
 #include "paimon/memory/memory_pool.h"
@@ -46,14 +49,45 @@ class ParquetReaderBuilder : public ReaderBuilder {
         PAIMON_ASSIGN_OR_RAISE(uint64_t file_length, path->Length());
         std::shared_ptr<arrow::MemoryPool> arrow_pool = GetArrowPool(pool_);
         auto input_stream = std::make_unique<ParquetInputStreamImpl>(path, arrow_pool, file_length);
-        return ParquetFileBatchReader::Create(std::move(input_stream), arrow_pool, options_,
-                                              batch_size_);
+        PAIMON_ASSIGN_OR_RAISE(bool footer_cache_enabled, IsFooterCacheEnabled());
+        std::string uri;
+        if (footer_cache_enabled) {
+            PAIMON_ASSIGN_OR_RAISE(uri, path->GetUri());
+        }
+        if (uri.empty()) {
+            return ParquetFileBatchReader::Create(std::move(input_stream), arrow_pool, options_,
+                                                  batch_size_);
+        }
+        auto* footer_cache = FooterCache<::parquet::FileMetaData>::Global();
+        std::shared_ptr<::parquet::FileMetaData> metadata = footer_cache->Get(uri, file_length);
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<ParquetFileBatchReader> reader,
+                               ParquetFileBatchReader::Create(std::move(input_stream), arrow_pool,
+                                                              options_, batch_size_, metadata));
+        reader->GetReaderMetrics()->SetCounter(metadata ? ParquetMetrics::READ_FOOTER_CACHE_HIT
+                                                        : ParquetMetrics::READ_FOOTER_CACHE_MISS,
+                                               1);
+        if (!metadata) {
+            metadata = reader->GetFileMetaData();
+            footer_cache->Put(uri, file_length, metadata, metadata->size());
+        }
+        return reader;
+    }
+
+    bool FooterCacheEnabled() const override {
+        Result<bool> enabled = IsFooterCacheEnabled();
+        return enabled.ok() && enabled.value();
     }
 
     Result<std::unique_ptr<FileBatchReader>> Build(const std::string& path) const override {
         return Status::Invalid("do not support build reader with path in parquet format");
     }
 
+ private:
+    Result<bool> IsFooterCacheEnabled() const {
+        return OptionsUtils::GetValueFromMap<bool>(options_, PARQUET_READ_FOOTER_CACHE_ENABLED,
+                                                   false);
+    }
+
  private:
     int32_t batch_size_ = -1;
     std::shared_ptr<MemoryPool> pool_;
@@ -42,7 +42,9 @@ Result<std::unique_ptr<FormatWriter>> ParquetWriterBuilder::Build(
     const std::shared_ptr<OutputStream>& out, const std::string& compression) {
     PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<::parquet::WriterProperties> writer_properties,
                            PrepareWriterProperties(compression));
-    return ParquetFormatWriter::Create(out, schema_, writer_properties, pool_);
+    PAIMON_ASSIGN_OR_RAISE(bool use_threads, OptionsUtils::GetValueFromMap<bool>(
+                                                 options_, PARQUET_WRITE_USE_THREADS, false));
+    return ParquetFormatWriter::Create(out, schema_, writer_properties, pool_, use_threads);
 }
 
 Result<std::shared_ptr<::parquet::WriterProperties>> ParquetWriterBuilder::PrepareWriterProperties(
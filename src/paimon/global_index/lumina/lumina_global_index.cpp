@@ -281,6 +281,52 @@ LuminaIndexReader::LuminaIndexReader(
       searcher_(std::move(searcher)),
       searcher_with_filter_(std::move(searcher_with_filter)) {}
 
+Result<std::optional<::lumina::extensions::SearchWithFilterExtension::Filter>>
+LuminaIndexReader::CreateFilter(const VectorSearch& vector_search) const {
+    using Filter = ::lumina::extensions::SearchWithFilterExtension::Filter;
+    const VectorSearch::PreFilter& pre_filter = vector_search.pre_filter;
+    if (!vector_search.pre_filter_bitmap) {
+        if (!pre_filter) {
+            return std::optional<Filter>();
+        }
+        return std::optional<Filter>(
+            [pre_filter](::lumina::core::VectorId id) -> bool { return pre_filter(id); });
+    }
+    std::shared_ptr<const RoaringBitmap64> bitmap = vector_search.pre_filter_bitmap;
+    int64_t row_count = range_end_ + 1;
+    if (!bitmap->ContainsAny(0, row_count)) {
+        // no candidate, an empty filter means skipping the search
+        return std::optional<Filter>(Filter());
+    }
+    int64_t allowed_count = bitmap->RangeCardinality(0, row_count);
+    if (allowed_count == row_count && !pre_filter) {
+        // all the rows are allowed
+        return std::optional<Filter>();
+    }
+    if (row_count > MAX_DENSE_FILTER_ROWS || allowed_count * SPARSE_FILTER_RATIO < row_count) {
+        return std::optional<Filter>([bitmap, pre_filter](::lumina::core::VectorId id) -> bool {
+            return bitmap->Contains(id) && (!pre_filter || pre_filter(id));
+        });
+    }
+    // probing a dense bitset is much cheaper than probing the roaring bitmap, which matters as
+    // the search visits many more rows than the top k
+    auto words = std::make_shared<std::vector<uint64_t>>((row_count + 63) / 64, 0);
+    for (auto iter = bitmap->Begin(); iter != bitmap->End() && *iter < row_count; ++iter) {
+        int64_t id = *iter;
+        if (id >= 0) {
+            (*words)[id >> 6] |= uint64_t{1} << (id & 63);
+        }
+    }
+    if (!pre_filter) {
+        return std::optional<Filter>([words](::lumina::core::VectorId id) -> bool {
+            return ((*words)[id >> 6] >> (id & 63)) & 1;
+        });
+    }
+    return std::optional<Filter>([words, pre_filter](::lumina::core::VectorId id) -> bool {
+        return (((*words)[id >> 6] >> (id & 63)) & 1) && pre_filter(id);
+    });
+}
+
 Result<std::shared_ptr<VectorSearchGlobalIndexResult>> LuminaIndexReader::VisitVectorSearch(
     const std::shared_ptr<VectorSearch>& vector_search) {
     if (vector_search->predicate) {
@@ -290,17 +336,19 @@ Result<std::shared_ptr<VectorSearchGlobalIndexResult>> LuminaIndexReader::VisitV
     search_options.Set(::lumina::core::kTopK, vector_search->limit);
 
     ::lumina::api::Query lumina_query(vector_search->query.data(), vector_search->query.size());
+    PAIMON_ASSIGN_OR_RAISE(std::optional<::lumina::extensions::SearchWithFilterExtension::Filter>
+                               lumina_filter,
+                           CreateFilter(*vector_search));
     ::lumina::api::LuminaSearcher::SearchResult search_result;
-    if (!vector_search->pre_filter) {
+    if (!lumina_filter) {
         PAIMON_ASSIGN_OR_RAISE_FROM_LUMINA(search_result,
                                            searcher_->Search(lumina_query, search_options, *pool_));
-    } else {
+    } else if (lumina_filter.value()) {
         search_options.Set(::lumina::core::kSearchThreadSafeFilter, true);
-        auto lumina_filter = [filter = vector_search->pre_filter](
-                                 ::lumina::core::VectorId id) -> bool { return filter(id); };
         PAIMON_ASSIGN_OR_RAISE_FROM_LUMINA(
-            search_result, searcher_with_filter_->SearchWithFilter(lumina_query, lumina_filter,
-                                                                   search_options, *pool_));
+            search_result, searcher_with_filter_->SearchWithFilter(
+                               lumina_query, std::move(lumina_filter).value(), search_options,
+                               *pool_));
     }
 
     // prepare BitmapVectorSearchGlobalIndexResult
@@ -18,6 +18,7 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -152,6 +153,19 @@ class LuminaIndexReader : public GlobalIndexReader {
     }
 
  private:
+    /// Beyond this number of rows, a bitmap pre-filter is probed directly instead of being
+    /// expanded to a dense bitset.
+    static constexpr int64_t MAX_DENSE_FILTER_ROWS = 256L * 1024 * 1024;
+    /// A bitmap pre-filter allowing less than 1 / SPARSE_FILTER_RATIO of the rows is probed
+    /// directly, as a dense bitset would take more than SPARSE_FILTER_RATIO bits per allowed row.
+    static constexpr int64_t SPARSE_FILTER_RATIO = 64;
+
+    /// Creates the filter for lumina from the pre-filters of `vector_search`.
+    ///
+    /// @return nullopt if no row is filtered out, or an empty filter if all rows are filtered out.
+    Result<std::optional<::lumina::extensions::SearchWithFilterExtension::Filter>> CreateFilter(
+        const VectorSearch& vector_search) const;
+
     int64_t range_end_;
     std::shared_ptr<LuminaMemoryPool> pool_;
     ::lumina::api::SearchOptions search_options_;
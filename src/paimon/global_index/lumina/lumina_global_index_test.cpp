@@ -243,6 +243,99 @@ TEST_F(LuminaGlobalIndexTest, TestWithFilter) {
     }
 }
 
+TEST_F(LuminaGlobalIndexTest, TestWithFilterBitmap) {
+    auto test_root_dir = paimon::test::UniqueTestDirectory::Create();
+    ASSERT_TRUE(test_root_dir);
+    std::string test_root = test_root_dir->Str();
+
+    ASSERT_OK_AND_ASSIGN(auto meta,
+                         WriteGlobalIndex(test_root, data_type_, options_, array_, Range(0, 3)));
+    ASSERT_OK_AND_ASSIGN(auto reader,
+                         CreateGlobalIndexReader(test_root, data_type_, options_, meta));
+    auto search = [&](int32_t limit, const std::vector<int64_t>& allowed_ids,
+                      VectorSearch::PreFilter filter) {
+        auto vector_search = std::make_shared<VectorSearch>("f0", limit, query_, filter,
+                                                            /*predicate=*/nullptr);
+        return reader->VisitVectorSearch(vector_search->ReplacePreFilterBitmap(
+            std::make_shared<RoaringBitmap64>(RoaringBitmap64::From(allowed_ids))));
+    };
+    {
+        ASSERT_OK_AND_ASSIGN(auto vector_search_result, search(2, {0, 1, 2}, nullptr));
+        CheckResult(vector_search_result, {1l, 2l}, {2.01f, 2.21f});
+    }
+    {
+        // ids out of the index range are ignored
+        ASSERT_OK_AND_ASSIGN(auto vector_search_result, search(4, {0, 2, 100}, nullptr));
+        CheckResult(vector_search_result, {2l, 0l}, {2.21f, 4.21f});
+    }
+    {
+        // all rows are allowed
+        ASSERT_OK_AND_ASSIGN(auto vector_search_result, search(2, {0, 1, 2, 3}, nullptr));
+        CheckResult(vector_search_result, {3l, 1l}, {0.01f, 2.01f});
+    }
+    {
+        // no row is allowed
+        ASSERT_OK_AND_ASSIGN(auto vector_search_result, search(2, {4, 5}, nullptr));
+        CheckResult(vector_search_result, {}, {});
+    }
+    {
+        // both the bitmap and the filter are applied
+        auto filter = [](int64_t id) -> bool { return id != 1; };
+        ASSERT_OK_AND_ASSIGN(auto vector_search_result, search(4, {0, 1, 3}, filter));
+        CheckResult(vector_search_result, {3l, 0l}, {0.01f, 4.21f});
+    }
+}
+
+TEST_F(LuminaGlobalIndexTest, TestWithSparseAndDenseFilterBitmap) {
+    auto test_root_dir = paimon::test::UniqueTestDirectory::Create();
+    ASSERT_TRUE(test_root_dir);
+    std::string test_root = test_root_dir->Str();
+
+    int64_t row_count = 10000;
+    auto array = CreateRandomVector(/*element_size*/ row_count, /*dimension=*/4);
+    ASSERT_OK_AND_ASSIGN(auto meta, WriteGlobalIndex(test_root, data_type_, options_, array,
+                                                     Range(0, row_count - 1)));
+    ASSERT_OK_AND_ASSIGN(auto reader,
+                         CreateGlobalIndexReader(test_root, data_type_, options_, meta));
+    auto search = [&](int32_t limit, const std::vector<int64_t>& allowed_ids,
+                      VectorSearch::PreFilter filter) -> Result<RoaringBitmap64> {
+        auto vector_search = std::make_shared<VectorSearch>("f0", limit, query_, filter,
+                                                            /*predicate=*/nullptr);
+        PAIMON_ASSIGN_OR_RAISE(
+            std::shared_ptr<VectorSearchGlobalIndexResult> result,
+            reader->VisitVectorSearch(vector_search->ReplacePreFilterBitmap(
+                std::make_shared<RoaringBitmap64>(RoaringBitmap64::From(allowed_ids)))));
+        auto typed_result = std::dynamic_pointer_cast<BitmapVectorSearchGlobalIndexResult>(result);
+        if (!typed_result) {
+            return Status::Invalid("unexpected vector search result");
+        }
+        return typed_result->bitmap_;
+    };
+    {
+        // a sparse bitmap is probed directly
+        std::vector<int64_t> allowed_ids = {7, 77, 777, 7777};
+        ASSERT_LT(static_cast<int64_t>(allowed_ids.size()) * LuminaIndexReader::SPARSE_FILTER_RATIO,
+                  row_count);
+        ASSERT_OK_AND_ASSIGN(RoaringBitmap64 result, search(10, allowed_ids, nullptr));
+        ASSERT_EQ(RoaringBitmap64::From(allowed_ids), result);
+        auto filter = [](int64_t id) -> bool { return id != 77; };
+        ASSERT_OK_AND_ASSIGN(result, search(10, allowed_ids, filter));
+        ASSERT_EQ(RoaringBitmap64::From({7, 777, 7777}), result);
+    }
+    {
+        // a dense bitmap is expanded to a bitset
+        std::vector<int64_t> allowed_ids;
+        for (int64_t id = 0; id < row_count; id += 2) {
+            allowed_ids.push_back(id);
+        }
+        ASSERT_OK_AND_ASSIGN(RoaringBitmap64 result, search(10, allowed_ids, nullptr));
+        ASSERT_EQ(10, result.Cardinality());
+        for (auto iter = result.Begin(); iter != result.End(); ++iter) {
+            ASSERT_EQ(0, *iter % 2);
+        }
+    }
+}
+
 TEST_F(LuminaGlobalIndexTest, TestInvalidInputs) {
     auto test_root_dir = paimon::test::UniqueTestDirectory::Create();
     ASSERT_TRUE(test_root_dir);
@@ -147,6 +147,17 @@ class TestHelper {
         return commit_messages;
     }
 
+    Status Commit(const std::vector<std::shared_ptr<CommitMessage>>& commit_messages,
+                  int64_t commit_identifier) {
+        return commit_->Commit(commit_messages, commit_identifier);
+    }
+
+    Status Overwrite(const std::vector<std::map<std::string, std::string>>& partitions,
+                     const std::vector<std::shared_ptr<CommitMessage>>& commit_messages,
+                     int64_t commit_identifier) {
+        return commit_->Overwrite(partitions, commit_messages, commit_identifier);
+    }
+
     Result<std::vector<std::shared_ptr<Split>>> NewScan(StartupMode startup_mode,
                                                         std::optional<int64_t> snapshot_id,
                                                         bool is_streaming = true) {
@@ -0,0 +1,173 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/c/bridge.h"
+#include "arrow/c/helpers.h"
+#include "benchmark/benchmark.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/defs.h"
+#include "paimon/macros.h"
+#include "paimon/record_batch.h"
+#include "paimon/reader/batch_reader.h"
+#include "paimon/result.h"
+#include "paimon/status.h"
+#include "paimon/testing/utils/test_helper.h"
+#include "paimon/testing/utils/testharness.h"
+
+/// Skip the benchmark with the error message and return if `status` is not ok.
+#define PAIMON_BENCHMARK_RETURN_NOT_OK(state, status)      \
+    do {                                                   \
+        ::paimon::Status __s = (status);                   \
+        if (PAIMON_UNLIKELY(!__s.ok())) {                  \
+            (state).SkipWithError(__s.ToString().c_str()); \
+            return;                                        \
+        }                                                  \
+    } while (false)
+
+#define PAIMON_BENCHMARK_ASSIGN_OR_RETURN_IMPL(result_name, state, lhs, rexpr) \
+    auto&& result_name = (rexpr);                                             \
+    PAIMON_BENCHMARK_RETURN_NOT_OK(state, (result_name).status());            \
+    lhs = std::move(result_name).value();
+
+/// Assign the value of `rexpr` to `lhs`, or skip the benchmark with the error message and
+/// return if `rexpr` is not ok.
+#define PAIMON_BENCHMARK_ASSIGN_OR_RETURN(state, lhs, rexpr)                             \
+    PAIMON_BENCHMARK_ASSIGN_OR_RETURN_IMPL(                                                  \
+        PAIMON_ASSIGN_OR_RAISE_NAME(_error_or_value, __COUNTER__), state, lhs, rexpr);
+
+namespace paimon::test {
+
+/// Data generator and table helpers shared by the benchmarks.
+///
+/// The generated rows have a bigint key `f0`, an int `f1`, a double `f2` and a string `f3`, and
+/// are deterministic for the same seed, so that the results of different runs are comparable.
+class BenchmarkUtil {
+ public:
+    static arrow::FieldVector Fields() {
+        return {arrow::field("f0", arrow::int64()), arrow::field("f1", arrow::int32()),
+                arrow::field("f2", arrow::float64()), arrow::field("f3", arrow::utf8())};
+    }
+
+    /// Generate `num_rows` rows whose keys are `key_start`, `key_start + key_step`, ...
+    static Result<std::shared_ptr<arrow::Array>> GenerateArray(int64_t num_rows, int64_t key_start,
+                                                               int64_t key_step, uint32_t seed) {
+        std::mt19937 engine(seed);
+        std::uniform_int_distribution<int32_t> int_distribution(0, 1 << 20);
+        std::uniform_real_distribution<double> double_distribution(0, 1);
+        arrow::StructBuilder struct_builder(
+            arrow::struct_(Fields()), arrow::default_memory_pool(),
+            {std::make_shared<arrow::Int64Builder>(), std::make_shared<arrow::Int32Builder>(),
+             std::make_shared<arrow::DoubleBuilder>(), std::make_shared<arrow::StringBuilder>()});
+        auto key_builder = static_cast<arrow::Int64Builder*>(struct_builder.field_builder(0));
+        auto int_builder = static_cast<arrow::Int32Builder*>(struct_builder.field_builder(1));
+        auto double_builder = static_cast<arrow::DoubleBuilder*>(struct_builder.field_builder(2));
+        auto string_builder = static_cast<arrow::StringBuilder*>(struct_builder.field_builder(3));
+        for (int64_t i = 0; i < num_rows; i++) {
+            int32_t value = int_distribution(engine);
+            PAIMON_RETURN_NOT_OK_FROM_ARROW(struct_builder.Append());
+            PAIMON_RETURN_NOT_OK_FROM_ARROW(key_builder->Append(key_start + i * key_step));
+            PAIMON_RETURN_NOT_OK_FROM_ARROW(int_builder->Append(value));
+            PAIMON_RETURN_NOT_OK_FROM_ARROW(double_builder->Append(double_distribution(engine)));
+            PAIMON_RETURN_NOT_OK_FROM_ARROW(
+                string_builder->Append("value-" + std::to_string(value)));
+        }
+        std::shared_ptr<arrow::Array> array;
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(struct_builder.Finish(&array));
+        return array;
+    }
+
+    static Result<std::unique_ptr<RecordBatch>> MakeRecordBatch(
+        const std::shared_ptr<arrow::Array>& array, int32_t bucket) {
+        ::ArrowArray c_array;
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(*array, &c_array));
+        RecordBatchBuilder batch_builder(&c_array);
+        return batch_builder.SetBucket(bucket).Finish();
+    }
+
+    /// Create a table with `Fields()` in a new directory owned by `dir`, the table is a primary
+    /// key table on `f0` if `primary_key` is true.
+    static Result<std::unique_ptr<TestHelper>> CreateTable(
+        bool primary_key, const std::map<std::string, std::string>& options,
+        std::unique_ptr<UniqueTestDirectory>* dir) {
+        *dir = UniqueTestDirectory::Create();
+        if (!*dir) {
+            return Status::IOError("fail to create benchmark directory");
+        }
+        std::map<std::string, std::string> table_options = {
+            {Options::MANIFEST_FORMAT, "orc"},
+            {Options::FILE_FORMAT, "orc"},
+            {Options::BUCKET, primary_key ? "1" : "-1"},
+            {Options::FILE_SYSTEM, "local"},
+        };
+        for (const auto& [key, value] : options) {
+            table_options[key] = value;
+        }
+        std::vector<std::string> primary_keys;
+        if (primary_key) {
+            primary_keys.push_back("f0");
+        }
+        return TestHelper::Create((*dir)->Str(), arrow::schema(Fields()),
+                                  /*partition_keys=*/{}, primary_keys, table_options,
+                                  /*is_streaming_mode=*/primary_key);
+    }
+
+    /// Write `array` as a batch to bucket 0 and commit it.
+    static Status WriteAndCommit(TestHelper* helper, const std::shared_ptr<arrow::Array>& array,
+                                 int64_t commit_identifier) {
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<RecordBatch> batch,
+                               MakeRecordBatch(array, /*bucket=*/0));
+        return helper
+            ->WriteAndCommit(std::move(batch), commit_identifier,
+                             /*expected_commit_messages=*/std::nullopt)
+            .status();
+    }
+
+    /// Read all the splits with `read_context_builder` and return the number of rows read.
+    static Result<int64_t> ReadAll(ReadContextBuilder* read_context_builder,
+                                   const std::vector<std::shared_ptr<Split>>& splits) {
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<ReadContext> read_context,
+                               read_context_builder->Finish());
+        PAIMON_ASSIGN_OR_RAISE(auto table_read, TableRead::Create(std::move(read_context)));
+        PAIMON_ASSIGN_OR_RAISE(auto batch_reader, table_read->CreateReader(splits));
+        int64_t num_rows = 0;
+        while (true) {
+            PAIMON_ASSIGN_OR_RAISE(BatchReader::ReadBatchWithBitmap batch_with_bitmap,
+                                   batch_reader->NextBatchWithBitmap());
+            if (BatchReader::IsEofBatch(batch_with_bitmap)) {
+                break;
+            }
+            auto& [batch, bitmap] = batch_with_bitmap;
+            num_rows += bitmap.Cardinality();
+            ArrowArrayRelease(batch.first.get());
+            ArrowSchemaRelease(batch.second.get());
+        }
+        batch_reader->Close();
+        return num_rows;
+    }
+};
+
+}  // namespace paimon::test
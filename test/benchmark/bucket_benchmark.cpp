@@ -0,0 +1,69 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/c/bridge.h"
+#include "benchmark/benchmark.h"
+#include "benchmark_util.h"
+#include "paimon/utils/bucket_id_calculator.h"
+
+namespace paimon::test {
+
+// Throughput of calculating the bucket ids of a batch, the argument is the number of rows.
+static void BM_BucketIdCalculator(benchmark::State& state, bool string_key) {
+    int64_t num_rows = state.range(0);
+    PAIMON_BENCHMARK_ASSIGN_OR_RETURN(
+        state, auto array,
+        BenchmarkUtil::GenerateArray(num_rows, /*key_start=*/0, /*key_step=*/7, /*seed=*/0));
+    auto struct_array = std::static_pointer_cast<arrow::StructArray>(array);
+    // bigint key f0 or string key f3
+    int32_t key_index = string_key ? 3 : 0;
+    auto bucket_field = BenchmarkUtil::Fields()[key_index];
+    auto bucket_schema = arrow::schema({bucket_field});
+    auto bucket_keys = arrow::StructArray::Make({struct_array->field(key_index)}, {bucket_field});
+    PAIMON_BENCHMARK_RETURN_NOT_OK(state, ToPaimonStatus(bucket_keys.status()));
+    PAIMON_BENCHMARK_ASSIGN_OR_RETURN(
+        state, auto calculator,
+        BucketIdCalculator::Create(/*is_pk_table=*/true, /*num_buckets=*/128));
+    std::vector<int32_t> bucket_ids(num_rows);
+    for (auto _ : state) {
+        ::ArrowArray c_bucket_keys;
+        ::ArrowSchema c_bucket_schema;
+        PAIMON_BENCHMARK_RETURN_NOT_OK(
+            state, ToPaimonStatus(arrow::ExportArray(**bucket_keys, &c_bucket_keys)));
+        PAIMON_BENCHMARK_RETURN_NOT_OK(
+            state, ToPaimonStatus(arrow::ExportSchema(*bucket_schema, &c_bucket_schema)));
+        PAIMON_BENCHMARK_RETURN_NOT_OK(
+            state, calculator->CalculateBucketIds(&c_bucket_keys, &c_bucket_schema,
+                                                  bucket_ids.data()));
+        benchmark::DoNotOptimize(bucket_ids.data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_rows);
+}
+
+BENCHMARK_CAPTURE(BM_BucketIdCalculator, bigint, false)
+    ->RangeMultiplier(16)
+    ->Range(1024, 1 << 20);
+BENCHMARK_CAPTURE(BM_BucketIdCalculator, string, true)
+    ->RangeMultiplier(16)
+    ->Range(1024, 1 << 20);
+
+}  // namespace paimon::test
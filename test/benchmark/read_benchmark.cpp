@@ -0,0 +1,120 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_util.h"
+#include "paimon/defs.h"
+#include "paimon/predicate/literal.h"
+#include "paimon/predicate/predicate_builder.h"
+#include "paimon/table/source/startup_mode.h"
+
+namespace paimon::test {
+
+// Throughput of reading a primary key table whose sorted runs overlap each other, the argument
+// is the number of runs. Each run is a commit of the same keys, so that all the rows of the runs
+// are merged by the sort merge reader.
+static void BM_MergeRead(benchmark::State& state) {
+    constexpr int64_t kNumKeys = 64 * 1024;
+    int64_t num_runs = state.range(0);
+    std::unique_ptr<UniqueTestDirectory> dir;
+    PAIMON_BENCHMARK_ASSIGN_OR_RETURN(
+        state, auto helper, BenchmarkUtil::CreateTable(/*primary_key=*/true, {}, &dir));
+    for (int64_t i = 0; i < num_runs; i++) {
+        PAIMON_BENCHMARK_ASSIGN_OR_RETURN(
+            state, auto array,
+            BenchmarkUtil::GenerateArray(kNumKeys, /*key_start=*/0, /*key_step=*/1, i));
+        PAIMON_BENCHMARK_RETURN_NOT_OK(state,
+                                       BenchmarkUtil::WriteAndCommit(helper.get(), array, i));
+    }
+    PAIMON_BENCHMARK_ASSIGN_OR_RETURN(
+        state, auto splits,
+        helper->NewScan(StartupMode::LatestFull(), /*snapshot_id=*/std::nullopt,
+                        /*is_streaming=*/false));
+    for (auto _ : state) {
+        ReadContextBuilder read_context_builder(helper->table_path_);
+        read_context_builder.SetOptions(helper->options_);
+        PAIMON_BENCHMARK_ASSIGN_OR_RETURN(state, int64_t num_rows,
+                                          BenchmarkUtil::ReadAll(&read_context_builder, splits));
+        if (num_rows != kNumKeys) {
+            state.SkipWithError("unexpected number of rows after merge");
+            return;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * num_runs * kNumKeys);
+}
+
+BENCHMARK(BM_MergeRead)->RangeMultiplier(2)->Range(1, 16)->Unit(benchmark::kMillisecond);
+
+// Throughput of reading an append table with a range predicate on the key, the argument is the
+// selectivity of the predicate in percent.
+static void BM_PredicateFilter(benchmark::State& state, const std::string& file_format) {
+    constexpr int64_t kNumRows = 256 * 1024;
+    constexpr int32_t kNumFiles = 8;
+    int64_t selectivity = state.range(0);
+    std::unique_ptr<UniqueTestDirectory> dir;
+    PAIMON_BENCHMARK_ASSIGN_OR_RETURN(
+        state, auto helper,
+        BenchmarkUtil::CreateTable(/*primary_key=*/false, {{Options::FILE_FORMAT, file_format}},
+                                   &dir));
+    for (int32_t i = 0; i < kNumFiles; i++) {
+        PAIMON_BENCHMARK_ASSIGN_OR_RETURN(
+            state, auto array,
+            BenchmarkUtil::GenerateArray(kNumRows / kNumFiles,
+                                         /*key_start=*/i * kNumRows / kNumFiles, /*key_step=*/1,
+                                         i));
+        PAIMON_BENCHMARK_RETURN_NOT_OK(state,
+                                       BenchmarkUtil::WriteAndCommit(helper.get(), array, i));
+    }
+    PAIMON_BENCHMARK_ASSIGN_OR_RETURN(
+        state, auto splits,
+        helper->NewScan(StartupMode::LatestFull(), /*snapshot_id=*/std::nullopt,
+                        /*is_streaming=*/false));
+    auto predicate = PredicateBuilder::LessThan(
+        /*field_index=*/0, /*field_name=*/"f0", FieldType::BIGINT,
+        Literal(static_cast<int64_t>(kNumRows * selectivity / 100)));
+    for (auto _ : state) {
+        ReadContextBuilder read_context_builder(helper->table_path_);
+        read_context_builder.SetOptions(helper->options_)
+            .SetPredicate(predicate)
+            .EnablePredicateFilter(true);
+        PAIMON_BENCHMARK_ASSIGN_OR_RETURN(state, int64_t num_rows,
+                                          BenchmarkUtil::ReadAll(&read_context_builder, splits));
+        benchmark::DoNotOptimize(num_rows);
+    }
+    state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+BENCHMARK_CAPTURE(BM_PredicateFilter, orc, std::string("orc"))
+    ->Arg(1)
+    ->Arg(10)
+    ->Arg(50)
+    ->Arg(100)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_PredicateFilter, parquet, std::string("parquet"))
+    ->Arg(1)
+    ->Arg(10)
+    ->Arg(50)
+    ->Arg(100)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace paimon::test
@@ -0,0 +1,157 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "arrow/api.h"
+#include "arrow/c/abi.h"
+#include "arrow/c/bridge.h"
+#include "benchmark/benchmark.h"
+#include "benchmark_util.h"
+#include "paimon/common/reader/arrow_batch_reader.h"
+#include "paimon/common/reader/reader_utils.h"
+#include "paimon/common/utils/arrow/status_utils.h"
+#include "paimon/utils/roaring_bitmap32.h"
+
+namespace paimon::test {
+namespace {
+constexpr int64_t kBatchSize = 1024;
+constexpr int64_t kNumBatches = 1024;
+
+// Returns the same array for kNumBatches times.
+class RepeatArrayReader : public ArrowBatchReader {
+ public:
+    explicit RepeatArrayReader(const std::shared_ptr<arrow::Array>& array) : array_(array) {}
+
+    Result<ReadBatch> NextBatch() override {
+        return Status::Invalid("RepeatArrayReader should use NextBatchWithBitmap");
+    }
+
+    Result<ArrowBatchWithBitmap> NextArrowBatchWithBitmap() override {
+        if (num_batches_++ >= kNumBatches) {
+            return MakeEofArrowBatch();
+        }
+        RoaringBitmap32 bitmap;
+        bitmap.AddRange(0, array_->length());
+        return std::make_pair(array_, std::move(bitmap));
+    }
+
+    std::shared_ptr<Metrics> GetReaderMetrics() const override {
+        return nullptr;
+    }
+
+    void Close() override {}
+
+ private:
+    std::shared_ptr<arrow::Array> array_;
+    int64_t num_batches_ = 0;
+};
+
+// An inner stage which passes arrow arrays to the next stage.
+class ArrowStageReader : public ArrowBatchReader {
+ public:
+    explicit ArrowStageReader(std::unique_ptr<BatchReader>&& reader) : reader_(std::move(reader)) {}
+
+    Result<ReadBatch> NextBatch() override {
+        return Status::Invalid("ArrowStageReader should use NextBatchWithBitmap");
+    }
+
+    Result<ArrowBatchWithBitmap> NextArrowBatchWithBitmap() override {
+        return NextArrowBatchOf(reader_.get());
+    }
+
+    std::shared_ptr<Metrics> GetReaderMetrics() const override {
+        return nullptr;
+    }
+
+    void Close() override {}
+
+ private:
+    std::unique_ptr<BatchReader> reader_;
+};
+
+// An inner stage which imports the batch from the C data interface and exports it again, as the
+// inner readers did before `ArrowBatchReader`.
+class CAbiStageReader : public BatchReader {
+ public:
+    explicit CAbiStageReader(std::unique_ptr<BatchReader>&& reader) : reader_(std::move(reader)) {}
+
+    Result<ReadBatch> NextBatch() override {
+        return Status::Invalid("CAbiStageReader should use NextBatchWithBitmap");
+    }
+
+    Result<ReadBatchWithBitmap> NextBatchWithBitmap() override {
+        PAIMON_ASSIGN_OR_RAISE(ReadBatchWithBitmap batch_with_bitmap,
+                               reader_->NextBatchWithBitmap());
+        if (BatchReader::IsEofBatch(batch_with_bitmap)) {
+            return batch_with_bitmap;
+        }
+        auto& [c_array, c_schema] = batch_with_bitmap.first;
+        PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::Array> array,
+                                          arrow::ImportArray(c_array.get(), c_schema.get()));
+        PAIMON_RETURN_NOT_OK_FROM_ARROW(arrow::ExportArray(*array, c_array.get(), c_schema.get()));
+        return batch_with_bitmap;
+    }
+
+    std::shared_ptr<Metrics> GetReaderMetrics() const override {
+        return nullptr;
+    }
+
+    void Close() override {}
+
+ private:
+    std::unique_ptr<BatchReader> reader_;
+};
+
+template <typename StageReader>
+std::unique_ptr<BatchReader> MakeReaderStack(const std::shared_ptr<arrow::Array>& array,
+                                             int64_t num_stages) {
+    std::unique_ptr<BatchReader> reader = std::make_unique<RepeatArrayReader>(array);
+    for (int64_t i = 0; i < num_stages; i++) {
+        reader = std::make_unique<StageReader>(std::move(reader));
+    }
+    return reader;
+}
+}  // namespace
+
+// Per batch overhead of a stack of inner readers, the argument is the number of stages. Batches
+// are exported once at the top of the stack, which is the boundary of the read pipeline.
+template <typename StageReader>
+static void BM_ReaderStack(benchmark::State& state) {
+    int64_t num_stages = state.range(0);
+    PAIMON_BENCHMARK_ASSIGN_OR_RETURN(
+        state, auto array,
+        BenchmarkUtil::GenerateArray(kBatchSize, /*key_start=*/0, /*key_step=*/1, /*seed=*/0));
+    for (auto _ : state) {
+        auto reader = MakeReaderStack<StageReader>(array, num_stages);
+        while (true) {
+            PAIMON_BENCHMARK_ASSIGN_OR_RETURN(state, auto batch_with_bitmap,
+                                              reader->NextBatchWithBitmap());
+            if (BatchReader::IsEofBatch(batch_with_bitmap)) {
+                break;
+            }
+            ReaderUtils::ReleaseReadBatch(std::move(batch_with_bitmap.first));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kNumBatches);
+}
+
+BENCHMARK_TEMPLATE(BM_ReaderStack, ArrowStageReader)->DenseRange(1, 6);
+BENCHMARK_TEMPLATE(BM_ReaderStack, CAbiStageReader)->DenseRange(1, 6);
+
+}  // namespace paimon::test
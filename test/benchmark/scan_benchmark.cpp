@@ -0,0 +1,60 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_util.h"
+#include "paimon/defs.h"
+#include "paimon/table/source/startup_mode.h"
+
+namespace paimon::test {
+
+// Latency of planning a full scan, the argument is the number of manifest files of the table.
+// Each commit adds a manifest file, and manifests are never merged.
+static void BM_ScanPlan(benchmark::State& state) {
+    int64_t num_manifests = state.range(0);
+    std::unique_ptr<UniqueTestDirectory> dir;
+    PAIMON_BENCHMARK_ASSIGN_OR_RETURN(
+        state, auto helper,
+        BenchmarkUtil::CreateTable(/*primary_key=*/false,
+                                   {{Options::MANIFEST_MERGE_MIN_COUNT, "1000000"}}, &dir));
+    PAIMON_BENCHMARK_ASSIGN_OR_RETURN(
+        state, auto array,
+        BenchmarkUtil::GenerateArray(/*num_rows=*/16, /*key_start=*/0, /*key_step=*/1,
+                                     /*seed=*/0));
+    for (int64_t i = 0; i < num_manifests; i++) {
+        PAIMON_BENCHMARK_RETURN_NOT_OK(state,
+                                       BenchmarkUtil::WriteAndCommit(helper.get(), array, i));
+    }
+    for (auto _ : state) {
+        PAIMON_BENCHMARK_ASSIGN_OR_RETURN(
+            state, auto splits,
+            helper->NewScan(StartupMode::LatestFull(), /*snapshot_id=*/std::nullopt,
+                            /*is_streaming=*/false));
+        benchmark::DoNotOptimize(splits);
+    }
+    state.counters["manifests"] = static_cast<double>(num_manifests);
+}
+
+BENCHMARK(BM_ScanPlan)->RangeMultiplier(4)->Range(1, 256)->Unit(benchmark::kMillisecond);
+
+}  // namespace paimon::test
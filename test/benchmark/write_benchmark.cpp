@@ -0,0 +1,118 @@
+/*
+ * Copyright 2026-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_util.h"
+#include "paimon/defs.h"
+
+namespace paimon::test {
+
+// Write throughput of an append table in each file format, the argument is the number of rows
+// of each batch. A commit is made after the batches are written, so that the files are flushed.
+static void BM_WriteThroughput(benchmark::State& state, const std::string& file_format) {
+    constexpr int32_t kNumBatches = 16;
+    int64_t num_rows = state.range(0);
+    std::vector<std::shared_ptr<arrow::Array>> arrays;
+    for (int32_t i = 0; i < kNumBatches; i++) {
+        PAIMON_BENCHMARK_ASSIGN_OR_RETURN(
+            state, auto array,
+            BenchmarkUtil::GenerateArray(num_rows, /*key_start=*/i * num_rows, /*key_step=*/1,
+                                         /*seed=*/i));
+        arrays.push_back(std::move(array));
+    }
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::unique_ptr<UniqueTestDirectory> dir;
+        PAIMON_BENCHMARK_ASSIGN_OR_RETURN(
+            state, auto helper,
+            BenchmarkUtil::CreateTable(/*primary_key=*/false,
+                                       {{Options::FILE_FORMAT, file_format}}, &dir));
+        state.ResumeTiming();
+        for (const auto& array : arrays) {
+            PAIMON_BENCHMARK_ASSIGN_OR_RETURN(state, auto batch,
+                                              BenchmarkUtil::MakeRecordBatch(array, /*bucket=*/0));
+            PAIMON_BENCHMARK_RETURN_NOT_OK(state, helper->write_->Write(std::move(batch)));
+        }
+        PAIMON_BENCHMARK_ASSIGN_OR_RETURN(
+            state, auto commit_messages,
+            helper->write_->PrepareCommit(/*wait_compaction=*/false, /*commit_identifier=*/0));
+        benchmark::DoNotOptimize(commit_messages);
+        state.PauseTiming();
+        helper.reset();
+        dir.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * kNumBatches * num_rows);
+}
+
+BENCHMARK_CAPTURE(BM_WriteThroughput, orc, std::string("orc"))
+    ->RangeMultiplier(8)
+    ->Range(1024, 64 * 1024)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_WriteThroughput, parquet, std::string("parquet"))
+    ->RangeMultiplier(8)
+    ->Range(1024, 64 * 1024)
+    ->Unit(benchmark::kMillisecond);
+#ifdef PAIMON_ENABLE_AVRO
+BENCHMARK_CAPTURE(BM_WriteThroughput, avro, std::string("avro"))
+    ->RangeMultiplier(8)
+    ->Range(1024, 64 * 1024)
+    ->Unit(benchmark::kMillisecond);
+#endif
+
+// Latency of committing a small append, the argument is the number of snapshots committed to
+// the table before, so that the cost of reading the previous manifests is included.
+static void BM_CommitLatency(benchmark::State& state) {
+    int64_t num_previous_commits = state.range(0);
+    std::unique_ptr<UniqueTestDirectory> dir;
+    // keep all the manifests, so that the manifest count grows with the commits
+    PAIMON_BENCHMARK_ASSIGN_OR_RETURN(
+        state, auto helper,
+        BenchmarkUtil::CreateTable(/*primary_key=*/false,
+                                   {{Options::MANIFEST_MERGE_MIN_COUNT, "1000000"}}, &dir));
+    PAIMON_BENCHMARK_ASSIGN_OR_RETURN(
+        state, auto array,
+        BenchmarkUtil::GenerateArray(/*num_rows=*/16, /*key_start=*/0, /*key_step=*/1,
+                                     /*seed=*/0));
+    int64_t commit_identifier = 0;
+    for (int64_t i = 0; i < num_previous_commits; i++) {
+        PAIMON_BENCHMARK_RETURN_NOT_OK(
+            state, BenchmarkUtil::WriteAndCommit(helper.get(), array, commit_identifier++));
+    }
+    for (auto _ : state) {
+        state.PauseTiming();
+        PAIMON_BENCHMARK_ASSIGN_OR_RETURN(state, auto batch,
+                                          BenchmarkUtil::MakeRecordBatch(array, /*bucket=*/0));
+        PAIMON_BENCHMARK_RETURN_NOT_OK(state, helper->write_->Write(std::move(batch)));
+        PAIMON_BENCHMARK_ASSIGN_OR_RETURN(
+            state, auto commit_messages,
+            helper->write_->PrepareCommit(/*wait_compaction=*/false, commit_identifier));
+        state.ResumeTiming();
+        PAIMON_BENCHMARK_RETURN_NOT_OK(
+            state, helper->commit_->Commit(commit_messages, commit_identifier++));
+    }
+}
+
+BENCHMARK(BM_CommitLatency)->Arg(0)->Arg(16)->Arg(128)->Unit(benchmark::kMillisecond);
+
+}  // namespace paimon::test
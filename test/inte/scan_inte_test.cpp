@@ -14,8 +14,10 @@
  * limitations under the License.
  */
 
+#include <chrono>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
@@ -828,6 +830,42 @@ TEST_F(ScanInteTest, TestScanAppendWithStreamOfFromSnapshotMode) {
     CheckStreamScanResult(table_scan.get(), expected_snapshot_ids, expected_data_splits);
 }
 
+TEST_F(ScanInteTest, TestWaitForNextPlanWithStreamOfFromSnapshotMode) {
+    std::string table_path = paimon::test::GetDataDir() + "orc/append_09.db/append_09";
+
+    ScanContextBuilder context_builder(table_path);
+    context_builder.AddOption(Options::SCAN_MODE, StartupMode::FromSnapshot().ToString())
+        .AddOption(Options::SCAN_SNAPSHOT_ID, "2")
+        .AddOption(Options::CONTINUOUS_DISCOVERY_INTERVAL, "100ms")
+        .WithStreamingMode(true);
+    ASSERT_OK_AND_ASSIGN(auto scan_context, context_builder.Finish());
+    ASSERT_OK_AND_ASSIGN(auto table_scan, TableScan::Create(std::move(scan_context)));
+
+    ASSERT_NOK(table_scan->WaitForNextPlan(/*timeout_ms=*/100, /*max_plans=*/0));
+    // the empty first plan is skipped, plans of consecutive snapshots are returned in one call
+    ASSERT_OK_AND_ASSIGN(auto plans,
+                         table_scan->WaitForNextPlan(/*timeout_ms=*/100, /*max_plans=*/2));
+    ASSERT_EQ(2, plans.size());
+    ASSERT_EQ(2, plans[0]->SnapshotId());
+    ASSERT_EQ(2, plans[0]->Splits().size());
+    ASSERT_EQ(3, plans[1]->SnapshotId());
+    ASSERT_EQ(1, plans[1]->Splits().size());
+
+    // a timeout which overflows the deadline is clamped, plans are returned without waiting
+    ASSERT_OK_AND_ASSIGN(plans, table_scan->WaitForNextPlan(
+                                    /*timeout_ms=*/std::numeric_limits<int64_t>::max(),
+                                    /*max_plans=*/10));
+    ASSERT_EQ(1, plans.size());
+    ASSERT_EQ(4, plans[0]->SnapshotId());
+    ASSERT_EQ(1, plans[0]->Splits().size());
+
+    // no more snapshot to read, wait until timeout
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_OK_AND_ASSIGN(plans, table_scan->WaitForNextPlan(/*timeout_ms=*/200, /*max_plans=*/10));
+    ASSERT_TRUE(plans.empty());
+    ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(200));
+}
+
 TEST_F(ScanInteTest, TestScanAppendWithStreamOfFromSnapshotFullMode) {
     std::string table_path = paimon::test::GetDataDir() + "orc/append_09.db/append_09";
 
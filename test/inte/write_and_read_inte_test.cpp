@@ -28,6 +28,8 @@
 #include "paimon/common/utils/date_time_utils.h"
 #include "paimon/common/utils/path_util.h"
 #include "paimon/common/utils/string_utils.h"
+#include "paimon/core/snapshot.h"
+#include "paimon/core/table/sink/commit_message_impl.h"
 #include "paimon/defs.h"
 #include "paimon/fs/file_system.h"
 #include "paimon/result.h"
@@ -37,6 +39,7 @@
 #include "paimon/testing/utils/testharness.h"
 
 namespace paimon {
+class CommitMessage;
 class DataSplit;
 class RecordBatch;
 }  // namespace paimon
@@ -178,6 +181,100 @@ TEST_P(WriteAndReadInteTest, TestPKSimple) {
     ASSERT_TRUE(success);
 }
 
+TEST_P(WriteAndReadInteTest, TestPKLookupChangelog) {
+    arrow::FieldVector fields = {
+        arrow::field("pk", arrow::utf8()),
+        arrow::field("f1", arrow::int32()),
+        arrow::field("f2", arrow::float64()),
+    };
+    auto schema = arrow::schema(fields);
+    auto [file_format, file_system] = GetParam();
+    std::map<std::string, std::string> options = {
+        {Options::MANIFEST_FORMAT, "orc"},
+        {Options::FILE_FORMAT, file_format},
+        {Options::BUCKET, "1"},
+        {Options::FILE_SYSTEM, file_system},
+        {Options::CHANGELOG_PRODUCER, "lookup"},
+        {Options::SNAPSHOT_NUM_RETAINED_MAX, "1"},
+        {Options::SNAPSHOT_NUM_RETAINED_MIN, "1"},
+    };
+    if (file_system == "jindo") {
+        options = AddOptionsForJindo(options);
+    }
+    ASSERT_OK_AND_ASSIGN(auto helper, TestHelper::Create(test_dir_, schema, /*partition_keys=*/{},
+                                                         /*primary_keys=*/{"pk"}, options,
+                                                         /*is_streaming_mode=*/true));
+    auto changelog_paths = [&](const std::vector<std::shared_ptr<CommitMessage>>& commit_msgs) {
+        std::vector<std::string> paths;
+        for (const auto& commit_msg : commit_msgs) {
+            auto msg = std::dynamic_pointer_cast<CommitMessageImpl>(commit_msg);
+            for (const auto& file : msg->GetNewFilesIncrement().ChangelogFiles()) {
+                paths.push_back(
+                    PathUtil::JoinPath(helper->table_path_, "bucket-0/" + file->file_name));
+            }
+        }
+        return paths;
+    };
+    int64_t commit_identifier = 0;
+    std::string data_1 = R"([
+            ["lucy", 14, 5.2],
+            ["dog", 1, 4.1]
+    ])";
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<RecordBatch> batch_1,
+                         TestHelper::MakeRecordBatch(arrow::struct_(fields), data_1,
+                                                     /*partition_map=*/{}, /*bucket=*/0, {}));
+    ASSERT_OK_AND_ASSIGN(auto commit_msgs_1,
+                         helper->WriteAndCommit(std::move(batch_1), commit_identifier++,
+                                                /*expected_commit_messages=*/std::nullopt));
+    std::vector<std::string> changelog_paths_1 = changelog_paths(commit_msgs_1);
+    ASSERT_EQ(1, changelog_paths_1.size());
+
+    arrow::FieldVector fields_with_row_kind = fields;
+    fields_with_row_kind.insert(fields_with_row_kind.begin(),
+                                arrow::field("_VALUE_KIND", arrow::int8()));
+    auto data_type = arrow::struct_(fields_with_row_kind);
+    // the first plan reads the full snapshot
+    ASSERT_OK_AND_ASSIGN(std::vector<std::shared_ptr<Split>> data_splits,
+                         helper->NewScan(StartupMode::LatestFull(), /*snapshot_id=*/std::nullopt));
+    ASSERT_OK_AND_ASSIGN(bool success, helper->ReadAndCheckResult(data_type, data_splits, R"([
+            [0, "dog", 1, 4.1],
+            [0, "lucy", 14, 5.2]
+    ])"));
+    ASSERT_TRUE(success);
+
+    std::string data_2 = R"([
+            ["apple", 20, 23.0],
+            ["lucy", 15, 5.3]
+    ])";
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<RecordBatch> batch_2,
+                         TestHelper::MakeRecordBatch(arrow::struct_(fields), data_2,
+                                                     /*partition_map=*/{}, /*bucket=*/0, {}));
+    ASSERT_OK_AND_ASSIGN(auto commit_msgs_2,
+                         helper->WriteAndCommit(std::move(batch_2), commit_identifier++,
+                                                /*expected_commit_messages=*/std::nullopt));
+    std::vector<std::string> changelog_paths_2 = changelog_paths(commit_msgs_2);
+    ASSERT_EQ(1, changelog_paths_2.size());
+    ASSERT_OK_AND_ASSIGN(std::optional<Snapshot> snapshot, helper->LatestSnapshot());
+    ASSERT_TRUE(snapshot);
+    ASSERT_TRUE(snapshot->ChangelogManifestList());
+
+    // the follow-up plan only reads the changelog of the new snapshot
+    ASSERT_OK_AND_ASSIGN(data_splits, helper->Scan());
+    ASSERT_OK_AND_ASSIGN(success, helper->ReadAndCheckResult(data_type, data_splits, R"([
+            [0, "apple", 20, 23.0],
+            [1, "lucy", 14, 5.2],
+            [2, "lucy", 15, 5.3]
+    ])"));
+    ASSERT_TRUE(success);
+
+    // changelog files are deleted with the expired snapshot
+    ASSERT_OK(helper->commit_->Expire());
+    ASSERT_OK_AND_ASSIGN(bool exist, helper->fs_->Exists(changelog_paths_1[0]));
+    ASSERT_FALSE(exist);
+    ASSERT_OK_AND_ASSIGN(exist, helper->fs_->Exists(changelog_paths_2[0]));
+    ASSERT_TRUE(exist);
+}
+
 TEST_P(WriteAndReadInteTest, TestNestedType) {
     // map use list(struct(key, value)) as lance does not support map
     arrow::FieldVector fields = {
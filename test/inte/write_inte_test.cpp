@@ -39,6 +39,7 @@
 #include "arrow/type.h"
 #include "fmt/format.h"
 #include "gtest/gtest.h"
+#include "paimon/bucket_rescaler.h"
 #include "paimon/catalog/catalog.h"
 #include "paimon/catalog/identifier.h"
 #include "paimon/commit_context.h"
@@ -78,6 +79,7 @@
 #include "paimon/fs/file_system.h"
 #include "paimon/fs/local/local_file_system.h"
 #include "paimon/memory/memory_pool.h"
+#include "paimon/postpone_bucket_compactor.h"
 #include "paimon/read_context.h"
 #include "paimon/reader/batch_reader.h"
 #include "paimon/reader/file_batch_reader.h"
@@ -1773,6 +1775,100 @@ TEST_P(WriteInteTest, TestPkTableForceLookup) {
     ASSERT_TRUE(success);
 }
 
+TEST_P(WriteInteTest, TestPkTableKeyRangeSplits) {
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    arrow::FieldVector fields = {arrow::field("f0", arrow::utf8()),
+                                 arrow::field("f1", arrow::int32()),
+                                 arrow::field("f2", arrow::float64())};
+    auto schema = arrow::schema(fields);
+    std::vector<std::string> primary_keys = {"f0"};
+    auto file_format = GetParam();
+    std::map<std::string, std::string> options = {{Options::MANIFEST_FORMAT, "orc"},
+                                                  {Options::FILE_FORMAT, file_format},
+                                                  {Options::BUCKET, "1"},
+                                                  {Options::FILE_SYSTEM, "local"}};
+    ASSERT_OK_AND_ASSIGN(auto helper, TestHelper::Create(dir->Str(), schema, /*partition_keys=*/{},
+                                                         primary_keys, options,
+                                                         /*is_streaming_mode=*/true));
+    std::string table_path = PathUtil::JoinPath(dir->Str(), "foo.db/bar");
+    // each commit writes a level 0 file, so all files overlap in a single section
+    std::vector<std::pair<std::string, std::vector<RecordBatch::RowKind>>> commits = {
+        {R"([["a", 0, 0.1], ["c", 0, 0.2], ["e", 0, 0.3], ["g", 0, 0.4], ["i", 0, 0.5],
+             ["k", 0, 0.6], ["m", 0, 0.7], ["o", 0, 0.8]])",
+         {}},
+        {R"([["d", 1, 1.1], ["f", 1, 1.2], ["h", 1, 1.3], ["j", 1, 1.4], ["l", 1, 1.5],
+             ["n", 1, 1.6], ["p", 1, 1.7], ["r", 1, 1.8]])",
+         {}},
+        {R"([["b", 2, 2.1], ["e", 2, 2.2], ["j", 2, 2.3], ["m", 2, 2.4], ["q", 2, 2.5],
+             ["s", 2, 2.6], ["u", 2, 2.7], ["w", 2, 2.8]])",
+         {}},
+        {R"([["c", 0, 0.2], ["k", 3, 3.1], ["t", 3, 3.2], ["v", 3, 3.3], ["x", 3, 3.4]])",
+         {RecordBatch::RowKind::DELETE, RecordBatch::RowKind::INSERT,
+          RecordBatch::RowKind::INSERT, RecordBatch::RowKind::INSERT,
+          RecordBatch::RowKind::INSERT}}};
+    int64_t commit_identifier = 0;
+    for (const auto& [data, row_kinds] : commits) {
+        ASSERT_OK_AND_ASSIGN(std::unique_ptr<RecordBatch> batch,
+                             TestHelper::MakeRecordBatch(arrow::struct_(fields), data,
+                                                         /*partition_map=*/{}, /*bucket=*/0,
+                                                         row_kinds));
+        ASSERT_OK(helper->WriteAndCommit(std::move(batch), commit_identifier++,
+                                         /*expected_commit_messages=*/std::nullopt));
+    }
+    // reads each split alone and concatenates the results, as parallel readers would do
+    auto read_splits = [&](const std::vector<std::shared_ptr<Split>>& splits)
+        -> Result<std::shared_ptr<arrow::ChunkedArray>> {
+        ReadContextBuilder read_context_builder(table_path);
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<ReadContext> read_context,
+                               read_context_builder.SetOptions(options).Finish());
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<TableRead> table_read,
+                               TableRead::Create(std::move(read_context)));
+        arrow::ArrayVector chunks;
+        for (const auto& split : splits) {
+            PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<BatchReader> batch_reader,
+                                   table_read->CreateReader(split));
+            PAIMON_ASSIGN_OR_RAISE(std::shared_ptr<arrow::ChunkedArray> result,
+                                   ReadResultCollector::CollectResult(batch_reader.get()));
+            if (result) {
+                chunks.insert(chunks.end(), result->chunks().begin(), result->chunks().end());
+            }
+        }
+        PAIMON_ASSIGN_OR_RAISE_FROM_ARROW(std::shared_ptr<arrow::ChunkedArray> concatenated,
+                                          arrow::ChunkedArray::Make(chunks));
+        return concatenated;
+    };
+
+    ASSERT_OK_AND_ASSIGN(std::vector<std::shared_ptr<Split>> unsplit_splits,
+                         helper->NewScan(StartupMode::LatestFull(), /*snapshot_id=*/std::nullopt,
+                                         /*is_streaming=*/false));
+    ASSERT_EQ(1, unsplit_splits.size());
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<arrow::ChunkedArray> expected,
+                         read_splits(unsplit_splits));
+    ASSERT_EQ(23, expected->length());
+
+    ScanContextBuilder scan_context_builder(table_path);
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<ScanContext> scan_context,
+                         scan_context_builder.SetOptions(options)
+                             .AddOption(Options::SOURCE_SPLIT_KEY_RANGE_ENABLED, "true")
+                             .AddOption(Options::SOURCE_SPLIT_TARGET_SIZE, "1")
+                             .Finish());
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<TableScan> table_scan,
+                         TableScan::Create(std::move(scan_context)));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Plan> plan, table_scan->CreatePlan());
+    std::vector<std::shared_ptr<Split>> key_range_splits = plan->Splits();
+    ASSERT_GT(key_range_splits.size(), 1U);
+    for (const auto& split : key_range_splits) {
+        auto split_impl = std::dynamic_pointer_cast<DataSplitImpl>(split);
+        ASSERT_TRUE(split_impl);
+        ASSERT_TRUE(split_impl->LowerKey() || split_impl->UpperKey());
+    }
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<arrow::ChunkedArray> actual,
+                         read_splits(key_range_splits));
+    ASSERT_TRUE(expected->Equals(*actual)) << "expected: " << expected->ToString()
+                                           << "\nactual: " << actual->ToString();
+}
+
 TEST_P(WriteInteTest, TestPkTableEnableDeletionVector) {
     auto dir = UniqueTestDirectory::Create();
     ASSERT_TRUE(dir);
@@ -3394,6 +3490,314 @@ TEST_P(WriteInteTest, TestPkTablePostponeBucket) {
     ASSERT_TRUE(success);
 }
 
+TEST_P(WriteInteTest, TestPkTablePostponeBucketCompact) {
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    arrow::FieldVector fields = {
+        arrow::field("f0", arrow::utf8()), arrow::field("f1", arrow::int32()),
+        arrow::field("f2", arrow::int32()), arrow::field("f3", arrow::float64())};
+    auto schema = arrow::schema(fields);
+    std::vector<std::string> primary_keys = {"f0", "f1"};
+    auto file_format = GetParam();
+    std::map<std::string, std::string> options = {{Options::MANIFEST_FORMAT, "orc"},
+                                                  {Options::FILE_FORMAT, file_format},
+                                                  {Options::BUCKET, "-2"},
+                                                  {Options::FILE_SYSTEM, "local"}};
+    ASSERT_OK_AND_ASSIGN(auto helper, TestHelper::Create(dir->Str(), schema, /*partition_keys=*/{},
+                                                         primary_keys, options,
+                                                         /*is_streaming_mode=*/true));
+    std::string table_path = PathUtil::JoinPath(dir->Str(), "foo.db/bar");
+    int64_t commit_identifier = 0;
+    auto write_postponed = [&](const std::string& data,
+                               const std::vector<RecordBatch::RowKind>& row_kinds) {
+        ASSERT_OK_AND_ASSIGN(std::unique_ptr<RecordBatch> batch,
+                             TestHelper::MakeRecordBatch(arrow::struct_(fields), data,
+                                                         /*partition_map=*/{},
+                                                         /*bucket=*/-2, row_kinds));
+        ASSERT_OK(helper->WriteAndCommit(std::move(batch), commit_identifier++,
+                                         /*expected_commit_messages=*/std::nullopt));
+    };
+    auto compact = [&](const std::string& default_bucket_num)
+        -> Result<std::vector<std::shared_ptr<CommitMessage>>> {
+        auto compact_options = options;
+        compact_options[Options::POSTPONE_DEFAULT_BUCKET_NUM] = default_bucket_num;
+        WriteContextBuilder context_builder(table_path, "commit_user");
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<WriteContext> write_context,
+                               context_builder.SetOptions(compact_options).Finish());
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<PostponeBucketCompactor> compactor,
+                               PostponeBucketCompactor::Create(std::move(write_context)));
+        return compactor->Compact(/*partitions=*/{});
+    };
+    auto check_commit_messages = [](const std::vector<std::shared_ptr<CommitMessage>>& messages,
+                                    size_t expected_postponed_files) {
+        size_t postponed_files = 0;
+        for (const auto& message : messages) {
+            auto message_impl = std::dynamic_pointer_cast<CommitMessageImpl>(message);
+            ASSERT_TRUE(message_impl);
+            const auto& data_increment = message_impl->GetNewFilesIncrement();
+            if (message_impl->Bucket() == -2) {
+                ASSERT_TRUE(data_increment.NewFiles().empty());
+                postponed_files += data_increment.DeletedFiles().size();
+            } else {
+                // the table has a single bucket since the first compaction
+                ASSERT_EQ(0, message_impl->Bucket());
+                ASSERT_EQ(1, message_impl->TotalBuckets().value());
+                ASSERT_TRUE(data_increment.DeletedFiles().empty());
+            }
+        }
+        ASSERT_EQ(expected_postponed_files, postponed_files);
+    };
+    auto data_type = arrow::struct_({arrow::field("_VALUE_KIND", arrow::int8()), fields[0],
+                                     fields[1], fields[2], fields[3]});
+
+    write_postponed(R"([
+        ["Alice", 50, 0, 11.1],
+        ["Paul", 20, 1, 12.1],
+        ["Cathy", 30, 0, 13.1]
+    ])",
+                    {});
+    write_postponed(R"([
+        ["Alice", 50, 0, 21.1],
+        ["Cathy", 30, 0, 13.1]
+    ])",
+                    {RecordBatch::RowKind::INSERT, RecordBatch::RowKind::DELETE});
+    // postponed data is invisible to batch read before compaction
+    ASSERT_OK_AND_ASSIGN(std::vector<std::shared_ptr<Split>> data_splits,
+                         helper->NewScan(StartupMode::LatestFull(), /*snapshot_id=*/std::nullopt,
+                                         /*is_streaming=*/false));
+    ASSERT_TRUE(data_splits.empty());
+
+    // the table has no data in real buckets, so the default bucket number is used
+    ASSERT_OK_AND_ASSIGN(std::vector<std::shared_ptr<CommitMessage>> compact_messages,
+                         compact("1"));
+    check_commit_messages(compact_messages, /*expected_postponed_files=*/2);
+    ASSERT_OK(helper->Commit(compact_messages, commit_identifier++));
+    ASSERT_OK_AND_ASSIGN(data_splits,
+                         helper->NewScan(StartupMode::LatestFull(), /*snapshot_id=*/std::nullopt,
+                                         /*is_streaming=*/false));
+    ASSERT_EQ(data_splits.size(), 1);
+    ASSERT_OK_AND_ASSIGN(bool success, helper->ReadAndCheckResult(data_type, data_splits, R"([
+        [0, "Alice", 50, 0, 21.1],
+        [0, "Paul", 20, 1, 12.1]
+    ])"));
+    ASSERT_TRUE(success);
+
+    write_postponed(R"([
+        ["Bob", 10, 0, 1.5],
+        ["Paul", 20, 1, 22.1]
+    ])",
+                    {});
+    // the bucket number of the existing data is used rather than the default one
+    ASSERT_OK_AND_ASSIGN(compact_messages, compact("3"));
+    check_commit_messages(compact_messages, /*expected_postponed_files=*/1);
+    ASSERT_OK(helper->Commit(compact_messages, commit_identifier++));
+    ASSERT_OK_AND_ASSIGN(data_splits,
+                         helper->NewScan(StartupMode::LatestFull(), /*snapshot_id=*/std::nullopt,
+                                         /*is_streaming=*/false));
+    ASSERT_EQ(data_splits.size(), 1);
+    ASSERT_OK_AND_ASSIGN(success, helper->ReadAndCheckResult(data_type, data_splits, R"([
+        [0, "Alice", 50, 0, 21.1],
+        [0, "Bob", 10, 0, 1.5],
+        [0, "Paul", 20, 1, 22.1]
+    ])"));
+    ASSERT_TRUE(success);
+
+    // the retract rows of the postponed files delete and update the keys already compacted into
+    // bucket 0
+    write_postponed(R"([
+        ["Paul", 20, 1, 22.1],
+        ["Alice", 50, 0, 21.1],
+        ["Alice", 50, 0, 31.1]
+    ])",
+                    {RecordBatch::RowKind::DELETE, RecordBatch::RowKind::UPDATE_BEFORE,
+                     RecordBatch::RowKind::UPDATE_AFTER});
+    write_postponed(R"([
+        ["Bob", 10, 0, 1.5]
+    ])",
+                    {RecordBatch::RowKind::UPDATE_BEFORE});
+    ASSERT_OK_AND_ASSIGN(compact_messages, compact("3"));
+    check_commit_messages(compact_messages, /*expected_postponed_files=*/2);
+    ASSERT_OK(helper->Commit(compact_messages, commit_identifier++));
+    ASSERT_OK_AND_ASSIGN(data_splits,
+                         helper->NewScan(StartupMode::LatestFull(), /*snapshot_id=*/std::nullopt,
+                                         /*is_streaming=*/false));
+    ASSERT_EQ(data_splits.size(), 1);
+    ASSERT_OK_AND_ASSIGN(success, helper->ReadAndCheckResult(data_type, data_splits, R"([
+        [0, "Alice", 50, 0, 31.1]
+    ])"));
+    ASSERT_TRUE(success);
+
+    // nothing left to compact
+    ASSERT_OK_AND_ASSIGN(compact_messages, compact("3"));
+    ASSERT_TRUE(compact_messages.empty());
+}
+
+TEST_P(WriteInteTest, TestPkTableBucketRescale) {
+    auto dir = UniqueTestDirectory::Create();
+    ASSERT_TRUE(dir);
+    arrow::FieldVector fields = {arrow::field("f0", arrow::utf8()),
+                                 arrow::field("f1", arrow::int32()),
+                                 arrow::field("f2", arrow::float64())};
+    auto schema = arrow::schema(fields);
+    std::vector<std::string> primary_keys = {"f0", "f1"};
+    std::vector<std::string> partition_keys = {"f1"};
+    auto file_format = GetParam();
+    std::map<std::string, std::string> options = {{Options::MANIFEST_FORMAT, "orc"},
+                                                  {Options::FILE_FORMAT, file_format},
+                                                  {Options::BUCKET, "2"},
+                                                  {Options::FILE_SYSTEM, "local"}};
+    ASSERT_OK_AND_ASSIGN(auto helper, TestHelper::Create(dir->Str(), schema, partition_keys,
+                                                         primary_keys, options,
+                                                         /*is_streaming_mode=*/true));
+    std::string table_path = PathUtil::JoinPath(dir->Str(), "foo.db/bar");
+    int64_t commit_identifier = 0;
+    ASSERT_OK_AND_ASSIGN(std::optional<std::shared_ptr<TableSchema>> table_schema,
+                         helper->LatestSchema());
+    ASSERT_TRUE(table_schema);
+    DataGenerator gen(table_schema.value(), pool_);
+    auto write_rows = [&](const std::vector<BinaryRow>& rows) {
+        ASSERT_OK_AND_ASSIGN(auto batches, gen.SplitArrayByPartitionAndBucket(rows));
+        ASSERT_OK(helper->WriteAndCommit(std::move(batches), commit_identifier++,
+                                         /*expected_commit_messages=*/std::nullopt));
+    };
+    auto rescale = [&](const std::map<std::string, std::string>& partition,
+                       int32_t bucket_num) -> Result<std::vector<std::shared_ptr<CommitMessage>>> {
+        WriteContextBuilder context_builder(table_path, "commit_user");
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<WriteContext> write_context,
+                               context_builder.SetOptions(options).Finish());
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<BucketRescaler> rescaler,
+                               BucketRescaler::Create(std::move(write_context)));
+        return rescaler->Rescale(partition, bucket_num);
+    };
+    auto rescale_and_overwrite = [&](int32_t bucket_num) {
+        std::map<std::string, std::string> partition = {{"f1", "10"}};
+        ASSERT_OK_AND_ASSIGN(std::vector<std::shared_ptr<CommitMessage>> messages,
+                             rescale(partition, bucket_num));
+        ASSERT_FALSE(messages.empty());
+        size_t deleted_files = 0;
+        for (const auto& message : messages) {
+            auto message_impl = std::dynamic_pointer_cast<CommitMessageImpl>(message);
+            ASSERT_TRUE(message_impl);
+            const DataIncrement& increment = message_impl->GetNewFilesIncrement();
+            if (!increment.DeletedFiles().empty()) {
+                // the files of an old bucket which are read
+                ASSERT_TRUE(increment.NewFiles().empty());
+                deleted_files += increment.DeletedFiles().size();
+                continue;
+            }
+            ASSERT_GE(message_impl->Bucket(), 0);
+            ASSERT_LT(message_impl->Bucket(), bucket_num);
+            ASSERT_EQ(bucket_num, message_impl->TotalBuckets().value());
+        }
+        ASSERT_GT(deleted_files, 0U);
+        ASSERT_OK(helper->Overwrite({partition}, messages, commit_identifier++));
+        // the partition is already rescaled
+        ASSERT_OK_AND_ASSIGN(messages, rescale(partition, bucket_num));
+        ASSERT_TRUE(messages.empty());
+    };
+    auto check_result = [&](int32_t expected_bucket_num) {
+        ASSERT_OK_AND_ASSIGN(
+            std::vector<std::shared_ptr<Split>> data_splits,
+            helper->NewScan(StartupMode::LatestFull(), /*snapshot_id=*/std::nullopt,
+                            /*is_streaming=*/false));
+        auto data_type = arrow::struct_(
+            {arrow::field("_VALUE_KIND", arrow::int8()), fields[0], fields[1], fields[2]});
+        size_t rescaled_splits = 0;
+        for (const auto& split : data_splits) {
+            auto split_impl = dynamic_cast<DataSplitImpl*>(split.get());
+            ASSERT_TRUE(split_impl);
+            ASSERT_OK_AND_ASSIGN(std::string partition_str,
+                                 helper->PartitionStr(split_impl->Partition()));
+            if (partition_str == "f1=20/") {
+                // other partitions are not rescaled
+                ASSERT_EQ(2, split_impl->TotalBuckets().value());
+                ASSERT_OK_AND_ASSIGN(bool success,
+                                     helper->ReadAndCheckResult(data_type, {split}, R"([
+        [0, "Frank", 20, 6.1]
+    ])"));
+                ASSERT_TRUE(success);
+                continue;
+            }
+            ASSERT_EQ("f1=10/", partition_str);
+            ASSERT_EQ(expected_bucket_num, split_impl->TotalBuckets().value());
+            rescaled_splits++;
+            if (expected_bucket_num == 1) {
+                ASSERT_OK_AND_ASSIGN(bool success,
+                                     helper->ReadAndCheckResult(data_type, {split}, R"([
+        [0, "Alice", 10, 1.2],
+        [0, "Cathy", 10, 3.1],
+        [0, "David", 10, 4.1],
+        [0, "Evan", 10, 5.1]
+    ])"));
+                ASSERT_TRUE(success);
+            }
+        }
+        ASSERT_GE(static_cast<size_t>(expected_bucket_num), rescaled_splits);
+        ASSERT_GT(rescaled_splits, 0);
+    };
+
+    std::vector<BinaryRow> rows;
+    rows.push_back(BinaryRowGenerator::GenerateRow({"Alice", 10, 1.1}, pool_.get()));
+    rows.push_back(BinaryRowGenerator::GenerateRow({"Bob", 10, 2.1}, pool_.get()));
+    rows.push_back(BinaryRowGenerator::GenerateRow({"Cathy", 10, 3.1}, pool_.get()));
+    rows.push_back(BinaryRowGenerator::GenerateRow({"David", 10, 4.1}, pool_.get()));
+    rows.push_back(BinaryRowGenerator::GenerateRow({"Evan", 10, 5.1}, pool_.get()));
+    rows.push_back(BinaryRowGenerator::GenerateRow({"Frank", 20, 6.1}, pool_.get()));
+    write_rows(rows);
+    rows.clear();
+    rows.push_back(BinaryRowGenerator::GenerateRow({"Alice", 10, 1.2}, pool_.get()));
+    rows.push_back(
+        BinaryRowGenerator::GenerateRow(RowKind::Delete(), {"Bob", 10, 2.1}, pool_.get()));
+    write_rows(rows);
+
+    ASSERT_NOK_WITH_MSG(rescale(/*partition=*/{}, /*bucket_num=*/1),
+                        "partition to rescale must specify all partition keys [f1]");
+    ASSERT_NOK_WITH_MSG(rescale({{"f1", "10"}}, /*bucket_num=*/0),
+                        "bucket number to rescale must be greater than 0, but is 0");
+    // a partition without data has nothing to rescale
+    ASSERT_OK_AND_ASSIGN(std::vector<std::shared_ptr<CommitMessage>> messages,
+                         rescale({{"f1", "30"}}, /*bucket_num=*/1));
+    ASSERT_TRUE(messages.empty());
+
+    rescale_and_overwrite(/*bucket_num=*/1);
+    check_result(/*expected_bucket_num=*/1);
+    rescale_and_overwrite(/*bucket_num=*/3);
+    check_result(/*expected_bucket_num=*/3);
+    rescale_and_overwrite(/*bucket_num=*/1);
+    check_result(/*expected_bucket_num=*/1);
+
+    // a new write takes the bucket number of the rescaled partition from its files rather than
+    // from the options
+    auto write_to_rescaled_partition = [&](const std::string& data, int32_t bucket) -> Status {
+        WriteContextBuilder context_builder(table_path, "commit_user");
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<WriteContext> write_context,
+                               context_builder.SetOptions(options).Finish());
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<FileStoreWrite> write,
+                               FileStoreWrite::Create(std::move(write_context)));
+        PAIMON_ASSIGN_OR_RAISE(std::unique_ptr<RecordBatch> batch,
+                               TestHelper::MakeRecordBatch(arrow::struct_(fields), data,
+                                                           {{"f1", "10"}}, bucket, {}));
+        PAIMON_RETURN_NOT_OK(write->Write(std::move(batch)));
+        PAIMON_ASSIGN_OR_RAISE(std::vector<std::shared_ptr<CommitMessage>> write_messages,
+                               write->PrepareCommit(/*wait_compaction=*/false, commit_identifier));
+        PAIMON_RETURN_NOT_OK(write->Close());
+        return helper->Commit(write_messages, commit_identifier++);
+    };
+    ASSERT_NOK_WITH_MSG(write_to_rescaled_partition(R"([["Gary", 10, 7.1]])", /*bucket=*/1),
+                        "fixed bucketed mode must specify a bucket which in [0, 1) in RecordBatch");
+    // the partition is changed between the rescale and the overwrite, so the overwrite fails
+    // instead of dropping the change
+    ASSERT_OK_AND_ASSIGN(messages, rescale({{"f1", "10"}}, /*bucket_num=*/2));
+    ASSERT_FALSE(messages.empty());
+    ASSERT_OK(write_to_rescaled_partition(R"([["Alice", 10, 1.2]])", /*bucket=*/0));
+    ASSERT_NOK_WITH_MSG(helper->Overwrite({{{"f1", "10"}}}, messages, commit_identifier++),
+                        "Partitions to overwrite have been changed since the files to overwrite "
+                        "were read");
+    check_result(/*expected_bucket_num=*/1);
+    rescale_and_overwrite(/*bucket_num=*/2);
+    check_result(/*expected_bucket_num=*/2);
+}
+
 TEST_F(WriteInteTest, TestBranchWrite) {
     arrow::FieldVector fields = {arrow::field("dt", arrow::utf8()),
                                  arrow::field("name", arrow::utf8()),